@@ -22,6 +22,7 @@
 #include "miner.h"
 #include "ADL_SDK/adl_sdk.h"
 #include "compat.h"
+#include "sensors.h"
 
 #if defined (__unix__)
 # include <dlfcn.h>
@@ -1023,6 +1024,7 @@ int set_engineclock(int gpu, int iEngineClock)
   ga->managed = true;
 out:
   unlock_adl();
+  cgtime(&ga->tv_lastengine);
 
   cgpu = &gpus[gpu];
   if (cgpu->gpu_memdiff)
@@ -1308,6 +1310,7 @@ void gpu_autotune(int gpu, enum dev_enable *denable)
 {
   int temp, fanpercent, engine, newengine, twintemp = 0;
   bool fan_optimal = true, fan_window = true;
+  struct gpu_sensors sensors, twin;
   struct cgpu_info *cgpu;
   struct gpu_adl *ga;
   unsigned int i;
@@ -1315,15 +1318,16 @@ void gpu_autotune(int gpu, enum dev_enable *denable)
   cgpu = &gpus[gpu];
   ga = &cgpu->adl;
 
-  lock_adl();
-  ADL_Overdrive5_CurrentActivity_Get(ga->iAdapterIndex, &ga->lpActivity);
-  temp = __gpu_temp(ga);
-  if (ga->twin)
-    twintemp = __gpu_temp(ga->twin);
-  fanpercent = __gpu_fanpercent(ga);
-  unlock_adl();
+  /* Tune on the last sample rather than waiting on the driver here, once
+   * it was taken after the last engine clock change */
+  if (!gpu_sensors_get(gpu, &sensors) || !time_more(&sensors.tv, &ga->tv_lastengine))
+    return;
+  temp = sensors.temp;
+  if (ga->twin && gpu_sensors_get(ga->twin->gpu, &twin))
+    twintemp = twin.temp;
+  fanpercent = sensors.fanpercent;
 
-  newengine = engine = gpu_engineclock(gpu) * 100;
+  newengine = engine = sensors.engineclock * 100;
 
   if (temp && fanpercent >= 0 && ga->autofan) {
     if (!ga->twin)
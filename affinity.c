@@ -0,0 +1,450 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sched.h>
+#include <dirent.h>
+#endif
+
+#include "compat.h"
+#include "miner.h"
+#include "affinity.h"
+#include "util.h"
+
+#define AFFINITY_MAX_CPUS  1024
+#define AFFINITY_MAX_NODES 64
+
+struct cpumask {
+  uint64_t bits[AFFINITY_MAX_CPUS / 64];
+};
+
+enum affinity_policy {
+  POLICY_ANY,  /* Leave the thread to the scheduler */
+  POLICY_AUTO, /* CPUs of the NUMA node the device's PCIe slot hangs off */
+  POLICY_NODE, /* CPUs of one NUMA node */
+  POLICY_CPUS  /* An explicit CPU list */
+};
+
+struct affinity_rule {
+  enum affinity_policy policy;
+  int node;
+  struct cpumask cpus;
+  char spec[64];
+};
+
+static const char *affinity_class_names[AFFINITY_CLASSES] = {
+  "miner",
+  "verify",
+  "stratum",
+  "api",
+};
+
+static struct affinity_rule rules[AFFINITY_CLASSES];
+
+/* Resolved lazily: node CPU lists from sysfs, and each device's NUMA node
+ * stored as node + 2 so 0 means not looked up yet and 1 means unknown */
+static pthread_mutex_t affinity_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct cpumask node_cpus[AFFINITY_MAX_NODES];
+static bool node_read[AFFINITY_MAX_NODES];
+static int device_nodes[MAX_DEVICES];
+
+static void cpumask_set(struct cpumask *mask, int cpu)
+{
+  mask->bits[cpu / 64] |= (uint64_t)1 << (cpu % 64);
+}
+
+static bool cpumask_isset(const struct cpumask *mask, int cpu)
+{
+  return !!(mask->bits[cpu / 64] & ((uint64_t)1 << (cpu % 64)));
+}
+
+static bool cpumask_empty(const struct cpumask *mask)
+{
+  int i;
+
+  for (i = 0; i < AFFINITY_MAX_CPUS / 64; i++) {
+    if (mask->bits[i])
+      return false;
+  }
+  return true;
+}
+
+/* Adds a Linux style CPU list, eg. "0-7,16-23", to mask */
+static bool parse_cpulist(const char *list, struct cpumask *mask)
+{
+  char *buf, *nextptr, *saveptr = NULL;
+  int val1, val2, i;
+  bool ret = true;
+
+  buf = strdup(list);
+  if (unlikely(!buf))
+    return false;
+
+  for (nextptr = strtok_r(buf, ",\n", &saveptr); nextptr; nextptr = strtok_r(NULL, ",\n", &saveptr)) {
+    if (nextptr[strspn(nextptr, "0123456789-")]) {
+      ret = false;
+      break;
+    }
+    get_intrange(nextptr, &val1, &val2);
+    if (val1 < 0 || val2 < val1 || val2 >= AFFINITY_MAX_CPUS) {
+      ret = false;
+      break;
+    }
+    for (i = val1; i <= val2; i++)
+      cpumask_set(mask, i);
+  }
+  free(buf);
+
+  return ret;
+}
+
+/* Parse --affinity class=policy[,class=policy...] where policy is auto, any,
+ * node<N> or a CPU list. A CPU list may itself contain commas, so items
+ * without a class carry on the list of the class before them */
+char *set_affinity(const char *arg)
+{
+  struct affinity_rule new_rules[AFFINITY_CLASSES];
+  char *buf, *nextptr, *saveptr = NULL;
+  struct affinity_rule *rule = NULL;
+
+  if (arg == NULL || *arg == '\0')
+    return "Invalid parameters for set affinity";
+#if !defined(__linux__) && !defined(WIN32)
+  return "Thread affinity is not supported on this platform";
+#endif
+
+  memset(new_rules, 0, sizeof(new_rules));
+  buf = strdup(arg);
+  if (unlikely(!buf))
+    return "Failed to allocate affinity buffer";
+
+  for (nextptr = strtok_r(buf, ",", &saveptr); nextptr; nextptr = strtok_r(NULL, ",", &saveptr)) {
+    char *value = strchr(nextptr, '=');
+    int i;
+
+    if (!value) {
+      if (!rule || rule->policy != POLICY_CPUS || !parse_cpulist(nextptr, &rule->cpus))
+        goto err;
+      strncat(rule->spec, ",", sizeof(rule->spec) - strlen(rule->spec) - 1);
+      strncat(rule->spec, nextptr, sizeof(rule->spec) - strlen(rule->spec) - 1);
+      continue;
+    }
+
+    *value++ = '\0';
+    for (i = 0; i < AFFINITY_CLASSES; i++) {
+      if (!strcasecmp(nextptr, affinity_class_names[i]))
+        break;
+    }
+    if (i == AFFINITY_CLASSES)
+      goto err;
+    rule = &new_rules[i];
+    memset(rule, 0, sizeof(*rule));
+    snprintf(rule->spec, sizeof(rule->spec), "%s", value);
+
+    if (!strcasecmp(value, "any"))
+      rule->policy = POLICY_ANY;
+    else if (!strcasecmp(value, "auto"))
+      rule->policy = POLICY_AUTO;
+    else if (!strncasecmp(value, "node", 4)) {
+      rule->policy = POLICY_NODE;
+      rule->node = atoi(value + 4);
+      if (rule->node < 0 || rule->node >= AFFINITY_MAX_NODES)
+        goto err;
+    } else {
+      rule->policy = POLICY_CPUS;
+      if (!parse_cpulist(value, &rule->cpus) || cpumask_empty(&rule->cpus))
+        goto err;
+    }
+  }
+  free(buf);
+
+  memcpy(rules, new_rules, sizeof(rules));
+  return NULL;
+err:
+  free(buf);
+  return "Invalid value passed to set affinity";
+}
+
+#ifdef __linux__
+static bool read_sysfs(const char *path, char *buf, size_t len)
+{
+  FILE *f = fopen(path, "r");
+  bool ret;
+
+  if (!f)
+    return false;
+  ret = fgets(buf, len, f) != NULL;
+  fclose(f);
+  return ret;
+}
+
+/* The device's PCIe slot, "bus:device.function", from OpenCL or ADL */
+static bool device_slot(struct cgpu_info *cgpu, char *slot, size_t len)
+{
+  if (cgpu->pci_slot[0])
+    snprintf(slot, len, "%s", cgpu->pci_slot);
+#ifdef HAVE_ADL
+  else if (cgpu->has_adl)
+    snprintf(slot, len, "%02x:00.0", cgpu->adl.iBusNumber);
+#endif
+  else
+    return false;
+  return true;
+}
+
+/* The NUMA node of a PCIe slot, searching all PCI domains */
+static int slot_node(const char *slot)
+{
+  char path[PATH_MAX], buf[32];
+  struct dirent *ent;
+  size_t slen = strlen(slot);
+  int node = -1;
+  DIR *dir;
+
+  dir = opendir("/sys/bus/pci/devices");
+  if (!dir)
+    return -1;
+  while ((ent = readdir(dir))) {
+    size_t nlen = strlen(ent->d_name);
+
+    if (nlen <= slen || ent->d_name[nlen - slen - 1] != ':' ||
+        strcasecmp(ent->d_name + nlen - slen, slot))
+      continue;
+    snprintf(path, sizeof(path), "/sys/bus/pci/devices/%s/numa_node", ent->d_name);
+    if (read_sysfs(path, buf, sizeof(buf)))
+      node = atoi(buf);
+    break;
+  }
+  closedir(dir);
+
+  return node < AFFINITY_MAX_NODES ? node : -1;
+}
+#endif
+
+/* The NUMA node local to the device, -1 if unknown */
+int affinity_numa_node(struct cgpu_info *cgpu)
+{
+  int id, node;
+
+  if (!cgpu)
+    return -1;
+  id = cgpu->sgminer_id;
+  if (id < 0 || id >= MAX_DEVICES)
+    return -1;
+
+  mutex_lock(&affinity_lock);
+  node = device_nodes[id];
+  mutex_unlock(&affinity_lock);
+  if (node)
+    return node - 2;
+
+  node = -1;
+#ifdef __linux__
+  {
+    char slot[16];
+
+    if (device_slot(cgpu, slot, sizeof(slot)))
+      node = slot_node(slot);
+  }
+#endif
+
+  mutex_lock(&affinity_lock);
+  device_nodes[id] = node + 2;
+  mutex_unlock(&affinity_lock);
+
+  return node;
+}
+
+static bool get_node_cpus(int node, struct cpumask *mask)
+{
+  if (node < 0 || node >= AFFINITY_MAX_NODES)
+    return false;
+
+  mutex_lock(&affinity_lock);
+  if (!node_read[node]) {
+#ifdef __linux__
+    char path[PATH_MAX], buf[1024];
+
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+    if (read_sysfs(path, buf, sizeof(buf)))
+      parse_cpulist(buf, &node_cpus[node]);
+#endif
+    node_read[node] = true;
+  }
+  memcpy(mask, &node_cpus[node], sizeof(*mask));
+  mutex_unlock(&affinity_lock);
+
+  return !cpumask_empty(mask);
+}
+
+int affinity_online_cpus(void)
+{
+#ifdef WIN32
+  SYSTEM_INFO sysinfo;
+
+  GetSystemInfo(&sysinfo);
+  return sysinfo.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+  return n > 0 ? (int)n : 1;
+#else
+  return 1;
+#endif
+}
+
+/* Mining threads of CPU devices get a CPU each rather than sharing one set */
+static bool cpu_miner(enum affinity_class cls, struct cgpu_info *cgpu)
+{
+  return cls == AFFINITY_MINER && cgpu && cgpu->drv->drv_id == DRIVER_cpu;
+}
+
+/* Narrows mask to the CPU of CPU device cgpu: its device number wraps
+ * around the CPUs of the rule, or every online CPU when the rule has none */
+static bool resolve_cpu_miner(struct cgpu_info *cgpu, struct cpumask *mask, bool found)
+{
+  int i, n = 0, nth;
+
+  if (!found) {
+    memset(mask, 0, sizeof(*mask));
+    for (i = 0; i < affinity_online_cpus() && i < AFFINITY_MAX_CPUS; i++)
+      cpumask_set(mask, i);
+  }
+
+  for (i = 0; i < AFFINITY_MAX_CPUS; i++)
+    n += cpumask_isset(mask, i);
+  if (!n)
+    return false;
+
+  nth = cgpu->device_id % n;
+  for (i = 0; i < AFFINITY_MAX_CPUS; i++) {
+    if (cpumask_isset(mask, i) && !nth--)
+      break;
+  }
+  memset(mask, 0, sizeof(*mask));
+  cpumask_set(mask, i);
+  return true;
+}
+
+/* Works out the CPUs for a thread of class cls working for cgpu. Returns
+ * false if the thread should be left unpinned */
+static bool resolve(enum affinity_class cls, struct cgpu_info *cgpu, struct cpumask *mask, int *node)
+{
+  struct affinity_rule *rule = &rules[cls];
+  bool found;
+
+  *node = -1;
+  switch (rule->policy) {
+    case POLICY_CPUS:
+      memcpy(mask, &rule->cpus, sizeof(*mask));
+      found = true;
+      break;
+    case POLICY_NODE:
+      *node = rule->node;
+      found = get_node_cpus(rule->node, mask);
+      break;
+    case POLICY_AUTO:
+      *node = affinity_numa_node(cgpu);
+      found = get_node_cpus(*node, mask);
+      break;
+    case POLICY_ANY:
+    default:
+      found = false;
+      break;
+  }
+
+  if (cpu_miner(cls, cgpu))
+    return resolve_cpu_miner(cgpu, mask, found);
+  return found;
+}
+
+void affinity_apply(enum affinity_class cls, struct cgpu_info *cgpu)
+{
+  struct cpumask mask;
+  int node, i;
+
+  if (rules[cls].policy == POLICY_ANY && !cpu_miner(cls, cgpu))
+    return;
+  if (!resolve(cls, cgpu, &mask, &node)) {
+    applog(LOG_DEBUG, "No CPUs found for %s affinity %s, leaving thread unpinned",
+           affinity_class_names[cls], rules[cls].spec);
+    return;
+  }
+
+#ifdef __linux__
+  {
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    for (i = 0; i < AFFINITY_MAX_CPUS && i < CPU_SETSIZE; i++) {
+      if (cpumask_isset(&mask, i))
+        CPU_SET(i, &set);
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+      applog(LOG_WARNING, "Failed to set %s thread affinity to %s",
+             affinity_class_names[cls], rules[cls].spec);
+  }
+#elif defined(WIN32)
+  {
+    DWORD_PTR bits = 0;
+
+    for (i = 0; i < (int)(sizeof(DWORD_PTR) * 8); i++) {
+      if (cpumask_isset(&mask, i))
+        bits |= (DWORD_PTR)1 << i;
+    }
+    if (!bits || !SetThreadAffinityMask(GetCurrentThread(), bits))
+      applog(LOG_WARNING, "Failed to set %s thread affinity to %s",
+             affinity_class_names[cls], rules[cls].spec);
+  }
+#else
+  (void)i;
+#endif
+}
+
+/* Describes where threads of class cls for cgpu are placed, for the API */
+void affinity_describe(enum affinity_class cls, struct cgpu_info *cgpu, char *buf, size_t len)
+{
+  struct cpumask mask;
+  int node, i, first = -1;
+  size_t used = 0;
+
+  if (!resolve(cls, cgpu, &mask, &node)) {
+    if (rules[cls].policy == POLICY_ANY)
+      snprintf(buf, len, "any");
+    else if (rules[cls].policy == POLICY_AUTO)
+      snprintf(buf, len, "any (no PCIe locality)");
+    else
+      snprintf(buf, len, "any (no CPUs on node%d)", node);
+    return;
+  }
+
+  buf[0] = '\0';
+  if (node >= 0)
+    used = snprintf(buf, len, "node%d:", node);
+  for (i = 0; i <= AFFINITY_MAX_CPUS && used < len; i++) {
+    bool set = i < AFFINITY_MAX_CPUS && cpumask_isset(&mask, i);
+
+    if (set && first < 0)
+      first = i;
+    else if (!set && first >= 0) {
+      used += snprintf(buf + used, len - used, "%s%d", used && buf[used - 1] != ':' ? "," : "", first);
+      if (i - 1 > first && used < len)
+        used += snprintf(buf + used, len - used, "-%d", i - 1);
+      first = -1;
+    }
+  }
+}
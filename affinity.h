@@ -0,0 +1,23 @@
+#ifndef AFFINITY_H
+#define AFFINITY_H
+
+#include "miner.h"
+
+/* Thread classes placed by --affinity */
+enum affinity_class {
+  AFFINITY_MINER,   /* Device mining threads */
+  AFFINITY_VERIFY,  /* postcalc_hash threads checking device results */
+  AFFINITY_STRATUM, /* Stratum send and receive threads */
+  AFFINITY_API,     /* API listener */
+  AFFINITY_CLASSES
+};
+
+extern char *set_affinity(const char *arg);
+
+/* cgpu is the device the thread works for, or NULL */
+extern void affinity_apply(enum affinity_class cls, struct cgpu_info *cgpu);
+extern void affinity_describe(enum affinity_class cls, struct cgpu_info *cgpu, char *buf, size_t len);
+extern int affinity_numa_node(struct cgpu_info *cgpu);
+extern int affinity_online_cpus(void);
+
+#endif /* AFFINITY_H */
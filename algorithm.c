@@ -11,6 +11,7 @@
 #include "sph/sph_sha2.h"
 #include "ocl.h"
 #include "ocl/build_kernel.h"
+#include "ocl/kernel_variant.h"
 
 #include "algorithm/scrypt.h"
 #include "algorithm/animecoin.h"
@@ -25,10 +26,7 @@
 #include "algorithm/twecoin.h"
 #include "algorithm/marucoin.h"
 #include "algorithm/maxcoin.h"
-#include "algorithm/talkcoin.h"
-#include "algorithm/bitblock.h"
-#include "algorithm/x14.h"
-#include "algorithm/fresh.h"
+#include "algorithm/chain.h"
 
 #include "compat.h"
 
@@ -92,15 +90,31 @@ static void append_scrypt_compiler_options(struct _build_kernel_data *data, stru
   strcat(data->binary_filename, buf);
 }
 
+static void append_variant_compiler_options(struct _build_kernel_data *data, struct cgpu_info *cgpu, struct _algorithm_t *algorithm)
+{
+  append_kernel_variant_options(data, &cgpu->kernel_variant);
+}
+
 static void append_hamsi_compiler_options(struct _build_kernel_data *data, struct cgpu_info *cgpu, struct _algorithm_t *algorithm)
 {
   char buf[255];
-  sprintf(buf, " -D SPH_HAMSI_EXPAND_BIG=%d -D SPH_HAMSI_SHORT=%d ",
-          opt_hamsi_expand_big, ((opt_hamsi_short)?1:0));
+
+  append_variant_compiler_options(data, cgpu, algorithm);
+
+  /* A hamsi-expand variant replaces --hamsi-expand-big */
+  if (!(cgpu->kernel_variant.set & (1 << KERNEL_VARIANT_HAMSI_EXPAND))) {
+    sprintf(buf, " -D SPH_HAMSI_EXPAND_BIG=%d", opt_hamsi_expand_big);
+    strcat(data->compiler_options, buf);
+
+    sprintf(buf, "big%u", (unsigned int)opt_hamsi_expand_big);
+    strcat(data->binary_filename, buf);
+  }
+
+  sprintf(buf, " -D SPH_HAMSI_SHORT=%d ", ((opt_hamsi_short)?1:0));
   strcat(data->compiler_options, buf);
 
-  sprintf(buf, "big%u%s", (unsigned int)opt_hamsi_expand_big, ((opt_hamsi_short)?"hs":""));
-  strcat(data->binary_filename, buf);
+  if (opt_hamsi_short)
+    strcat(data->binary_filename, "hs");
 }
 
 static cl_int queue_scrypt_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
@@ -158,307 +172,40 @@ static cl_int queue_sph_kernel(struct __clState *clState, struct _dev_blk_ctx *b
   return status;
 }
 
-static cl_int queue_fresh_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
-{
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // echo - search10
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
+/* Counters ahead of the two branch index lists, see quarkcoin-mod.cl */
+#define QUARK_BRANCH_HEADER 8
 
-  return status;
-}
-
-static cl_int queue_darkcoin_mod_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
-{
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // jh - search4
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search5
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // luffa - search6
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // cubehash - search7
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shavite - search8
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // echo - search10
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
-
-  return status;
-}
-
-static cl_int queue_bitblock_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
+/* The branch lists hold an entry per thread, so the buffer is grown when
+ * the intensity goes up */
+static cl_int alloc_branch_buffer(struct __clState *clState, cl_uint threads)
 {
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // jh - search4
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search5
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // luffa - search6
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // cubehash - search7
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shavite - search8
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // echo - search10
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // hamsi - search11
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // fugue - search12
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // hamsi - search11
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // fugue - search12
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
-
-  return status;
-}
-
-static cl_int queue_bitblockold_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
-{
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // jh - search4
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search5
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // luffa - search6
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // cubehash - search7
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shavite - search8
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // combined echo, hamsi, fugue - shabal - whirlpool - search10
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
-
-  return status;
-}
-
-
-static cl_int queue_marucoin_mod_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
-{
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // jh - search4
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search5
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // luffa - search6
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // cubehash - search7
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shavite - search8
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // echo - search10
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // hamsi - search11
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // fugue - search12
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
-
-  return status;
-}
-
-static cl_int queue_marucoin_mod_old_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
-{
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // jh - search4
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search5
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // luffa - search6
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // cubehash - search7
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shavite - search8
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // combined echo, hamsi, fugue - search10
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
-
-  return status;
-}
-
-static cl_int queue_talkcoin_mod_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
-{
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // groestl - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // jh - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search4
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
+  size_t bufsize = (QUARK_BRANCH_HEADER + 2 * (size_t)threads) * sizeof(cl_uint);
+  cl_int status;
+
+  if (clState->branchbufsize >= bufsize)
+    return CL_SUCCESS;
+
+  if (clState->branchBuffer)
+    clReleaseMemObject(clState->branchBuffer);
+  clState->branchbufsize = 0;
+  clState->branchBuffer = clCreateBuffer(clState->context, CL_MEM_READ_WRITE, bufsize, NULL, &status);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: clCreateBuffer (branchBuffer)", status);
+    clState->branchBuffer = NULL;
+    return status;
+  }
+  clState->branchbufsize = bufsize;
 
-  return status;
+  return CL_SUCCESS;
 }
 
-static cl_int queue_x14_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
+/* Sets the arguments of every kernel of the chain the state was built for,
+ * in the order each stage binds them */
+static cl_int queue_chain_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, cl_uint threads)
 {
+  const algorithm_stage_t *stage;
   cl_kernel *kernel;
-  unsigned int num;
+  unsigned int num, i;
   cl_ulong le_target;
   cl_int status = 0;
 
@@ -466,88 +213,99 @@ static cl_int queue_x14_kernel(struct __clState *clState, struct _dev_blk_ctx *b
   flip80(clState->cldata, blk->work->data);
   status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
 
-  // blake - search
   kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // jh - search4
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search5
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // luffa - search6
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // cubehash - search7
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shavite - search8
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // echo - search10
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // hamsi - search11
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // fugue - search12
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shabal - search13
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
+  for (stage = clState->chain; stage->hashes; stage++) {
+    num = 0;
+    for (i = 0; i < ALGORITHM_STAGE_MAX_ARGS && stage->args[i] != CHAIN_ARG_END; i++) {
+      switch (stage->args[i]) {
+        case CHAIN_ARG_HEADER:
+          CL_SET_ARG(clState->CLbuffer0);
+          break;
+        case CHAIN_ARG_HASHES:
+          CL_SET_ARG(clState->padbuffer8);
+          break;
+        case CHAIN_ARG_BRANCHES:
+          status |= alloc_branch_buffer(clState, threads);
+          CL_SET_ARG(clState->branchBuffer);
+          break;
+        case CHAIN_ARG_OUTPUT:
+          CL_SET_ARG(clState->outputBuffer);
+          break;
+        case CHAIN_ARG_TARGET:
+          CL_SET_ARG(le_target);
+          break;
+        default:
+          break;
+      }
+    }
+    kernel = &clState->extra_kernels[stage - clState->chain];
+  }
 
   return status;
 }
 
-static cl_int queue_x14_old_kernel(struct __clState *clState, struct _dev_blk_ctx *blk, __maybe_unused cl_uint threads)
-{
-  cl_kernel *kernel;
-  unsigned int num;
-  cl_ulong le_target;
-  cl_int status = 0;
-
-  le_target = *(cl_ulong *)(blk->work->device_target + 24);
-  flip80(clState->cldata, blk->work->data);
-  status = clEnqueueWriteBuffer(clState->commandQueue, clState->CLbuffer0, true, 0, 80, clState->cldata, 0, NULL,NULL);
-
-  // blake - search
-  kernel = &clState->kernel;
-  num = 0;
-  CL_SET_ARG(clState->CLbuffer0);
-  CL_SET_ARG(clState->padbuffer8);
-  // bmw - search1
-  kernel = clState->extra_kernels;
-  CL_SET_ARG_0(clState->padbuffer8);
-  // groestl - search2
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // skein - search3
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // jh - search4
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // keccak - search5
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // luffa - search6
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // cubehash - search7
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // shavite - search8
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // simd - search9
-  CL_NEXTKERNEL_SET_ARG_0(clState->padbuffer8);
-  // combined echo, hamsi, fugue - shabal - search10
-  num = 0;
-  CL_NEXTKERNEL_SET_ARG(clState->padbuffer8);
-  CL_SET_ARG(clState->outputBuffer);
-  CL_SET_ARG(le_target);
+/* Chains of the split kernels, one entry per kernel starting with "search".
+ * A stage running several hash functions in one kernel lists them '-'
+ * separated. Most stages read and write the hashes in padbuffer8, the
+ * first one hashes the header and the last one checks the target */
+#define STAGE_FIRST(h) { h, CHAIN_ALWAYS, { CHAIN_ARG_HEADER, CHAIN_ARG_HASHES } }
+#define STAGE(h)       { h, CHAIN_ALWAYS, { CHAIN_ARG_HASHES } }
+#define STAGE_LAST(h)  { h, CHAIN_ALWAYS, { CHAIN_ARG_HASHES, CHAIN_ARG_OUTPUT, CHAIN_ARG_TARGET } }
+#define STAGE_END      { NULL, CHAIN_ALWAYS, { CHAIN_ARG_END } }
+
+#define X11_STAGES \
+  STAGE_FIRST("blake"), STAGE("bmw"), STAGE("groestl"), STAGE("skein"), \
+  STAGE("jh"), STAGE("keccak"), STAGE("luffa"), STAGE("cubehash"), \
+  STAGE("shavite"), STAGE("simd")
+
+static const algorithm_stage_t darkcoin_mod_chain[] = {
+  X11_STAGES, STAGE_LAST("echo"), STAGE_END
+};
+static const algorithm_stage_t marucoin_mod_chain[] = {
+  X11_STAGES, STAGE("echo"), STAGE("hamsi"), STAGE_LAST("fugue"), STAGE_END
+};
+static const algorithm_stage_t marucoin_mod_old_chain[] = {
+  X11_STAGES, STAGE_LAST("echo-hamsi-fugue"), STAGE_END
+};
+static const algorithm_stage_t x14_chain[] = {
+  X11_STAGES, STAGE("echo"), STAGE("hamsi"), STAGE("fugue"), STAGE_LAST("shabal"), STAGE_END
+};
+static const algorithm_stage_t x14_old_chain[] = {
+  X11_STAGES, STAGE_LAST("echo-hamsi-fugue-shabal"), STAGE_END
+};
+static const algorithm_stage_t bitblock_chain[] = {
+  X11_STAGES, STAGE("echo"), STAGE("hamsi"), STAGE("fugue"), STAGE("shabal"), STAGE_LAST("whirlpool"), STAGE_END
+};
+static const algorithm_stage_t bitblockold_chain[] = {
+  X11_STAGES, STAGE_LAST("echo-hamsi-fugue-shabal-whirlpool"), STAGE_END
+};
+static const algorithm_stage_t talkcoin_mod_chain[] = {
+  STAGE_FIRST("blake"), STAGE("groestl"), STAGE("jh"), STAGE("keccak"), STAGE_LAST("skein"), STAGE_END
+};
+static const algorithm_stage_t fresh_chain[] = {
+  STAGE_FIRST("shavite"), STAGE("simd"), STAGE("shavite"), STAGE("simd"), STAGE_LAST("echo"), STAGE_END
+};
 
-  return status;
-}
+/* The quark chains pick a hash function by bit 3 of the previous hash three
+ * times. Every kernel also binds the branch index lists, see
+ * quarkcoin-mod.cl */
+#define QSTAGE_FIRST(h) { h, CHAIN_ALWAYS, { CHAIN_ARG_HEADER, CHAIN_ARG_HASHES, CHAIN_ARG_BRANCHES } }
+#define QSTAGE(h, c)    { h, c, { CHAIN_ARG_HASHES, CHAIN_ARG_BRANCHES } }
+#define QSTAGE_LAST(h, c) { h, c, { CHAIN_ARG_HASHES, CHAIN_ARG_BRANCHES, CHAIN_ARG_OUTPUT, CHAIN_ARG_TARGET } }
+
+#define QUARK_STAGES \
+  QSTAGE("groestl", CHAIN_TAKEN), QSTAGE("skein", CHAIN_NOT_TAKEN), \
+  QSTAGE("groestl", CHAIN_ALWAYS), QSTAGE("jh", CHAIN_PICK), \
+  QSTAGE("blake", CHAIN_TAKEN), QSTAGE("bmw", CHAIN_NOT_TAKEN), \
+  QSTAGE("keccak", CHAIN_ALWAYS), QSTAGE("skein", CHAIN_PICK), \
+  QSTAGE_LAST("keccak", CHAIN_TAKEN), QSTAGE_LAST("jh", CHAIN_NOT_TAKEN)
+
+static const algorithm_stage_t quarkcoin_mod_chain[] = {
+  QSTAGE_FIRST("blake"), QSTAGE("bmw", CHAIN_PICK), QUARK_STAGES, STAGE_END
+};
+static const algorithm_stage_t animecoin_mod_chain[] = {
+  QSTAGE_FIRST("bmw"), QSTAGE("blake", CHAIN_PICK), QUARK_STAGES, STAGE_END
+};
 
 typedef struct _algorithm_settings_t {
   const char *name; /* Human-readable identifier */
@@ -567,6 +325,7 @@ typedef struct _algorithm_settings_t {
   cl_int   (*queue_kernel)(struct __clState *, struct _dev_blk_ctx *, cl_uint);
   void     (*gen_hash)(const unsigned char *, unsigned int, unsigned char *);
   void     (*set_compile_options)(build_kernel_data *, struct cgpu_info *, algorithm_t *);
+  const algorithm_stage_t *chain;
 } algorithm_settings_t;
 
 static algorithm_settings_t algos[] = {
@@ -583,16 +342,18 @@ static algorithm_settings_t algos[] = {
 
   // kernels starting from this will have difficulty calculated by using quarkcoin algorithm
 #define A_QUARK(a, b) \
-    { a, ALGO_QUARK, 256, 256, 256, 0, 0, 0xFF, 0xFFFFFFULL, 0x0000ffffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, b, queue_sph_kernel, gen_hash, NULL}
+    { a, ALGO_QUARK, 256, 256, 256, 0, 0, 0xFF, 0xFFFFFFULL, 0x0000ffffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, b, queue_sph_kernel, gen_hash, append_variant_compiler_options}
   A_QUARK( "quarkcoin", quarkcoin_regenhash),
   A_QUARK( "qubitcoin", qubitcoin_regenhash),
   A_QUARK( "animecoin", animecoin_regenhash),
   A_QUARK( "sifcoin",   sifcoin_regenhash),
 #undef A_QUARK
+  { "quarkcoin-mod", ALGO_QUARK, 256, 256, 256, 0, 0, 0xFF, 0xFFFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_variant_compiler_options, quarkcoin_mod_chain},
+  { "animecoin-mod", ALGO_QUARK, 256, 256, 256, 0, 0, 0xFF, 0xFFFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_variant_compiler_options, animecoin_mod_chain},
 
   // kernels starting from this will have difficulty calculated by using bitcoin algorithm
 #define A_DARK(a, b) \
-    { a, ALGO_X11, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, b, queue_sph_kernel, gen_hash, NULL}
+    { a, ALGO_X11, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, b, queue_sph_kernel, gen_hash, append_variant_compiler_options}
   A_DARK( "darkcoin",           darkcoin_regenhash),
   A_DARK( "inkcoin",            inkcoin_regenhash),
   A_DARK( "myriadcoin-groestl", myriadcoin_groestl_regenhash),
@@ -600,20 +361,20 @@ static algorithm_settings_t algos[] = {
 
   { "twecoin", ALGO_TWE, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, twecoin_regenhash, queue_sph_kernel, sha256, NULL},
   { "maxcoin", ALGO_KECCAK, 1, 256, 1, 4, 15, 0x0F, 0xFFFFULL, 0x000000ffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, maxcoin_regenhash, queue_maxcoin_kernel, sha256, NULL},
-  { "darkcoin-mod", ALGO_X11, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 10, 8 * 16 * 4194304, 0, darkcoin_regenhash, queue_darkcoin_mod_kernel, gen_hash, NULL},
+  { "darkcoin-mod", ALGO_X11, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_variant_compiler_options, darkcoin_mod_chain},
 
   { "marucoin", ALGO_X13, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, marucoin_regenhash, queue_sph_kernel, gen_hash, append_hamsi_compiler_options},
-  { "marucoin-mod", ALGO_X13, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 12, 8 * 16 * 4194304, 0, marucoin_regenhash, queue_marucoin_mod_kernel, gen_hash, append_hamsi_compiler_options},
-  { "marucoin-modold", ALGO_X13, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 10, 8 * 16 * 4194304, 0, marucoin_regenhash, queue_marucoin_mod_old_kernel, gen_hash, append_hamsi_compiler_options},
+  { "marucoin-mod", ALGO_X13, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_hamsi_compiler_options, marucoin_mod_chain},
+  { "marucoin-modold", ALGO_X13, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_hamsi_compiler_options, marucoin_mod_old_chain},
 
-  { "x14", ALGO_X14, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 13, 8 * 16 * 4194304, 0, x14_regenhash, queue_x14_kernel, gen_hash, append_hamsi_compiler_options},
-  { "x14old", ALGO_X14, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 10, 8 * 16 * 4194304, 0, x14_regenhash, queue_x14_old_kernel, gen_hash, append_hamsi_compiler_options},
+  { "x14", ALGO_X14, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_hamsi_compiler_options, x14_chain},
+  { "x14old", ALGO_X14, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_hamsi_compiler_options, x14_old_chain},
 
-  { "bitblock", ALGO_X15, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 14, 8 * 16 * 4194304, 0, bitblock_regenhash, queue_bitblock_kernel, gen_hash, append_hamsi_compiler_options},
-  { "bitblockold", ALGO_X15, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 10, 8 * 16 * 4194304, 0, bitblock_regenhash, queue_bitblockold_kernel, gen_hash, append_hamsi_compiler_options},
+  { "bitblock", ALGO_X15, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_hamsi_compiler_options, bitblock_chain},
+  { "bitblockold", ALGO_X15, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_hamsi_compiler_options, bitblockold_chain},
 
-  { "talkcoin-mod", ALGO_NIST, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 4,  8 * 16 * 4194304, 0, talkcoin_regenhash, queue_talkcoin_mod_kernel, gen_hash, NULL},
-  { "fresh", ALGO_FRESH, 1, 256, 256, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 4,  4 * 16 * 4194304, 0, fresh_regenhash, queue_fresh_kernel, gen_hash, NULL},
+  { "talkcoin-mod", ALGO_NIST, 1, 1, 1, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 8 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_variant_compiler_options, talkcoin_mod_chain},
+  { "fresh", ALGO_FRESH, 1, 256, 256, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 4 * 16 * 4194304, 0, chain_regenhash, queue_chain_kernel, gen_hash, append_variant_compiler_options, fresh_chain},
   // kernels starting from this will have difficulty calculated by using fuguecoin algorithm
 #define A_FUGUE(a, b) \
     { a, ALGO_FUGUE, 1, 256, 256, 0, 0, 0xFF, 0xFFFFULL, 0x0000ffffUL, 0, 0, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, b, queue_sph_kernel, sha256, NULL}
@@ -646,6 +407,14 @@ void copy_algorithm_settings(algorithm_t* dest, const char* algo)
       dest->diff_numerator = src->diff_numerator;
       dest->diff1targ = src->diff1targ;
       dest->n_extra_kernels = src->n_extra_kernels;
+      dest->chain = src->chain;
+      if (src->chain) {
+        const algorithm_stage_t *stage;
+
+        for (stage = src->chain; stage->hashes; stage++)
+          ;
+        dest->n_extra_kernels = stage - src->chain - 1;
+      }
       dest->rw_buffer_size = src->rw_buffer_size;
       dest->cq_properties = src->cq_properties;
       dest->regenhash = src->regenhash;
@@ -743,8 +512,43 @@ void set_algorithm_nfactor(algorithm_t* algo, const uint8_t nfactor)
   }
 }
 
+void set_algorithm_nfactor_start(algorithm_t* algo, const uint32_t chain_start)
+{
+  algo->nfactor_start = chain_start;
+}
+
+/* Adaptive N-factor schedule as used by Vertcoin and its forks: N grows
+ * with the log2 of the time since chain start. The configured N-factor
+ * acts as the floor. */
+#define ADAPTIVE_NFACTOR_MAX 30
+
+uint8_t get_algorithm_nfactor(const algorithm_t* algo, const uint32_t ntime)
+{
+  int64_t s;
+  int l = 0, n;
+
+  if (!algo->nfactor_start || ntime <= algo->nfactor_start)
+    return algo->nfactor;
+
+  s = (int64_t)ntime - algo->nfactor_start;
+  while ((s >> 1) > 3) {
+    l++;
+    s >>= 1;
+  }
+  s &= 3;
+
+  n = (l * 158 + (int)s * 28 - 2670) / 100;
+  if (n < algo->nfactor)
+    n = algo->nfactor;
+  if (n > ADAPTIVE_NFACTOR_MAX)
+    n = ADAPTIVE_NFACTOR_MAX;
+
+  return (uint8_t)n;
+}
+
 bool cmp_algorithm(algorithm_t* algo1, algorithm_t* algo2)
 {
   return (strcmp(algo1->name, algo2->name) == 0) &&
-         (algo1->nfactor == algo2->nfactor);
+         (algo1->nfactor == algo2->nfactor) &&
+         (algo1->nfactor_start == algo2->nfactor_start);
 }
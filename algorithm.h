@@ -30,6 +30,36 @@ extern const char *algorithm_type_str[];
 
 extern void gen_hash(const unsigned char *data, unsigned int len, unsigned char *hash);
 
+/* Kernel arguments a chain stage binds, in order */
+typedef enum {
+  CHAIN_ARG_END,
+  CHAIN_ARG_HEADER,   /* The 80 byte block header */
+  CHAIN_ARG_HASHES,   /* padbuffer8, a 64 byte hash per thread */
+  CHAIN_ARG_BRANCHES, /* Branch index lists, see kernel/quarkcoin-mod.cl */
+  CHAIN_ARG_OUTPUT,   /* Found nonces */
+  CHAIN_ARG_TARGET
+} algorithm_chain_arg_t;
+
+/* When a stage runs. Chains such as quark pick one of two hash functions
+ * by bit 3 of the hash, the CHAIN_PICK stage decides for the TAKEN and
+ * NOT_TAKEN stages that follow it */
+typedef enum {
+  CHAIN_ALWAYS,
+  CHAIN_PICK,
+  CHAIN_TAKEN,
+  CHAIN_NOT_TAKEN
+} algorithm_chain_cond_t;
+
+#define ALGORITHM_STAGE_MAX_ARGS 5
+
+/* One kernel of a split chain, the first one is "search" and stage n
+ * "search<n>". A chain is an array of stages ended by a NULL hashes */
+typedef struct _algorithm_stage_t {
+  const char *hashes; /* Hash functions run, '-' separated when fused into one kernel */
+  algorithm_chain_cond_t cond;
+  algorithm_chain_arg_t args[ALGORITHM_STAGE_MAX_ARGS];
+} algorithm_stage_t;
+
 struct __clState;
 struct _dev_blk_ctx;
 struct _build_kernel_data;
@@ -44,6 +74,7 @@ typedef struct _algorithm_t {
   algorithm_type_t type; //algorithm type
   uint32_t n;        /* N (CPU/Memory tradeoff parameter) */
   uint8_t  nfactor;  /* Factor of N above (n = 2^nfactor) */
+  uint32_t nfactor_start; /* Adaptive N-factor chain start time, 0 if N is fixed */
   double   diff_multiplier1;
   double   diff_multiplier2;
   double   share_diff_multiplier;
@@ -59,6 +90,7 @@ typedef struct _algorithm_t {
   cl_int   (*queue_kernel)(struct __clState *, struct _dev_blk_ctx *, cl_uint);
   void     (*gen_hash)(const unsigned char *, unsigned int, unsigned char *);
   void     (*set_compile_options)(struct _build_kernel_data *, struct cgpu_info *, struct _algorithm_t *);
+  const algorithm_stage_t *chain; /* Split kernel chain, NULL for other kernels */
 } algorithm_t;
 
 /* Set default parameters based on name. */
@@ -67,6 +99,12 @@ void set_algorithm(algorithm_t* algo, const char* name);
 /* Set to specific N factor. */
 void set_algorithm_nfactor(algorithm_t* algo, const uint8_t nfactor);
 
+/* Enable the adaptive N-factor schedule starting at chain_start (0 disables). */
+void set_algorithm_nfactor_start(algorithm_t* algo, const uint32_t chain_start);
+
+/* N-factor in effect for a block with the given timestamp. */
+uint8_t get_algorithm_nfactor(const algorithm_t* algo, const uint32_t ntime);
+
 /* Compare two algorithm parameters */
 bool cmp_algorithm(algorithm_t* algo1, algorithm_t* algo2);
 
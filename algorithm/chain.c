@@ -0,0 +1,143 @@
+/*
+ * Copyright 2014 sgminer developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+#include "miner.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "algorithm/chain.h"
+
+#include "sph/sph_blake.h"
+#include "sph/sph_bmw.h"
+#include "sph/sph_groestl.h"
+#include "sph/sph_jh.h"
+#include "sph/sph_keccak.h"
+#include "sph/sph_skein.h"
+#include "sph/sph_luffa.h"
+#include "sph/sph_cubehash.h"
+#include "sph/sph_shavite.h"
+#include "sph/sph_simd.h"
+#include "sph/sph_echo.h"
+#include "sph/sph_hamsi.h"
+#include "sph/sph_fugue.h"
+#include "sph/sph_shabal.h"
+#include "sph/sph_whirlpool.h"
+
+typedef union {
+  sph_blake512_context blake;
+  sph_bmw512_context bmw;
+  sph_groestl512_context groestl;
+  sph_jh512_context jh;
+  sph_keccak512_context keccak;
+  sph_skein512_context skein;
+  sph_luffa512_context luffa;
+  sph_cubehash512_context cubehash;
+  sph_shavite512_context shavite;
+  sph_simd512_context simd;
+  sph_echo512_context echo;
+  sph_hamsi512_context hamsi;
+  sph_fugue512_context fugue;
+  sph_shabal512_context shabal;
+  sph_whirlpool_context whirlpool;
+} chain_context;
+
+/* 512 bit hash functions a chain stage can name */
+static const struct {
+  const char *name;
+  void (*init)(void *);
+  void (*update)(void *, const void *, size_t);
+  void (*close)(void *, void *);
+} chain_hashes[] = {
+  { "blake",     sph_blake512_init,    sph_blake512,    sph_blake512_close },
+  { "bmw",       sph_bmw512_init,      sph_bmw512,      sph_bmw512_close },
+  { "groestl",   sph_groestl512_init,  sph_groestl512,  sph_groestl512_close },
+  { "jh",        sph_jh512_init,       sph_jh512,       sph_jh512_close },
+  { "keccak",    sph_keccak512_init,   sph_keccak512,   sph_keccak512_close },
+  { "skein",     sph_skein512_init,    sph_skein512,    sph_skein512_close },
+  { "luffa",     sph_luffa512_init,    sph_luffa512,    sph_luffa512_close },
+  { "cubehash",  sph_cubehash512_init, sph_cubehash512, sph_cubehash512_close },
+  { "shavite",   sph_shavite512_init,  sph_shavite512,  sph_shavite512_close },
+  { "simd",      sph_simd512_init,     sph_simd512,     sph_simd512_close },
+  { "echo",      sph_echo512_init,     sph_echo512,     sph_echo512_close },
+  { "hamsi",     sph_hamsi512_init,    sph_hamsi512,    sph_hamsi512_close },
+  { "fugue",     sph_fugue512_init,    sph_fugue512,    sph_fugue512_close },
+  { "shabal",    sph_shabal512_init,   sph_shabal512,   sph_shabal512_close },
+  { "whirlpool", sph_whirlpool_init,   sph_whirlpool,   sph_whirlpool_close },
+  { NULL, NULL, NULL, NULL }
+};
+
+static inline void be32enc_vect(uint32_t *dst, const uint32_t *src, uint32_t len)
+{
+  uint32_t i;
+
+  for (i = 0; i < len; i++)
+    dst[i] = htobe32(src[i]);
+}
+
+/* Runs the '-' separated hash functions of a stage over hash in place, the
+ * first one reads len bytes of it */
+static bool chain_stage_hash(const char *hashes, unsigned char *hash, size_t len)
+{
+  chain_context ctx;
+  const char *p = hashes;
+
+  while (*p) {
+    size_t n = strcspn(p, "-");
+    int i;
+
+    for (i = 0; chain_hashes[i].name; i++) {
+      if (strlen(chain_hashes[i].name) == n && !strncmp(chain_hashes[i].name, p, n))
+        break;
+    }
+    if (unlikely(!chain_hashes[i].name)) {
+      applog(LOG_ERR, "Unknown hash function in chain stage %s", hashes);
+      return false;
+    }
+
+    chain_hashes[i].init(&ctx);
+    chain_hashes[i].update(&ctx, hash, len);
+    chain_hashes[i].close(&ctx, hash);
+    len = 64;
+
+    p += n;
+    if (*p)
+      p++;
+  }
+
+  return true;
+}
+
+void chain_regenhash(struct work *work)
+{
+  const algorithm_stage_t *stage = work->pool->algorithm.chain;
+  uint32_t *nonce = (uint32_t *)(work->data + 76);
+  unsigned char hash[80];
+  size_t len = 80;
+  bool taken = false;
+
+  be32enc_vect((uint32_t *)hash, (const uint32_t *)work->data, 19);
+  ((uint32_t *)hash)[19] = htobe32(*nonce);
+
+  for (; stage && stage->hashes; stage++) {
+    if ((stage->cond == CHAIN_TAKEN && !taken) ||
+        (stage->cond == CHAIN_NOT_TAKEN && taken))
+      continue;
+
+    if (unlikely(!chain_stage_hash(stage->hashes, hash, len)))
+      break;
+    len = 64;
+
+    if (stage->cond == CHAIN_PICK)
+      taken = (hash[0] & 0x8) != 0;
+  }
+
+  memcpy(work->hash, hash, 32);
+}
@@ -0,0 +1,10 @@
+#ifndef CHAIN_H
+#define CHAIN_H
+
+#include "miner.h"
+
+/* Builds work->hash on the CPU by running the split kernel chain of the
+ * work's algorithm */
+extern void chain_regenhash(struct work *work);
+
+#endif /* CHAIN_H */
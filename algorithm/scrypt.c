@@ -34,6 +34,17 @@
 #include <stdint.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SCRYPT_SSE2 1
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "algorithm/scrypt.h"
+
 typedef struct SHA256Context {
 	uint32_t state[8];
 	uint32_t buf[16];
@@ -353,6 +364,119 @@ salsa20_8(uint32_t B[16], const uint32_t Bx[16])
 	B[15] += x15;
 }
 
+#ifdef SCRYPT_SSE2
+/**
+ * salsa20_8_sse2(B, Bx):
+ * Apply the salsa20/8 core to the provided block, with both blocks held in
+ * the diagonal order produced by scrypt_shuffle().
+ */
+static inline void
+salsa20_8_sse2(__m128i B[4], const __m128i Bx[4])
+{
+	__m128i X0, X1, X2, X3;
+	__m128i T;
+	size_t i;
+
+	X0 = B[0] = _mm_xor_si128(B[0], Bx[0]);
+	X1 = B[1] = _mm_xor_si128(B[1], Bx[1]);
+	X2 = B[2] = _mm_xor_si128(B[2], Bx[2]);
+	X3 = B[3] = _mm_xor_si128(B[3], Bx[3]);
+
+	for (i = 0; i < 8; i += 2) {
+#define R(x, t, b) do { \
+		x = _mm_xor_si128(x, _mm_slli_epi32(t, b)); \
+		x = _mm_xor_si128(x, _mm_srli_epi32(t, 32 - (b))); \
+	} while (0)
+		/* Operate on "columns". */
+		T = _mm_add_epi32(X0, X3);	R(X1, T, 7);
+		T = _mm_add_epi32(X1, X0);	R(X2, T, 9);
+		T = _mm_add_epi32(X2, X1);	R(X3, T, 13);
+		T = _mm_add_epi32(X3, X2);	R(X0, T, 18);
+
+		/* Rearrange data. */
+		X1 = _mm_shuffle_epi32(X1, 0x93);
+		X2 = _mm_shuffle_epi32(X2, 0x4E);
+		X3 = _mm_shuffle_epi32(X3, 0x39);
+
+		/* Operate on "rows". */
+		T = _mm_add_epi32(X0, X1);	R(X3, T, 7);
+		T = _mm_add_epi32(X3, X0);	R(X2, T, 9);
+		T = _mm_add_epi32(X2, X3);	R(X1, T, 13);
+		T = _mm_add_epi32(X1, X2);	R(X0, T, 18);
+
+		/* Rearrange data. */
+		X1 = _mm_shuffle_epi32(X1, 0x39);
+		X2 = _mm_shuffle_epi32(X2, 0x4E);
+		X3 = _mm_shuffle_epi32(X3, 0x93);
+#undef R
+	}
+	B[0] = _mm_add_epi32(B[0], X0);
+	B[1] = _mm_add_epi32(B[1], X1);
+	B[2] = _mm_add_epi32(B[2], X2);
+	B[3] = _mm_add_epi32(B[3], X3);
+}
+
+/**
+ * salsa20_8_x4(B, Bx):
+ * Apply the salsa20/8 core to four independent blocks at once.  Word k of
+ * lane l lives in lane l of B[k].
+ */
+static inline void
+salsa20_8_x4(__m128i B[16], const __m128i Bx[16])
+{
+	__m128i x[16];
+	size_t i;
+
+	for (i = 0; i < 16; i++)
+		x[i] = B[i] = _mm_xor_si128(B[i], Bx[i]);
+
+	for (i = 0; i < 8; i += 2) {
+#define R(d, a, b, c) do { \
+		__m128i t = _mm_add_epi32(x[a], x[b]); \
+		x[d] = _mm_xor_si128(x[d], _mm_slli_epi32(t, c)); \
+		x[d] = _mm_xor_si128(x[d], _mm_srli_epi32(t, 32 - (c))); \
+	} while (0)
+		/* Operate on columns. */
+		R( 4,  0, 12,  7);	R( 9,  5,  1,  7);	R(14, 10,  6,  7);	R( 3, 15, 11,  7);
+		R( 8,  4,  0,  9);	R(13,  9,  5,  9);	R( 2, 14, 10,  9);	R( 7,  3, 15,  9);
+		R(12,  8,  4, 13);	R( 1, 13,  9, 13);	R( 6,  2, 14, 13);	R(11,  7,  3, 13);
+		R( 0, 12,  8, 18);	R( 5,  1, 13, 18);	R(10,  6,  2, 18);	R(15, 11,  7, 18);
+
+		/* Operate on rows. */
+		R( 1,  0,  3,  7);	R( 6,  5,  4,  7);	R(11, 10,  9,  7);	R(12, 15, 14,  7);
+		R( 2,  1,  0,  9);	R( 7,  6,  5,  9);	R( 8, 11, 10,  9);	R(13, 12, 15,  9);
+		R( 3,  2,  1, 13);	R( 4,  7,  6, 13);	R( 9,  8, 11, 13);	R(14, 13, 12, 13);
+		R( 0,  3,  2, 18);	R( 5,  4,  7, 18);	R(10,  9,  8, 18);	R(15, 14, 13, 18);
+#undef R
+	}
+	for (i = 0; i < 16; i++)
+		B[i] = _mm_add_epi32(B[i], x[i]);
+}
+
+/* Reorder both 16 word blocks of X into the diagonal layout used by
+ * salsa20_8_sse2().  Word 0 of each block does not move, so the integerify
+ * step can keep reading X[16]. */
+static inline void
+scrypt_shuffle(uint32_t *dst, const uint32_t *src)
+{
+	uint32_t b, k;
+
+	for (b = 0; b < 32; b += 16)
+		for (k = 0; k < 16; k++)
+			dst[b + k] = src[b + (k * 5) % 16];
+}
+
+static inline void
+scrypt_unshuffle(uint32_t *dst, const uint32_t *src)
+{
+	uint32_t b, k;
+
+	for (b = 0; b < 32; b += 16)
+		for (k = 0; k < 16; k++)
+			dst[b + (k * 5) % 16] = src[b + k];
+}
+#endif /* SCRYPT_SSE2 */
+
 /* cpu and memory intensive function to transform a 80 byte buffer into
  * a 32 byte output.
  * scratchpad size needs to be at least (bytes):
@@ -360,6 +484,41 @@ salsa20_8(uint32_t B[16], const uint32_t Bx[16])
  */
 static void scrypt_n_1_1_256_sp(const uint32_t* input, char* scratchpad, uint32_t *ostate, uint32_t n)
 {
+#ifdef SCRYPT_SSE2
+	__m128i *V;
+	union {
+		__m128i v[8];
+		uint32_t w[32];
+	} X;
+	uint32_t T[32];
+	uint32_t i;
+	uint32_t j;
+	uint32_t k;
+
+	V = (__m128i *)(((uintptr_t)(scratchpad) + 63) & ~ (uintptr_t)(63));
+
+	PBKDF2_SHA256_80_128(input, T);
+	scrypt_shuffle(X.w, T);
+
+	for (i = 0; i < n; i++) {
+		for (k = 0; k < 8; k++)
+			V[i * 8 + k] = X.v[k];
+
+		salsa20_8_sse2(&X.v[0], &X.v[4]);
+		salsa20_8_sse2(&X.v[4], &X.v[0]);
+	}
+	for (i = 0; i < n; i++) {
+		j = X.w[16] & (n-1);
+		for (k = 0; k < 8; k++)
+			X.v[k] = _mm_xor_si128(X.v[k], V[j * 8 + k]);
+
+		salsa20_8_sse2(&X.v[0], &X.v[4]);
+		salsa20_8_sse2(&X.v[4], &X.v[0]);
+	}
+
+	scrypt_unshuffle(T, X.w);
+	PBKDF2_SHA256_80_128_32(input, T, ostate);
+#else
 	uint32_t * V;
 	uint32_t X[32];
 	uint32_t i;
@@ -402,19 +561,261 @@ static void scrypt_n_1_1_256_sp(const uint32_t* input, char* scratchpad, uint32_
 	}
 
 	PBKDF2_SHA256_80_128_32(input, X, ostate);
+#endif
 }
 
-void scrypt_regenhash(struct work *work)
+#ifdef SCRYPT_SSE2
+/* As scrypt_n_1_1_256_sp, for four inputs at once.  The scratchpad needs
+ * to be at least 63 + (4 * 128 * N) bytes. */
+static void scrypt_n_1_1_256_sp_x4(const uint32_t input[4][20], char* scratchpad, uint32_t ostate[4][8], uint32_t n)
+{
+	__m128i *V;
+	union {
+		__m128i v[32];
+		uint32_t w[32][4];
+	} X;
+	uint32_t T[4][32];
+	uint32_t i;
+	uint32_t j;
+	uint32_t k;
+	uint32_t l;
+
+	V = (__m128i *)(((uintptr_t)(scratchpad) + 63) & ~ (uintptr_t)(63));
+
+	for (l = 0; l < 4; l++)
+		PBKDF2_SHA256_80_128(input[l], T[l]);
+	for (k = 0; k < 32; k++)
+		X.v[k] = _mm_set_epi32(T[3][k], T[2][k], T[1][k], T[0][k]);
+
+	for (i = 0; i < n; i++) {
+		for (k = 0; k < 32; k++)
+			V[i * 32 + k] = X.v[k];
+
+		salsa20_8_x4(&X.v[0], &X.v[16]);
+		salsa20_8_x4(&X.v[16], &X.v[0]);
+	}
+	for (i = 0; i < n; i++) {
+		/* Every lane picks its own V entry */
+		for (l = 0; l < 4; l++) {
+			const uint32_t *v;
+
+			j = X.w[16][l] & (n-1);
+			v = (const uint32_t *)&V[j * 32];
+			for (k = 0; k < 32; k++)
+				X.w[k][l] ^= v[k * 4 + l];
+		}
+
+		salsa20_8_x4(&X.v[0], &X.v[16]);
+		salsa20_8_x4(&X.v[16], &X.v[0]);
+	}
+
+	for (l = 0; l < 4; l++) {
+		for (k = 0; k < 32; k++)
+			T[l][k] = X.w[k][l];
+		PBKDF2_SHA256_80_128_32(input[l], T[l], ostate[l]);
+	}
+}
+#endif /* SCRYPT_SSE2 */
+
+/* Verifier scratchpads are kept on a free list and reused across calls
+ * instead of being allocated on the stack for every nonce.  Each one grows
+ * to the largest N it has been asked for and is never shrunk. */
+struct scrypt_scratchpad {
+	struct scrypt_scratchpad *next;
+	char *buf;
+	size_t size;
+	size_t mapped;
+};
+
+static struct scrypt_scratchpad *scratchpads;
+static pthread_mutex_t scratchpad_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Batch verification of very large N would need too much memory */
+#define SCRYPT_BATCH_MAX_PAD (64 * 1024 * 1024)
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+#define SCRYPT_HUGEPAGE_SIZE (2 * 1024 * 1024)
+#endif
+
+static void scratchpad_release(struct scrypt_scratchpad *pad)
+{
+	if (!pad->buf)
+		return;
+#ifdef SCRYPT_HUGEPAGE_SIZE
+	if (pad->mapped) {
+		munmap(pad->buf, pad->mapped);
+		pad->mapped = 0;
+	} else
+#endif
+		free(pad->buf);
+	pad->buf = NULL;
+	pad->size = 0;
+}
+
+static bool scratchpad_reserve(struct scrypt_scratchpad *pad, size_t size)
+{
+	if (pad->size >= size)
+		return true;
+
+	scratchpad_release(pad);
+
+#ifdef SCRYPT_HUGEPAGE_SIZE
+	/* Pads of a huge page or more are worth mapping with huge pages to
+	 * cut TLB misses on the random V lookups, fall back to normal pages
+	 * (with a transparent huge page hint) when none are reserved */
+	if (size >= SCRYPT_HUGEPAGE_SIZE) {
+		size_t len = (size + SCRYPT_HUGEPAGE_SIZE - 1) & ~(size_t)(SCRYPT_HUGEPAGE_SIZE - 1);
+		void *buf;
+
+		buf = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (buf == MAP_FAILED) {
+			buf = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+			if (buf != MAP_FAILED)
+				madvise(buf, len, MADV_HUGEPAGE);
+#endif
+		}
+		if (buf != MAP_FAILED) {
+			pad->buf = (char *)buf;
+			pad->size = len;
+			pad->mapped = len;
+			return true;
+		}
+	}
+#endif
+
+	pad->buf = (char *)malloc(size);
+	if (unlikely(!pad->buf)) {
+		applog(LOG_ERR, "Failed to allocate %lu byte scrypt scratchpad", (unsigned long)size);
+		return false;
+	}
+	pad->size = size;
+	return true;
+}
+
+static struct scrypt_scratchpad *scratchpad_get(size_t size)
+{
+	struct scrypt_scratchpad *pad;
+
+	mutex_lock(&scratchpad_lock);
+	pad = scratchpads;
+	if (pad)
+		scratchpads = pad->next;
+	mutex_unlock(&scratchpad_lock);
+
+	if (!pad) {
+		pad = (struct scrypt_scratchpad *)calloc(1, sizeof(struct scrypt_scratchpad));
+		if (unlikely(!pad)) {
+			applog(LOG_ERR, "Failed to calloc scrypt scratchpad");
+			return NULL;
+		}
+	}
+
+	if (!scratchpad_reserve(pad, size)) {
+		free(pad);
+		return NULL;
+	}
+	return pad;
+}
+
+static void scratchpad_put(struct scrypt_scratchpad *pad)
+{
+	mutex_lock(&scratchpad_lock);
+	pad->next = scratchpads;
+	scratchpads = pad;
+	mutex_unlock(&scratchpad_lock);
+}
+
+/* N used for this work, following the adaptive N-factor schedule if any */
+static uint32_t scrypt_work_n(struct work *work)
+{
+	const algorithm_t *algo = &work->pool->algorithm;
+
+	if (!algo->nfactor_start)
+		return algo->n;
+	return 1U << get_algorithm_nfactor(algo, be32toh(*(uint32_t *)(work->data + 68)));
+}
+
+/* nonce is given as stored in the header, i.e. little endian */
+static void scrypt_hash_one(struct work *work, uint32_t nonce, char *scratchbuf, uint32_t *ohash, uint32_t n)
 {
 	uint32_t data[20];
-	char *scratchbuf;
-	uint32_t *nonce = (uint32_t *)(work->data + 76);
-	uint32_t *ohash = (uint32_t *)(work->hash);
 
 	be32enc_vect(data, (const uint32_t *)work->data, 19);
-	data[19] = htobe32(*nonce);
+	data[19] = htobe32(nonce);
 
-	scratchbuf = (char *)alloca(work->pool->algorithm.n * 128 + 512);
-	scrypt_n_1_1_256_sp(data, scratchbuf, ohash, work->pool->algorithm.n);
+	scrypt_n_1_1_256_sp(data, scratchbuf, ohash, n);
 	flip32(ohash, ohash);
 }
+
+void scrypt_regenhash(struct work *work)
+{
+	uint32_t *nonce = (uint32_t *)(work->data + 76);
+	uint32_t *ohash = (uint32_t *)(work->hash);
+	const uint32_t n = scrypt_work_n(work);
+	struct scrypt_scratchpad *pad;
+	char *scratchbuf;
+
+	pad = scratchpad_get((size_t)n * 128 + 512);
+	if (unlikely(!pad)) {
+		/* Last resort, the way this used to be done */
+		scratchbuf = (char *)alloca(n * 128 + 512);
+		scrypt_hash_one(work, *nonce, scratchbuf, ohash, n);
+		return;
+	}
+
+	scrypt_hash_one(work, *nonce, pad->buf, ohash, n);
+	scratchpad_put(pad);
+}
+
+void scrypt_regenhash_batch(struct work *work, const uint32_t *nonces, uint32_t (*hashes)[8], unsigned int count)
+{
+	const uint32_t n = scrypt_work_n(work);
+	struct scrypt_scratchpad *pad;
+	unsigned int i = 0;
+	size_t size;
+
+#ifdef SCRYPT_SSE2
+	if (count > 1 && (size_t)n * 4 * 128 <= SCRYPT_BATCH_MAX_PAD)
+		size = (size_t)n * 4 * 128 + 512;
+	else
+#endif
+		size = (size_t)n * 128 + 512;
+
+	pad = scratchpad_get(size);
+	if (unlikely(!pad)) {
+		uint32_t *nonce = (uint32_t *)(work->data + 76);
+
+		for (i = 0; i < count; i++) {
+			*nonce = htole32(nonces[i]);
+			scrypt_regenhash(work);
+			memcpy(hashes[i], work->hash, 32);
+		}
+		return;
+	}
+
+#ifdef SCRYPT_SSE2
+	if (size > (size_t)n * 128 + 512) {
+		/* Runs of 2 or 3 are still cheaper padded out to 4 lanes */
+		while (count - i > 1) {
+			uint32_t data[4][20];
+			uint32_t ohash[4][8];
+			unsigned int l, lanes = count - i < 4 ? count - i : 4;
+
+			for (l = 0; l < 4; l++) {
+				be32enc_vect(data[l], (const uint32_t *)work->data, 19);
+				data[l][19] = htobe32(htole32(nonces[i + (l < lanes ? l : lanes - 1)]));
+			}
+			scrypt_n_1_1_256_sp_x4(data, pad->buf, ohash, n);
+			for (l = 0; l < lanes; l++)
+				flip32(hashes[i + l], ohash[l]);
+			i += lanes;
+		}
+	}
+#endif
+
+	for (; i < count; i++)
+		scrypt_hash_one(work, htole32(nonces[i]), pad->buf, hashes[i], n);
+
+	scratchpad_put(pad);
+}
@@ -7,4 +7,9 @@
 /* 			uint32_t nonce); */
 extern void scrypt_regenhash(struct work *work);
 
+/* Computes the hashes of several nonces of the same work at once, hashes[i]
+ * receives what scrypt_regenhash would leave in work->hash for nonces[i].
+ * work->data itself is only used as the header template. */
+extern void scrypt_regenhash_batch(struct work *work, const uint32_t *nonces, uint32_t (*hashes)[8], unsigned int count);
+
 #endif /* SCRYPT_H */
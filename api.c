@@ -32,8 +32,15 @@
 #include "util.h"
 #include "pool.h"
 #include "algorithm.h"
+#include "sensors.h"
 
 #include "config_parser.h"
+#include "affinity.h"
+#include "ocl/kernel_profile.h"
+#include "trace.h"
+#include "lock_stats.h"
+#include "share_table.h"
+#include "lowmem.h"
 
 #ifdef WIN32
 static char WSAbuf[1024];
@@ -193,7 +200,7 @@ struct CODES codes[] = {
  { SEVERITY_SUCC,  MSG_ZERSUM,  PARAM_STR,  "Zeroed %s stats with summary" },
  { SEVERITY_SUCC,  MSG_ZERNOSUM, PARAM_STR, "Zeroed %s stats without summary" },
  { SEVERITY_SUCC,  MSG_LOCKOK,  PARAM_NONE, "Lock stats created" },
- { SEVERITY_WARN,  MSG_LOCKDIS, PARAM_NONE, "Lock stats not enabled" },
+ { SEVERITY_WARN,  MSG_LOCKDIS, PARAM_NONE, "Lock stats not enabled, use lockstats|on or --lock-stats" },
  { SEVERITY_SUCC,  MSG_CHSTRAT,  PARAM_STR, "Multipool strategy changed to '%s'" },
  { SEVERITY_ERR,   MSG_MISSTRAT, PARAM_NONE, "Missing multipool strategy" },
  { SEVERITY_ERR,   MSG_INVSTRAT, PARAM_NONE, "Invalid multipool strategy %d" },
@@ -213,6 +220,18 @@ struct CODES codes[] = {
  { SEVERITY_SUCC,  MSG_REMPROFILE, PARAM_BOTH, "Removed pool %d:'%s'" },
 
  { SEVERITY_SUCC,  MSG_CHPOOLPR, PARAM_BOTH, "Changed pool %d to profile '%s'" },
+ { SEVERITY_SUCC,  MSG_KERNPROF, PARAM_NONE, "Kernel profile" },
+ { SEVERITY_WARN,  MSG_KERNPROFDIS, PARAM_NONE, "Kernel profiling not enabled, start with --kernel-profile" },
+ { SEVERITY_SUCC,  MSG_TRACE, PARAM_STR,  "Trace written to file '%s'" },
+ { SEVERITY_WARN,  MSG_TRACEDIS, PARAM_NONE, "Tracing not enabled, start with --trace" },
+ { SEVERITY_ERR,   MSG_TRACEERR, PARAM_STR,  "Can't write trace file '%s'" },
+ { SEVERITY_SUCC,  MSG_LOCKSTATS, PARAM_NONE, "Lock stats" },
+ { SEVERITY_SUCC,  MSG_LOCKSTATSON, PARAM_NONE, "Lock stats enabled" },
+ { SEVERITY_SUCC,  MSG_LOCKSTATSOFF, PARAM_NONE, "Lock stats disabled" },
+ { SEVERITY_SUCC,  MSG_LOCKSTATSZERO, PARAM_NONE, "Lock stats reset" },
+ { SEVERITY_ERR,   MSG_INVLOCKSTATS, PARAM_STR,  "Invalid lockstats parameter '%s', use on, off or reset" },
+ { SEVERITY_SUCC,  MSG_RELOADED, PARAM_STR,  "Reloaded settings from '%s'" },
+ { SEVERITY_ERR,   MSG_RELOADERR, PARAM_STR,  "Reload failed: %s" },
 
  { SEVERITY_SUCC,  MSG_BYE,   PARAM_STR,  "%s" },
  { SEVERITY_FAIL, 0, (enum code_parameters)0, NULL }
@@ -1310,14 +1329,110 @@ static void copyadvanceafter(char ch, char **param, char **buf)
   *(dst_b++) = '\0';
 }
 
-static void lockstats(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __maybe_unused char *param, bool isjson, __maybe_unused char group)
+static void lockstats(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char *param, bool isjson, __maybe_unused char group)
 {
+  struct api_data *root = NULL;
+  struct lock_site_stats *sites;
+  char buf[TMPBUFSIZ];
+  bool io_open = false;
+  int i, count;
+
+  if (param != NULL && *param != '\0') {
+    if (strcasecmp(param, "on") == 0) {
+      lock_stats_enable(true);
+      message(io_data, MSG_LOCKSTATSON, 0, NULL, isjson);
+    } else if (strcasecmp(param, "off") == 0) {
+      lock_stats_enable(false);
+      message(io_data, MSG_LOCKSTATSOFF, 0, NULL, isjson);
+    } else if (strcasecmp(param, "reset") == 0) {
+      lock_stats_reset();
+      message(io_data, MSG_LOCKSTATSZERO, 0, NULL, isjson);
+    } else {
+      char *ptr = escape_string(param, isjson);
+
+      message(io_data, MSG_INVLOCKSTATS, 0, ptr, isjson);
+      if (ptr != param)
+        free(ptr);
+    }
+    return;
+  }
+
 #if LOCK_TRACKING
   show_locks();
-  message(io_data, MSG_LOCKOK, 0, NULL, isjson);
-#else
-  message(io_data, MSG_LOCKDIS, 0, NULL, isjson);
 #endif
+
+  sites = lock_stats_snapshot(&count);
+  if (!count && !opt_lock_stats) {
+    free(sites);
+    message(io_data, MSG_LOCKDIS, 0, NULL, isjson);
+    return;
+  }
+
+  message(io_data, MSG_LOCKSTATS, 0, NULL, isjson);
+
+  if (isjson)
+    io_open = io_add(io_data, COMSTR JSON_LOCKSTATS);
+
+  for (i = 0; i < count; i++) {
+    root = lock_stats_api_site(&sites[i], root);
+    root = print_data(root, buf, isjson, isjson && (i > 0));
+    io_add(io_data, buf);
+  }
+  free(sites);
+
+  if (isjson && io_open)
+    io_close(io_data);
+}
+
+static void kernelprofile(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __maybe_unused char *param, bool isjson, __maybe_unused char group)
+{
+  struct api_data *root = NULL;
+  char buf[TMPBUFSIZ];
+  bool io_open = false;
+  unsigned int stage;
+  int i, j = 0;
+
+  if (!opt_kernel_profile) {
+    message(io_data, MSG_KERNPROFDIS, 0, NULL, isjson);
+    return;
+  }
+
+  message(io_data, MSG_KERNPROF, 0, NULL, isjson);
+
+  if (isjson)
+    io_open = io_add(io_data, COMSTR JSON_KERNELPROFILE);
+
+  for (i = 0; i < nDevs; i++) {
+    for (stage = 0; kernel_profile_api_stage(&gpus[i], stage, &root); stage++) {
+      root = print_data(root, buf, isjson, isjson && (j > 0));
+      io_add(io_data, buf);
+      j++;
+    }
+  }
+
+  if (isjson && io_open)
+    io_close(io_data);
+}
+
+static void dotrace(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char *param, bool isjson, __maybe_unused char group)
+{
+  char *ptr;
+  bool ok;
+
+  if (!opt_trace) {
+    message(io_data, MSG_TRACEDIS, 0, NULL, isjson);
+    return;
+  }
+
+  if (param == NULL || *param == '\0')
+    param = opt_trace_file;
+
+  ok = trace_dump(param);
+
+  ptr = escape_string(param, isjson);
+  message(io_data, ok ? MSG_TRACE : MSG_TRACEERR, 0, ptr, isjson);
+  if (ptr != param)
+    free(ptr);
 }
 
 static void apiversion(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __maybe_unused char *param, bool isjson, __maybe_unused char group)
@@ -1409,6 +1524,7 @@ static void gpustatus(struct io_data *io_data, int gpu, bool isjson, bool precom
   char buf[TMPBUFSIZ];
   char *enabled;
   char *status;
+  struct gpu_sensors sensors;
   float gt, gv;
   int ga, gf, gp, gc, gm, pt;
 
@@ -1420,9 +1536,17 @@ static void gpustatus(struct io_data *io_data, int gpu, bool isjson, bool precom
 
     cgpu->utility = cgpu->accepted / dev_runtime * 60;
 
-#ifdef HAVE_ADL
-    if (!gpu_stats(gpu, &gt, &gc, &gm, &gv, &ga, &gf, &gp, &pt))
-#endif
+    /* The last sample, replies never wait on the driver */
+    if (gpu_sensors_get(gpu, &sensors)) {
+      gt = sensors.temp;
+      gc = sensors.engineclock;
+      gm = sensors.memclock;
+      gv = sensors.vddc;
+      ga = sensors.activity;
+      gf = sensors.fanspeed;
+      gp = sensors.fanpercent;
+      pt = sensors.powertune;
+    } else
       gt = gv = gm = gc = ga = gf = gp = pt = 0;
 
     if (cgpu->deven != DEV_DISABLED)
@@ -1553,6 +1677,8 @@ static void poolstatus(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __m
   struct api_data *root = NULL;
   char buf[TMPBUFSIZ];
   bool io_open = false;
+  struct share_table_stats share_stats;
+  double ack_avg_ms;
   char *status, *lp;
   int i;
 
@@ -1643,6 +1769,13 @@ static void poolstatus(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __m
     else
       root = api_add_const(root, "Stratum URL", BLANK, false);
     root = api_add_bool(root, "Has GBT", &(pool->has_gbt), false);
+    root = api_add_bool(root, "Hot Standby", &(pool->hot_standby), false);
+    share_table_get_stats(pool->share_table, &share_stats);
+    ack_avg_ms = share_stats.acked ? share_stats.ack_total_ms / share_stats.acked : 0.0;
+    root = api_add_int(root, "Shares Outstanding", &share_stats.outstanding, true);
+    root = api_add_uint64(root, "Shares Lost", &share_stats.lost, true);
+    root = api_add_double(root, "Share Ack Avg ms", &ack_avg_ms, true);
+    root = api_add_double(root, "Share Ack Max ms", &share_stats.ack_max_ms, true);
     root = api_add_double(root, "Best Share", &(pool->best_diff), true);
     double rejp = (pool->diff_accepted + pool->diff_rejected + pool->diff_stale) ?
         (double)(pool->diff_rejected) / (double)(pool->diff_accepted + pool->diff_rejected + pool->diff_stale) : 0;
@@ -1718,6 +1851,9 @@ static void summary(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __mayb
       (double)(total_diff_stale) / (double)(total_diff_accepted + total_diff_rejected + total_diff_stale) : 0;
   root = api_add_percent(root, "Pool Stale%", &stalep, false);
   root = api_add_time(root, "Last getwork", &last_getwork, false);
+  root = api_add_uint(root, "Failovers", &(total_failovers), true);
+  root = api_add_double(root, "Last Failover Gap", &(last_failover_gap), true);
+  root = api_add_double(root, "Max Failover Gap", &(max_failover_gap), true);
 
   mutex_unlock(&hash_lock);
 
@@ -2534,8 +2670,9 @@ static void devdetails(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __m
   struct api_data *root = NULL;
   char buf[TMPBUFSIZ];
   bool io_open = false;
+  char miner_cpus[128], verify_cpus[128];
   struct cgpu_info *cgpu;
-  int i, j;
+  int i, j, numa_node;
 
   if (total_devices == 0) {
     message(io_data, MSG_NODEVS, 0, NULL, isjson);
@@ -2559,6 +2696,13 @@ static void devdetails(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __m
     root = api_add_const(root, "Kernel", cgpu->algorithm.name, false);
     root = api_add_const(root, "Model", cgpu->name ? cgpu->name : BLANK, false);
     root = api_add_const(root, "Device Path", cgpu->device_path ? cgpu->device_path : BLANK, false);
+    root = api_add_const(root, "PCI Slot", cgpu->pci_slot[0] ? cgpu->pci_slot : BLANK, false);
+    numa_node = affinity_numa_node(cgpu);
+    root = api_add_int(root, "NUMA Node", &numa_node, true);
+    affinity_describe(AFFINITY_MINER, cgpu, miner_cpus, sizeof(miner_cpus));
+    root = api_add_string(root, "Miner Affinity", miner_cpus, true);
+    affinity_describe(AFFINITY_VERIFY, cgpu, verify_cpus, sizeof(verify_cpus));
+    root = api_add_string(root, "Verify Affinity", verify_cpus, true);
 
     root = print_data(root, buf, isjson, isjson && (j > 0));
     io_add(io_data, buf);
@@ -2635,6 +2779,7 @@ static int itemstats(struct io_data *io_data, int i, char *id, struct sgminer_st
     root = api_add_uint64(root, "Bytes Recv", &(pool_stats->bytes_received), false);
     root = api_add_uint64(root, "Net Bytes Sent", &(pool_stats->net_bytes_sent), false);
     root = api_add_uint64(root, "Net Bytes Recv", &(pool_stats->net_bytes_received), false);
+    root = api_add_uint64(root, "Lines Dropped", &(pool_stats->lines_dropped), false);
   }
 
   if (extra)
@@ -2646,6 +2791,34 @@ static int itemstats(struct io_data *io_data, int i, char *id, struct sgminer_st
   return ++i;
 }
 
+static int lowmemstats(struct io_data *io_data, int i, enum lowmem_pool id, bool isjson)
+{
+  struct api_data *root = NULL;
+  struct lowmem_stats stats;
+  char buf[TMPBUFSIZ];
+  char name[32];
+  int size;
+
+  lowmem_get_stats(id, &stats);
+  snprintf(name, sizeof(name), "MEM%d", (int)id);
+  size = (int)stats.size;
+
+  root = api_add_int(root, "STATS", &i, false);
+  root = api_add_string(root, "ID", name, true);
+  root = api_add_const(root, "Name", stats.name, false);
+  root = api_add_int(root, "Object Size", &size, true);
+  root = api_add_int(root, "Capacity", &stats.capacity, true);
+  root = api_add_int(root, "In Use", &stats.in_use, true);
+  root = api_add_int(root, "High Water", &stats.high_water, true);
+  root = api_add_uint64(root, "Allocs", &stats.allocs, true);
+  root = api_add_uint64(root, "Exhausted", &stats.exhausted, true);
+
+  root = print_data(root, buf, isjson, isjson && (i > 0));
+  io_add(io_data, buf);
+
+  return ++i;
+}
+
 static void minerstats(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __maybe_unused char *param, bool isjson, __maybe_unused char group)
 {
   struct cgpu_info *cgpu;
@@ -2681,6 +2854,11 @@ static void minerstats(struct io_data *io_data, __maybe_unused SOCKETTYPE c, __m
     i = itemstats(io_data, i, id, &(pool->sgminer_stats), &(pool->sgminer_pool_stats), NULL, NULL, isjson);
   }
 
+  if (opt_lowmem) {
+    for (j = 0; j < LOWMEM_POOLS; j++)
+      i = lowmemstats(io_data, i, (enum lowmem_pool)j, isjson);
+  }
+
   if (isjson && io_open)
     io_close(io_data);
 }
@@ -2932,6 +3110,7 @@ struct CMDS {
   { "gpufan",             gpufan,         true, false },
   { "gpuvddc",            gpuvddc,        true, false },
   { "save",   dosave,   true, false },
+  { "reloadconfig", api_reload_config, true, false },
   { "quit",   doquit,   true, false },
   { "privileged",   privileged, true, false },
   { "notify",   notify,   false,  true },
@@ -2945,6 +3124,8 @@ struct CMDS {
   { "setconfig",    setconfig,  true, false },
   { "zero",   dozero,   true, false },
   { "lockstats",    lockstats,  true, true },
+  { "kernelprofile",  kernelprofile,  false,  true },
+  { "trace",    dotrace,  true, false },
   { NULL,     NULL,   false,  false }
 };
 
@@ -38,6 +38,8 @@
 #define _MINECOIN "COIN"
 #define _DEBUGSET "DEBUG"
 #define _SETCONFIG  "SETCONFIG"
+#define _KERNELPROFILE "KERNELPROFILE"
+#define _LOCKSTATS "LOCKSTATS"
 
 #define JSON0   "{"
 #define JSON1   "\""
@@ -67,6 +69,8 @@
 #define JSON_MINECOIN JSON1 _MINECOIN JSON2
 #define JSON_DEBUGSET JSON1 _DEBUGSET JSON2
 #define JSON_SETCONFIG  JSON1 _SETCONFIG JSON2
+#define JSON_KERNELPROFILE JSON1 _KERNELPROFILE JSON2
+#define JSON_LOCKSTATS JSON1 _LOCKSTATS JSON2
 
 #define JSON_END  JSON4 JSON5
 #define JSON_END_TRUNCATED  JSON4_TRUNCATED JSON5
@@ -181,6 +185,22 @@
 
 #define MSG_CHPOOLPR 139
 
+#define MSG_KERNPROF 140
+#define MSG_KERNPROFDIS 141
+
+#define MSG_TRACE 142
+#define MSG_TRACEDIS 143
+#define MSG_TRACEERR 144
+
+#define MSG_LOCKSTATS 145
+#define MSG_LOCKSTATSON 146
+#define MSG_LOCKSTATSOFF 147
+#define MSG_LOCKSTATSZERO 148
+#define MSG_INVLOCKSTATS 149
+
+#define MSG_RELOADED 150
+#define MSG_RELOADERR 151
+
 enum code_severity {
   SEVERITY_ERR,
   SEVERITY_WARN,
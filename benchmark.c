@@ -0,0 +1,135 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "miner.h"
+#include "benchmark.h"
+#include "util.h"
+#include "lowmem.h"
+
+/* Mine synthesised work offline, see gen_benchmark_work */
+bool opt_benchmark;
+/* Share difficulty of benchmark work */
+double opt_benchmark_diff = 1.0;
+
+struct benchmark_timing {
+  uint64_t count;
+  double total;
+  double max;
+};
+
+static const char *benchmark_stage_names[BENCH_STAGES] = {
+  "Queue wait",
+  "Work to share",
+  "Postcalc dispatch",
+  "Postcalc",
+};
+
+static pthread_mutex_t benchmark_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct benchmark_timing benchmark_timings[BENCH_STAGES];
+static double benchmark_verify_cpu;
+static uint64_t benchmark_shares;
+
+char *set_benchmark_diff(const char *arg)
+{
+  double diff;
+
+  if (!(arg && arg[0]))
+    return "Invalid parameters for set benchmark diff";
+  diff = strtod(arg, NULL);
+  if (diff <= 0.0)
+    return "Invalid value passed to set benchmark diff";
+  opt_benchmark_diff = diff;
+
+  return NULL;
+}
+
+/* CPU time used by the calling thread, in seconds. Falls back to 0 where
+ * there is no per thread clock, which leaves the CPU figures out */
+double benchmark_thread_cpu(void)
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+
+  if (!clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts))
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+#endif
+  return 0;
+}
+
+void benchmark_stage(enum benchmark_stage stage, struct timeval *start, struct timeval *end)
+{
+  struct benchmark_timing *timing = &benchmark_timings[stage];
+  double secs = tdiff(end, start);
+
+  mutex_lock(&benchmark_lock);
+  timing->count++;
+  timing->total += secs;
+  if (secs > timing->max)
+    timing->max = secs;
+  mutex_unlock(&benchmark_lock);
+}
+
+/* Adds the CPU time a postcalc thread spent verifying results */
+void benchmark_verified(double cpu_secs)
+{
+  mutex_lock(&benchmark_lock);
+  benchmark_verify_cpu += cpu_secs;
+  mutex_unlock(&benchmark_lock);
+}
+
+/* Counts a share swallowed instead of being submitted */
+void benchmark_share(void)
+{
+  mutex_lock(&benchmark_lock);
+  benchmark_shares++;
+  mutex_unlock(&benchmark_lock);
+}
+
+void benchmark_report(double secs, double mhashes)
+{
+  int i;
+
+  if (secs <= 0)
+    secs = 1;
+
+  applog(LOG_WARNING, "Benchmark results at share difficulty %g:", opt_benchmark_diff);
+  applog(LOG_WARNING, " Hashes/s: %.0f", mhashes * 1000000.0 / secs);
+  applog(LOG_WARNING, " Shares: %"PRIu64" (%.3f/s)", benchmark_shares,
+         (double)benchmark_shares / secs);
+  applog(LOG_WARNING, " Verification CPU time: %.3f secs (%.3f ms/share)",
+         benchmark_verify_cpu,
+         benchmark_shares ? benchmark_verify_cpu * 1000.0 / benchmark_shares : 0.0);
+  applog(LOG_WARNING, " %-18s %10s %10s %10s", "Stage", "Count", "Avg ms", "Max ms");
+  for (i = 0; i < BENCH_STAGES; i++) {
+    struct benchmark_timing *timing = &benchmark_timings[i];
+
+    applog(LOG_WARNING, " %-18s %10"PRIu64" %10.3f %10.3f", benchmark_stage_names[i],
+           timing->count,
+           timing->count ? timing->total * 1000.0 / timing->count : 0.0,
+           timing->max * 1000.0);
+  }
+  applog(LOG_WARNING, " Peak RSS: %ld KiB", lowmem_peak_rss());
+  if (opt_lowmem) {
+    applog(LOG_WARNING, " %-18s %10s %10s %10s", "Object pool", "Capacity", "High water", "Exhausted");
+    for (i = 0; i < LOWMEM_POOLS; i++) {
+      struct lowmem_stats stats;
+
+      lowmem_get_stats((enum lowmem_pool)i, &stats);
+      applog(LOG_WARNING, " %-18s %10d %10d %10"PRIu64, stats.name, stats.capacity,
+             stats.high_water, stats.exhausted);
+    }
+  }
+  applog(LOG_WARNING, " ");
+}
@@ -0,0 +1,26 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "miner.h"
+
+extern bool opt_benchmark;
+extern double opt_benchmark_diff;
+
+/* Pipeline stages timed in --benchmark mode */
+enum benchmark_stage {
+  BENCH_QUEUE,    /* Work staged until a mining thread takes it */
+  BENCH_SHARE,    /* Mining thread took the work until a share from it was found */
+  BENCH_DISPATCH, /* Device results read until their postcalc thread runs */
+  BENCH_POSTCALC, /* Postcalc thread verifying and submitting one result set */
+  BENCH_STAGES
+};
+
+extern char *set_benchmark_diff(const char *arg);
+
+extern double benchmark_thread_cpu(void);
+extern void benchmark_stage(enum benchmark_stage stage, struct timeval *start, struct timeval *end);
+extern void benchmark_verified(double cpu_secs);
+extern void benchmark_share(void);
+extern void benchmark_report(double secs, double mhashes);
+
+#endif /* BENCHMARK_H */
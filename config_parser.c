@@ -41,6 +41,7 @@
 
 #include "algorithm.h"
 #include "pool.h"
+#include "reconfig.h"
 
 #ifdef HAVE_ADL
 #include "adl.h"
@@ -167,6 +168,14 @@ char *set_default_nfactor(const char *arg)
   return NULL;
 }
 
+char *set_default_nfactor_start(const char *arg)
+{
+  set_algorithm_nfactor_start(&default_profile.algorithm, (const uint32_t) strtoul(arg, NULL, 10));
+  applog(LOG_INFO, "Set adaptive N-factor chain start to %u", default_profile.algorithm.nfactor_start);
+
+  return NULL;
+}
+
 char *set_default_devices(const char *arg)
 {
   default_profile.devices = arg;
@@ -380,6 +389,16 @@ char *set_profile_nfactor(const char *arg)
   return NULL;
 }
 
+char *set_profile_nfactor_start(const char *arg)
+{
+  struct profile *profile = get_current_profile();
+
+  applog(LOG_DEBUG, "Setting profile %s adaptive N-factor chain start to %s", profile->name, arg);
+  set_algorithm_nfactor_start(&profile->algorithm, (const uint32_t) strtoul(arg, NULL, 10));
+
+  return NULL;
+}
+
 char *set_profile_shaders(const char *arg)
 {
   struct profile *profile = get_current_profile();
@@ -769,6 +788,132 @@ void load_default_config(void)
   }
 }
 
+/* Top level options a running miner picks up again, the ones that only
+ * change the kernels or clocks of the devices */
+static const char *reload_keys[] = {
+  "intensity",
+  "xintensity",
+  "rawintensity",
+  "lookup-gap",
+  "shaders",
+  "thread-concurrency",
+  "worksize",
+#ifdef HAVE_ADL
+  "gpu-engine",
+  "gpu-memclock",
+  "gpu-fan",
+  "gpu-powertune",
+  "gpu-vddc",
+#endif
+  NULL
+};
+
+#define RELOAD_FIELD(field) \
+  if (pool->field == old.field) \
+    pool->field = default_profile.field
+
+/* Copies a setting the reload changed out of the config JSON */
+#define RELOAD_KEEP(field) \
+  if (default_profile.field != old.field && default_profile.field && \
+      unlikely(!(default_profile.field = strdup(default_profile.field)))) \
+    quit(1, "Failed to strdup reloaded " #field)
+
+char *reload_config(const char *arg)
+{
+  static char err_buf[200];
+  struct profile old;
+  json_error_t err;
+  json_t *config, *val;
+  char *errmsg;
+  int i;
+
+  if (empty_string(arg))
+    arg = cnfbuf;
+  if (empty_string(arg))
+    return "No config file to reload";
+
+  #ifdef HAVE_LIBCURL
+    if((strstr(arg, "http://") != NULL) || (strstr(arg, "https://") != NULL) || (strstr(arg, "ftp://") != NULL))
+    {
+      if((arg = fetch_remote_config(arg)) == NULL)
+        return "Failed to fetch remote config";
+    }
+  #endif
+
+#if JANSSON_MAJOR_VERSION > 1
+  config = json_load_file(arg, 0, &err);
+#else
+  config = json_load_file(arg, &err);
+#endif
+
+  if(!json_is_object(config))
+  {
+    snprintf(err_buf, sizeof(err_buf), "JSON decode of file \"%s\" failed: %s", arg, err.text);
+    json_decref(config);
+    return err_buf;
+  }
+
+  mutex_lock(&reconfig_lock);
+  memcpy(&old, &default_profile, sizeof(struct profile));
+
+  /* The setters keep pointers into config, the values they took are copied
+   * below before it is freed */
+  for (i = 0; reload_keys[i]; i++)
+  {
+    if (!(val = json_object_get(config, reload_keys[i])))
+      continue;
+
+    if ((errmsg = parse_config(val, reload_keys[i], "", false, -1)))
+    {
+      memcpy(&default_profile, &old, sizeof(struct profile));
+      mutex_unlock(&reconfig_lock);
+      json_decref(config);
+      return errmsg;
+    }
+  }
+
+  RELOAD_KEEP(intensity);
+  RELOAD_KEEP(xintensity);
+  RELOAD_KEEP(rawintensity);
+  RELOAD_KEEP(lookup_gap);
+  RELOAD_KEEP(shaders);
+  RELOAD_KEEP(thread_concurrency);
+  RELOAD_KEEP(worksize);
+  RELOAD_KEEP(gpu_engine);
+  RELOAD_KEEP(gpu_memclock);
+  RELOAD_KEEP(gpu_fan);
+  RELOAD_KEEP(gpu_powertune);
+  RELOAD_KEEP(gpu_vddc);
+  json_decref(config);
+
+  //pools that inherited a default get the new one
+  for (i = 0; i < total_pools; i++)
+  {
+    struct pool *pool = pools[i];
+
+    RELOAD_FIELD(intensity);
+    RELOAD_FIELD(xintensity);
+    RELOAD_FIELD(rawintensity);
+    RELOAD_FIELD(lookup_gap);
+    RELOAD_FIELD(shaders);
+    RELOAD_FIELD(thread_concurrency);
+    RELOAD_FIELD(worksize);
+    RELOAD_FIELD(gpu_engine);
+    RELOAD_FIELD(gpu_memclock);
+    RELOAD_FIELD(gpu_fan);
+    RELOAD_FIELD(gpu_powertune);
+    RELOAD_FIELD(gpu_vddc);
+  }
+  mutex_unlock(&reconfig_lock);
+
+  applog(LOG_NOTICE, "Reloaded settings from %s", arg);
+
+  for (i = 0; i < total_pools; i++)
+    reconfigure_pool(pools[i]);
+
+  return NULL;
+}
+
 /*******************************************
  * Startup functions
  * *****************************************/
@@ -2285,9 +2430,21 @@ void api_pool_profile(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char
   //apply settings
   apply_pool_profile(pool);
 
-  //if current pool restart it
-  if (pool == current_pool())
-    switch_pools(NULL);
+  //if the devices are set up for it, catch them up
+  reconfigure_pool(pool);
 
   message(io_data, MSG_CHPOOLPR, pool->pool_no, profile->name, isjson);
 }
+
+void api_reload_config(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char *param, bool isjson, __maybe_unused char group)
+{
+  char *err;
+
+  if ((err = reload_config(param)))
+  {
+    message(io_data, MSG_RELOADERR, 0, err, isjson);
+    return;
+  }
+
+  message(io_data, MSG_RELOADED, 0, isnull(param, cnfbuf), isjson);
+}
@@ -65,6 +65,7 @@ extern int total_profiles;
 /* option parser functions */
 extern char *set_default_algorithm(const char *arg);
 extern char *set_default_nfactor(const char *arg);
+extern char *set_default_nfactor_start(const char *arg);
 extern char *set_default_devices(const char *arg);
 extern char *set_default_lookup_gap(const char *arg);
 extern char *set_default_intensity(const char *arg);
@@ -100,6 +101,7 @@ extern char *set_profile_thread_concurrency(const char *arg);
   extern char *set_profile_gpu_vddc(const char *arg);
 #endif
 extern char *set_profile_nfactor(const char *arg);
+extern char *set_profile_nfactor_start(const char *arg);
 extern char *set_profile_shaders(const char *arg);
 extern char *set_profile_worksize(const char *arg);
 
@@ -108,6 +110,10 @@ extern char *parse_config(json_t *val, const char *key, const char *parentkey, b
 extern char *load_config(const char *arg, const char *parentkey, void __maybe_unused *unused);
 extern char *set_default_config(const char *arg);
 extern void load_default_config(void);
+/* Reads the intensity, kernel and clock options of the config file arg, or
+ * of the one loaded at startup, again and applies them to the pools that
+ * use the defaults */
+extern char *reload_config(const char *arg);
 
 /* startup functions */
 extern void load_default_profile();
@@ -123,5 +129,6 @@ extern void api_profile_list(struct io_data *io_data, __maybe_unused SOCKETTYPE
 extern void api_profile_add(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char *param, bool isjson, __maybe_unused char group);
 extern void api_profile_remove(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char *param, bool isjson, __maybe_unused char group);
 extern void api_pool_profile(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char *param, bool isjson, __maybe_unused char group);
+extern void api_reload_config(struct io_data *io_data, __maybe_unused SOCKETTYPE c, char *param, bool isjson, __maybe_unused char group);
 
 #endif // CONFIG_PARSER_H
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "compat.h"
+#include "miner.h"
+#include "config_parser.h"
+#include "driver-cpu.h"
+#include "findnonce.h"
+#include "util.h"
+#include "affinity.h"
+
+/* Number of CPU mining devices, one worker thread each; 0 disables the driver */
+int opt_cpu_threads = 0;
+
+/* Per-core counters, kept in cgpu->device_data */
+struct cpu_device_data {
+  uint64_t hashes;   /* Nonces hashed since start or the last zero stats */
+  uint64_t found;    /* Nonces that met the device target */
+};
+
+static struct cgpu_info *cpus;
+
+static void cpu_detect(void)
+{
+  int i;
+
+  if (opt_cpu_threads <= 0)
+    return;
+
+  cpus = (struct cgpu_info *)calloc(opt_cpu_threads, sizeof(struct cgpu_info));
+  if (unlikely(!cpus))
+    quit(1, "Failed to calloc cpus");
+
+  applog(LOG_INFO, "CPU: %d worker threads on %d online cores", opt_cpu_threads, affinity_online_cpus());
+
+  cpu_drv.max_diff = 65536;
+
+  for (i = 0; i < opt_cpu_threads; ++i) {
+    struct cgpu_info *cgpu = &cpus[i];
+    struct cpu_device_data *data;
+
+    data = (struct cpu_device_data *)calloc(1, sizeof(struct cpu_device_data));
+    if (unlikely(!data))
+      quit(1, "Failed to calloc cpu device data");
+
+    cgpu->drv = &cpu_drv;
+    cgpu->deven = DEV_ENABLED;
+    cgpu->thr = NULL;
+    cgpu->threads = 1;
+    cgpu->device_data = data;
+    cgpu->algorithm = default_profile.algorithm;
+    add_cgpu(cgpu);
+  }
+}
+
+static void get_cpu_statline_before(char *buf, size_t bufsiz, struct cgpu_info *cgpu)
+{
+  char core[32];
+
+  affinity_describe(AFFINITY_MINER, cgpu, core, sizeof(core));
+  tailsprintf(buf, bufsiz, "cpu %-10.10s | ", core);
+}
+
+static struct api_data *get_cpu_api_stats(struct cgpu_info *cgpu)
+{
+  struct cpu_device_data *data = (struct cpu_device_data *)cgpu->device_data;
+  struct api_data *root = NULL;
+  char core[32];
+
+  affinity_describe(AFFINITY_MINER, cgpu, core, sizeof(core));
+  root = api_add_string(root, "Core", core, true);
+  root = api_add_uint64(root, "Hashes", &data->hashes, false);
+  root = api_add_uint64(root, "Target Hits", &data->found, false);
+  root = api_add_string(root, "Algorithm", cgpu->algorithm.name, false);
+
+  return root;
+}
+
+/* Start with a small range; hash_sole_work scales it to the observed rate */
+static uint64_t cpu_can_limit_work(struct thr_info __maybe_unused *thr)
+{
+  return 0xffff;
+}
+
+static int64_t cpu_scanhash(struct thr_info *thr, struct work *work, int64_t max_nonce)
+{
+  struct cpu_device_data *data = (struct cpu_device_data *)thr->cgpu->device_data;
+  void (*regenhash)(struct work *) = work->pool->algorithm.regenhash;
+  uint32_t *work_nonce = (uint32_t *)(work->data + 64 + 12);
+  const uint32_t *hash_32 = (const uint32_t *)(work->hash + 28);
+  const uint32_t target = le32toh(((const uint32_t *)work->device_target)[7]);
+  const uint32_t first = work->blk.nonce;
+  uint32_t last, nonce = first;
+  int64_t hashes;
+
+  /* Keep blk.nonce from wrapping so abandon_work sees the range run out */
+  if (max_nonce > (int64_t)MAXTHREADS - 1)
+    last = MAXTHREADS - 1;
+  else
+    last = (uint32_t)max_nonce;
+  if (unlikely(last < first))
+    last = first;
+
+  while (42) {
+    *work_nonce = htole32(nonce);
+    regenhash(work);
+
+    /* Only the top word decides most nonces; fall through to the full
+     * comparison in the rare case it is at or under the target */
+    if (unlikely(le32toh(*hash_32) <= target) &&
+        fulltest(work->hash, work->device_target)) {
+      data->found++;
+      submit_tested_work(thr, work);
+    }
+
+    if (unlikely(nonce == last || thr->work_restart))
+      break;
+    nonce++;
+  }
+
+  hashes = (int64_t)(nonce - first) + 1;
+  data->hashes += hashes;
+  work->blk.nonce = nonce + 1;
+
+  return hashes;
+}
+
+static void cpu_zero_stats(struct cgpu_info *cgpu)
+{
+  struct cpu_device_data *data = (struct cpu_device_data *)cgpu->device_data;
+
+  data->hashes = 0;
+  data->found = 0;
+}
+
+struct device_drv cpu_drv = {
+  /*.drv_id = */      DRIVER_cpu,
+  /*.dname = */     "cpu",
+  /*.name = */      "CPU",
+  /*.drv_detect = */    cpu_detect,
+  /*.reinit_device = */   NULL,
+  /*.get_statline_before = */ get_cpu_statline_before,
+  /*.get_statline = */    NULL,
+  /*.api_data = */    get_cpu_api_stats,
+  /*.get_stats = */   NULL,
+  /*.identify_device = */   NULL,
+  /*.set_device = */    NULL,
+
+  /*.thread_prepare = */    NULL,
+  /*.can_limit_work = */    cpu_can_limit_work,
+  /*.thread_init = */   NULL,
+  /*.prepare_work = */    NULL,
+  /*.hash_work = */   NULL,
+  /*.scanhash = */    cpu_scanhash,
+  /*.scanwork = */    NULL,
+  /*.queue_full = */    NULL,
+  /*.flush_work = */    NULL,
+  /*.update_work = */   NULL,
+  /*.hw_error = */    NULL,
+  /*.thread_shutdown = */   NULL,
+  /*.thread_enable =*/    NULL,
+  /*.zero_stats = */    cpu_zero_stats,
+          false,
+          0,
+          0
+};
@@ -0,0 +1,10 @@
+#ifndef DEVICE_CPU_H
+#define DEVICE_CPU_H
+
+#include "miner.h"
+
+extern int opt_cpu_threads;
+
+extern struct device_drv cpu_drv;
+
+#endif /* DEVICE_CPU_H */
@@ -32,7 +32,14 @@
 #include "driver-opencl.h"
 #include "findnonce.h"
 #include "ocl.h"
+#include "ocl/kernel_profile.h"
+#include "ocl/kernel_variant.h"
+#include "ocl/gpu_nonce2.h"
+#include "bench_block.h"
+#include "trace.h"
 #include "adl.h"
+#include "sensors.h"
+#include "reconfig.h"
 #include "util.h"
 
 /* TODO: cleanup externals ********************/
@@ -56,12 +63,6 @@ extern void decay_time(double *f, double fadd);
 
 /**********************************************/
 
-#ifdef HAVE_ADL
-extern float gpu_temp(int gpu);
-extern int gpu_fanspeed(int gpu);
-extern int gpu_fanpercent(int gpu);
-#endif
-
 char *set_vector(char *arg)
 {
   int i, val = 0, device = 0;
@@ -197,6 +198,33 @@ char *set_thread_concurrency(const char *_arg)
   return NULL;
 }
 
+char *set_kernel_variant(const char *_arg)
+{
+  int i, device = 0;
+  char *nextptr, *err;
+  char *arg = (char *)alloca(strlen(_arg) + 1);
+  strcpy(arg, _arg);
+
+  nextptr = strtok(arg, ",");
+  if (nextptr == NULL)
+    return "Invalid parameters for set kernel variant";
+
+  do {
+    if (device >= MAX_GPUDEVICES)
+      return "Too many values passed to set kernel variant";
+    err = kernel_variant_parse(nextptr, &gpus[device++].kernel_variant);
+    if (err)
+      return err;
+  } while ((nextptr = strtok(NULL, ",")) != NULL);
+
+  if (device == 1) {
+    for (i = device; i < MAX_GPUDEVICES; i++)
+      gpus[i].kernel_variant = gpus[0].kernel_variant;
+  }
+
+  return NULL;
+}
+
 #ifdef HAVE_ADL
 /* This function allows us to map an adl device to an opencl device for when
  * simple enumeration has failed to match them. */
@@ -736,40 +764,37 @@ retry: // TODO: refactor
       gpu, displayed_rolling, displayed_total, mhash_base ? "M" : "K",
       cgpu->accepted, cgpu->rejected, cgpu->hw_errors,
       cgpu->utility, cgpu->intensity, cgpu->xintensity, cgpu->rawintensity);
-#ifdef HAVE_ADL
-    if (gpus[gpu].has_adl) {
-      int engineclock = 0, memclock = 0, activity = 0, fanspeed = 0, fanpercent = 0, powertune = 0;
-      float temp = 0, vddc = 0;
+    if (gpu_sensors_available(gpu)) {
+      struct gpu_sensors sensors;
 
-      if (gpu_stats(gpu, &temp, &engineclock, &memclock, &vddc, &activity, &fanspeed, &fanpercent, &powertune)) {
+      if (gpu_sensors_get(gpu, &sensors)) {
         char logline[255];
 
         strcpy(logline, ""); // In case it has no data
-        if (temp != -1)
-          sprintf(logline, "%.1f C  ", temp);
-        if (fanspeed != -1 || fanpercent != -1) {
+        if (sensors.temp != -1)
+          sprintf(logline, "%.1f C  ", sensors.temp);
+        if (sensors.fanspeed != -1 || sensors.fanpercent != -1) {
           tailsprintf(logline, sizeof(logline), "F: ");
-          if (fanpercent != -1)
-            tailsprintf(logline, sizeof(logline), "%d%% ", fanpercent);
-          if (fanspeed != -1)
-            tailsprintf(logline, sizeof(logline), "(%d RPM) ", fanspeed);
+          if (sensors.fanpercent != -1)
+            tailsprintf(logline, sizeof(logline), "%d%% ", sensors.fanpercent);
+          if (sensors.fanspeed != -1)
+            tailsprintf(logline, sizeof(logline), "(%d RPM) ", sensors.fanspeed);
           tailsprintf(logline, sizeof(logline), " ");
         }
-        if (engineclock != -1)
-          tailsprintf(logline, sizeof(logline), "E: %d MHz  ", engineclock);
-        if (memclock != -1)
-          tailsprintf(logline, sizeof(logline), "M: %d Mhz  ", memclock);
-        if (vddc != -1)
-          tailsprintf(logline, sizeof(logline), "V: %.3fV  ", vddc);
-        if (activity != -1)
-          tailsprintf(logline, sizeof(logline), "A: %d%%  ", activity);
-        if (powertune != -1)
-          tailsprintf(logline, sizeof(logline), "P: %d%%", powertune);
+        if (sensors.engineclock != -1)
+          tailsprintf(logline, sizeof(logline), "E: %d MHz  ", sensors.engineclock);
+        if (sensors.memclock != -1)
+          tailsprintf(logline, sizeof(logline), "M: %d Mhz  ", sensors.memclock);
+        if (sensors.vddc != -1)
+          tailsprintf(logline, sizeof(logline), "V: %.3fV  ", sensors.vddc);
+        if (sensors.activity != -1)
+          tailsprintf(logline, sizeof(logline), "A: %d%%  ", sensors.activity);
+        if (sensors.powertune != -1)
+          tailsprintf(logline, sizeof(logline), "P: %d%%", sensors.powertune);
         tailsprintf(logline, sizeof(logline), "\n");
         _wlog(logline);
       }
     }
-#endif
     wlog("Last initialised: %s\n", cgpu->init);
 
     rd_lock(&mining_thr_lock);
@@ -1173,27 +1198,29 @@ static void opencl_detect(void)
 
 static void reinit_opencl_device(struct cgpu_info *gpu)
 {
-  tq_push(control_thr[gpur_thr_id].q, gpu);
+  if (unlikely(!tq_push(control_thr[gpur_thr_id].q, gpu)))
+    applog(LOG_WARNING, "Failed to queue restart of %s %d", gpu->drv->name, gpu->device_id);
 }
 
 #ifdef HAVE_ADL
 static void get_opencl_statline_before(char *buf, size_t bufsiz, struct cgpu_info *gpu)
 {
-  if (gpu->has_adl) {
-    int gpuid = gpu->device_id;
-    float gt = gpu_temp(gpuid);
-    int gf = gpu_fanspeed(gpuid);
-    int gp;
-
-    if (gt != -1)
-      tailsprintf(buf, bufsiz, "%5.1fC ", gt);
+  if (gpu_sensors_available(gpu->device_id)) {
+    struct gpu_sensors sensors;
+
+    /* Not sampled yet shows as no readings */
+    if (!gpu_sensors_get(gpu->device_id, &sensors))
+      sensors.temp = sensors.fanspeed = sensors.fanpercent = -1;
+
+    if (sensors.temp != -1)
+      tailsprintf(buf, bufsiz, "%5.1fC ", sensors.temp);
     else
       tailsprintf(buf, bufsiz, "       ");
-    if (gf != -1)
+    if (sensors.fanspeed != -1)
       // show invalid as 9999
-      tailsprintf(buf, bufsiz, "%4dRPM ", gf > 9999 ? 9999 : gf);
-    else if ((gp = gpu_fanpercent(gpuid)) != -1)
-      tailsprintf(buf, bufsiz, "%3d%%    ", gp);
+      tailsprintf(buf, bufsiz, "%4dRPM ", sensors.fanspeed > 9999 ? 9999 : sensors.fanspeed);
+    else if (sensors.fanpercent != -1)
+      tailsprintf(buf, bufsiz, "%3d%%    ", sensors.fanpercent);
     else
       tailsprintf(buf, bufsiz, "        ");
     tailsprintf(buf, bufsiz, "| ");
@@ -1215,10 +1242,256 @@ static void get_opencl_statline(char *buf, size_t bufsiz, struct cgpu_info *gpu)
 struct opencl_thread_data {
   cl_int (*queue_kernel_parameters)(_clState *, dev_blk_ctx *, cl_uint);
   uint32_t *res;
+
+  /* Settings the kernel in clStates was built with, and the reconfig_gen
+   * of the device they are up to date with */
+  struct device_settings settings;
+  unsigned int reconfig_gen;
+
+  /* Kernel for the next adaptive N-factor or for new settings of the
+   * device, built in the background */
+  pthread_mutex_t next_lock;
+  pthread_t next_pth;
+  bool next_started;
+  bool next_building;
+  uint8_t next_nfactor;
+  struct device_settings next_settings;
+  _clState *next_clState;
+  struct cgpu_info next_plan;
+
+  /* --kernel-profile events of the last pass over the kernel chain */
+  cl_event profile_events[KERNEL_PROFILE_MAX_STAGES];
+
+  /* --gpu-nonce2 work whose headers are on the device, and the index in
+   * its nonce2 range of the header being searched */
+  int n2_work_id;
+  bool n2_ready;
+  unsigned int n2_index;
+  /* Position of the next multi-header launch, header index in the high
+   * word and nonce in the low */
+  uint64_t n2_pos;
 };
 
 static uint32_t *blank_res;
 
+/* Only one kernel is built in the background at a time, so that threads
+ * sharing a GPU load the saved binary rather than compiling it again */
+static pthread_mutex_t precompile_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* How far ahead of an N-factor change its kernel gets built */
+#define NFACTOR_PRECOMPILE_WINDOW 3600
+
+/* Threads of each timed pass and passes per candidate kernel variant */
+#define VARIANT_SELECT_THREADS (1 << 18)
+#define VARIANT_SELECT_PASSES 8
+
+/* Runs the kernel chain over the benchmark block and adds up the time of
+ * the stages param changes in ns, false when the chain failed to run */
+static bool opencl_time_variant(_clState *clState, struct cgpu_info *cgpu, struct work *work,
+                                enum kernel_variant_param param, uint64_t *ns)
+{
+  size_t globalThreads[1] = { VARIANT_SELECT_THREADS };
+  size_t localThreads[1] = { clState->wsize };
+  cl_event events[KERNEL_PROFILE_MAX_STAGES];
+  unsigned int n_stages = MIN(clState->n_extra_kernels + 1, KERNEL_PROFILE_MAX_STAGES);
+  unsigned int pass, i;
+  uint64_t total = 0;
+  cl_int status;
+
+  status = cgpu->algorithm.queue_kernel(clState, &work->blk, globalThreads[0]);
+  if (unlikely(status != CL_SUCCESS)) {
+    applog(LOG_ERR, "Error: clSetKernelArg of all params failed.");
+    return false;
+  }
+
+  for (pass = 0; pass <= VARIANT_SELECT_PASSES; pass++) {
+    for (i = 0; i < n_stages; i++) {
+      status = clEnqueueNDRangeKernel(clState->commandQueue, i ? clState->extra_kernels[i - 1] : clState->kernel,
+                                      1, NULL, globalThreads, localThreads, 0, NULL, &events[i]);
+      if (unlikely(status != CL_SUCCESS)) {
+        applog(LOG_ERR, "Error %d: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)", status);
+        clFinish(clState->commandQueue);
+        while (i--)
+          clReleaseEvent(events[i]);
+        return false;
+      }
+    }
+    clFinish(clState->commandQueue);
+
+    for (i = 0; i < n_stages; i++) {
+      cl_ulong start, end;
+
+      /* The first pass only warms up */
+      if (pass && kernel_variant_affects(param, clState->chain[i].hashes) &&
+          clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_START, sizeof(start), &start, NULL) == CL_SUCCESS &&
+          clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_END, sizeof(end), &end, NULL) == CL_SUCCESS &&
+          end >= start)
+        total += end - start;
+      clReleaseEvent(events[i]);
+    }
+  }
+
+  *ns = total;
+  return true;
+}
+
+/* Builds the chain with variant and times the stages param changes, false
+ * when it failed to build or run */
+static bool opencl_try_variant(struct cgpu_info *cgpu, struct work *work, const struct kernel_variant *variant,
+                               enum kernel_variant_param param, char *name, size_t nameSize, uint64_t *ns)
+{
+  struct cgpu_info *trial;
+  _clState *clState;
+  bool ret = false;
+
+  /* Plans on a copy, like the background N-factor builds */
+  trial = (struct cgpu_info *)malloc(sizeof(struct cgpu_info));
+  if (unlikely(!trial))
+    quit(1, "Failed to malloc trial in opencl_try_variant");
+  memcpy(trial, cgpu, sizeof(struct cgpu_info));
+  trial->kernel_variant = *variant;
+
+  clState = profileCl(trial, cgpu->virtual_gpu, name, nameSize, &cgpu->algorithm);
+  if (clState) {
+    ret = opencl_time_variant(clState, trial, work, param, ns);
+    release_cl_state(clState);
+  }
+  free(trial);
+
+  return ret;
+}
+
+/* Picks the kernel variant of a split chain for the device. The parameters
+ * not given a value are benchmarked on the stages running the hash function
+ * they change, every combination of those changing the same hash function
+ * together. The winner is remembered per algorithm and device name */
+static void opencl_select_variant(struct thr_info *thr)
+{
+  static const unsigned char bench_block[] = { SGMINER_BENCHMARK_BLOCK };
+  struct cgpu_info *cgpu = thr->cgpu;
+  struct kernel_variant pinned = cgpu->kernel_variant;
+  struct kernel_variant best, remembered;
+  bool grouped[KERNEL_VARIANT_PARAMS] = { false };
+  const algorithm_stage_t *stage;
+  char name[256], spec[128];
+  struct work *work;
+  uint64_t ns;
+  int p, q;
+
+  /* Once per device, whatever the outcome */
+  cgpu->kernel_variant.autoselect = false;
+  pinned.autoselect = false;
+
+  if (!cgpu->algorithm.chain) {
+    applog(LOG_NOTICE, "GPU %d: kernel variant selection needs a split kernel chain, %s is built as given",
+           cgpu->device_id, cgpu->algorithm.name);
+    return;
+  }
+
+  work = (struct work *)calloc(1, sizeof(struct work));
+  if (unlikely(!work))
+    quit(1, "Failed to calloc work in opencl_select_variant");
+  memcpy(work->data, bench_block, sizeof(work->data));
+  work->blk.work = work;
+
+  /* The baseline build also gives the device name, its timing is unused */
+  strcpy(name, "");
+  best = pinned;
+  if (!opencl_try_variant(cgpu, work, &best, KERNEL_VARIANT_GROESTL_SMALL, name, sizeof(name), &ns)) {
+    applog(LOG_WARNING, "GPU %d: failed to benchmark kernel variants, using the given one", cgpu->device_id);
+    goto out;
+  }
+
+  if (kernel_variant_load(cgpu->algorithm.name, name, &remembered)) {
+    /* Values given on the command line win over remembered ones */
+    for (p = 0; p < KERNEL_VARIANT_PARAMS; p++) {
+      if (!(pinned.set & (1 << p)) && (remembered.set & (1 << p))) {
+        best.set |= 1 << p;
+        best.value[p] = remembered.value[p];
+      }
+    }
+    kernel_variant_str(&best, spec, sizeof(spec));
+    applog(LOG_NOTICE, "GPU %d: using kernel variant %s remembered for %s", cgpu->device_id, spec, name);
+    cgpu->kernel_variant = best;
+    goto out;
+  }
+
+  applog(LOG_NOTICE, "GPU %d: benchmarking kernel variants of %s, this takes a few builds",
+         cgpu->device_id, cgpu->algorithm.name);
+
+  for (p = 0; p < KERNEL_VARIANT_PARAMS; p++) {
+    enum kernel_variant_param group[KERNEL_VARIANT_PARAMS];
+    struct kernel_variant group_best = best;
+    uint64_t best_ns = 0;
+    bool have_best = false;
+    int n_group = 0, n_combos = 1, combo;
+
+    if (grouped[p])
+      continue;
+    for (q = p; q < KERNEL_VARIANT_PARAMS; q++) {
+      if (grouped[q] || !kernel_variant_same_hash(p, q))
+        continue;
+      grouped[q] = true;
+      if (!(pinned.set & (1 << q)))
+        group[n_group++] = q;
+    }
+    if (!n_group)
+      continue;
+
+    for (stage = cgpu->algorithm.chain; stage->hashes; stage++) {
+      if (kernel_variant_affects(p, stage->hashes))
+        break;
+    }
+    if (!stage->hashes)
+      continue;
+
+    for (q = 0; q < n_group; q++) {
+      const int *values;
+
+      n_combos *= kernel_variant_values(group[q], &values);
+    }
+
+    for (combo = 0; combo < n_combos; combo++) {
+      struct kernel_variant candidate = best;
+      int digits = combo;
+      bool ok;
+
+      for (q = 0; q < n_group; q++) {
+        const int *values;
+        int n_values = kernel_variant_values(group[q], &values);
+
+        candidate.set |= 1 << group[q];
+        candidate.value[group[q]] = values[digits % n_values];
+        digits /= n_values;
+      }
+
+      ok = opencl_try_variant(cgpu, work, &candidate, p, name, sizeof(name), &ns);
+      kernel_variant_str(&candidate, spec, sizeof(spec));
+      /* A variant that fails to build or run is passed over */
+      if (!ok) {
+        applog(LOG_INFO, "GPU %d: kernel variant %s failed", cgpu->device_id, spec);
+        continue;
+      }
+      applog(LOG_INFO, "GPU %d: kernel variant %s: %.3f ms on %s", cgpu->device_id, spec,
+             ns / 1e6 / VARIANT_SELECT_PASSES, stage->hashes);
+      if (!have_best || ns < best_ns) {
+        have_best = true;
+        best_ns = ns;
+        group_best = candidate;
+      }
+    }
+    best = group_best;
+  }
+
+  kernel_variant_str(&best, spec, sizeof(spec));
+  applog(LOG_NOTICE, "GPU %d: picked kernel variant %s for %s", cgpu->device_id, spec, name);
+  kernel_variant_save(cgpu->algorithm.name, name, &best);
+  cgpu->kernel_variant = best;
+
+out:
+  free(work);
+}
+
 static bool opencl_thread_prepare(struct thr_info *thr)
 {
   char name[256];
@@ -1240,7 +1513,17 @@ static bool opencl_thread_prepare(struct thr_info *thr)
   strcpy(name, "");
   applog(LOG_INFO, "Init GPU thread %i GPU %i virtual GPU %i", i, gpu, virtual_gpu);
 
-  clStates[i] = initCl(virtual_gpu, name, sizeof(name), &cgpu->algorithm);
+  if (cgpu->kernel_variant.autoselect)
+    opencl_select_variant(thr);
+
+  if (cgpu->algorithm.nfactor_start) {
+    /* Start out with the N-factor in effect right now */
+    algorithm_t algorithm = cgpu->algorithm;
+
+    set_algorithm_nfactor(&algorithm, get_algorithm_nfactor(&algorithm, (uint32_t)time(NULL)));
+    clStates[i] = initCl(virtual_gpu, name, sizeof(name), &algorithm);
+  } else
+    clStates[i] = initCl(virtual_gpu, name, sizeof(name), &cgpu->algorithm);
   if (!clStates[i]) {
 #ifdef HAVE_CURSES
     if (use_curses)
@@ -1293,8 +1576,15 @@ static bool opencl_thread_init(struct thr_info *thr)
     return false;
   }
 
-  thrdata->queue_kernel_parameters = gpu->algorithm.queue_kernel;
+  mutex_lock(&reconfig_lock);
+  thrdata->reconfig_gen = gpu->reconfig_gen;
+  get_device_settings(gpu, &thrdata->settings);
+  mutex_unlock(&reconfig_lock);
+
+  thrdata->queue_kernel_parameters = thrdata->settings.algorithm.queue_kernel;
   thrdata->res = (uint32_t *)calloc(buffersize, 1);
+  mutex_init(&thrdata->next_lock);
+  thrdata->n2_work_id = -1;
 
   if (!thrdata->res) {
     free(thrdata);
@@ -1318,15 +1608,331 @@ static bool opencl_thread_init(struct thr_info *thr)
   return true;
 }
 
+static void *opencl_precompile_thread(void *userdata)
+{
+  struct thr_info *thr = (struct thr_info *)userdata;
+  struct opencl_thread_data *thrdata = (struct opencl_thread_data *)thr->cgpu_data;
+  struct cgpu_info *cgpu = thr->cgpu;
+  struct cgpu_info *plan;
+  algorithm_t algorithm;
+  _clState *clState;
+  char name[256];
+
+  RenameThread("OCLPrecompile");
+
+  /* Plan thread concurrency and lookup gap on a copy so the device keeps
+   * its current settings until the new kernel is swapped in */
+  plan = (struct cgpu_info *)malloc(sizeof(struct cgpu_info));
+  if (unlikely(!plan)) {
+    applog(LOG_ERR, "Failed to malloc in opencl_precompile_thread");
+    clState = NULL;
+    goto out;
+  }
+  memcpy(plan, cgpu, sizeof(struct cgpu_info));
+
+  mutex_lock(&thrdata->next_lock);
+  plan->algorithm = thrdata->next_settings.algorithm;
+  plan->work_size = thrdata->next_settings.work_size;
+  plan->opt_lg = thrdata->next_settings.opt_lg;
+  plan->opt_tc = thrdata->next_settings.opt_tc;
+  plan->shaders = thrdata->next_settings.shaders;
+  algorithm = plan->algorithm;
+  if (algorithm.nfactor_start)
+    set_algorithm_nfactor(&algorithm, thrdata->next_nfactor);
+  mutex_unlock(&thrdata->next_lock);
+
+  applog(LOG_INFO, "GPU thread %d: preparing kernel %s for N-factor %d", thr->id, algorithm.name, algorithm.nfactor);
+
+  strcpy(name, "");
+  mutex_lock(&precompile_lock);
+  clState = prepareCl(plan, cgpu->virtual_gpu, name, sizeof(name), &algorithm);
+  mutex_unlock(&precompile_lock);
+
+  /* A buffer of fixed size is allocated here too, leaving the swap nothing
+   * to do. One sized from thread concurrency waits for the old one to be
+   * freed */
+  if (clState && algorithm.rw_buffer_size >= 0 && !alloc_cl_padbuffer(clState, plan, cgpu->virtual_gpu)) {
+    release_cl_state(clState);
+    clState = NULL;
+  }
+
+  if (!clState)
+    applog(LOG_WARNING, "GPU thread %d: failed to prepare kernel %s for N-factor %d, will build it on switch",
+           thr->id, algorithm.name, algorithm.nfactor);
+
+out:
+  mutex_lock(&thrdata->next_lock);
+  thrdata->next_clState = clState;
+  if (clState)
+    memcpy(&thrdata->next_plan, plan, sizeof(struct cgpu_info));
+  thrdata->next_building = false;
+  mutex_unlock(&thrdata->next_lock);
+
+  free(plan);
+  return NULL;
+}
+
+/* Waits for a background build, if any, and drops what it produced */
+static void opencl_precompile_join(struct opencl_thread_data *thrdata)
+{
+  if (thrdata->next_started) {
+    pthread_join(thrdata->next_pth, NULL);
+    thrdata->next_started = false;
+  }
+  if (thrdata->next_clState) {
+    release_cl_state(thrdata->next_clState);
+    thrdata->next_clState = NULL;
+  }
+}
+
+/* Whether the background build is for settings and nfactor */
+static bool opencl_precompile_match(struct opencl_thread_data *thrdata, const struct device_settings *settings,
+                                    uint8_t nfactor)
+{
+  return thrdata->next_nfactor == nfactor &&
+         diff_device_settings(&thrdata->next_settings, settings) < RECONFIG_REBUILD;
+}
+
+/* Whether the background build is over, whatever it produced */
+static bool opencl_precompile_done(struct opencl_thread_data *thrdata)
+{
+  bool done;
+
+  mutex_lock(&thrdata->next_lock);
+  done = thrdata->next_started && !thrdata->next_building;
+  mutex_unlock(&thrdata->next_lock);
+
+  return done;
+}
+
+static void opencl_precompile_start(struct thr_info *thr, const struct device_settings *settings, uint8_t nfactor)
+{
+  struct opencl_thread_data *thrdata = (struct opencl_thread_data *)thr->cgpu_data;
+
+  mutex_lock(&thrdata->next_lock);
+  if (thrdata->next_building || (thrdata->next_started && opencl_precompile_match(thrdata, settings, nfactor))) {
+    mutex_unlock(&thrdata->next_lock);
+    return;
+  }
+  mutex_unlock(&thrdata->next_lock);
+
+  /* A previous build for something else is finished, discard it */
+  opencl_precompile_join(thrdata);
+
+  thrdata->next_nfactor = nfactor;
+  thrdata->next_settings = *settings;
+  thrdata->next_building = true;
+  if (unlikely(pthread_create(&thrdata->next_pth, NULL, opencl_precompile_thread, (void *)thr))) {
+    applog(LOG_ERR, "Failed to create opencl_precompile_thread");
+    thrdata->next_building = false;
+    return;
+  }
+  thrdata->next_started = true;
+}
+
+/* Swaps in the kernel for settings and nfactor, using the one built in the
+ * background when it is ready and building it here otherwise */
+static bool opencl_switch_kernel(struct thr_info *thr, const struct device_settings *settings, uint8_t nfactor)
+{
+  struct opencl_thread_data *thrdata = (struct opencl_thread_data *)thr->cgpu_data;
+  struct cgpu_info *cgpu = thr->cgpu;
+  _clState *clState = NULL;
+  char name[256];
+  cl_int status;
+
+  /* A build that is nearly done still beats starting from scratch */
+  if (thrdata->next_started) {
+    pthread_join(thrdata->next_pth, NULL);
+    thrdata->next_started = false;
+  }
+  if (thrdata->next_clState && opencl_precompile_match(thrdata, settings, nfactor)) {
+    clState = thrdata->next_clState;
+    thrdata->next_clState = NULL;
+  } else
+    opencl_precompile_join(thrdata);
+
+  applog(LOG_NOTICE, "GPU thread %d: switching to %s N-factor %d%s", thr->id, settings->algorithm.name, nfactor,
+         clState ? " (prepared)" : "");
+
+  /* Free the old padbuffer before the new one is allocated */
+  release_cl_state(clStates[thr->id]);
+  clStates[thr->id] = NULL;
+
+  if (clState) {
+    cgpu->thread_concurrency = thrdata->next_plan.thread_concurrency;
+    cgpu->lookup_gap = thrdata->next_plan.lookup_gap;
+    if (!clState->padbuffer8 && !alloc_cl_padbuffer(clState, cgpu, cgpu->virtual_gpu)) {
+      release_cl_state(clState);
+      clState = NULL;
+    }
+  }
+
+  if (!clState) {
+    algorithm_t algorithm = settings->algorithm;
+
+    if (algorithm.nfactor_start)
+      set_algorithm_nfactor(&algorithm, nfactor);
+    strcpy(name, "");
+    clState = initCl(cgpu->virtual_gpu, name, sizeof(name), &algorithm);
+    if (!clState) {
+      applog(LOG_ERR, "GPU thread %d: failed to build kernel %s for N-factor %d", thr->id, algorithm.name, nfactor);
+      return false;
+    }
+  }
+
+  status = clEnqueueWriteBuffer(clState->commandQueue, clState->outputBuffer, CL_TRUE, 0,
+               BUFFERSIZE, blank_res, 0, NULL, NULL);
+  if (unlikely(status != CL_SUCCESS)) {
+    applog(LOG_ERR, "Error: clEnqueueWriteBuffer failed.");
+    release_cl_state(clState);
+    return false;
+  }
+
+  clStates[thr->id] = clState;
+  thrdata->settings = *settings;
+  thrdata->queue_kernel_parameters = settings->algorithm.queue_kernel;
+  /* The headers of the nonce2 range were on the old device buffers */
+  thrdata->n2_work_id = -1;
+  return true;
+}
+
+/* Catches up with the settings reconfigure_devices() gave the device.
+ * Intensity takes effect right away. A kernel built with other settings is
+ * rebuilt in the background while the old one keeps hashing the work it
+ * can, and swapped in between two rounds once ready */
+static bool opencl_reconfigure(struct thr_info *thr, struct work *work)
+{
+  struct opencl_thread_data *thrdata = (struct opencl_thread_data *)thr->cgpu_data;
+  struct cgpu_info *cgpu = thr->cgpu;
+  struct device_settings settings;
+  enum reconfig_level level;
+  unsigned int gen;
+  uint8_t nfactor;
+
+  mutex_lock(&reconfig_lock);
+  gen = cgpu->reconfig_gen;
+  get_device_settings(cgpu, &settings);
+  mutex_unlock(&reconfig_lock);
+
+  level = diff_device_settings(&thrdata->settings, &settings);
+  if (level >= RECONFIG_REBUILD) {
+    nfactor = settings.algorithm.nfactor;
+    if (settings.algorithm.nfactor_start)
+      nfactor = get_algorithm_nfactor(&settings.algorithm, be32toh(*(uint32_t *)(work->data + 68)));
+
+    /* Work for the algorithm of the old kernel does not wait for the new */
+    if (cmp_algorithm(&work->pool->algorithm, &thrdata->settings.algorithm)) {
+      opencl_precompile_start(thr, &settings, nfactor);
+      if (thrdata->next_started && !opencl_precompile_done(thrdata))
+        return true;
+    }
+
+    if (!opencl_switch_kernel(thr, &settings, nfactor))
+      return false;
+  }
+
+  applog(LOG_INFO, "GPU thread %d: new settings applied, %s", thr->id, reconfig_level_str(level));
+  thrdata->settings = settings;
+  thrdata->reconfig_gen = gen;
+  return true;
+}
+
 static bool opencl_prepare_work(struct thr_info __maybe_unused *thr, struct work *work)
 {
+  struct opencl_thread_data *thrdata = (struct opencl_thread_data *)thr->cgpu_data;
+
   work->blk.work = work;
   thr->pool_no = work->pool->pool_no;
+
+  if (thrdata->reconfig_gen != thr->cgpu->reconfig_gen && !opencl_reconfigure(thr, work))
+    return false;
+
+  /* A failed kernel switch leaves the thread without a kernel */
+  if (unlikely(!clStates[thr->id])) {
+    applog(LOG_ERR, "GPU thread %d: no kernel to run", thr->id);
+    return false;
+  }
+
+  if (work->pool->algorithm.nfactor_start) {
+    uint32_t ntime = be32toh(*(uint32_t *)(work->data + 68));
+    uint8_t nfactor = get_algorithm_nfactor(&work->pool->algorithm, ntime);
+    uint8_t upcoming;
+
+    if (nfactor != clStates[thr->id]->nfactor && !opencl_switch_kernel(thr, &thrdata->settings, nfactor))
+      return false;
+
+    upcoming = get_algorithm_nfactor(&work->pool->algorithm, ntime + NFACTOR_PRECOMPILE_WINDOW);
+    if (upcoming != nfactor)
+      opencl_precompile_start(thr, &thrdata->settings, upcoming);
+  }
+
   return true;
 }
 
 extern int opt_dynamic_interval;
 
+/* Hands res to postcalc_hash_async as the results of the header of nonce2
+ * index of the range of work */
+static void postcalc_nonce2(struct thr_info *thr, struct work *work, uint32_t *res, unsigned int index)
+{
+  struct work *n2_work;
+
+  if (!index) {
+    postcalc_hash_async(thr, work, res);
+    return;
+  }
+
+  n2_work = copy_work(work);
+  work_set_nonce2(n2_work, work->nonce2 + index);
+  postcalc_hash_async(thr, n2_work, res);
+  free_work(n2_work);
+}
+
+/* Splits the results of a multi-header launch, a nonce and header index
+ * pair each, into one batch per header */
+static void postcalc_multi_header(struct thr_info *thr, struct work *work, uint32_t *res, int found)
+{
+  uint32_t *batch = (uint32_t *)alloca(BUFFERSIZE);
+  uint32_t count = MIN(res[found], (uint32_t)found / 2);
+  uint32_t headers = MAX(work->nonce2_range, 1);
+  uint32_t i, j, n;
+
+  for (i = 0; i < count; i++) {
+    uint32_t index = res[i * 2 + 1];
+
+    for (j = 0; j < i && res[j * 2 + 1] != index; j++)
+      ;
+    if (j < i)
+      continue; /* Batched with the first result of its header */
+    if (unlikely(index >= headers)) {
+      applog(LOG_WARNING, "%s %d: result for header %u of %u, discarding",
+             thr->cgpu->drv->name, thr->cgpu->device_id, index, headers);
+      continue;
+    }
+
+    memset(batch, 0, BUFFERSIZE);
+    for (j = i, n = 0; j < count; j++) {
+      if (res[j * 2 + 1] == index)
+        batch[n++] = res[j * 2];
+    }
+    batch[found] = n;
+    postcalc_nonce2(thr, work, batch, index);
+  }
+}
+
+/* Drops the profile events of a pass that failed before they were recorded */
+static void release_profile_events(struct opencl_thread_data *thrdata, unsigned int n_events)
+{
+  unsigned int i;
+
+  for (i = 0; i < n_events; i++) {
+    if (thrdata->profile_events[i]) {
+      clReleaseEvent(thrdata->profile_events[i]);
+      thrdata->profile_events[i] = NULL;
+    }
+  }
+}
+
 static int64_t opencl_scanhash(struct thr_info *thr, struct work *work,
         int64_t __maybe_unused max_nonce)
 {
@@ -1341,9 +1947,13 @@ static int64_t opencl_scanhash(struct thr_info *thr, struct work *work,
   size_t localThreads[1] = { clState->wsize };
     size_t *p_global_work_offset = NULL;
   int64_t hashes;
-  int found = gpu->algorithm.found_idx;
-  int buffersize = BUFFERSIZE;
+  int found = thrdata->settings.algorithm.found_idx;
+  uint32_t slots;
     unsigned int i;
+  unsigned int n_events = 0;
+  unsigned int n2_index = 0;
+  cl_event n2_event = NULL;
+  size_t mh_offset;
 
   /* Windows' timer resolution is only 15ms so oversample 5x */
   if (gpu->dynamic && (++gpu->intervals * dynamic_us) > 70000) {
@@ -1364,7 +1974,7 @@ static int64_t opencl_scanhash(struct thr_info *thr, struct work *work,
   }
 
   set_threads_hashes(clState->vwidth, clState->compute_shaders, &hashes, globalThreads, localThreads[0],
-         &gpu->intensity, &gpu->xintensity, &gpu->rawintensity, &gpu->algorithm);
+         &gpu->intensity, &gpu->xintensity, &gpu->rawintensity, &thrdata->settings.algorithm);
   if (hashes > gpu->max_hashes)
     gpu->max_hashes = hashes;
 
@@ -1377,26 +1987,74 @@ static int64_t opencl_scanhash(struct thr_info *thr, struct work *work,
     if (clState->goffset)
         p_global_work_offset = (size_t *)&work->blk.nonce;
 
+  /* With --gpu-nonce2 the device derives the headers of the work's nonce2
+   * range once, then each launch copies the one it searches over the
+   * header queue_kernel_parameters wrote. Multi-header kernels read them
+   * all instead, one launch running on from the end of a header into the
+   * next */
+  if (work->nonce2_range > 1 && clState->n2kernel) {
+    if (thrdata->n2_work_id != work->id) {
+      thrdata->n2_work_id = work->id;
+      thrdata->n2_index = 0;
+      thrdata->n2_pos = work->blk.nonce;
+      thrdata->n2_ready = gpu_nonce2_headers(clState, work) == CL_SUCCESS;
+      if (!thrdata->n2_ready)
+        applog(LOG_WARNING, "GPU %d: failed to derive nonce2 headers, searching the first only", gpu->device_id);
+    }
+    if (clState->multi_header) {
+      if (thrdata->n2_ready) {
+        status = clSetKernelArg(clState->kernel, 0, sizeof(cl_mem), (void *)&clState->n2headerBuffer);
+        if (unlikely(status != CL_SUCCESS)) {
+          applog(LOG_ERR, "Error %d: clSetKernelArg of the nonce2 headers failed.", status);
+          return -1;
+        }
+        mh_offset = (size_t)thrdata->n2_pos;
+        p_global_work_offset = &mh_offset;
+      }
+    } else {
+      n2_index = thrdata->n2_index;
+      if (n2_index) {
+        status = gpu_nonce2_select(clState, n2_index, &n2_event);
+        if (unlikely(status != CL_SUCCESS))
+          return -1;
+      }
+    }
+  }
+
+    if (opt_kernel_profile)
+        n_events = MIN(clState->n_extra_kernels + 1, KERNEL_PROFILE_MAX_STAGES);
+
+    TRACE_BEGIN("kernel enqueue");
     status = clEnqueueNDRangeKernel(clState->commandQueue, clState->kernel, 1, p_global_work_offset,
-                    globalThreads, localThreads, 0,  NULL, NULL);
+                    globalThreads, localThreads, n2_event ? 1 : 0, n2_event ? &n2_event : NULL,
+                    n_events ? &thrdata->profile_events[0] : NULL);
+  if (n2_event)
+    clReleaseEvent(n2_event);
   if (unlikely(status != CL_SUCCESS)) {
     applog(LOG_ERR, "Error %d: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)", status);
+    TRACE_END("kernel enqueue");
     return -1;
   }
 
   for (i = 0; i < clState->n_extra_kernels; i++) {
       status = clEnqueueNDRangeKernel(clState->commandQueue, clState->extra_kernels[i], 1, p_global_work_offset,
-                      globalThreads, localThreads, 0,  NULL, NULL);
+                      globalThreads, localThreads, 0,  NULL, i + 1 < n_events ? &thrdata->profile_events[i + 1] : NULL);
       if (unlikely(status != CL_SUCCESS)) {
           applog(LOG_ERR, "Error %d: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)", status);
+          TRACE_END("kernel enqueue");
+          release_profile_events(thrdata, n_events);
           return -1;
       }
   }
+  TRACE_END("kernel enqueue");
 
-  status = clEnqueueReadBuffer(clState->commandQueue, clState->outputBuffer, CL_FALSE, 0,
-             buffersize, thrdata->res, 0, NULL, NULL);
+  /* Only fetch the found counter word here, the nonce slots are read
+   * below only when the kernel actually reported something */
+  status = clEnqueueReadBuffer(clState->commandQueue, clState->outputBuffer, CL_FALSE, found * sizeof(uint32_t),
+             sizeof(uint32_t), &thrdata->res[found], 0, NULL, NULL);
   if (unlikely(status != CL_SUCCESS)) {
     applog(LOG_ERR, "Error: clEnqueueReadBuffer failed error %d. (clEnqueueReadBuffer)", status);
+    release_profile_events(thrdata, n_events);
     return -1;
   }
 
@@ -1405,25 +2063,64 @@ static int64_t opencl_scanhash(struct thr_info *thr, struct work *work,
    * than enough to prevent repeating work */
   work->blk.nonce += gpu->max_hashes;
 
+  /* Until the last header of the range the position runs past 2^32, so
+   * hash_sole_work only sees nonces running out in the last */
+  if (p_global_work_offset == &mh_offset) {
+    uint64_t last = (uint64_t)(work->nonce2_range - 1) << 32;
+
+    thrdata->n2_pos += gpu->max_hashes;
+    work->blk.nonce = thrdata->n2_pos < last ? 0 : (uint32_t)(thrdata->n2_pos - last);
+  }
+
   /* This finish flushes the readbuffer set with CL_FALSE in clEnqueueReadBuffer */
+  TRACE_BEGIN("kernel finish");
   clFinish(clState->commandQueue);
+  TRACE_END("kernel finish");
+
+  if (n_events)
+    kernel_profile_record(gpu, thrdata->profile_events, n_events);
 
   /* found entry is used as a counter to say how many nonces exist */
   if (thrdata->res[found]) {
-    /* Clear the buffer again */
-    status = clEnqueueWriteBuffer(clState->commandQueue, clState->outputBuffer, CL_FALSE, 0,
-                buffersize, blank_res, 0, NULL, NULL);
+    /* A corrupt counter is caught in postcalc_hash, never read past it */
+    if (clState->multi_header)
+      slots = MIN(thrdata->res[found], (uint32_t)found / 2) * 2;
+    else
+      slots = thrdata->res[found] & found;
+    if (slots) {
+      status = clEnqueueReadBuffer(clState->commandQueue, clState->outputBuffer, CL_TRUE, 0,
+                 slots * sizeof(uint32_t), thrdata->res, 0, NULL, NULL);
+      if (unlikely(status != CL_SUCCESS)) {
+        applog(LOG_ERR, "Error: clEnqueueReadBuffer failed error %d. (clEnqueueReadBuffer)", status);
+        return -1;
+      }
+    }
+    /* Reset the counter only, stale slots beyond it are never read */
+    status = clEnqueueWriteBuffer(clState->commandQueue, clState->outputBuffer, CL_FALSE, found * sizeof(uint32_t),
+                sizeof(uint32_t), blank_res, 0, NULL, NULL);
     if (unlikely(status != CL_SUCCESS)) {
       applog(LOG_ERR, "Error: clEnqueueWriteBuffer failed.");
       return -1;
     }
     applog(LOG_DEBUG, "GPU %d found something?", gpu->device_id);
-    postcalc_hash_async(thr, work, thrdata->res);
-    memset(thrdata->res, 0, buffersize);
+    if (clState->multi_header)
+      postcalc_multi_header(thr, work, thrdata->res, found);
+    else
+      postcalc_nonce2(thr, work, thrdata->res, n2_index);
+    thrdata->res[found] = 0;
     /* This finish flushes the writebuffer set with CL_FALSE in clEnqueueWriteBuffer */
     clFinish(clState->commandQueue);
   }
 
+  /* Move on to the next nonce2 of the range where hash_sole_work would
+   * abandon the work for running out of nonces */
+  if (!clState->multi_header && thrdata->n2_ready && thrdata->n2_work_id == work->id &&
+      thrdata->n2_index + 1 < (unsigned int)work->nonce2_range &&
+      work->blk.nonce >= MAXTHREADS - gpu->max_hashes) {
+    thrdata->n2_index++;
+    work->blk.nonce = 0;
+  }
+
   return hashes;
 }
 
@@ -1432,31 +2129,29 @@ static int64_t opencl_scanhash(struct thr_info *thr, struct work *work,
 static void opencl_thread_shutdown(struct thr_info *thr)
 {
   const int thr_id = thr->id;
+  struct opencl_thread_data *thrdata = (struct opencl_thread_data *)thr->cgpu_data;
   _clState *clState = clStates[thr_id];
   clStates[thr_id] = NULL;
-    unsigned int i;
 
-  if (clState) {
-    clFinish(clState->commandQueue);
-    clReleaseMemObject(clState->outputBuffer);
-    clReleaseMemObject(clState->CLbuffer0);
-    if (clState->padbuffer8)
-      clReleaseMemObject(clState->padbuffer8);
-    clReleaseKernel(clState->kernel);
-        for (i = 0; i < clState->n_extra_kernels; i++)
-            clReleaseKernel(clState->extra_kernels[i]);
-    clReleaseProgram(clState->program);
-    clReleaseCommandQueue(clState->commandQueue);
-    clReleaseContext(clState->context);
-    if (clState->extra_kernels)
-      free(clState->extra_kernels);
-    free(clState);
-  }
-  free(((struct opencl_thread_data *)thr->cgpu_data)->res);
+  if (clState)
+    release_cl_state(clState);
+  opencl_precompile_join(thrdata);
+  mutex_destroy(&thrdata->next_lock);
+  free(thrdata->res);
   free(thr->cgpu_data);
   thr->cgpu_data = NULL;
 }
 
+static struct api_data *get_opencl_api_stats(struct cgpu_info *gpu)
+{
+  return kernel_profile_api_stats(gpu, NULL);
+}
+
+static void opencl_zero_stats(struct cgpu_info *gpu)
+{
+  kernel_profile_zero(gpu);
+}
+
 struct device_drv opencl_drv = {
   /*.drv_id = */      DRIVER_opencl,
   /*.dname = */     "opencl",
@@ -1469,7 +2164,7 @@ struct device_drv opencl_drv = {
           NULL,
 #endif
   /*.get_statline = */    get_opencl_statline,
-  /*.api_data = */    NULL,
+  /*.api_data = */    get_opencl_api_stats,
   /*.get_stats = */   NULL,
   /*.identify_device = */   NULL,
   /*.set_device = */    NULL,
@@ -1487,6 +2182,7 @@ struct device_drv opencl_drv = {
   /*.hw_error = */    NULL,
   /*.thread_shutdown = */   opencl_thread_shutdown,
   /*.thread_enable =*/    NULL,
+  /*.zero_stats = */    opencl_zero_stats,
           false,
           0,
           0
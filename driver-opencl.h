@@ -24,6 +24,7 @@ extern char *set_worksize(char *arg);
 extern char *set_shaders(char *arg);
 extern char *set_lookup_gap(char *arg);
 extern char *set_thread_concurrency(const char *arg);
+extern char *set_kernel_variant(const char *arg);
 void manage_gpu(void);
 extern void pause_dynamic_threads(int gpu);
 
@@ -16,6 +16,10 @@
 
 #include "findnonce.h"
 #include "algorithm/scrypt.h"
+#include "benchmark.h"
+#include "affinity.h"
+#include "trace.h"
+#include "lowmem.h"
 
 const uint32_t SHA256_K[64] = {
   0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
@@ -169,23 +173,26 @@ void precalc_hash(dev_blk_ctx *blk, uint32_t *state, uint32_t *data)
 
 #endif
 
-struct pc_data {
-  struct thr_info *thr;
-  struct work *work;
-  uint32_t res[MAXBUFFERS];
-  pthread_t pth;
-  int found;
-};
-
 static void *postcalc_hash(void *userdata)
 {
   struct pc_data *pcd = (struct pc_data *)userdata;
   struct thr_info *thr = pcd->thr;
   unsigned int entry = 0;
+  struct timeval tv_start, tv_end;
+  double cpu_start = 0;
 
   int found = thr->cgpu->algorithm.found_idx;
 
   pthread_detach(pthread_self());
+  affinity_apply(AFFINITY_VERIFY, thr->cgpu);
+  trace_thread_name("Postcalc");
+  TRACE_BEGIN("postcalc_hash");
+
+  if (opt_benchmark) {
+    cgtime(&tv_start);
+    cpu_start = benchmark_thread_cpu();
+    benchmark_stage(BENCH_DISPATCH, &pcd->tv_queued, &tv_start);
+  }
 
   /* To prevent corrupt values in FOUND from trying to read beyond the
    * end of the res[] array */
@@ -197,6 +204,19 @@ static void *postcalc_hash(void *userdata)
     pcd->res[found] &= found;
   }
 
+  /* Several scrypt nonces are cheaper to verify together */
+  if (pcd->res[found] > 1 && (pcd->work->pool->algorithm.type == ALGO_SCRYPT ||
+                              pcd->work->pool->algorithm.type == ALGO_NSCRYPT)) {
+    uint32_t hashes[MAXBUFFERS][8];
+
+    scrypt_regenhash_batch(pcd->work, pcd->res, hashes, pcd->res[found]);
+    for (entry = 0; entry < pcd->res[found]; entry++) {
+      applog(LOG_DEBUG, "OCL NONCE %u found in slot %d", pcd->res[entry], entry);
+      submit_hashed_nonce(thr, pcd->work, pcd->res[entry], hashes[entry]);
+    }
+    goto out;
+  }
+
   for (entry = 0; entry < pcd->res[found]; entry++) {
     uint32_t nonce = pcd->res[entry];
     if (found == 0x0F)
@@ -206,24 +226,35 @@ static void *postcalc_hash(void *userdata)
     submit_nonce(thr, pcd->work, nonce);
   }
 
+out:
+  if (opt_benchmark) {
+    benchmark_verified(benchmark_thread_cpu() - cpu_start);
+    cgtime(&tv_end);
+    benchmark_stage(BENCH_POSTCALC, &tv_start, &tv_end);
+  }
+  TRACE_END("postcalc_hash");
+
   discard_work(pcd->work);
-  free(pcd);
+  lowmem_free(LOWMEM_PC_DATA, pcd);
 
   return NULL;
 }
 
 void postcalc_hash_async(struct thr_info *thr, struct work *work, uint32_t *res)
 {
-  struct pc_data *pcd = (struct pc_data *)malloc(sizeof(struct pc_data));
+  struct pc_data *pcd = (struct pc_data *)lowmem_alloc(LOWMEM_PC_DATA);
   int buffersize;
 
   if (unlikely(!pcd)) {
-    applog(LOG_ERR, "Failed to malloc pc_data in postcalc_hash_async");
+    applog(LOG_WARNING, "Failed to allocate pc_data in postcalc_hash_async, shares from %s %d lost",
+           thr->cgpu->drv->name, thr->cgpu->device_id);
     return;
   }
 
   pcd->thr = thr;
   pcd->work = copy_work(work);
+  if (opt_benchmark)
+    cgtime(&pcd->tv_queued);
   buffersize = BUFFERSIZE;
 
   memcpy(&pcd->res, res, buffersize);
@@ -231,6 +262,6 @@ void postcalc_hash_async(struct thr_info *thr, struct work *work, uint32_t *res)
   if (pthread_create(&pcd->pth, NULL, postcalc_hash, (void *)pcd)) {
     applog(LOG_ERR, "Failed to create postcalc_hash thread");
     discard_work(pcd->work);
-    free(pcd);
+    lowmem_free(LOWMEM_PC_DATA, pcd);
   }
 }
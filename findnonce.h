@@ -8,6 +8,15 @@
 #define MAXBUFFERS (0x100)
 #define BUFFERSIZE (sizeof(uint32_t) * MAXBUFFERS)
 
+struct pc_data {
+  struct thr_info *thr;
+  struct work *work;
+  uint32_t res[MAXBUFFERS];
+  pthread_t pth;
+  int found;
+  struct timeval tv_queued; /* For --benchmark stage timings */
+};
+
 extern void precalc_hash(dev_blk_ctx *blk, uint32_t *state, uint32_t *data);
 extern void postcalc_hash_async(struct thr_info *thr, struct work *work, uint32_t *res);
 
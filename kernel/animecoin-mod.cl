@@ -0,0 +1,14 @@
+/*
+ * AnimeCoin kernel implementation, split into one kernel per stage.
+ *
+ * Animecoin only differs from quarkcoin in the first two stages, bmw over
+ * the header followed by blake, see quarkcoin-mod.cl.
+ */
+
+#ifndef ANIMECOIN_MOD_CL
+#define ANIMECOIN_MOD_CL
+
+#define ANIMECOIN_MOD 1
+#include "quarkcoin-mod.cl"
+
+#endif // ANIMECOIN_MOD_CL
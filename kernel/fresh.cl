@@ -66,6 +66,9 @@ typedef long sph_s64;
 
 #define SPH_ECHO_64 1
 #define SPH_SIMD_NOCOPY 0
+#ifndef ECHO_LOCAL_TABLES
+#define ECHO_LOCAL_TABLES 1
+#endif
 
 #include "shavite.cl"
 #include "simd.cl"
@@ -499,11 +502,16 @@ __kernel void search4(__global hash_t* hashes, __global uint* output, const ulon
   uint gid = get_global_id(0);
   __global hash_t *hash = &(hashes[gid-get_global_offset(0)]);
 
+#if ECHO_LOCAL_TABLES
   __local sph_u32 AES0[256], AES1[256], AES2[256], AES3[256];
+#else
+  __constant const sph_u32 *AES0 = AES0_C, *AES1 = AES1_C, *AES2 = AES2_C, *AES3 = AES3_C;
+#endif
 
   int init = get_local_id(0);
   int step = get_local_size(0);
 
+#if ECHO_LOCAL_TABLES
   for (int i = init; i < 256; i += step)
   {
   AES0[i] = AES0_C[i];
@@ -513,6 +521,7 @@ __kernel void search4(__global hash_t* hashes, __global uint* output, const ulon
   }
 
   barrier(CLK_LOCAL_MEM_FENCE);
+#endif
 
   // copies hashes to "hash"
   // echo
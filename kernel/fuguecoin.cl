@@ -64,6 +64,7 @@ typedef long sph_s64;
 #define SPH_ROTR64(x, n)   SPH_ROTL64(x, (64 - (n)))
 
 #include "fugue.cl"
+#include "multi_header.cl"
 
 #define SWAP4(x) as_uint(as_uchar4(x).wzyx)
 #define SWAP8(x) as_ulong(as_uchar8(x).s76543210)
@@ -78,6 +79,7 @@ __attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
 __kernel void search(__global unsigned char* input, volatile __global uint* output, const ulong target)
 {
   uint gid = get_global_id(0);
+  input = SELECT_HEADER(input);
 
   //mixtab
   __local sph_u32 mixtab0[256], mixtab1[256], mixtab2[256], mixtab3[256];
@@ -223,7 +225,7 @@ __kernel void search(__global unsigned char* input, volatile __global uint* outp
 
   bool result = ((((sph_u64) SWAP4(S19) << 32) | SWAP4(S18)) <= target);
   if (result)
-    output[output[0xFF]++] = SWAP4(gid);
+    SETFOUND_HEADER(0xFF, SWAP4(gid));
 }
 
 #endif // FUGUECOIN_CL
@@ -69,6 +69,7 @@ typedef long sph_s64;
 #define SPH_CUBEHASH_UNROLL 0
 
 #include "groestl.cl"
+#include "multi_header.cl"
 
 #define SWAP4(x) as_uint(as_uchar4(x).wzyx)
 #define SWAP8(x) as_ulong(as_uchar8(x).s76543210)
@@ -129,6 +130,7 @@ __attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
 __kernel void search(__global unsigned char* block, volatile __global uint* output, const ulong target)
 {
   uint gid = get_global_id(0);
+  block = SELECT_HEADER(block);
   union {
     unsigned char h1[64];
     uint h4[16];
@@ -246,7 +248,7 @@ __kernel void search(__global unsigned char* block, volatile __global uint* outp
 
   bool result = (hash.h8[3] <= target);
   if (result)
-    output[output[0xFF]++] = SWAP4(gid);
+    SETFOUND_HEADER(0xFF, SWAP4(gid));
 }
 
 #endif // GROESTLCOIN_CL
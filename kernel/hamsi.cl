@@ -103,6 +103,23 @@
 #pragma warning (disable: 4146)
 #endif
 
+/*
+ * With SPH_HAMSI_COMPACT, the big expansion at 2 and 4 bits per lookup
+ * comes from hamsi_helper_compact.cl: one table per level and a rolled
+ * INPUT_BIG, for smaller kernels that compile faster. The 1 bit
+ * expansion is rolled already, and reads every table row masked by its
+ * input bit.
+ */
+#if !defined SPH_HAMSI_COMPACT
+  #define SPH_HAMSI_COMPACT  0
+#endif
+
+#if SPH_HAMSI_COMPACT && (SPH_HAMSI_EXPAND_BIG == 2 || SPH_HAMSI_EXPAND_BIG == 4)
+  #define SPH_HAMSI_COMPACT_BIG  1
+#else
+  #define SPH_HAMSI_COMPACT_BIG  0
+#endif
+
 //temp fix for shortened implementation of X15
 #ifdef SPH_HAMSI_SHORT
   #if SPH_HAMSI_SHORT == 1 && SPH_HAMSI_EXPAND_BIG == 1
@@ -114,6 +131,10 @@
   #include "hamsi_helper.cl"
 #endif
 
+#if SPH_HAMSI_COMPACT_BIG
+  #include "hamsi_helper_compact.cl"
+#endif
+
 __constant static const sph_u32 HAMSI_IV224[] = {
   SPH_C32(0xc3967a67), SPH_C32(0xc3bc6c20), SPH_C32(0x4bc3bcc3),
   SPH_C32(0xa7c3bc6b), SPH_C32(0x2c204b61), SPH_C32(0x74686f6c),
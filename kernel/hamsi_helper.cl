@@ -8415,7 +8415,7 @@ __constant static const sph_u32 T512[64][16] = {
 
 #endif
 
-#if SPH_HAMSI_EXPAND_BIG == 2
+#if SPH_HAMSI_EXPAND_BIG == 2 && !SPH_HAMSI_COMPACT_BIG
 
 __constant static const sph_u32 T512_0[4][16] = {
   { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
@@ -11315,7 +11315,7 @@ __constant static const sph_u32 T512_63[2][16] = {
 
 #endif
 
-#if SPH_HAMSI_EXPAND_BIG == 4
+#if SPH_HAMSI_EXPAND_BIG == 4 && !SPH_HAMSI_COMPACT_BIG
 
 __constant static const sph_u32 T512_0[16][16] = {
   { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
@@ -0,0 +1,2536 @@
+/*
+ * Compact helper code for the Hamsi-384/512 input block expansion. The
+ * per group tables of hamsi_helper.cl are merged into one table for each
+ * expansion level, which lets INPUT_BIG run as a loop over the groups of
+ * input bits instead of an unrolled sequence. Every entry is the XOR of
+ * the rows of the 1 bit table of hamsi_helper.cl selected by its index.
+ *
+ * Generated by tools/hamsi-compact.c (make hamsi-compact), regenerate it
+ * rather than editing the tables by hand:
+ *
+ *   hamsi-compact kernel/hamsi_helper.cl > kernel/hamsi_helper_compact.cl
+ *
+ * This file is included from hamsi.cl when SPH_HAMSI_COMPACT is set, and
+ * is not meant to be compiled independently.
+ *
+ * ==========================(LICENSE BEGIN)============================
+ *
+ * Copyright (c) 2007-2010  Projet RNRT SAPHIR
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ===========================(LICENSE END)=============================
+ *
+ * @author   Thomas Pornin <thomas.pornin@cryptolog.com>
+ */
+
+#if SPH_HAMSI_EXPAND_BIG == 2
+
+__constant static const sph_u32 T512_N2[32][4][16] = {
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x29449c00), SPH_C32(0x64e70000), SPH_C32(0xf24b0000),
+      SPH_C32(0xc2f30000), SPH_C32(0x0ede4e8f), SPH_C32(0x56c23745),
+      SPH_C32(0xf3e04259), SPH_C32(0x8d0d9ec4), SPH_C32(0x466d0c00),
+      SPH_C32(0x08620000), SPH_C32(0xdd5d0000), SPH_C32(0xbadd0000),
+      SPH_C32(0x6a927942), SPH_C32(0x441f2b93), SPH_C32(0x218ace6f),
+      SPH_C32(0xbf2c0be2) },
+    { SPH_C32(0x466d0c00), SPH_C32(0x08620000), SPH_C32(0xdd5d0000),
+      SPH_C32(0xbadd0000), SPH_C32(0x6a927942), SPH_C32(0x441f2b93),
+      SPH_C32(0x218ace6f), SPH_C32(0xbf2c0be2), SPH_C32(0x6f299000),
+      SPH_C32(0x6c850000), SPH_C32(0x2f160000), SPH_C32(0x782e0000),
+      SPH_C32(0x644c37cd), SPH_C32(0x12dd1cd6), SPH_C32(0xd26a8c36),
+      SPH_C32(0x32219526) },
+    { SPH_C32(0x6f299000), SPH_C32(0x6c850000), SPH_C32(0x2f160000),
+      SPH_C32(0x782e0000), SPH_C32(0x644c37cd), SPH_C32(0x12dd1cd6),
+      SPH_C32(0xd26a8c36), SPH_C32(0x32219526), SPH_C32(0x29449c00),
+      SPH_C32(0x64e70000), SPH_C32(0xf24b0000), SPH_C32(0xc2f30000),
+      SPH_C32(0x0ede4e8f), SPH_C32(0x56c23745), SPH_C32(0xf3e04259),
+      SPH_C32(0x8d0d9ec4) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x54285c00), SPH_C32(0xeaed0000), SPH_C32(0xc5d60000),
+      SPH_C32(0xa1c50000), SPH_C32(0xb3a26770), SPH_C32(0x94a5c4e1),
+      SPH_C32(0x6bb0419d), SPH_C32(0x551b3782), SPH_C32(0x9cbb1800),
+      SPH_C32(0xb0d30000), SPH_C32(0x92510000), SPH_C32(0xed930000),
+      SPH_C32(0x593a4345), SPH_C32(0xe114d5f4), SPH_C32(0x430633da),
+      SPH_C32(0x78cace29) },
+    { SPH_C32(0x9cbb1800), SPH_C32(0xb0d30000), SPH_C32(0x92510000),
+      SPH_C32(0xed930000), SPH_C32(0x593a4345), SPH_C32(0xe114d5f4),
+      SPH_C32(0x430633da), SPH_C32(0x78cace29), SPH_C32(0xc8934400),
+      SPH_C32(0x5a3e0000), SPH_C32(0x57870000), SPH_C32(0x4c560000),
+      SPH_C32(0xea982435), SPH_C32(0x75b11115), SPH_C32(0x28b67247),
+      SPH_C32(0x2dd1f9ab) },
+    { SPH_C32(0xc8934400), SPH_C32(0x5a3e0000), SPH_C32(0x57870000),
+      SPH_C32(0x4c560000), SPH_C32(0xea982435), SPH_C32(0x75b11115),
+      SPH_C32(0x28b67247), SPH_C32(0x2dd1f9ab), SPH_C32(0x54285c00),
+      SPH_C32(0xeaed0000), SPH_C32(0xc5d60000), SPH_C32(0xa1c50000),
+      SPH_C32(0xb3a26770), SPH_C32(0x94a5c4e1), SPH_C32(0x6bb0419d),
+      SPH_C32(0x551b3782) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x145a3c00), SPH_C32(0xb9e90000), SPH_C32(0x61270000),
+      SPH_C32(0xf1610000), SPH_C32(0xce613d6c), SPH_C32(0xb0493d78),
+      SPH_C32(0x47a96720), SPH_C32(0xe18e24c5), SPH_C32(0x23671400),
+      SPH_C32(0xc8b90000), SPH_C32(0xf4c70000), SPH_C32(0xfb750000),
+      SPH_C32(0x73cd2465), SPH_C32(0xf8a6a549), SPH_C32(0x02c40a3f),
+      SPH_C32(0xdc24e61f) },
+    { SPH_C32(0x23671400), SPH_C32(0xc8b90000), SPH_C32(0xf4c70000),
+      SPH_C32(0xfb750000), SPH_C32(0x73cd2465), SPH_C32(0xf8a6a549),
+      SPH_C32(0x02c40a3f), SPH_C32(0xdc24e61f), SPH_C32(0x373d2800),
+      SPH_C32(0x71500000), SPH_C32(0x95e00000), SPH_C32(0x0a140000),
+      SPH_C32(0xbdac1909), SPH_C32(0x48ef9831), SPH_C32(0x456d6d1f),
+      SPH_C32(0x3daac2da) },
+    { SPH_C32(0x373d2800), SPH_C32(0x71500000), SPH_C32(0x95e00000),
+      SPH_C32(0x0a140000), SPH_C32(0xbdac1909), SPH_C32(0x48ef9831),
+      SPH_C32(0x456d6d1f), SPH_C32(0x3daac2da), SPH_C32(0x145a3c00),
+      SPH_C32(0xb9e90000), SPH_C32(0x61270000), SPH_C32(0xf1610000),
+      SPH_C32(0xce613d6c), SPH_C32(0xb0493d78), SPH_C32(0x47a96720),
+      SPH_C32(0xe18e24c5) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xef0b0270), SPH_C32(0x3afd0000), SPH_C32(0x5dae0000),
+      SPH_C32(0x69490000), SPH_C32(0x9b0f3c06), SPH_C32(0x4405b5f9),
+      SPH_C32(0x66140a51), SPH_C32(0x924f5d0a), SPH_C32(0xc96b0030),
+      SPH_C32(0xe7250000), SPH_C32(0x2f840000), SPH_C32(0x264f0000),
+      SPH_C32(0x08695bf9), SPH_C32(0x6dfcf137), SPH_C32(0x509f6984),
+      SPH_C32(0x9e69af68) },
+    { SPH_C32(0xc96b0030), SPH_C32(0xe7250000), SPH_C32(0x2f840000),
+      SPH_C32(0x264f0000), SPH_C32(0x08695bf9), SPH_C32(0x6dfcf137),
+      SPH_C32(0x509f6984), SPH_C32(0x9e69af68), SPH_C32(0x26600240),
+      SPH_C32(0xddd80000), SPH_C32(0x722a0000), SPH_C32(0x4f060000),
+      SPH_C32(0x936667ff), SPH_C32(0x29f944ce), SPH_C32(0x368b63d5),
+      SPH_C32(0x0c26f262) },
+    { SPH_C32(0x26600240), SPH_C32(0xddd80000), SPH_C32(0x722a0000),
+      SPH_C32(0x4f060000), SPH_C32(0x936667ff), SPH_C32(0x29f944ce),
+      SPH_C32(0x368b63d5), SPH_C32(0x0c26f262), SPH_C32(0xef0b0270),
+      SPH_C32(0x3afd0000), SPH_C32(0x5dae0000), SPH_C32(0x69490000),
+      SPH_C32(0x9b0f3c06), SPH_C32(0x4405b5f9), SPH_C32(0x66140a51),
+      SPH_C32(0x924f5d0a) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xe8870170), SPH_C32(0x9d720000), SPH_C32(0x12db0000),
+      SPH_C32(0xd4220000), SPH_C32(0xf2886b27), SPH_C32(0xa921e543),
+      SPH_C32(0x4ef8b518), SPH_C32(0x618813b1), SPH_C32(0xb4370060),
+      SPH_C32(0x0c4c0000), SPH_C32(0x56c20000), SPH_C32(0x5cae0000),
+      SPH_C32(0x94541f3f), SPH_C32(0x3b3ef825), SPH_C32(0x1b365f3d),
+      SPH_C32(0xf3d45758) },
+    { SPH_C32(0xb4370060), SPH_C32(0x0c4c0000), SPH_C32(0x56c20000),
+      SPH_C32(0x5cae0000), SPH_C32(0x94541f3f), SPH_C32(0x3b3ef825),
+      SPH_C32(0x1b365f3d), SPH_C32(0xf3d45758), SPH_C32(0x5cb00110),
+      SPH_C32(0x913e0000), SPH_C32(0x44190000), SPH_C32(0x888c0000),
+      SPH_C32(0x66dc7418), SPH_C32(0x921f1d66), SPH_C32(0x55ceea25),
+      SPH_C32(0x925c44e9) },
+    { SPH_C32(0x5cb00110), SPH_C32(0x913e0000), SPH_C32(0x44190000),
+      SPH_C32(0x888c0000), SPH_C32(0x66dc7418), SPH_C32(0x921f1d66),
+      SPH_C32(0x55ceea25), SPH_C32(0x925c44e9), SPH_C32(0xe8870170),
+      SPH_C32(0x9d720000), SPH_C32(0x12db0000), SPH_C32(0xd4220000),
+      SPH_C32(0xf2886b27), SPH_C32(0xa921e543), SPH_C32(0x4ef8b518),
+      SPH_C32(0x618813b1) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x774400f0), SPH_C32(0xf15a0000), SPH_C32(0xf5b20000),
+      SPH_C32(0x34140000), SPH_C32(0x89377e8c), SPH_C32(0x5a8bec25),
+      SPH_C32(0x0bc3cd1e), SPH_C32(0xcf3775cb), SPH_C32(0xf46c0050),
+      SPH_C32(0x96180000), SPH_C32(0x14a50000), SPH_C32(0x031f0000),
+      SPH_C32(0x42947eb8), SPH_C32(0x66bf7e19), SPH_C32(0x9ca470d2),
+      SPH_C32(0x8a341574) },
+    { SPH_C32(0xf46c0050), SPH_C32(0x96180000), SPH_C32(0x14a50000),
+      SPH_C32(0x031f0000), SPH_C32(0x42947eb8), SPH_C32(0x66bf7e19),
+      SPH_C32(0x9ca470d2), SPH_C32(0x8a341574), SPH_C32(0x832800a0),
+      SPH_C32(0x67420000), SPH_C32(0xe1170000), SPH_C32(0x370b0000),
+      SPH_C32(0xcba30034), SPH_C32(0x3c34923c), SPH_C32(0x9767bdcc),
+      SPH_C32(0x450360bf) },
+    { SPH_C32(0x832800a0), SPH_C32(0x67420000), SPH_C32(0xe1170000),
+      SPH_C32(0x370b0000), SPH_C32(0xcba30034), SPH_C32(0x3c34923c),
+      SPH_C32(0x9767bdcc), SPH_C32(0x450360bf), SPH_C32(0x774400f0),
+      SPH_C32(0xf15a0000), SPH_C32(0xf5b20000), SPH_C32(0x34140000),
+      SPH_C32(0x89377e8c), SPH_C32(0x5a8bec25), SPH_C32(0x0bc3cd1e),
+      SPH_C32(0xcf3775cb) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xf7750009), SPH_C32(0xcf3cc000), SPH_C32(0xc3d60000),
+      SPH_C32(0x04920000), SPH_C32(0x029519a9), SPH_C32(0xf8e836ba),
+      SPH_C32(0x7a87f14e), SPH_C32(0x9e16981a), SPH_C32(0xd46a0000),
+      SPH_C32(0x8dc8c000), SPH_C32(0xa5af0000), SPH_C32(0x4a290000),
+      SPH_C32(0xfc4e427a), SPH_C32(0xc9b4866c), SPH_C32(0x98369604),
+      SPH_C32(0xf746c320) },
+    { SPH_C32(0xd46a0000), SPH_C32(0x8dc8c000), SPH_C32(0xa5af0000),
+      SPH_C32(0x4a290000), SPH_C32(0xfc4e427a), SPH_C32(0xc9b4866c),
+      SPH_C32(0x98369604), SPH_C32(0xf746c320), SPH_C32(0x231f0009),
+      SPH_C32(0x42f40000), SPH_C32(0x66790000), SPH_C32(0x4ebb0000),
+      SPH_C32(0xfedb5bd3), SPH_C32(0x315cb0d6), SPH_C32(0xe2b1674a),
+      SPH_C32(0x69505b3a) },
+    { SPH_C32(0x231f0009), SPH_C32(0x42f40000), SPH_C32(0x66790000),
+      SPH_C32(0x4ebb0000), SPH_C32(0xfedb5bd3), SPH_C32(0x315cb0d6),
+      SPH_C32(0xe2b1674a), SPH_C32(0x69505b3a), SPH_C32(0xf7750009),
+      SPH_C32(0xcf3cc000), SPH_C32(0xc3d60000), SPH_C32(0x04920000),
+      SPH_C32(0x029519a9), SPH_C32(0xf8e836ba), SPH_C32(0x7a87f14e),
+      SPH_C32(0x9e16981a) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xf6800005), SPH_C32(0x3443c000), SPH_C32(0x24070000),
+      SPH_C32(0x8f3d0000), SPH_C32(0x21373bfb), SPH_C32(0x0ab8d5ae),
+      SPH_C32(0xcdc58b19), SPH_C32(0xd795ba31), SPH_C32(0xa67f0001),
+      SPH_C32(0x71378000), SPH_C32(0x19fc0000), SPH_C32(0x96db0000),
+      SPH_C32(0x3a8b6dfd), SPH_C32(0xebcaaef3), SPH_C32(0x2c6d478f),
+      SPH_C32(0xac8e6c88) },
+    { SPH_C32(0xa67f0001), SPH_C32(0x71378000), SPH_C32(0x19fc0000),
+      SPH_C32(0x96db0000), SPH_C32(0x3a8b6dfd), SPH_C32(0xebcaaef3),
+      SPH_C32(0x2c6d478f), SPH_C32(0xac8e6c88), SPH_C32(0x50ff0004),
+      SPH_C32(0x45744000), SPH_C32(0x3dfb0000), SPH_C32(0x19e60000),
+      SPH_C32(0x1bbc5606), SPH_C32(0xe1727b5d), SPH_C32(0xe1a8cc96),
+      SPH_C32(0x7b1bd6b9) },
+    { SPH_C32(0x50ff0004), SPH_C32(0x45744000), SPH_C32(0x3dfb0000),
+      SPH_C32(0x19e60000), SPH_C32(0x1bbc5606), SPH_C32(0xe1727b5d),
+      SPH_C32(0xe1a8cc96), SPH_C32(0x7b1bd6b9), SPH_C32(0xf6800005),
+      SPH_C32(0x3443c000), SPH_C32(0x24070000), SPH_C32(0x8f3d0000),
+      SPH_C32(0x21373bfb), SPH_C32(0x0ab8d5ae), SPH_C32(0xcdc58b19),
+      SPH_C32(0xd795ba31) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x75c90003), SPH_C32(0x0e10c000), SPH_C32(0xd1200000),
+      SPH_C32(0xbaea0000), SPH_C32(0x8bc42f3e), SPH_C32(0x8758b757),
+      SPH_C32(0xbb28761d), SPH_C32(0x00b72e2b), SPH_C32(0xeecf0001),
+      SPH_C32(0x6f564000), SPH_C32(0xf33e0000), SPH_C32(0xa79e0000),
+      SPH_C32(0xbdb57219), SPH_C32(0xb711ebc5), SPH_C32(0x4a3b40ba),
+      SPH_C32(0xfeabf254) },
+    { SPH_C32(0xeecf0001), SPH_C32(0x6f564000), SPH_C32(0xf33e0000),
+      SPH_C32(0xa79e0000), SPH_C32(0xbdb57219), SPH_C32(0xb711ebc5),
+      SPH_C32(0x4a3b40ba), SPH_C32(0xfeabf254), SPH_C32(0x9b060002),
+      SPH_C32(0x61468000), SPH_C32(0x221e0000), SPH_C32(0x1d740000),
+      SPH_C32(0x36715d27), SPH_C32(0x30495c92), SPH_C32(0xf11336a7),
+      SPH_C32(0xfe1cdc7f) },
+    { SPH_C32(0x9b060002), SPH_C32(0x61468000), SPH_C32(0x221e0000),
+      SPH_C32(0x1d740000), SPH_C32(0x36715d27), SPH_C32(0x30495c92),
+      SPH_C32(0xf11336a7), SPH_C32(0xfe1cdc7f), SPH_C32(0x75c90003),
+      SPH_C32(0x0e10c000), SPH_C32(0xd1200000), SPH_C32(0xbaea0000),
+      SPH_C32(0x8bc42f3e), SPH_C32(0x8758b757), SPH_C32(0xbb28761d),
+      SPH_C32(0x00b72e2b) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x75a40000), SPH_C32(0xc28b2700), SPH_C32(0x94a40000),
+      SPH_C32(0x90f50000), SPH_C32(0xfb7857e0), SPH_C32(0x49ce0bae),
+      SPH_C32(0x1767c483), SPH_C32(0xaedf667e), SPH_C32(0xd1660000),
+      SPH_C32(0x1bbc0300), SPH_C32(0x9eec0000), SPH_C32(0xf6940000),
+      SPH_C32(0x03024527), SPH_C32(0xcf70fcf2), SPH_C32(0xb4431b17),
+      SPH_C32(0x857f3c2b) },
+    { SPH_C32(0xd1660000), SPH_C32(0x1bbc0300), SPH_C32(0x9eec0000),
+      SPH_C32(0xf6940000), SPH_C32(0x03024527), SPH_C32(0xcf70fcf2),
+      SPH_C32(0xb4431b17), SPH_C32(0x857f3c2b), SPH_C32(0xa4c20000),
+      SPH_C32(0xd9372400), SPH_C32(0x0a480000), SPH_C32(0x66610000),
+      SPH_C32(0xf87a12c7), SPH_C32(0x86bef75c), SPH_C32(0xa324df94),
+      SPH_C32(0x2ba05a55) },
+    { SPH_C32(0xa4c20000), SPH_C32(0xd9372400), SPH_C32(0x0a480000),
+      SPH_C32(0x66610000), SPH_C32(0xf87a12c7), SPH_C32(0x86bef75c),
+      SPH_C32(0xa324df94), SPH_C32(0x2ba05a55), SPH_C32(0x75a40000),
+      SPH_C32(0xc28b2700), SPH_C32(0x94a40000), SPH_C32(0x90f50000),
+      SPH_C32(0xfb7857e0), SPH_C32(0x49ce0bae), SPH_C32(0x1767c483),
+      SPH_C32(0xaedf667e) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x45180000), SPH_C32(0xa5b51700), SPH_C32(0xf96a0000),
+      SPH_C32(0x3b480000), SPH_C32(0x1ecc142c), SPH_C32(0x231395d6),
+      SPH_C32(0x16bca6b0), SPH_C32(0xdf33f4df), SPH_C32(0xb83d0000),
+      SPH_C32(0x16710600), SPH_C32(0x379a0000), SPH_C32(0xf5b10000),
+      SPH_C32(0x228161ac), SPH_C32(0xae48f145), SPH_C32(0x66241616),
+      SPH_C32(0xc5c1eb3e) },
+    { SPH_C32(0xb83d0000), SPH_C32(0x16710600), SPH_C32(0x379a0000),
+      SPH_C32(0xf5b10000), SPH_C32(0x228161ac), SPH_C32(0xae48f145),
+      SPH_C32(0x66241616), SPH_C32(0xc5c1eb3e), SPH_C32(0xfd250000),
+      SPH_C32(0xb3c41100), SPH_C32(0xcef00000), SPH_C32(0xcef90000),
+      SPH_C32(0x3c4d7580), SPH_C32(0x8d5b6493), SPH_C32(0x7098b0a6),
+      SPH_C32(0x1af21fe1) },
+    { SPH_C32(0xfd250000), SPH_C32(0xb3c41100), SPH_C32(0xcef00000),
+      SPH_C32(0xcef90000), SPH_C32(0x3c4d7580), SPH_C32(0x8d5b6493),
+      SPH_C32(0x7098b0a6), SPH_C32(0x1af21fe1), SPH_C32(0x45180000),
+      SPH_C32(0xa5b51700), SPH_C32(0xf96a0000), SPH_C32(0x3b480000),
+      SPH_C32(0x1ecc142c), SPH_C32(0x231395d6), SPH_C32(0x16bca6b0),
+      SPH_C32(0xdf33f4df) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x0c720000), SPH_C32(0x49e50f00), SPH_C32(0x42790000),
+      SPH_C32(0x5cea0000), SPH_C32(0x33aa301a), SPH_C32(0x15822514),
+      SPH_C32(0x95a34b7b), SPH_C32(0xb44b0090), SPH_C32(0xfe220000),
+      SPH_C32(0xa7580500), SPH_C32(0x25d10000), SPH_C32(0xf7600000),
+      SPH_C32(0x893178da), SPH_C32(0x1fd4f860), SPH_C32(0x4ed0a315),
+      SPH_C32(0xa123ff9f) },
+    { SPH_C32(0xfe220000), SPH_C32(0xa7580500), SPH_C32(0x25d10000),
+      SPH_C32(0xf7600000), SPH_C32(0x893178da), SPH_C32(0x1fd4f860),
+      SPH_C32(0x4ed0a315), SPH_C32(0xa123ff9f), SPH_C32(0xf2500000),
+      SPH_C32(0xeebd0a00), SPH_C32(0x67a80000), SPH_C32(0xab8a0000),
+      SPH_C32(0xba9b48c0), SPH_C32(0x0a56dd74), SPH_C32(0xdb73e86e),
+      SPH_C32(0x1568ff0f) },
+    { SPH_C32(0xf2500000), SPH_C32(0xeebd0a00), SPH_C32(0x67a80000),
+      SPH_C32(0xab8a0000), SPH_C32(0xba9b48c0), SPH_C32(0x0a56dd74),
+      SPH_C32(0xdb73e86e), SPH_C32(0x1568ff0f), SPH_C32(0x0c720000),
+      SPH_C32(0x49e50f00), SPH_C32(0x42790000), SPH_C32(0x5cea0000),
+      SPH_C32(0x33aa301a), SPH_C32(0x15822514), SPH_C32(0x95a34b7b),
+      SPH_C32(0xb44b0090) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x69510000), SPH_C32(0xd4e1009c), SPH_C32(0xc3230000),
+      SPH_C32(0xac2f0000), SPH_C32(0xe4950bae), SPH_C32(0xcea415dc),
+      SPH_C32(0x87ec287c), SPH_C32(0xbce1a3ce), SPH_C32(0xc6730000),
+      SPH_C32(0xaf8d000c), SPH_C32(0xa4c10000), SPH_C32(0x218d0000),
+      SPH_C32(0x23111587), SPH_C32(0x7913512f), SPH_C32(0x1d28ac88),
+      SPH_C32(0x378dd173) },
+    { SPH_C32(0xc6730000), SPH_C32(0xaf8d000c), SPH_C32(0xa4c10000),
+      SPH_C32(0x218d0000), SPH_C32(0x23111587), SPH_C32(0x7913512f),
+      SPH_C32(0x1d28ac88), SPH_C32(0x378dd173), SPH_C32(0xaf220000),
+      SPH_C32(0x7b6c0090), SPH_C32(0x67e20000), SPH_C32(0x8da20000),
+      SPH_C32(0xc7841e29), SPH_C32(0xb7b744f3), SPH_C32(0x9ac484f4),
+      SPH_C32(0x8b6c72bd) },
+    { SPH_C32(0xaf220000), SPH_C32(0x7b6c0090), SPH_C32(0x67e20000),
+      SPH_C32(0x8da20000), SPH_C32(0xc7841e29), SPH_C32(0xb7b744f3),
+      SPH_C32(0x9ac484f4), SPH_C32(0x8b6c72bd), SPH_C32(0x69510000),
+      SPH_C32(0xd4e1009c), SPH_C32(0xc3230000), SPH_C32(0xac2f0000),
+      SPH_C32(0xe4950bae), SPH_C32(0xcea415dc), SPH_C32(0x87ec287c),
+      SPH_C32(0xbce1a3ce) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x54500000), SPH_C32(0x0671005c), SPH_C32(0x25ae0000),
+      SPH_C32(0x6a1e0000), SPH_C32(0x2ea54edf), SPH_C32(0x664e8512),
+      SPH_C32(0xbfba18c3), SPH_C32(0x7e715d17), SPH_C32(0xbc8d0000),
+      SPH_C32(0xfc3b0018), SPH_C32(0x19830000), SPH_C32(0xd10b0000),
+      SPH_C32(0xae1878c4), SPH_C32(0x42a69856), SPH_C32(0x0012da37),
+      SPH_C32(0x2c3b504e) },
+    { SPH_C32(0xbc8d0000), SPH_C32(0xfc3b0018), SPH_C32(0x19830000),
+      SPH_C32(0xd10b0000), SPH_C32(0xae1878c4), SPH_C32(0x42a69856),
+      SPH_C32(0x0012da37), SPH_C32(0x2c3b504e), SPH_C32(0xe8dd0000),
+      SPH_C32(0xfa4a0044), SPH_C32(0x3c2d0000), SPH_C32(0xbb150000),
+      SPH_C32(0x80bd361b), SPH_C32(0x24e81d44), SPH_C32(0xbfa8c2f4),
+      SPH_C32(0x524a0d59) },
+    { SPH_C32(0xe8dd0000), SPH_C32(0xfa4a0044), SPH_C32(0x3c2d0000),
+      SPH_C32(0xbb150000), SPH_C32(0x80bd361b), SPH_C32(0x24e81d44),
+      SPH_C32(0xbfa8c2f4), SPH_C32(0x524a0d59), SPH_C32(0x54500000),
+      SPH_C32(0x0671005c), SPH_C32(0x25ae0000), SPH_C32(0x6a1e0000),
+      SPH_C32(0x2ea54edf), SPH_C32(0x664e8512), SPH_C32(0xbfba18c3),
+      SPH_C32(0x7e715d17) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x14190000), SPH_C32(0x23ca003c), SPH_C32(0x50df0000),
+      SPH_C32(0x44b60000), SPH_C32(0x1b6c67b0), SPH_C32(0x3cf3ac75),
+      SPH_C32(0x61e610b0), SPH_C32(0xdbcadb80), SPH_C32(0xe3430000),
+      SPH_C32(0x3a4e0014), SPH_C32(0xf2c60000), SPH_C32(0xaa4e0000),
+      SPH_C32(0xdb1e42a6), SPH_C32(0x256bbe15), SPH_C32(0x123db156),
+      SPH_C32(0x3a4e99d7) },
+    { SPH_C32(0xe3430000), SPH_C32(0x3a4e0014), SPH_C32(0xf2c60000),
+      SPH_C32(0xaa4e0000), SPH_C32(0xdb1e42a6), SPH_C32(0x256bbe15),
+      SPH_C32(0x123db156), SPH_C32(0x3a4e99d7), SPH_C32(0xf75a0000),
+      SPH_C32(0x19840028), SPH_C32(0xa2190000), SPH_C32(0xeef80000),
+      SPH_C32(0xc0722516), SPH_C32(0x19981260), SPH_C32(0x73dba1e6),
+      SPH_C32(0xe1844257) },
+    { SPH_C32(0xf75a0000), SPH_C32(0x19840028), SPH_C32(0xa2190000),
+      SPH_C32(0xeef80000), SPH_C32(0xc0722516), SPH_C32(0x19981260),
+      SPH_C32(0x73dba1e6), SPH_C32(0xe1844257), SPH_C32(0x14190000),
+      SPH_C32(0x23ca003c), SPH_C32(0x50df0000), SPH_C32(0x44b60000),
+      SPH_C32(0x1b6c67b0), SPH_C32(0x3cf3ac75), SPH_C32(0x61e610b0),
+      SPH_C32(0xdbcadb80) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x86790000), SPH_C32(0x3f390002), SPH_C32(0xe19ae000),
+      SPH_C32(0x98560000), SPH_C32(0x9565670e), SPH_C32(0x4e88c8ea),
+      SPH_C32(0xd3dd4944), SPH_C32(0x161ddab9), SPH_C32(0x30b70000),
+      SPH_C32(0xe5d00000), SPH_C32(0xf4f46000), SPH_C32(0x42c40000),
+      SPH_C32(0x63b83d6a), SPH_C32(0x78ba9460), SPH_C32(0x21afa1ea),
+      SPH_C32(0xb0a51834) },
+    { SPH_C32(0x30b70000), SPH_C32(0xe5d00000), SPH_C32(0xf4f46000),
+      SPH_C32(0x42c40000), SPH_C32(0x63b83d6a), SPH_C32(0x78ba9460),
+      SPH_C32(0x21afa1ea), SPH_C32(0xb0a51834), SPH_C32(0xb6ce0000),
+      SPH_C32(0xdae90002), SPH_C32(0x156e8000), SPH_C32(0xda920000),
+      SPH_C32(0xf6dd5a64), SPH_C32(0x36325c8a), SPH_C32(0xf272e8ae),
+      SPH_C32(0xa6b8c28d) },
+    { SPH_C32(0xb6ce0000), SPH_C32(0xdae90002), SPH_C32(0x156e8000),
+      SPH_C32(0xda920000), SPH_C32(0xf6dd5a64), SPH_C32(0x36325c8a),
+      SPH_C32(0xf272e8ae), SPH_C32(0xa6b8c28d), SPH_C32(0x86790000),
+      SPH_C32(0x3f390002), SPH_C32(0xe19ae000), SPH_C32(0x98560000),
+      SPH_C32(0x9565670e), SPH_C32(0x4e88c8ea), SPH_C32(0xd3dd4944),
+      SPH_C32(0x161ddab9) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xaec30000), SPH_C32(0x9c4f0001), SPH_C32(0x79d1e000),
+      SPH_C32(0x2c150000), SPH_C32(0x45cc75b3), SPH_C32(0x6650b736),
+      SPH_C32(0xab92f78f), SPH_C32(0xa312567b), SPH_C32(0xdb250000),
+      SPH_C32(0x09290000), SPH_C32(0x49aac000), SPH_C32(0x81e10000),
+      SPH_C32(0xcafe6b59), SPH_C32(0x42793431), SPH_C32(0x43566b76),
+      SPH_C32(0xe86cba2e) },
+    { SPH_C32(0xdb250000), SPH_C32(0x09290000), SPH_C32(0x49aac000),
+      SPH_C32(0x81e10000), SPH_C32(0xcafe6b59), SPH_C32(0x42793431),
+      SPH_C32(0x43566b76), SPH_C32(0xe86cba2e), SPH_C32(0x75e60000),
+      SPH_C32(0x95660001), SPH_C32(0x307b2000), SPH_C32(0xadf40000),
+      SPH_C32(0x8f321eea), SPH_C32(0x24298307), SPH_C32(0xe8c49cf9),
+      SPH_C32(0x4b7eec55) },
+    { SPH_C32(0x75e60000), SPH_C32(0x95660001), SPH_C32(0x307b2000),
+      SPH_C32(0xadf40000), SPH_C32(0x8f321eea), SPH_C32(0x24298307),
+      SPH_C32(0xe8c49cf9), SPH_C32(0x4b7eec55), SPH_C32(0xaec30000),
+      SPH_C32(0x9c4f0001), SPH_C32(0x79d1e000), SPH_C32(0x2c150000),
+      SPH_C32(0x45cc75b3), SPH_C32(0x6650b736), SPH_C32(0xab92f78f),
+      SPH_C32(0xa312567b) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xac480000), SPH_C32(0x1ba60000), SPH_C32(0x45fb1380),
+      SPH_C32(0x03430000), SPH_C32(0x5a85316a), SPH_C32(0x1fb250b6),
+      SPH_C32(0xfe72c7fe), SPH_C32(0x91e478f6), SPH_C32(0x1e4e0000),
+      SPH_C32(0xdecf0000), SPH_C32(0x6df80180), SPH_C32(0x77240000),
+      SPH_C32(0xec47079e), SPH_C32(0xf4a0694e), SPH_C32(0xcda31812),
+      SPH_C32(0x98aa496e) },
+    { SPH_C32(0x1e4e0000), SPH_C32(0xdecf0000), SPH_C32(0x6df80180),
+      SPH_C32(0x77240000), SPH_C32(0xec47079e), SPH_C32(0xf4a0694e),
+      SPH_C32(0xcda31812), SPH_C32(0x98aa496e), SPH_C32(0xb2060000),
+      SPH_C32(0xc5690000), SPH_C32(0x28031200), SPH_C32(0x74670000),
+      SPH_C32(0xb6c236f4), SPH_C32(0xeb1239f8), SPH_C32(0x33d1dfec),
+      SPH_C32(0x094e3198) },
+    { SPH_C32(0xb2060000), SPH_C32(0xc5690000), SPH_C32(0x28031200),
+      SPH_C32(0x74670000), SPH_C32(0xb6c236f4), SPH_C32(0xeb1239f8),
+      SPH_C32(0x33d1dfec), SPH_C32(0x094e3198), SPH_C32(0xac480000),
+      SPH_C32(0x1ba60000), SPH_C32(0x45fb1380), SPH_C32(0x03430000),
+      SPH_C32(0x5a85316a), SPH_C32(0x1fb250b6), SPH_C32(0xfe72c7fe),
+      SPH_C32(0x91e478f6) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x78230000), SPH_C32(0x12fc0000), SPH_C32(0xa93a0b80),
+      SPH_C32(0x90a50000), SPH_C32(0x713e2879), SPH_C32(0x7ee98924),
+      SPH_C32(0xf08ca062), SPH_C32(0x636f8bab), SPH_C32(0x02af0000),
+      SPH_C32(0xb7280000), SPH_C32(0xba1c0300), SPH_C32(0x56980000),
+      SPH_C32(0xba8d45d3), SPH_C32(0x8048c667), SPH_C32(0xa95c149a),
+      SPH_C32(0xf4f6ea7b) },
+    { SPH_C32(0x02af0000), SPH_C32(0xb7280000), SPH_C32(0xba1c0300),
+      SPH_C32(0x56980000), SPH_C32(0xba8d45d3), SPH_C32(0x8048c667),
+      SPH_C32(0xa95c149a), SPH_C32(0xf4f6ea7b), SPH_C32(0x7a8c0000),
+      SPH_C32(0xa5d40000), SPH_C32(0x13260880), SPH_C32(0xc63d0000),
+      SPH_C32(0xcbb36daa), SPH_C32(0xfea14f43), SPH_C32(0x59d0b4f8),
+      SPH_C32(0x979961d0) },
+    { SPH_C32(0x7a8c0000), SPH_C32(0xa5d40000), SPH_C32(0x13260880),
+      SPH_C32(0xc63d0000), SPH_C32(0xcbb36daa), SPH_C32(0xfea14f43),
+      SPH_C32(0x59d0b4f8), SPH_C32(0x979961d0), SPH_C32(0x78230000),
+      SPH_C32(0x12fc0000), SPH_C32(0xa93a0b80), SPH_C32(0x90a50000),
+      SPH_C32(0x713e2879), SPH_C32(0x7ee98924), SPH_C32(0xf08ca062),
+      SPH_C32(0x636f8bab) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xcc140000), SPH_C32(0xa5630000), SPH_C32(0x5ab90780),
+      SPH_C32(0x3b500000), SPH_C32(0x4bd013ff), SPH_C32(0x879b3418),
+      SPH_C32(0x694348c1), SPH_C32(0xca5a87fe), SPH_C32(0x819e0000),
+      SPH_C32(0xec570000), SPH_C32(0x66320280), SPH_C32(0x95f30000),
+      SPH_C32(0x5da92802), SPH_C32(0x48f43cbc), SPH_C32(0xe65aa22d),
+      SPH_C32(0x8e67b7fa) },
+    { SPH_C32(0x819e0000), SPH_C32(0xec570000), SPH_C32(0x66320280),
+      SPH_C32(0x95f30000), SPH_C32(0x5da92802), SPH_C32(0x48f43cbc),
+      SPH_C32(0xe65aa22d), SPH_C32(0x8e67b7fa), SPH_C32(0x4d8a0000),
+      SPH_C32(0x49340000), SPH_C32(0x3c8b0500), SPH_C32(0xaea30000),
+      SPH_C32(0x16793bfd), SPH_C32(0xcf6f08a4), SPH_C32(0x8f19eaec),
+      SPH_C32(0x443d3004) },
+    { SPH_C32(0x4d8a0000), SPH_C32(0x49340000), SPH_C32(0x3c8b0500),
+      SPH_C32(0xaea30000), SPH_C32(0x16793bfd), SPH_C32(0xcf6f08a4),
+      SPH_C32(0x8f19eaec), SPH_C32(0x443d3004), SPH_C32(0xcc140000),
+      SPH_C32(0xa5630000), SPH_C32(0x5ab90780), SPH_C32(0x3b500000),
+      SPH_C32(0x4bd013ff), SPH_C32(0x879b3418), SPH_C32(0x694348c1),
+      SPH_C32(0xca5a87fe) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x52500000), SPH_C32(0x29540000), SPH_C32(0x6a61004e),
+      SPH_C32(0xf0ff0000), SPH_C32(0x9a317eec), SPH_C32(0x452341ce),
+      SPH_C32(0xcf568fe5), SPH_C32(0x5303130f), SPH_C32(0x538d0000),
+      SPH_C32(0xa9fc0000), SPH_C32(0x9ef70006), SPH_C32(0x56ff0000),
+      SPH_C32(0x0ae4004e), SPH_C32(0x92c5cdf9), SPH_C32(0xa9444018),
+      SPH_C32(0x7f975691) },
+    { SPH_C32(0x538d0000), SPH_C32(0xa9fc0000), SPH_C32(0x9ef70006),
+      SPH_C32(0x56ff0000), SPH_C32(0x0ae4004e), SPH_C32(0x92c5cdf9),
+      SPH_C32(0xa9444018), SPH_C32(0x7f975691), SPH_C32(0x01dd0000),
+      SPH_C32(0x80a80000), SPH_C32(0xf4960048), SPH_C32(0xa6000000),
+      SPH_C32(0x90d57ea2), SPH_C32(0xd7e68c37), SPH_C32(0x6612cffd),
+      SPH_C32(0x2c94459e) },
+    { SPH_C32(0x01dd0000), SPH_C32(0x80a80000), SPH_C32(0xf4960048),
+      SPH_C32(0xa6000000), SPH_C32(0x90d57ea2), SPH_C32(0xd7e68c37),
+      SPH_C32(0x6612cffd), SPH_C32(0x2c94459e), SPH_C32(0x52500000),
+      SPH_C32(0x29540000), SPH_C32(0x6a61004e), SPH_C32(0xf0ff0000),
+      SPH_C32(0x9a317eec), SPH_C32(0x452341ce), SPH_C32(0xcf568fe5),
+      SPH_C32(0x5303130f) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x88980000), SPH_C32(0x1f940000), SPH_C32(0x7fcf002e),
+      SPH_C32(0xfb4e0000), SPH_C32(0xf158079a), SPH_C32(0x61ae9167),
+      SPH_C32(0xa895706c), SPH_C32(0xe6107494), SPH_C32(0x0bc20000),
+      SPH_C32(0xdb630000), SPH_C32(0x7e88000c), SPH_C32(0x15860000),
+      SPH_C32(0x91fd48f3), SPH_C32(0x7581bb43), SPH_C32(0xf460449e),
+      SPH_C32(0xd8b61463) },
+    { SPH_C32(0x0bc20000), SPH_C32(0xdb630000), SPH_C32(0x7e88000c),
+      SPH_C32(0x15860000), SPH_C32(0x91fd48f3), SPH_C32(0x7581bb43),
+      SPH_C32(0xf460449e), SPH_C32(0xd8b61463), SPH_C32(0x835a0000),
+      SPH_C32(0xc4f70000), SPH_C32(0x01470022), SPH_C32(0xeec80000),
+      SPH_C32(0x60a54f69), SPH_C32(0x142f2a24), SPH_C32(0x5cf534f2),
+      SPH_C32(0x3ea660f7) },
+    { SPH_C32(0x835a0000), SPH_C32(0xc4f70000), SPH_C32(0x01470022),
+      SPH_C32(0xeec80000), SPH_C32(0x60a54f69), SPH_C32(0x142f2a24),
+      SPH_C32(0x5cf534f2), SPH_C32(0x3ea660f7), SPH_C32(0x88980000),
+      SPH_C32(0x1f940000), SPH_C32(0x7fcf002e), SPH_C32(0xfb4e0000),
+      SPH_C32(0xf158079a), SPH_C32(0x61ae9167), SPH_C32(0xa895706c),
+      SPH_C32(0xe6107494) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xa53b0000), SPH_C32(0x14260000), SPH_C32(0x4e30001e),
+      SPH_C32(0x7cae0000), SPH_C32(0x8f9e0dd5), SPH_C32(0x78dfaa3d),
+      SPH_C32(0xf73168d8), SPH_C32(0x0b1b4946), SPH_C32(0x07ed0000),
+      SPH_C32(0xb2500000), SPH_C32(0x8774000a), SPH_C32(0x970d0000),
+      SPH_C32(0x437223ae), SPH_C32(0x48c76ea4), SPH_C32(0xf4786222),
+      SPH_C32(0x9075b1ce) },
+    { SPH_C32(0x07ed0000), SPH_C32(0xb2500000), SPH_C32(0x8774000a),
+      SPH_C32(0x970d0000), SPH_C32(0x437223ae), SPH_C32(0x48c76ea4),
+      SPH_C32(0xf4786222), SPH_C32(0x9075b1ce), SPH_C32(0xa2d60000),
+      SPH_C32(0xa6760000), SPH_C32(0xc9440014), SPH_C32(0xeba30000),
+      SPH_C32(0xccec2e7b), SPH_C32(0x3018c499), SPH_C32(0x03490afa),
+      SPH_C32(0x9b6ef888) },
+    { SPH_C32(0xa2d60000), SPH_C32(0xa6760000), SPH_C32(0xc9440014),
+      SPH_C32(0xeba30000), SPH_C32(0xccec2e7b), SPH_C32(0x3018c499),
+      SPH_C32(0x03490afa), SPH_C32(0x9b6ef888), SPH_C32(0xa53b0000),
+      SPH_C32(0x14260000), SPH_C32(0x4e30001e), SPH_C32(0x7cae0000),
+      SPH_C32(0x8f9e0dd5), SPH_C32(0x78dfaa3d), SPH_C32(0xf73168d8),
+      SPH_C32(0x0b1b4946) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x58430000), SPH_C32(0x807e0000), SPH_C32(0x78330001),
+      SPH_C32(0xc66b3800), SPH_C32(0xe7375cdc), SPH_C32(0x79ad3fdd),
+      SPH_C32(0xac73fe6f), SPH_C32(0x3a4479b1), SPH_C32(0x1d5a0000),
+      SPH_C32(0x2b720000), SPH_C32(0x488d0000), SPH_C32(0xaf611800),
+      SPH_C32(0x25cb2ec5), SPH_C32(0xc879bfd0), SPH_C32(0x81a20429),
+      SPH_C32(0x1e7536a6) },
+    { SPH_C32(0x1d5a0000), SPH_C32(0x2b720000), SPH_C32(0x488d0000),
+      SPH_C32(0xaf611800), SPH_C32(0x25cb2ec5), SPH_C32(0xc879bfd0),
+      SPH_C32(0x81a20429), SPH_C32(0x1e7536a6), SPH_C32(0x45190000),
+      SPH_C32(0xab0c0000), SPH_C32(0x30be0001), SPH_C32(0x690a2000),
+      SPH_C32(0xc2fc7219), SPH_C32(0xb1d4800d), SPH_C32(0x2dd1fa46),
+      SPH_C32(0x24314f17) },
+    { SPH_C32(0x45190000), SPH_C32(0xab0c0000), SPH_C32(0x30be0001),
+      SPH_C32(0x690a2000), SPH_C32(0xc2fc7219), SPH_C32(0xb1d4800d),
+      SPH_C32(0x2dd1fa46), SPH_C32(0x24314f17), SPH_C32(0x58430000),
+      SPH_C32(0x807e0000), SPH_C32(0x78330001), SPH_C32(0xc66b3800),
+      SPH_C32(0xe7375cdc), SPH_C32(0x79ad3fdd), SPH_C32(0xac73fe6f),
+      SPH_C32(0x3a4479b1) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x1e6c0000), SPH_C32(0xc4420000), SPH_C32(0x8a2e0000),
+      SPH_C32(0xbcb6b800), SPH_C32(0x2c4413b6), SPH_C32(0x8bfdd3da),
+      SPH_C32(0x6a0c1bc8), SPH_C32(0xb99dc2eb), SPH_C32(0x92560000),
+      SPH_C32(0x1eda0000), SPH_C32(0xea510000), SPH_C32(0xe8b13000),
+      SPH_C32(0xa93556a5), SPH_C32(0xebfb6199), SPH_C32(0xb15c2254),
+      SPH_C32(0x33c5244f) },
+    { SPH_C32(0x92560000), SPH_C32(0x1eda0000), SPH_C32(0xea510000),
+      SPH_C32(0xe8b13000), SPH_C32(0xa93556a5), SPH_C32(0xebfb6199),
+      SPH_C32(0xb15c2254), SPH_C32(0x33c5244f), SPH_C32(0x8c3a0000),
+      SPH_C32(0xda980000), SPH_C32(0x607f0000), SPH_C32(0x54078800),
+      SPH_C32(0x85714513), SPH_C32(0x6006b243), SPH_C32(0xdb50399c),
+      SPH_C32(0x8a58e6a4) },
+    { SPH_C32(0x8c3a0000), SPH_C32(0xda980000), SPH_C32(0x607f0000),
+      SPH_C32(0x54078800), SPH_C32(0x85714513), SPH_C32(0x6006b243),
+      SPH_C32(0xdb50399c), SPH_C32(0x8a58e6a4), SPH_C32(0x1e6c0000),
+      SPH_C32(0xc4420000), SPH_C32(0x8a2e0000), SPH_C32(0xbcb6b800),
+      SPH_C32(0x2c4413b6), SPH_C32(0x8bfdd3da), SPH_C32(0x6a0c1bc8),
+      SPH_C32(0xb99dc2eb) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x02f20000), SPH_C32(0xa2810000), SPH_C32(0x873f0000),
+      SPH_C32(0xe36c7800), SPH_C32(0x1e1d74ef), SPH_C32(0x073d2bd6),
+      SPH_C32(0xc4c23237), SPH_C32(0x7f32259e), SPH_C32(0xbadd0000),
+      SPH_C32(0x13ad0000), SPH_C32(0xb7e70000), SPH_C32(0xf7282800),
+      SPH_C32(0xdf45144d), SPH_C32(0x361ac33a), SPH_C32(0xea5a8d14),
+      SPH_C32(0x2a2c18f0) },
+    { SPH_C32(0xbadd0000), SPH_C32(0x13ad0000), SPH_C32(0xb7e70000),
+      SPH_C32(0xf7282800), SPH_C32(0xdf45144d), SPH_C32(0x361ac33a),
+      SPH_C32(0xea5a8d14), SPH_C32(0x2a2c18f0), SPH_C32(0xb82f0000),
+      SPH_C32(0xb12c0000), SPH_C32(0x30d80000), SPH_C32(0x14445000),
+      SPH_C32(0xc15860a2), SPH_C32(0x3127e8ec), SPH_C32(0x2e98bf23),
+      SPH_C32(0x551e3d6e) },
+    { SPH_C32(0xb82f0000), SPH_C32(0xb12c0000), SPH_C32(0x30d80000),
+      SPH_C32(0x14445000), SPH_C32(0xc15860a2), SPH_C32(0x3127e8ec),
+      SPH_C32(0x2e98bf23), SPH_C32(0x551e3d6e), SPH_C32(0x02f20000),
+      SPH_C32(0xa2810000), SPH_C32(0x873f0000), SPH_C32(0xe36c7800),
+      SPH_C32(0x1e1d74ef), SPH_C32(0x073d2bd6), SPH_C32(0xc4c23237),
+      SPH_C32(0x7f32259e) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xb4310000), SPH_C32(0x77330000), SPH_C32(0xb15d0000),
+      SPH_C32(0x7fd004e0), SPH_C32(0x78a26138), SPH_C32(0xd116c35d),
+      SPH_C32(0xd256d489), SPH_C32(0x4e6f74de), SPH_C32(0xe3060000),
+      SPH_C32(0xbdc10000), SPH_C32(0x87130000), SPH_C32(0xbff20060),
+      SPH_C32(0x2eba0a1a), SPH_C32(0x8db53751), SPH_C32(0x73c5ab06),
+      SPH_C32(0x5bd61539) },
+    { SPH_C32(0xe3060000), SPH_C32(0xbdc10000), SPH_C32(0x87130000),
+      SPH_C32(0xbff20060), SPH_C32(0x2eba0a1a), SPH_C32(0x8db53751),
+      SPH_C32(0x73c5ab06), SPH_C32(0x5bd61539), SPH_C32(0x57370000),
+      SPH_C32(0xcaf20000), SPH_C32(0x364e0000), SPH_C32(0xc0220480),
+      SPH_C32(0x56186b22), SPH_C32(0x5ca3f40c), SPH_C32(0xa1937f8f),
+      SPH_C32(0x15b961e7) },
+    { SPH_C32(0x57370000), SPH_C32(0xcaf20000), SPH_C32(0x364e0000),
+      SPH_C32(0xc0220480), SPH_C32(0x56186b22), SPH_C32(0x5ca3f40c),
+      SPH_C32(0xa1937f8f), SPH_C32(0x15b961e7), SPH_C32(0xb4310000),
+      SPH_C32(0x77330000), SPH_C32(0xb15d0000), SPH_C32(0x7fd004e0),
+      SPH_C32(0x78a26138), SPH_C32(0xd116c35d), SPH_C32(0xd256d489),
+      SPH_C32(0x4e6f74de) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xe6280000), SPH_C32(0x4c4b0000), SPH_C32(0xa8550000),
+      SPH_C32(0xd3d002e0), SPH_C32(0xd86130b8), SPH_C32(0x98a7b0da),
+      SPH_C32(0x289506b4), SPH_C32(0xd75a4897), SPH_C32(0xf0c50000),
+      SPH_C32(0x59230000), SPH_C32(0x45820000), SPH_C32(0xe18d00c0),
+      SPH_C32(0x3b6d0631), SPH_C32(0xc2ed5699), SPH_C32(0xcbe0fe1c),
+      SPH_C32(0x56a7b19f) },
+    { SPH_C32(0xf0c50000), SPH_C32(0x59230000), SPH_C32(0x45820000),
+      SPH_C32(0xe18d00c0), SPH_C32(0x3b6d0631), SPH_C32(0xc2ed5699),
+      SPH_C32(0xcbe0fe1c), SPH_C32(0x56a7b19f), SPH_C32(0x16ed0000),
+      SPH_C32(0x15680000), SPH_C32(0xedd70000), SPH_C32(0x325d0220),
+      SPH_C32(0xe30c3689), SPH_C32(0x5a4ae643), SPH_C32(0xe375f8a8),
+      SPH_C32(0x81fdf908) },
+    { SPH_C32(0x16ed0000), SPH_C32(0x15680000), SPH_C32(0xedd70000),
+      SPH_C32(0x325d0220), SPH_C32(0xe30c3689), SPH_C32(0x5a4ae643),
+      SPH_C32(0xe375f8a8), SPH_C32(0x81fdf908), SPH_C32(0xe6280000),
+      SPH_C32(0x4c4b0000), SPH_C32(0xa8550000), SPH_C32(0xd3d002e0),
+      SPH_C32(0xd86130b8), SPH_C32(0x98a7b0da), SPH_C32(0x289506b4),
+      SPH_C32(0xd75a4897) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xee930000), SPH_C32(0xd6070000), SPH_C32(0x92c10000),
+      SPH_C32(0x2b9801e0), SPH_C32(0x9451287c), SPH_C32(0x3b6cfb57),
+      SPH_C32(0x45312374), SPH_C32(0x201f6a64), SPH_C32(0x7b280000),
+      SPH_C32(0x57420000), SPH_C32(0xa9e50000), SPH_C32(0x634300a0),
+      SPH_C32(0x9edb442f), SPH_C32(0x6d9995bb), SPH_C32(0x27f83b03),
+      SPH_C32(0xc7ff60f0) },
+    { SPH_C32(0x7b280000), SPH_C32(0x57420000), SPH_C32(0xa9e50000),
+      SPH_C32(0x634300a0), SPH_C32(0x9edb442f), SPH_C32(0x6d9995bb),
+      SPH_C32(0x27f83b03), SPH_C32(0xc7ff60f0), SPH_C32(0x95bb0000),
+      SPH_C32(0x81450000), SPH_C32(0x3b240000), SPH_C32(0x48db0140),
+      SPH_C32(0x0a8a6c53), SPH_C32(0x56f56eec), SPH_C32(0x62c91877),
+      SPH_C32(0xe7e00a94) },
+    { SPH_C32(0x95bb0000), SPH_C32(0x81450000), SPH_C32(0x3b240000),
+      SPH_C32(0x48db0140), SPH_C32(0x0a8a6c53), SPH_C32(0x56f56eec),
+      SPH_C32(0x62c91877), SPH_C32(0xe7e00a94), SPH_C32(0xee930000),
+      SPH_C32(0xd6070000), SPH_C32(0x92c10000), SPH_C32(0x2b9801e0),
+      SPH_C32(0x9451287c), SPH_C32(0x3b6cfb57), SPH_C32(0x45312374),
+      SPH_C32(0x201f6a64) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x5fa80000), SPH_C32(0x56030000), SPH_C32(0x43ae0000),
+      SPH_C32(0x64f30013), SPH_C32(0x257e86bf), SPH_C32(0x1311944e),
+      SPH_C32(0x541e95bf), SPH_C32(0x8ea4db69), SPH_C32(0x00440000),
+      SPH_C32(0x7f480000), SPH_C32(0xda7c0000), SPH_C32(0x2a230001),
+      SPH_C32(0x3badc9cc), SPH_C32(0xa9b69c87), SPH_C32(0x030a9e60),
+      SPH_C32(0xbe0a679e) },
+    { SPH_C32(0x00440000), SPH_C32(0x7f480000), SPH_C32(0xda7c0000),
+      SPH_C32(0x2a230001), SPH_C32(0x3badc9cc), SPH_C32(0xa9b69c87),
+      SPH_C32(0x030a9e60), SPH_C32(0xbe0a679e), SPH_C32(0x5fec0000),
+      SPH_C32(0x294b0000), SPH_C32(0x99d20000), SPH_C32(0x4ed00012),
+      SPH_C32(0x1ed34f73), SPH_C32(0xbaa708c9), SPH_C32(0x57140bdf),
+      SPH_C32(0x30aebcf7) },
+    { SPH_C32(0x5fec0000), SPH_C32(0x294b0000), SPH_C32(0x99d20000),
+      SPH_C32(0x4ed00012), SPH_C32(0x1ed34f73), SPH_C32(0xbaa708c9),
+      SPH_C32(0x57140bdf), SPH_C32(0x30aebcf7), SPH_C32(0x5fa80000),
+      SPH_C32(0x56030000), SPH_C32(0x43ae0000), SPH_C32(0x64f30013),
+      SPH_C32(0x257e86bf), SPH_C32(0x1311944e), SPH_C32(0x541e95bf),
+      SPH_C32(0x8ea4db69) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x01930000), SPH_C32(0xe7820000), SPH_C32(0xedfb0000),
+      SPH_C32(0xcf0c000b), SPH_C32(0x8dd08d58), SPH_C32(0xbca3b42e),
+      SPH_C32(0x063661e1), SPH_C32(0x536f9e7b), SPH_C32(0x92280000),
+      SPH_C32(0xdc850000), SPH_C32(0x57fa0000), SPH_C32(0x56dc0003),
+      SPH_C32(0xbae92316), SPH_C32(0x5aefa30c), SPH_C32(0x90cef752),
+      SPH_C32(0x7b1675d7) },
+    { SPH_C32(0x92280000), SPH_C32(0xdc850000), SPH_C32(0x57fa0000),
+      SPH_C32(0x56dc0003), SPH_C32(0xbae92316), SPH_C32(0x5aefa30c),
+      SPH_C32(0x90cef752), SPH_C32(0x7b1675d7), SPH_C32(0x93bb0000),
+      SPH_C32(0x3b070000), SPH_C32(0xba010000), SPH_C32(0x99d00008),
+      SPH_C32(0x3739ae4e), SPH_C32(0xe64c1722), SPH_C32(0x96f896b3),
+      SPH_C32(0x2879ebac) },
+    { SPH_C32(0x93bb0000), SPH_C32(0x3b070000), SPH_C32(0xba010000),
+      SPH_C32(0x99d00008), SPH_C32(0x3739ae4e), SPH_C32(0xe64c1722),
+      SPH_C32(0x96f896b3), SPH_C32(0x2879ebac), SPH_C32(0x01930000),
+      SPH_C32(0xe7820000), SPH_C32(0xedfb0000), SPH_C32(0xcf0c000b),
+      SPH_C32(0x8dd08d58), SPH_C32(0xbca3b42e), SPH_C32(0x063661e1),
+      SPH_C32(0x536f9e7b) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x033d0000), SPH_C32(0x08b30000), SPH_C32(0xf33a0000),
+      SPH_C32(0x3ac20007), SPH_C32(0x51298a50), SPH_C32(0x6b6e661f),
+      SPH_C32(0x0ea5cfe3), SPH_C32(0xe6da7ffe), SPH_C32(0xa8da0000),
+      SPH_C32(0x96be0000), SPH_C32(0x5c1d0000), SPH_C32(0x07da0002),
+      SPH_C32(0x7d669583), SPH_C32(0x1f98708a), SPH_C32(0xbb668808),
+      SPH_C32(0xda878000) },
+    { SPH_C32(0xa8da0000), SPH_C32(0x96be0000), SPH_C32(0x5c1d0000),
+      SPH_C32(0x07da0002), SPH_C32(0x7d669583), SPH_C32(0x1f98708a),
+      SPH_C32(0xbb668808), SPH_C32(0xda878000), SPH_C32(0xabe70000),
+      SPH_C32(0x9e0d0000), SPH_C32(0xaf270000), SPH_C32(0x3d180005),
+      SPH_C32(0x2c4f1fd3), SPH_C32(0x74f61695), SPH_C32(0xb5c347eb),
+      SPH_C32(0x3c5dfffe) },
+    { SPH_C32(0xabe70000), SPH_C32(0x9e0d0000), SPH_C32(0xaf270000),
+      SPH_C32(0x3d180005), SPH_C32(0x2c4f1fd3), SPH_C32(0x74f61695),
+      SPH_C32(0xb5c347eb), SPH_C32(0x3c5dfffe), SPH_C32(0x033d0000),
+      SPH_C32(0x08b30000), SPH_C32(0xf33a0000), SPH_C32(0x3ac20007),
+      SPH_C32(0x51298a50), SPH_C32(0x6b6e661f), SPH_C32(0x0ea5cfe3),
+      SPH_C32(0xe6da7ffe) }
+  }
+};
+
+#define INPUT_BIG   do { \
+    __constant const sph_u32 *rp; \
+    unsigned u; \
+    m0 = 0; \
+    m1 = 0; \
+    m2 = 0; \
+    m3 = 0; \
+    m4 = 0; \
+    m5 = 0; \
+    m6 = 0; \
+    m7 = 0; \
+    m8 = 0; \
+    m9 = 0; \
+    mA = 0; \
+    mB = 0; \
+    mC = 0; \
+    mD = 0; \
+    mE = 0; \
+    mF = 0; \
+    for (u = 0; u < 32; u ++) { \
+      rp = &T512_N2[u][(buf((u >> 2)) >> (6 - 2 * (u & 3))) & 0x03][0]; \
+      m0 ^= rp[0]; \
+      m1 ^= rp[1]; \
+      m2 ^= rp[2]; \
+      m3 ^= rp[3]; \
+      m4 ^= rp[4]; \
+      m5 ^= rp[5]; \
+      m6 ^= rp[6]; \
+      m7 ^= rp[7]; \
+      m8 ^= rp[8]; \
+      m9 ^= rp[9]; \
+      mA ^= rp[10]; \
+      mB ^= rp[11]; \
+      mC ^= rp[12]; \
+      mD ^= rp[13]; \
+      mE ^= rp[14]; \
+      mF ^= rp[15]; \
+    } \
+  } while (0)
+
+#endif
+
+#if SPH_HAMSI_EXPAND_BIG == 4
+
+__constant static const sph_u32 T512_N4[16][16][16] = {
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x54285c00), SPH_C32(0xeaed0000), SPH_C32(0xc5d60000),
+      SPH_C32(0xa1c50000), SPH_C32(0xb3a26770), SPH_C32(0x94a5c4e1),
+      SPH_C32(0x6bb0419d), SPH_C32(0x551b3782), SPH_C32(0x9cbb1800),
+      SPH_C32(0xb0d30000), SPH_C32(0x92510000), SPH_C32(0xed930000),
+      SPH_C32(0x593a4345), SPH_C32(0xe114d5f4), SPH_C32(0x430633da),
+      SPH_C32(0x78cace29) },
+    { SPH_C32(0x9cbb1800), SPH_C32(0xb0d30000), SPH_C32(0x92510000),
+      SPH_C32(0xed930000), SPH_C32(0x593a4345), SPH_C32(0xe114d5f4),
+      SPH_C32(0x430633da), SPH_C32(0x78cace29), SPH_C32(0xc8934400),
+      SPH_C32(0x5a3e0000), SPH_C32(0x57870000), SPH_C32(0x4c560000),
+      SPH_C32(0xea982435), SPH_C32(0x75b11115), SPH_C32(0x28b67247),
+      SPH_C32(0x2dd1f9ab) },
+    { SPH_C32(0xc8934400), SPH_C32(0x5a3e0000), SPH_C32(0x57870000),
+      SPH_C32(0x4c560000), SPH_C32(0xea982435), SPH_C32(0x75b11115),
+      SPH_C32(0x28b67247), SPH_C32(0x2dd1f9ab), SPH_C32(0x54285c00),
+      SPH_C32(0xeaed0000), SPH_C32(0xc5d60000), SPH_C32(0xa1c50000),
+      SPH_C32(0xb3a26770), SPH_C32(0x94a5c4e1), SPH_C32(0x6bb0419d),
+      SPH_C32(0x551b3782) },
+    { SPH_C32(0x29449c00), SPH_C32(0x64e70000), SPH_C32(0xf24b0000),
+      SPH_C32(0xc2f30000), SPH_C32(0x0ede4e8f), SPH_C32(0x56c23745),
+      SPH_C32(0xf3e04259), SPH_C32(0x8d0d9ec4), SPH_C32(0x466d0c00),
+      SPH_C32(0x08620000), SPH_C32(0xdd5d0000), SPH_C32(0xbadd0000),
+      SPH_C32(0x6a927942), SPH_C32(0x441f2b93), SPH_C32(0x218ace6f),
+      SPH_C32(0xbf2c0be2) },
+    { SPH_C32(0x7d6cc000), SPH_C32(0x8e0a0000), SPH_C32(0x379d0000),
+      SPH_C32(0x63360000), SPH_C32(0xbd7c29ff), SPH_C32(0xc267f3a4),
+      SPH_C32(0x985003c4), SPH_C32(0xd816a946), SPH_C32(0xdad61400),
+      SPH_C32(0xb8b10000), SPH_C32(0x4f0c0000), SPH_C32(0x574e0000),
+      SPH_C32(0x33a83a07), SPH_C32(0xa50bfe67), SPH_C32(0x628cfdb5),
+      SPH_C32(0xc7e6c5cb) },
+    { SPH_C32(0xb5ff8400), SPH_C32(0xd4340000), SPH_C32(0x601a0000),
+      SPH_C32(0x2f600000), SPH_C32(0x57e40dca), SPH_C32(0xb7d6e2b1),
+      SPH_C32(0xb0e67183), SPH_C32(0xf5c750ed), SPH_C32(0x8efe4800),
+      SPH_C32(0x525c0000), SPH_C32(0x8ada0000), SPH_C32(0xf68b0000),
+      SPH_C32(0x800a5d77), SPH_C32(0x31ae3a86), SPH_C32(0x093cbc28),
+      SPH_C32(0x92fdf249) },
+    { SPH_C32(0xe1d7d800), SPH_C32(0x3ed90000), SPH_C32(0xa5cc0000),
+      SPH_C32(0x8ea50000), SPH_C32(0xe4466aba), SPH_C32(0x23732650),
+      SPH_C32(0xdb56301e), SPH_C32(0xa0dc676f), SPH_C32(0x12455000),
+      SPH_C32(0xe28f0000), SPH_C32(0x188b0000), SPH_C32(0x1b180000),
+      SPH_C32(0xd9301e32), SPH_C32(0xd0baef72), SPH_C32(0x4a3a8ff2),
+      SPH_C32(0xea373c60) },
+    { SPH_C32(0x466d0c00), SPH_C32(0x08620000), SPH_C32(0xdd5d0000),
+      SPH_C32(0xbadd0000), SPH_C32(0x6a927942), SPH_C32(0x441f2b93),
+      SPH_C32(0x218ace6f), SPH_C32(0xbf2c0be2), SPH_C32(0x6f299000),
+      SPH_C32(0x6c850000), SPH_C32(0x2f160000), SPH_C32(0x782e0000),
+      SPH_C32(0x644c37cd), SPH_C32(0x12dd1cd6), SPH_C32(0xd26a8c36),
+      SPH_C32(0x32219526) },
+    { SPH_C32(0x12455000), SPH_C32(0xe28f0000), SPH_C32(0x188b0000),
+      SPH_C32(0x1b180000), SPH_C32(0xd9301e32), SPH_C32(0xd0baef72),
+      SPH_C32(0x4a3a8ff2), SPH_C32(0xea373c60), SPH_C32(0xf3928800),
+      SPH_C32(0xdc560000), SPH_C32(0xbd470000), SPH_C32(0x95bd0000),
+      SPH_C32(0x3d767488), SPH_C32(0xf3c9c922), SPH_C32(0x916cbfec),
+      SPH_C32(0x4aeb5b0f) },
+    { SPH_C32(0xdad61400), SPH_C32(0xb8b10000), SPH_C32(0x4f0c0000),
+      SPH_C32(0x574e0000), SPH_C32(0x33a83a07), SPH_C32(0xa50bfe67),
+      SPH_C32(0x628cfdb5), SPH_C32(0xc7e6c5cb), SPH_C32(0xa7bad400),
+      SPH_C32(0x36bb0000), SPH_C32(0x78910000), SPH_C32(0x34780000),
+      SPH_C32(0x8ed413f8), SPH_C32(0x676c0dc3), SPH_C32(0xfadcfe71),
+      SPH_C32(0x1ff06c8d) },
+    { SPH_C32(0x8efe4800), SPH_C32(0x525c0000), SPH_C32(0x8ada0000),
+      SPH_C32(0xf68b0000), SPH_C32(0x800a5d77), SPH_C32(0x31ae3a86),
+      SPH_C32(0x093cbc28), SPH_C32(0x92fdf249), SPH_C32(0x3b01cc00),
+      SPH_C32(0x86680000), SPH_C32(0xeac00000), SPH_C32(0xd9eb0000),
+      SPH_C32(0xd7ee50bd), SPH_C32(0x8678d837), SPH_C32(0xb9dacdab),
+      SPH_C32(0x673aa2a4) },
+    { SPH_C32(0x6f299000), SPH_C32(0x6c850000), SPH_C32(0x2f160000),
+      SPH_C32(0x782e0000), SPH_C32(0x644c37cd), SPH_C32(0x12dd1cd6),
+      SPH_C32(0xd26a8c36), SPH_C32(0x32219526), SPH_C32(0x29449c00),
+      SPH_C32(0x64e70000), SPH_C32(0xf24b0000), SPH_C32(0xc2f30000),
+      SPH_C32(0x0ede4e8f), SPH_C32(0x56c23745), SPH_C32(0xf3e04259),
+      SPH_C32(0x8d0d9ec4) },
+    { SPH_C32(0x3b01cc00), SPH_C32(0x86680000), SPH_C32(0xeac00000),
+      SPH_C32(0xd9eb0000), SPH_C32(0xd7ee50bd), SPH_C32(0x8678d837),
+      SPH_C32(0xb9dacdab), SPH_C32(0x673aa2a4), SPH_C32(0xb5ff8400),
+      SPH_C32(0xd4340000), SPH_C32(0x601a0000), SPH_C32(0x2f600000),
+      SPH_C32(0x57e40dca), SPH_C32(0xb7d6e2b1), SPH_C32(0xb0e67183),
+      SPH_C32(0xf5c750ed) },
+    { SPH_C32(0xf3928800), SPH_C32(0xdc560000), SPH_C32(0xbd470000),
+      SPH_C32(0x95bd0000), SPH_C32(0x3d767488), SPH_C32(0xf3c9c922),
+      SPH_C32(0x916cbfec), SPH_C32(0x4aeb5b0f), SPH_C32(0xe1d7d800),
+      SPH_C32(0x3ed90000), SPH_C32(0xa5cc0000), SPH_C32(0x8ea50000),
+      SPH_C32(0xe4466aba), SPH_C32(0x23732650), SPH_C32(0xdb56301e),
+      SPH_C32(0xa0dc676f) },
+    { SPH_C32(0xa7bad400), SPH_C32(0x36bb0000), SPH_C32(0x78910000),
+      SPH_C32(0x34780000), SPH_C32(0x8ed413f8), SPH_C32(0x676c0dc3),
+      SPH_C32(0xfadcfe71), SPH_C32(0x1ff06c8d), SPH_C32(0x7d6cc000),
+      SPH_C32(0x8e0a0000), SPH_C32(0x379d0000), SPH_C32(0x63360000),
+      SPH_C32(0xbd7c29ff), SPH_C32(0xc267f3a4), SPH_C32(0x985003c4),
+      SPH_C32(0xd816a946) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xef0b0270), SPH_C32(0x3afd0000), SPH_C32(0x5dae0000),
+      SPH_C32(0x69490000), SPH_C32(0x9b0f3c06), SPH_C32(0x4405b5f9),
+      SPH_C32(0x66140a51), SPH_C32(0x924f5d0a), SPH_C32(0xc96b0030),
+      SPH_C32(0xe7250000), SPH_C32(0x2f840000), SPH_C32(0x264f0000),
+      SPH_C32(0x08695bf9), SPH_C32(0x6dfcf137), SPH_C32(0x509f6984),
+      SPH_C32(0x9e69af68) },
+    { SPH_C32(0xc96b0030), SPH_C32(0xe7250000), SPH_C32(0x2f840000),
+      SPH_C32(0x264f0000), SPH_C32(0x08695bf9), SPH_C32(0x6dfcf137),
+      SPH_C32(0x509f6984), SPH_C32(0x9e69af68), SPH_C32(0x26600240),
+      SPH_C32(0xddd80000), SPH_C32(0x722a0000), SPH_C32(0x4f060000),
+      SPH_C32(0x936667ff), SPH_C32(0x29f944ce), SPH_C32(0x368b63d5),
+      SPH_C32(0x0c26f262) },
+    { SPH_C32(0x26600240), SPH_C32(0xddd80000), SPH_C32(0x722a0000),
+      SPH_C32(0x4f060000), SPH_C32(0x936667ff), SPH_C32(0x29f944ce),
+      SPH_C32(0x368b63d5), SPH_C32(0x0c26f262), SPH_C32(0xef0b0270),
+      SPH_C32(0x3afd0000), SPH_C32(0x5dae0000), SPH_C32(0x69490000),
+      SPH_C32(0x9b0f3c06), SPH_C32(0x4405b5f9), SPH_C32(0x66140a51),
+      SPH_C32(0x924f5d0a) },
+    { SPH_C32(0x145a3c00), SPH_C32(0xb9e90000), SPH_C32(0x61270000),
+      SPH_C32(0xf1610000), SPH_C32(0xce613d6c), SPH_C32(0xb0493d78),
+      SPH_C32(0x47a96720), SPH_C32(0xe18e24c5), SPH_C32(0x23671400),
+      SPH_C32(0xc8b90000), SPH_C32(0xf4c70000), SPH_C32(0xfb750000),
+      SPH_C32(0x73cd2465), SPH_C32(0xf8a6a549), SPH_C32(0x02c40a3f),
+      SPH_C32(0xdc24e61f) },
+    { SPH_C32(0xfb513e70), SPH_C32(0x83140000), SPH_C32(0x3c890000),
+      SPH_C32(0x98280000), SPH_C32(0x556e016a), SPH_C32(0xf44c8881),
+      SPH_C32(0x21bd6d71), SPH_C32(0x73c179cf), SPH_C32(0xea0c1430),
+      SPH_C32(0x2f9c0000), SPH_C32(0xdb430000), SPH_C32(0xdd3a0000),
+      SPH_C32(0x7ba47f9c), SPH_C32(0x955a547e), SPH_C32(0x525b63bb),
+      SPH_C32(0x424d4977) },
+    { SPH_C32(0xdd313c30), SPH_C32(0x5ecc0000), SPH_C32(0x4ea30000),
+      SPH_C32(0xd72e0000), SPH_C32(0xc6086695), SPH_C32(0xddb5cc4f),
+      SPH_C32(0x17360ea4), SPH_C32(0x7fe78bad), SPH_C32(0x05071640),
+      SPH_C32(0x15610000), SPH_C32(0x86ed0000), SPH_C32(0xb4730000),
+      SPH_C32(0xe0ab439a), SPH_C32(0xd15fe187), SPH_C32(0x344f69ea),
+      SPH_C32(0xd002147d) },
+    { SPH_C32(0x323a3e40), SPH_C32(0x64310000), SPH_C32(0x130d0000),
+      SPH_C32(0xbe670000), SPH_C32(0x5d075a93), SPH_C32(0x99b079b6),
+      SPH_C32(0x712204f5), SPH_C32(0xeda8d6a7), SPH_C32(0xcc6c1670),
+      SPH_C32(0xf2440000), SPH_C32(0xa9690000), SPH_C32(0x923c0000),
+      SPH_C32(0xe8c21863), SPH_C32(0xbca310b0), SPH_C32(0x64d0006e),
+      SPH_C32(0x4e6bbb15) },
+    { SPH_C32(0x23671400), SPH_C32(0xc8b90000), SPH_C32(0xf4c70000),
+      SPH_C32(0xfb750000), SPH_C32(0x73cd2465), SPH_C32(0xf8a6a549),
+      SPH_C32(0x02c40a3f), SPH_C32(0xdc24e61f), SPH_C32(0x373d2800),
+      SPH_C32(0x71500000), SPH_C32(0x95e00000), SPH_C32(0x0a140000),
+      SPH_C32(0xbdac1909), SPH_C32(0x48ef9831), SPH_C32(0x456d6d1f),
+      SPH_C32(0x3daac2da) },
+    { SPH_C32(0xcc6c1670), SPH_C32(0xf2440000), SPH_C32(0xa9690000),
+      SPH_C32(0x923c0000), SPH_C32(0xe8c21863), SPH_C32(0xbca310b0),
+      SPH_C32(0x64d0006e), SPH_C32(0x4e6bbb15), SPH_C32(0xfe562830),
+      SPH_C32(0x96750000), SPH_C32(0xba640000), SPH_C32(0x2c5b0000),
+      SPH_C32(0xb5c542f0), SPH_C32(0x25136906), SPH_C32(0x15f2049b),
+      SPH_C32(0xa3c36db2) },
+    { SPH_C32(0xea0c1430), SPH_C32(0x2f9c0000), SPH_C32(0xdb430000),
+      SPH_C32(0xdd3a0000), SPH_C32(0x7ba47f9c), SPH_C32(0x955a547e),
+      SPH_C32(0x525b63bb), SPH_C32(0x424d4977), SPH_C32(0x115d2a40),
+      SPH_C32(0xac880000), SPH_C32(0xe7ca0000), SPH_C32(0x45120000),
+      SPH_C32(0x2eca7ef6), SPH_C32(0x6116dcff), SPH_C32(0x73e60eca),
+      SPH_C32(0x318c30b8) },
+    { SPH_C32(0x05071640), SPH_C32(0x15610000), SPH_C32(0x86ed0000),
+      SPH_C32(0xb4730000), SPH_C32(0xe0ab439a), SPH_C32(0xd15fe187),
+      SPH_C32(0x344f69ea), SPH_C32(0xd002147d), SPH_C32(0xd8362a70),
+      SPH_C32(0x4bad0000), SPH_C32(0xc84e0000), SPH_C32(0x635d0000),
+      SPH_C32(0x26a3250f), SPH_C32(0x0cea2dc8), SPH_C32(0x2379674e),
+      SPH_C32(0xafe59fd0) },
+    { SPH_C32(0x373d2800), SPH_C32(0x71500000), SPH_C32(0x95e00000),
+      SPH_C32(0x0a140000), SPH_C32(0xbdac1909), SPH_C32(0x48ef9831),
+      SPH_C32(0x456d6d1f), SPH_C32(0x3daac2da), SPH_C32(0x145a3c00),
+      SPH_C32(0xb9e90000), SPH_C32(0x61270000), SPH_C32(0xf1610000),
+      SPH_C32(0xce613d6c), SPH_C32(0xb0493d78), SPH_C32(0x47a96720),
+      SPH_C32(0xe18e24c5) },
+    { SPH_C32(0xd8362a70), SPH_C32(0x4bad0000), SPH_C32(0xc84e0000),
+      SPH_C32(0x635d0000), SPH_C32(0x26a3250f), SPH_C32(0x0cea2dc8),
+      SPH_C32(0x2379674e), SPH_C32(0xafe59fd0), SPH_C32(0xdd313c30),
+      SPH_C32(0x5ecc0000), SPH_C32(0x4ea30000), SPH_C32(0xd72e0000),
+      SPH_C32(0xc6086695), SPH_C32(0xddb5cc4f), SPH_C32(0x17360ea4),
+      SPH_C32(0x7fe78bad) },
+    { SPH_C32(0xfe562830), SPH_C32(0x96750000), SPH_C32(0xba640000),
+      SPH_C32(0x2c5b0000), SPH_C32(0xb5c542f0), SPH_C32(0x25136906),
+      SPH_C32(0x15f2049b), SPH_C32(0xa3c36db2), SPH_C32(0x323a3e40),
+      SPH_C32(0x64310000), SPH_C32(0x130d0000), SPH_C32(0xbe670000),
+      SPH_C32(0x5d075a93), SPH_C32(0x99b079b6), SPH_C32(0x712204f5),
+      SPH_C32(0xeda8d6a7) },
+    { SPH_C32(0x115d2a40), SPH_C32(0xac880000), SPH_C32(0xe7ca0000),
+      SPH_C32(0x45120000), SPH_C32(0x2eca7ef6), SPH_C32(0x6116dcff),
+      SPH_C32(0x73e60eca), SPH_C32(0x318c30b8), SPH_C32(0xfb513e70),
+      SPH_C32(0x83140000), SPH_C32(0x3c890000), SPH_C32(0x98280000),
+      SPH_C32(0x556e016a), SPH_C32(0xf44c8881), SPH_C32(0x21bd6d71),
+      SPH_C32(0x73c179cf) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x774400f0), SPH_C32(0xf15a0000), SPH_C32(0xf5b20000),
+      SPH_C32(0x34140000), SPH_C32(0x89377e8c), SPH_C32(0x5a8bec25),
+      SPH_C32(0x0bc3cd1e), SPH_C32(0xcf3775cb), SPH_C32(0xf46c0050),
+      SPH_C32(0x96180000), SPH_C32(0x14a50000), SPH_C32(0x031f0000),
+      SPH_C32(0x42947eb8), SPH_C32(0x66bf7e19), SPH_C32(0x9ca470d2),
+      SPH_C32(0x8a341574) },
+    { SPH_C32(0xf46c0050), SPH_C32(0x96180000), SPH_C32(0x14a50000),
+      SPH_C32(0x031f0000), SPH_C32(0x42947eb8), SPH_C32(0x66bf7e19),
+      SPH_C32(0x9ca470d2), SPH_C32(0x8a341574), SPH_C32(0x832800a0),
+      SPH_C32(0x67420000), SPH_C32(0xe1170000), SPH_C32(0x370b0000),
+      SPH_C32(0xcba30034), SPH_C32(0x3c34923c), SPH_C32(0x9767bdcc),
+      SPH_C32(0x450360bf) },
+    { SPH_C32(0x832800a0), SPH_C32(0x67420000), SPH_C32(0xe1170000),
+      SPH_C32(0x370b0000), SPH_C32(0xcba30034), SPH_C32(0x3c34923c),
+      SPH_C32(0x9767bdcc), SPH_C32(0x450360bf), SPH_C32(0x774400f0),
+      SPH_C32(0xf15a0000), SPH_C32(0xf5b20000), SPH_C32(0x34140000),
+      SPH_C32(0x89377e8c), SPH_C32(0x5a8bec25), SPH_C32(0x0bc3cd1e),
+      SPH_C32(0xcf3775cb) },
+    { SPH_C32(0xe8870170), SPH_C32(0x9d720000), SPH_C32(0x12db0000),
+      SPH_C32(0xd4220000), SPH_C32(0xf2886b27), SPH_C32(0xa921e543),
+      SPH_C32(0x4ef8b518), SPH_C32(0x618813b1), SPH_C32(0xb4370060),
+      SPH_C32(0x0c4c0000), SPH_C32(0x56c20000), SPH_C32(0x5cae0000),
+      SPH_C32(0x94541f3f), SPH_C32(0x3b3ef825), SPH_C32(0x1b365f3d),
+      SPH_C32(0xf3d45758) },
+    { SPH_C32(0x9fc30180), SPH_C32(0x6c280000), SPH_C32(0xe7690000),
+      SPH_C32(0xe0360000), SPH_C32(0x7bbf15ab), SPH_C32(0xf3aa0966),
+      SPH_C32(0x453b7806), SPH_C32(0xaebf667a), SPH_C32(0x405b0030),
+      SPH_C32(0x9a540000), SPH_C32(0x42670000), SPH_C32(0x5fb10000),
+      SPH_C32(0xd6c06187), SPH_C32(0x5d81863c), SPH_C32(0x87922fef),
+      SPH_C32(0x79e0422c) },
+    { SPH_C32(0x1ceb0120), SPH_C32(0x0b6a0000), SPH_C32(0x067e0000),
+      SPH_C32(0xd73d0000), SPH_C32(0xb01c159f), SPH_C32(0xcf9e9b5a),
+      SPH_C32(0xd25cc5ca), SPH_C32(0xebbc06c5), SPH_C32(0x371f00c0),
+      SPH_C32(0x6b0e0000), SPH_C32(0xb7d50000), SPH_C32(0x6ba50000),
+      SPH_C32(0x5ff71f0b), SPH_C32(0x070a6a19), SPH_C32(0x8c51e2f1),
+      SPH_C32(0xb6d737e7) },
+    { SPH_C32(0x6baf01d0), SPH_C32(0xfa300000), SPH_C32(0xf3cc0000),
+      SPH_C32(0xe3290000), SPH_C32(0x392b6b13), SPH_C32(0x9515777f),
+      SPH_C32(0xd99f08d4), SPH_C32(0x248b730e), SPH_C32(0xc3730090),
+      SPH_C32(0xfd160000), SPH_C32(0xa3700000), SPH_C32(0x68ba0000),
+      SPH_C32(0x1d6361b3), SPH_C32(0x61b51400), SPH_C32(0x10f59223),
+      SPH_C32(0x3ce32293) },
+    { SPH_C32(0xb4370060), SPH_C32(0x0c4c0000), SPH_C32(0x56c20000),
+      SPH_C32(0x5cae0000), SPH_C32(0x94541f3f), SPH_C32(0x3b3ef825),
+      SPH_C32(0x1b365f3d), SPH_C32(0xf3d45758), SPH_C32(0x5cb00110),
+      SPH_C32(0x913e0000), SPH_C32(0x44190000), SPH_C32(0x888c0000),
+      SPH_C32(0x66dc7418), SPH_C32(0x921f1d66), SPH_C32(0x55ceea25),
+      SPH_C32(0x925c44e9) },
+    { SPH_C32(0xc3730090), SPH_C32(0xfd160000), SPH_C32(0xa3700000),
+      SPH_C32(0x68ba0000), SPH_C32(0x1d6361b3), SPH_C32(0x61b51400),
+      SPH_C32(0x10f59223), SPH_C32(0x3ce32293), SPH_C32(0xa8dc0140),
+      SPH_C32(0x07260000), SPH_C32(0x50bc0000), SPH_C32(0x8b930000),
+      SPH_C32(0x24480aa0), SPH_C32(0xf4a0637f), SPH_C32(0xc96a9af7),
+      SPH_C32(0x1868519d) },
+    { SPH_C32(0x405b0030), SPH_C32(0x9a540000), SPH_C32(0x42670000),
+      SPH_C32(0x5fb10000), SPH_C32(0xd6c06187), SPH_C32(0x5d81863c),
+      SPH_C32(0x87922fef), SPH_C32(0x79e0422c), SPH_C32(0xdf9801b0),
+      SPH_C32(0xf67c0000), SPH_C32(0xa50e0000), SPH_C32(0xbf870000),
+      SPH_C32(0xad7f742c), SPH_C32(0xae2b8f5a), SPH_C32(0xc2a957e9),
+      SPH_C32(0xd75f2456) },
+    { SPH_C32(0x371f00c0), SPH_C32(0x6b0e0000), SPH_C32(0xb7d50000),
+      SPH_C32(0x6ba50000), SPH_C32(0x5ff71f0b), SPH_C32(0x070a6a19),
+      SPH_C32(0x8c51e2f1), SPH_C32(0xb6d737e7), SPH_C32(0x2bf401e0),
+      SPH_C32(0x60640000), SPH_C32(0xb1ab0000), SPH_C32(0xbc980000),
+      SPH_C32(0xefeb0a94), SPH_C32(0xc894f143), SPH_C32(0x5e0d273b),
+      SPH_C32(0x5d6b3122) },
+    { SPH_C32(0x5cb00110), SPH_C32(0x913e0000), SPH_C32(0x44190000),
+      SPH_C32(0x888c0000), SPH_C32(0x66dc7418), SPH_C32(0x921f1d66),
+      SPH_C32(0x55ceea25), SPH_C32(0x925c44e9), SPH_C32(0xe8870170),
+      SPH_C32(0x9d720000), SPH_C32(0x12db0000), SPH_C32(0xd4220000),
+      SPH_C32(0xf2886b27), SPH_C32(0xa921e543), SPH_C32(0x4ef8b518),
+      SPH_C32(0x618813b1) },
+    { SPH_C32(0x2bf401e0), SPH_C32(0x60640000), SPH_C32(0xb1ab0000),
+      SPH_C32(0xbc980000), SPH_C32(0xefeb0a94), SPH_C32(0xc894f143),
+      SPH_C32(0x5e0d273b), SPH_C32(0x5d6b3122), SPH_C32(0x1ceb0120),
+      SPH_C32(0x0b6a0000), SPH_C32(0x067e0000), SPH_C32(0xd73d0000),
+      SPH_C32(0xb01c159f), SPH_C32(0xcf9e9b5a), SPH_C32(0xd25cc5ca),
+      SPH_C32(0xebbc06c5) },
+    { SPH_C32(0xa8dc0140), SPH_C32(0x07260000), SPH_C32(0x50bc0000),
+      SPH_C32(0x8b930000), SPH_C32(0x24480aa0), SPH_C32(0xf4a0637f),
+      SPH_C32(0xc96a9af7), SPH_C32(0x1868519d), SPH_C32(0x6baf01d0),
+      SPH_C32(0xfa300000), SPH_C32(0xf3cc0000), SPH_C32(0xe3290000),
+      SPH_C32(0x392b6b13), SPH_C32(0x9515777f), SPH_C32(0xd99f08d4),
+      SPH_C32(0x248b730e) },
+    { SPH_C32(0xdf9801b0), SPH_C32(0xf67c0000), SPH_C32(0xa50e0000),
+      SPH_C32(0xbf870000), SPH_C32(0xad7f742c), SPH_C32(0xae2b8f5a),
+      SPH_C32(0xc2a957e9), SPH_C32(0xd75f2456), SPH_C32(0x9fc30180),
+      SPH_C32(0x6c280000), SPH_C32(0xe7690000), SPH_C32(0xe0360000),
+      SPH_C32(0x7bbf15ab), SPH_C32(0xf3aa0966), SPH_C32(0x453b7806),
+      SPH_C32(0xaebf667a) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xf6800005), SPH_C32(0x3443c000), SPH_C32(0x24070000),
+      SPH_C32(0x8f3d0000), SPH_C32(0x21373bfb), SPH_C32(0x0ab8d5ae),
+      SPH_C32(0xcdc58b19), SPH_C32(0xd795ba31), SPH_C32(0xa67f0001),
+      SPH_C32(0x71378000), SPH_C32(0x19fc0000), SPH_C32(0x96db0000),
+      SPH_C32(0x3a8b6dfd), SPH_C32(0xebcaaef3), SPH_C32(0x2c6d478f),
+      SPH_C32(0xac8e6c88) },
+    { SPH_C32(0xa67f0001), SPH_C32(0x71378000), SPH_C32(0x19fc0000),
+      SPH_C32(0x96db0000), SPH_C32(0x3a8b6dfd), SPH_C32(0xebcaaef3),
+      SPH_C32(0x2c6d478f), SPH_C32(0xac8e6c88), SPH_C32(0x50ff0004),
+      SPH_C32(0x45744000), SPH_C32(0x3dfb0000), SPH_C32(0x19e60000),
+      SPH_C32(0x1bbc5606), SPH_C32(0xe1727b5d), SPH_C32(0xe1a8cc96),
+      SPH_C32(0x7b1bd6b9) },
+    { SPH_C32(0x50ff0004), SPH_C32(0x45744000), SPH_C32(0x3dfb0000),
+      SPH_C32(0x19e60000), SPH_C32(0x1bbc5606), SPH_C32(0xe1727b5d),
+      SPH_C32(0xe1a8cc96), SPH_C32(0x7b1bd6b9), SPH_C32(0xf6800005),
+      SPH_C32(0x3443c000), SPH_C32(0x24070000), SPH_C32(0x8f3d0000),
+      SPH_C32(0x21373bfb), SPH_C32(0x0ab8d5ae), SPH_C32(0xcdc58b19),
+      SPH_C32(0xd795ba31) },
+    { SPH_C32(0xf7750009), SPH_C32(0xcf3cc000), SPH_C32(0xc3d60000),
+      SPH_C32(0x04920000), SPH_C32(0x029519a9), SPH_C32(0xf8e836ba),
+      SPH_C32(0x7a87f14e), SPH_C32(0x9e16981a), SPH_C32(0xd46a0000),
+      SPH_C32(0x8dc8c000), SPH_C32(0xa5af0000), SPH_C32(0x4a290000),
+      SPH_C32(0xfc4e427a), SPH_C32(0xc9b4866c), SPH_C32(0x98369604),
+      SPH_C32(0xf746c320) },
+    { SPH_C32(0x01f5000c), SPH_C32(0xfb7f0000), SPH_C32(0xe7d10000),
+      SPH_C32(0x8baf0000), SPH_C32(0x23a22252), SPH_C32(0xf250e314),
+      SPH_C32(0xb7427a57), SPH_C32(0x4983222b), SPH_C32(0x72150001),
+      SPH_C32(0xfcff4000), SPH_C32(0xbc530000), SPH_C32(0xdcf20000),
+      SPH_C32(0xc6c52f87), SPH_C32(0x227e289f), SPH_C32(0xb45bd18b),
+      SPH_C32(0x5bc8afa8) },
+    { SPH_C32(0x510a0008), SPH_C32(0xbe0b4000), SPH_C32(0xda2a0000),
+      SPH_C32(0x92490000), SPH_C32(0x381e7454), SPH_C32(0x13229849),
+      SPH_C32(0x56eab6c1), SPH_C32(0x3298f492), SPH_C32(0x84950004),
+      SPH_C32(0xc8bc8000), SPH_C32(0x98540000), SPH_C32(0x53cf0000),
+      SPH_C32(0xe7f2147c), SPH_C32(0x28c6fd31), SPH_C32(0x799e5a92),
+      SPH_C32(0x8c5d1599) },
+    { SPH_C32(0xa78a000d), SPH_C32(0x8a488000), SPH_C32(0xfe2d0000),
+      SPH_C32(0x1d740000), SPH_C32(0x19294faf), SPH_C32(0x199a4de7),
+      SPH_C32(0x9b2f3dd8), SPH_C32(0xe50d4ea3), SPH_C32(0x22ea0005),
+      SPH_C32(0xb98b0000), SPH_C32(0x81a80000), SPH_C32(0xc5140000),
+      SPH_C32(0xdd797981), SPH_C32(0xc30c53c2), SPH_C32(0x55f31d1d),
+      SPH_C32(0x20d37911) },
+    { SPH_C32(0xd46a0000), SPH_C32(0x8dc8c000), SPH_C32(0xa5af0000),
+      SPH_C32(0x4a290000), SPH_C32(0xfc4e427a), SPH_C32(0xc9b4866c),
+      SPH_C32(0x98369604), SPH_C32(0xf746c320), SPH_C32(0x231f0009),
+      SPH_C32(0x42f40000), SPH_C32(0x66790000), SPH_C32(0x4ebb0000),
+      SPH_C32(0xfedb5bd3), SPH_C32(0x315cb0d6), SPH_C32(0xe2b1674a),
+      SPH_C32(0x69505b3a) },
+    { SPH_C32(0x22ea0005), SPH_C32(0xb98b0000), SPH_C32(0x81a80000),
+      SPH_C32(0xc5140000), SPH_C32(0xdd797981), SPH_C32(0xc30c53c2),
+      SPH_C32(0x55f31d1d), SPH_C32(0x20d37911), SPH_C32(0x85600008),
+      SPH_C32(0x33c38000), SPH_C32(0x7f850000), SPH_C32(0xd8600000),
+      SPH_C32(0xc450362e), SPH_C32(0xda961e25), SPH_C32(0xcedc20c5),
+      SPH_C32(0xc5de37b2) },
+    { SPH_C32(0x72150001), SPH_C32(0xfcff4000), SPH_C32(0xbc530000),
+      SPH_C32(0xdcf20000), SPH_C32(0xc6c52f87), SPH_C32(0x227e289f),
+      SPH_C32(0xb45bd18b), SPH_C32(0x5bc8afa8), SPH_C32(0x73e0000d),
+      SPH_C32(0x07804000), SPH_C32(0x5b820000), SPH_C32(0x575d0000),
+      SPH_C32(0xe5670dd5), SPH_C32(0xd02ecb8b), SPH_C32(0x0319abdc),
+      SPH_C32(0x124b8d83) },
+    { SPH_C32(0x84950004), SPH_C32(0xc8bc8000), SPH_C32(0x98540000),
+      SPH_C32(0x53cf0000), SPH_C32(0xe7f2147c), SPH_C32(0x28c6fd31),
+      SPH_C32(0x799e5a92), SPH_C32(0x8c5d1599), SPH_C32(0xd59f000c),
+      SPH_C32(0x76b7c000), SPH_C32(0x427e0000), SPH_C32(0xc1860000),
+      SPH_C32(0xdfec6028), SPH_C32(0x3be46578), SPH_C32(0x2f74ec53),
+      SPH_C32(0xbec5e10b) },
+    { SPH_C32(0x231f0009), SPH_C32(0x42f40000), SPH_C32(0x66790000),
+      SPH_C32(0x4ebb0000), SPH_C32(0xfedb5bd3), SPH_C32(0x315cb0d6),
+      SPH_C32(0xe2b1674a), SPH_C32(0x69505b3a), SPH_C32(0xf7750009),
+      SPH_C32(0xcf3cc000), SPH_C32(0xc3d60000), SPH_C32(0x04920000),
+      SPH_C32(0x029519a9), SPH_C32(0xf8e836ba), SPH_C32(0x7a87f14e),
+      SPH_C32(0x9e16981a) },
+    { SPH_C32(0xd59f000c), SPH_C32(0x76b7c000), SPH_C32(0x427e0000),
+      SPH_C32(0xc1860000), SPH_C32(0xdfec6028), SPH_C32(0x3be46578),
+      SPH_C32(0x2f74ec53), SPH_C32(0xbec5e10b), SPH_C32(0x510a0008),
+      SPH_C32(0xbe0b4000), SPH_C32(0xda2a0000), SPH_C32(0x92490000),
+      SPH_C32(0x381e7454), SPH_C32(0x13229849), SPH_C32(0x56eab6c1),
+      SPH_C32(0x3298f492) },
+    { SPH_C32(0x85600008), SPH_C32(0x33c38000), SPH_C32(0x7f850000),
+      SPH_C32(0xd8600000), SPH_C32(0xc450362e), SPH_C32(0xda961e25),
+      SPH_C32(0xcedc20c5), SPH_C32(0xc5de37b2), SPH_C32(0xa78a000d),
+      SPH_C32(0x8a488000), SPH_C32(0xfe2d0000), SPH_C32(0x1d740000),
+      SPH_C32(0x19294faf), SPH_C32(0x199a4de7), SPH_C32(0x9b2f3dd8),
+      SPH_C32(0xe50d4ea3) },
+    { SPH_C32(0x73e0000d), SPH_C32(0x07804000), SPH_C32(0x5b820000),
+      SPH_C32(0x575d0000), SPH_C32(0xe5670dd5), SPH_C32(0xd02ecb8b),
+      SPH_C32(0x0319abdc), SPH_C32(0x124b8d83), SPH_C32(0x01f5000c),
+      SPH_C32(0xfb7f0000), SPH_C32(0xe7d10000), SPH_C32(0x8baf0000),
+      SPH_C32(0x23a22252), SPH_C32(0xf250e314), SPH_C32(0xb7427a57),
+      SPH_C32(0x4983222b) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x75a40000), SPH_C32(0xc28b2700), SPH_C32(0x94a40000),
+      SPH_C32(0x90f50000), SPH_C32(0xfb7857e0), SPH_C32(0x49ce0bae),
+      SPH_C32(0x1767c483), SPH_C32(0xaedf667e), SPH_C32(0xd1660000),
+      SPH_C32(0x1bbc0300), SPH_C32(0x9eec0000), SPH_C32(0xf6940000),
+      SPH_C32(0x03024527), SPH_C32(0xcf70fcf2), SPH_C32(0xb4431b17),
+      SPH_C32(0x857f3c2b) },
+    { SPH_C32(0xd1660000), SPH_C32(0x1bbc0300), SPH_C32(0x9eec0000),
+      SPH_C32(0xf6940000), SPH_C32(0x03024527), SPH_C32(0xcf70fcf2),
+      SPH_C32(0xb4431b17), SPH_C32(0x857f3c2b), SPH_C32(0xa4c20000),
+      SPH_C32(0xd9372400), SPH_C32(0x0a480000), SPH_C32(0x66610000),
+      SPH_C32(0xf87a12c7), SPH_C32(0x86bef75c), SPH_C32(0xa324df94),
+      SPH_C32(0x2ba05a55) },
+    { SPH_C32(0xa4c20000), SPH_C32(0xd9372400), SPH_C32(0x0a480000),
+      SPH_C32(0x66610000), SPH_C32(0xf87a12c7), SPH_C32(0x86bef75c),
+      SPH_C32(0xa324df94), SPH_C32(0x2ba05a55), SPH_C32(0x75a40000),
+      SPH_C32(0xc28b2700), SPH_C32(0x94a40000), SPH_C32(0x90f50000),
+      SPH_C32(0xfb7857e0), SPH_C32(0x49ce0bae), SPH_C32(0x1767c483),
+      SPH_C32(0xaedf667e) },
+    { SPH_C32(0x75c90003), SPH_C32(0x0e10c000), SPH_C32(0xd1200000),
+      SPH_C32(0xbaea0000), SPH_C32(0x8bc42f3e), SPH_C32(0x8758b757),
+      SPH_C32(0xbb28761d), SPH_C32(0x00b72e2b), SPH_C32(0xeecf0001),
+      SPH_C32(0x6f564000), SPH_C32(0xf33e0000), SPH_C32(0xa79e0000),
+      SPH_C32(0xbdb57219), SPH_C32(0xb711ebc5), SPH_C32(0x4a3b40ba),
+      SPH_C32(0xfeabf254) },
+    { SPH_C32(0x006d0003), SPH_C32(0xcc9be700), SPH_C32(0x45840000),
+      SPH_C32(0x2a1f0000), SPH_C32(0x70bc78de), SPH_C32(0xce96bcf9),
+      SPH_C32(0xac4fb29e), SPH_C32(0xae684855), SPH_C32(0x3fa90001),
+      SPH_C32(0x74ea4300), SPH_C32(0x6dd20000), SPH_C32(0x510a0000),
+      SPH_C32(0xbeb7373e), SPH_C32(0x78611737), SPH_C32(0xfe785bad),
+      SPH_C32(0x7bd4ce7f) },
+    { SPH_C32(0xa4af0003), SPH_C32(0x15acc300), SPH_C32(0x4fcc0000),
+      SPH_C32(0x4c7e0000), SPH_C32(0x88c66a19), SPH_C32(0x48284ba5),
+      SPH_C32(0x0f6b6d0a), SPH_C32(0x85c81200), SPH_C32(0x4a0d0001),
+      SPH_C32(0xb6616400), SPH_C32(0xf9760000), SPH_C32(0xc1ff0000),
+      SPH_C32(0x45cf60de), SPH_C32(0x31af1c99), SPH_C32(0xe91f9f2e),
+      SPH_C32(0xd50ba801) },
+    { SPH_C32(0xd10b0003), SPH_C32(0xd727e400), SPH_C32(0xdb680000),
+      SPH_C32(0xdc8b0000), SPH_C32(0x73be3df9), SPH_C32(0x01e6400b),
+      SPH_C32(0x180ca989), SPH_C32(0x2b17747e), SPH_C32(0x9b6b0001),
+      SPH_C32(0xaddd6700), SPH_C32(0x679a0000), SPH_C32(0x376b0000),
+      SPH_C32(0x46cd25f9), SPH_C32(0xfedfe06b), SPH_C32(0x5d5c8439),
+      SPH_C32(0x5074942a) },
+    { SPH_C32(0xeecf0001), SPH_C32(0x6f564000), SPH_C32(0xf33e0000),
+      SPH_C32(0xa79e0000), SPH_C32(0xbdb57219), SPH_C32(0xb711ebc5),
+      SPH_C32(0x4a3b40ba), SPH_C32(0xfeabf254), SPH_C32(0x9b060002),
+      SPH_C32(0x61468000), SPH_C32(0x221e0000), SPH_C32(0x1d740000),
+      SPH_C32(0x36715d27), SPH_C32(0x30495c92), SPH_C32(0xf11336a7),
+      SPH_C32(0xfe1cdc7f) },
+    { SPH_C32(0x9b6b0001), SPH_C32(0xaddd6700), SPH_C32(0x679a0000),
+      SPH_C32(0x376b0000), SPH_C32(0x46cd25f9), SPH_C32(0xfedfe06b),
+      SPH_C32(0x5d5c8439), SPH_C32(0x5074942a), SPH_C32(0x4a600002),
+      SPH_C32(0x7afa8300), SPH_C32(0xbcf20000), SPH_C32(0xebe00000),
+      SPH_C32(0x35731800), SPH_C32(0xff39a060), SPH_C32(0x45502db0),
+      SPH_C32(0x7b63e054) },
+    { SPH_C32(0x3fa90001), SPH_C32(0x74ea4300), SPH_C32(0x6dd20000),
+      SPH_C32(0x510a0000), SPH_C32(0xbeb7373e), SPH_C32(0x78611737),
+      SPH_C32(0xfe785bad), SPH_C32(0x7bd4ce7f), SPH_C32(0x3fc40002),
+      SPH_C32(0xb871a400), SPH_C32(0x28560000), SPH_C32(0x7b150000),
+      SPH_C32(0xce0b4fe0), SPH_C32(0xb6f7abce), SPH_C32(0x5237e933),
+      SPH_C32(0xd5bc862a) },
+    { SPH_C32(0x4a0d0001), SPH_C32(0xb6616400), SPH_C32(0xf9760000),
+      SPH_C32(0xc1ff0000), SPH_C32(0x45cf60de), SPH_C32(0x31af1c99),
+      SPH_C32(0xe91f9f2e), SPH_C32(0xd50ba801), SPH_C32(0xeea20002),
+      SPH_C32(0xa3cda700), SPH_C32(0xb6ba0000), SPH_C32(0x8d810000),
+      SPH_C32(0xcd090ac7), SPH_C32(0x7987573c), SPH_C32(0xe674f224),
+      SPH_C32(0x50c3ba01) },
+    { SPH_C32(0x9b060002), SPH_C32(0x61468000), SPH_C32(0x221e0000),
+      SPH_C32(0x1d740000), SPH_C32(0x36715d27), SPH_C32(0x30495c92),
+      SPH_C32(0xf11336a7), SPH_C32(0xfe1cdc7f), SPH_C32(0x75c90003),
+      SPH_C32(0x0e10c000), SPH_C32(0xd1200000), SPH_C32(0xbaea0000),
+      SPH_C32(0x8bc42f3e), SPH_C32(0x8758b757), SPH_C32(0xbb28761d),
+      SPH_C32(0x00b72e2b) },
+    { SPH_C32(0xeea20002), SPH_C32(0xa3cda700), SPH_C32(0xb6ba0000),
+      SPH_C32(0x8d810000), SPH_C32(0xcd090ac7), SPH_C32(0x7987573c),
+      SPH_C32(0xe674f224), SPH_C32(0x50c3ba01), SPH_C32(0xa4af0003),
+      SPH_C32(0x15acc300), SPH_C32(0x4fcc0000), SPH_C32(0x4c7e0000),
+      SPH_C32(0x88c66a19), SPH_C32(0x48284ba5), SPH_C32(0x0f6b6d0a),
+      SPH_C32(0x85c81200) },
+    { SPH_C32(0x4a600002), SPH_C32(0x7afa8300), SPH_C32(0xbcf20000),
+      SPH_C32(0xebe00000), SPH_C32(0x35731800), SPH_C32(0xff39a060),
+      SPH_C32(0x45502db0), SPH_C32(0x7b63e054), SPH_C32(0xd10b0003),
+      SPH_C32(0xd727e400), SPH_C32(0xdb680000), SPH_C32(0xdc8b0000),
+      SPH_C32(0x73be3df9), SPH_C32(0x01e6400b), SPH_C32(0x180ca989),
+      SPH_C32(0x2b17747e) },
+    { SPH_C32(0x3fc40002), SPH_C32(0xb871a400), SPH_C32(0x28560000),
+      SPH_C32(0x7b150000), SPH_C32(0xce0b4fe0), SPH_C32(0xb6f7abce),
+      SPH_C32(0x5237e933), SPH_C32(0xd5bc862a), SPH_C32(0x006d0003),
+      SPH_C32(0xcc9be700), SPH_C32(0x45840000), SPH_C32(0x2a1f0000),
+      SPH_C32(0x70bc78de), SPH_C32(0xce96bcf9), SPH_C32(0xac4fb29e),
+      SPH_C32(0xae684855) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x0c720000), SPH_C32(0x49e50f00), SPH_C32(0x42790000),
+      SPH_C32(0x5cea0000), SPH_C32(0x33aa301a), SPH_C32(0x15822514),
+      SPH_C32(0x95a34b7b), SPH_C32(0xb44b0090), SPH_C32(0xfe220000),
+      SPH_C32(0xa7580500), SPH_C32(0x25d10000), SPH_C32(0xf7600000),
+      SPH_C32(0x893178da), SPH_C32(0x1fd4f860), SPH_C32(0x4ed0a315),
+      SPH_C32(0xa123ff9f) },
+    { SPH_C32(0xfe220000), SPH_C32(0xa7580500), SPH_C32(0x25d10000),
+      SPH_C32(0xf7600000), SPH_C32(0x893178da), SPH_C32(0x1fd4f860),
+      SPH_C32(0x4ed0a315), SPH_C32(0xa123ff9f), SPH_C32(0xf2500000),
+      SPH_C32(0xeebd0a00), SPH_C32(0x67a80000), SPH_C32(0xab8a0000),
+      SPH_C32(0xba9b48c0), SPH_C32(0x0a56dd74), SPH_C32(0xdb73e86e),
+      SPH_C32(0x1568ff0f) },
+    { SPH_C32(0xf2500000), SPH_C32(0xeebd0a00), SPH_C32(0x67a80000),
+      SPH_C32(0xab8a0000), SPH_C32(0xba9b48c0), SPH_C32(0x0a56dd74),
+      SPH_C32(0xdb73e86e), SPH_C32(0x1568ff0f), SPH_C32(0x0c720000),
+      SPH_C32(0x49e50f00), SPH_C32(0x42790000), SPH_C32(0x5cea0000),
+      SPH_C32(0x33aa301a), SPH_C32(0x15822514), SPH_C32(0x95a34b7b),
+      SPH_C32(0xb44b0090) },
+    { SPH_C32(0x45180000), SPH_C32(0xa5b51700), SPH_C32(0xf96a0000),
+      SPH_C32(0x3b480000), SPH_C32(0x1ecc142c), SPH_C32(0x231395d6),
+      SPH_C32(0x16bca6b0), SPH_C32(0xdf33f4df), SPH_C32(0xb83d0000),
+      SPH_C32(0x16710600), SPH_C32(0x379a0000), SPH_C32(0xf5b10000),
+      SPH_C32(0x228161ac), SPH_C32(0xae48f145), SPH_C32(0x66241616),
+      SPH_C32(0xc5c1eb3e) },
+    { SPH_C32(0x496a0000), SPH_C32(0xec501800), SPH_C32(0xbb130000),
+      SPH_C32(0x67a20000), SPH_C32(0x2d662436), SPH_C32(0x3691b0c2),
+      SPH_C32(0x831fedcb), SPH_C32(0x6b78f44f), SPH_C32(0x461f0000),
+      SPH_C32(0xb1290300), SPH_C32(0x124b0000), SPH_C32(0x02d10000),
+      SPH_C32(0xabb01976), SPH_C32(0xb19c0925), SPH_C32(0x28f4b503),
+      SPH_C32(0x64e214a1) },
+    { SPH_C32(0xbb3a0000), SPH_C32(0x02ed1200), SPH_C32(0xdcbb0000),
+      SPH_C32(0xcc280000), SPH_C32(0x97fd6cf6), SPH_C32(0x3cc76db6),
+      SPH_C32(0x586c05a5), SPH_C32(0x7e100b40), SPH_C32(0x4a6d0000),
+      SPH_C32(0xf8cc0c00), SPH_C32(0x50320000), SPH_C32(0x5e3b0000),
+      SPH_C32(0x981a296c), SPH_C32(0xa41e2c31), SPH_C32(0xbd57fe78),
+      SPH_C32(0xd0a91431) },
+    { SPH_C32(0xb7480000), SPH_C32(0x4b081d00), SPH_C32(0x9ec20000),
+      SPH_C32(0x90c20000), SPH_C32(0xa4575cec), SPH_C32(0x294548a2),
+      SPH_C32(0xcdcf4ede), SPH_C32(0xca5b0bd0), SPH_C32(0xb44f0000),
+      SPH_C32(0x5f940900), SPH_C32(0x75e30000), SPH_C32(0xa95b0000),
+      SPH_C32(0x112b51b6), SPH_C32(0xbbcad451), SPH_C32(0xf3875d6d),
+      SPH_C32(0x718aebae) },
+    { SPH_C32(0xb83d0000), SPH_C32(0x16710600), SPH_C32(0x379a0000),
+      SPH_C32(0xf5b10000), SPH_C32(0x228161ac), SPH_C32(0xae48f145),
+      SPH_C32(0x66241616), SPH_C32(0xc5c1eb3e), SPH_C32(0xfd250000),
+      SPH_C32(0xb3c41100), SPH_C32(0xcef00000), SPH_C32(0xcef90000),
+      SPH_C32(0x3c4d7580), SPH_C32(0x8d5b6493), SPH_C32(0x7098b0a6),
+      SPH_C32(0x1af21fe1) },
+    { SPH_C32(0xb44f0000), SPH_C32(0x5f940900), SPH_C32(0x75e30000),
+      SPH_C32(0xa95b0000), SPH_C32(0x112b51b6), SPH_C32(0xbbcad451),
+      SPH_C32(0xf3875d6d), SPH_C32(0x718aebae), SPH_C32(0x03070000),
+      SPH_C32(0x149c1400), SPH_C32(0xeb210000), SPH_C32(0x39990000),
+      SPH_C32(0xb57c0d5a), SPH_C32(0x928f9cf3), SPH_C32(0x3e4813b3),
+      SPH_C32(0xbbd1e07e) },
+    { SPH_C32(0x461f0000), SPH_C32(0xb1290300), SPH_C32(0x124b0000),
+      SPH_C32(0x02d10000), SPH_C32(0xabb01976), SPH_C32(0xb19c0925),
+      SPH_C32(0x28f4b503), SPH_C32(0x64e214a1), SPH_C32(0x0f750000),
+      SPH_C32(0x5d791b00), SPH_C32(0xa9580000), SPH_C32(0x65730000),
+      SPH_C32(0x86d63d40), SPH_C32(0x870db9e7), SPH_C32(0xabeb58c8),
+      SPH_C32(0x0f9ae0ee) },
+    { SPH_C32(0x4a6d0000), SPH_C32(0xf8cc0c00), SPH_C32(0x50320000),
+      SPH_C32(0x5e3b0000), SPH_C32(0x981a296c), SPH_C32(0xa41e2c31),
+      SPH_C32(0xbd57fe78), SPH_C32(0xd0a91431), SPH_C32(0xf1570000),
+      SPH_C32(0xfa211e00), SPH_C32(0x8c890000), SPH_C32(0x92130000),
+      SPH_C32(0x0fe7459a), SPH_C32(0x98d94187), SPH_C32(0xe53bfbdd),
+      SPH_C32(0xaeb91f71) },
+    { SPH_C32(0xfd250000), SPH_C32(0xb3c41100), SPH_C32(0xcef00000),
+      SPH_C32(0xcef90000), SPH_C32(0x3c4d7580), SPH_C32(0x8d5b6493),
+      SPH_C32(0x7098b0a6), SPH_C32(0x1af21fe1), SPH_C32(0x45180000),
+      SPH_C32(0xa5b51700), SPH_C32(0xf96a0000), SPH_C32(0x3b480000),
+      SPH_C32(0x1ecc142c), SPH_C32(0x231395d6), SPH_C32(0x16bca6b0),
+      SPH_C32(0xdf33f4df) },
+    { SPH_C32(0xf1570000), SPH_C32(0xfa211e00), SPH_C32(0x8c890000),
+      SPH_C32(0x92130000), SPH_C32(0x0fe7459a), SPH_C32(0x98d94187),
+      SPH_C32(0xe53bfbdd), SPH_C32(0xaeb91f71), SPH_C32(0xbb3a0000),
+      SPH_C32(0x02ed1200), SPH_C32(0xdcbb0000), SPH_C32(0xcc280000),
+      SPH_C32(0x97fd6cf6), SPH_C32(0x3cc76db6), SPH_C32(0x586c05a5),
+      SPH_C32(0x7e100b40) },
+    { SPH_C32(0x03070000), SPH_C32(0x149c1400), SPH_C32(0xeb210000),
+      SPH_C32(0x39990000), SPH_C32(0xb57c0d5a), SPH_C32(0x928f9cf3),
+      SPH_C32(0x3e4813b3), SPH_C32(0xbbd1e07e), SPH_C32(0xb7480000),
+      SPH_C32(0x4b081d00), SPH_C32(0x9ec20000), SPH_C32(0x90c20000),
+      SPH_C32(0xa4575cec), SPH_C32(0x294548a2), SPH_C32(0xcdcf4ede),
+      SPH_C32(0xca5b0bd0) },
+    { SPH_C32(0x0f750000), SPH_C32(0x5d791b00), SPH_C32(0xa9580000),
+      SPH_C32(0x65730000), SPH_C32(0x86d63d40), SPH_C32(0x870db9e7),
+      SPH_C32(0xabeb58c8), SPH_C32(0x0f9ae0ee), SPH_C32(0x496a0000),
+      SPH_C32(0xec501800), SPH_C32(0xbb130000), SPH_C32(0x67a20000),
+      SPH_C32(0x2d662436), SPH_C32(0x3691b0c2), SPH_C32(0x831fedcb),
+      SPH_C32(0x6b78f44f) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x54500000), SPH_C32(0x0671005c), SPH_C32(0x25ae0000),
+      SPH_C32(0x6a1e0000), SPH_C32(0x2ea54edf), SPH_C32(0x664e8512),
+      SPH_C32(0xbfba18c3), SPH_C32(0x7e715d17), SPH_C32(0xbc8d0000),
+      SPH_C32(0xfc3b0018), SPH_C32(0x19830000), SPH_C32(0xd10b0000),
+      SPH_C32(0xae1878c4), SPH_C32(0x42a69856), SPH_C32(0x0012da37),
+      SPH_C32(0x2c3b504e) },
+    { SPH_C32(0xbc8d0000), SPH_C32(0xfc3b0018), SPH_C32(0x19830000),
+      SPH_C32(0xd10b0000), SPH_C32(0xae1878c4), SPH_C32(0x42a69856),
+      SPH_C32(0x0012da37), SPH_C32(0x2c3b504e), SPH_C32(0xe8dd0000),
+      SPH_C32(0xfa4a0044), SPH_C32(0x3c2d0000), SPH_C32(0xbb150000),
+      SPH_C32(0x80bd361b), SPH_C32(0x24e81d44), SPH_C32(0xbfa8c2f4),
+      SPH_C32(0x524a0d59) },
+    { SPH_C32(0xe8dd0000), SPH_C32(0xfa4a0044), SPH_C32(0x3c2d0000),
+      SPH_C32(0xbb150000), SPH_C32(0x80bd361b), SPH_C32(0x24e81d44),
+      SPH_C32(0xbfa8c2f4), SPH_C32(0x524a0d59), SPH_C32(0x54500000),
+      SPH_C32(0x0671005c), SPH_C32(0x25ae0000), SPH_C32(0x6a1e0000),
+      SPH_C32(0x2ea54edf), SPH_C32(0x664e8512), SPH_C32(0xbfba18c3),
+      SPH_C32(0x7e715d17) },
+    { SPH_C32(0x69510000), SPH_C32(0xd4e1009c), SPH_C32(0xc3230000),
+      SPH_C32(0xac2f0000), SPH_C32(0xe4950bae), SPH_C32(0xcea415dc),
+      SPH_C32(0x87ec287c), SPH_C32(0xbce1a3ce), SPH_C32(0xc6730000),
+      SPH_C32(0xaf8d000c), SPH_C32(0xa4c10000), SPH_C32(0x218d0000),
+      SPH_C32(0x23111587), SPH_C32(0x7913512f), SPH_C32(0x1d28ac88),
+      SPH_C32(0x378dd173) },
+    { SPH_C32(0x3d010000), SPH_C32(0xd29000c0), SPH_C32(0xe68d0000),
+      SPH_C32(0xc6310000), SPH_C32(0xca304571), SPH_C32(0xa8ea90ce),
+      SPH_C32(0x385630bf), SPH_C32(0xc290fed9), SPH_C32(0x7afe0000),
+      SPH_C32(0x53b60014), SPH_C32(0xbd420000), SPH_C32(0xf0860000),
+      SPH_C32(0x8d096d43), SPH_C32(0x3bb5c979), SPH_C32(0x1d3a76bf),
+      SPH_C32(0x1bb6813d) },
+    { SPH_C32(0xd5dc0000), SPH_C32(0x28da0084), SPH_C32(0xdaa00000),
+      SPH_C32(0x7d240000), SPH_C32(0x4a8d736a), SPH_C32(0x8c028d8a),
+      SPH_C32(0x87fef24b), SPH_C32(0x90daf380), SPH_C32(0x2eae0000),
+      SPH_C32(0x55c70048), SPH_C32(0x98ec0000), SPH_C32(0x9a980000),
+      SPH_C32(0xa3ac239c), SPH_C32(0x5dfb4c6b), SPH_C32(0xa2806e7c),
+      SPH_C32(0x65c7dc2a) },
+    { SPH_C32(0x818c0000), SPH_C32(0x2eab00d8), SPH_C32(0xff0e0000),
+      SPH_C32(0x173a0000), SPH_C32(0x64283db5), SPH_C32(0xea4c0898),
+      SPH_C32(0x3844ea88), SPH_C32(0xeeabae97), SPH_C32(0x92230000),
+      SPH_C32(0xa9fc0050), SPH_C32(0x816f0000), SPH_C32(0x4b930000),
+      SPH_C32(0x0db45b58), SPH_C32(0x1f5dd43d), SPH_C32(0xa292b44b),
+      SPH_C32(0x49fc8c64) },
+    { SPH_C32(0xc6730000), SPH_C32(0xaf8d000c), SPH_C32(0xa4c10000),
+      SPH_C32(0x218d0000), SPH_C32(0x23111587), SPH_C32(0x7913512f),
+      SPH_C32(0x1d28ac88), SPH_C32(0x378dd173), SPH_C32(0xaf220000),
+      SPH_C32(0x7b6c0090), SPH_C32(0x67e20000), SPH_C32(0x8da20000),
+      SPH_C32(0xc7841e29), SPH_C32(0xb7b744f3), SPH_C32(0x9ac484f4),
+      SPH_C32(0x8b6c72bd) },
+    { SPH_C32(0x92230000), SPH_C32(0xa9fc0050), SPH_C32(0x816f0000),
+      SPH_C32(0x4b930000), SPH_C32(0x0db45b58), SPH_C32(0x1f5dd43d),
+      SPH_C32(0xa292b44b), SPH_C32(0x49fc8c64), SPH_C32(0x13af0000),
+      SPH_C32(0x87570088), SPH_C32(0x7e610000), SPH_C32(0x5ca90000),
+      SPH_C32(0x699c66ed), SPH_C32(0xf511dca5), SPH_C32(0x9ad65ec3),
+      SPH_C32(0xa75722f3) },
+    { SPH_C32(0x7afe0000), SPH_C32(0x53b60014), SPH_C32(0xbd420000),
+      SPH_C32(0xf0860000), SPH_C32(0x8d096d43), SPH_C32(0x3bb5c979),
+      SPH_C32(0x1d3a76bf), SPH_C32(0x1bb6813d), SPH_C32(0x47ff0000),
+      SPH_C32(0x812600d4), SPH_C32(0x5bcf0000), SPH_C32(0x36b70000),
+      SPH_C32(0x47392832), SPH_C32(0x935f59b7), SPH_C32(0x256c4600),
+      SPH_C32(0xd9267fe4) },
+    { SPH_C32(0x2eae0000), SPH_C32(0x55c70048), SPH_C32(0x98ec0000),
+      SPH_C32(0x9a980000), SPH_C32(0xa3ac239c), SPH_C32(0x5dfb4c6b),
+      SPH_C32(0xa2806e7c), SPH_C32(0x65c7dc2a), SPH_C32(0xfb720000),
+      SPH_C32(0x7d1d00cc), SPH_C32(0x424c0000), SPH_C32(0xe7bc0000),
+      SPH_C32(0xe92150f6), SPH_C32(0xd1f9c1e1), SPH_C32(0x257e9c37),
+      SPH_C32(0xf51d2faa) },
+    { SPH_C32(0xaf220000), SPH_C32(0x7b6c0090), SPH_C32(0x67e20000),
+      SPH_C32(0x8da20000), SPH_C32(0xc7841e29), SPH_C32(0xb7b744f3),
+      SPH_C32(0x9ac484f4), SPH_C32(0x8b6c72bd), SPH_C32(0x69510000),
+      SPH_C32(0xd4e1009c), SPH_C32(0xc3230000), SPH_C32(0xac2f0000),
+      SPH_C32(0xe4950bae), SPH_C32(0xcea415dc), SPH_C32(0x87ec287c),
+      SPH_C32(0xbce1a3ce) },
+    { SPH_C32(0xfb720000), SPH_C32(0x7d1d00cc), SPH_C32(0x424c0000),
+      SPH_C32(0xe7bc0000), SPH_C32(0xe92150f6), SPH_C32(0xd1f9c1e1),
+      SPH_C32(0x257e9c37), SPH_C32(0xf51d2faa), SPH_C32(0xd5dc0000),
+      SPH_C32(0x28da0084), SPH_C32(0xdaa00000), SPH_C32(0x7d240000),
+      SPH_C32(0x4a8d736a), SPH_C32(0x8c028d8a), SPH_C32(0x87fef24b),
+      SPH_C32(0x90daf380) },
+    { SPH_C32(0x13af0000), SPH_C32(0x87570088), SPH_C32(0x7e610000),
+      SPH_C32(0x5ca90000), SPH_C32(0x699c66ed), SPH_C32(0xf511dca5),
+      SPH_C32(0x9ad65ec3), SPH_C32(0xa75722f3), SPH_C32(0x818c0000),
+      SPH_C32(0x2eab00d8), SPH_C32(0xff0e0000), SPH_C32(0x173a0000),
+      SPH_C32(0x64283db5), SPH_C32(0xea4c0898), SPH_C32(0x3844ea88),
+      SPH_C32(0xeeabae97) },
+    { SPH_C32(0x47ff0000), SPH_C32(0x812600d4), SPH_C32(0x5bcf0000),
+      SPH_C32(0x36b70000), SPH_C32(0x47392832), SPH_C32(0x935f59b7),
+      SPH_C32(0x256c4600), SPH_C32(0xd9267fe4), SPH_C32(0x3d010000),
+      SPH_C32(0xd29000c0), SPH_C32(0xe68d0000), SPH_C32(0xc6310000),
+      SPH_C32(0xca304571), SPH_C32(0xa8ea90ce), SPH_C32(0x385630bf),
+      SPH_C32(0xc290fed9) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x86790000), SPH_C32(0x3f390002), SPH_C32(0xe19ae000),
+      SPH_C32(0x98560000), SPH_C32(0x9565670e), SPH_C32(0x4e88c8ea),
+      SPH_C32(0xd3dd4944), SPH_C32(0x161ddab9), SPH_C32(0x30b70000),
+      SPH_C32(0xe5d00000), SPH_C32(0xf4f46000), SPH_C32(0x42c40000),
+      SPH_C32(0x63b83d6a), SPH_C32(0x78ba9460), SPH_C32(0x21afa1ea),
+      SPH_C32(0xb0a51834) },
+    { SPH_C32(0x30b70000), SPH_C32(0xe5d00000), SPH_C32(0xf4f46000),
+      SPH_C32(0x42c40000), SPH_C32(0x63b83d6a), SPH_C32(0x78ba9460),
+      SPH_C32(0x21afa1ea), SPH_C32(0xb0a51834), SPH_C32(0xb6ce0000),
+      SPH_C32(0xdae90002), SPH_C32(0x156e8000), SPH_C32(0xda920000),
+      SPH_C32(0xf6dd5a64), SPH_C32(0x36325c8a), SPH_C32(0xf272e8ae),
+      SPH_C32(0xa6b8c28d) },
+    { SPH_C32(0xb6ce0000), SPH_C32(0xdae90002), SPH_C32(0x156e8000),
+      SPH_C32(0xda920000), SPH_C32(0xf6dd5a64), SPH_C32(0x36325c8a),
+      SPH_C32(0xf272e8ae), SPH_C32(0xa6b8c28d), SPH_C32(0x86790000),
+      SPH_C32(0x3f390002), SPH_C32(0xe19ae000), SPH_C32(0x98560000),
+      SPH_C32(0x9565670e), SPH_C32(0x4e88c8ea), SPH_C32(0xd3dd4944),
+      SPH_C32(0x161ddab9) },
+    { SPH_C32(0x14190000), SPH_C32(0x23ca003c), SPH_C32(0x50df0000),
+      SPH_C32(0x44b60000), SPH_C32(0x1b6c67b0), SPH_C32(0x3cf3ac75),
+      SPH_C32(0x61e610b0), SPH_C32(0xdbcadb80), SPH_C32(0xe3430000),
+      SPH_C32(0x3a4e0014), SPH_C32(0xf2c60000), SPH_C32(0xaa4e0000),
+      SPH_C32(0xdb1e42a6), SPH_C32(0x256bbe15), SPH_C32(0x123db156),
+      SPH_C32(0x3a4e99d7) },
+    { SPH_C32(0x92600000), SPH_C32(0x1cf3003e), SPH_C32(0xb145e000),
+      SPH_C32(0xdce00000), SPH_C32(0x8e0900be), SPH_C32(0x727b649f),
+      SPH_C32(0xb23b59f4), SPH_C32(0xcdd70139), SPH_C32(0xd3f40000),
+      SPH_C32(0xdf9e0014), SPH_C32(0x06326000), SPH_C32(0xe88a0000),
+      SPH_C32(0xb8a67fcc), SPH_C32(0x5dd12a75), SPH_C32(0x339210bc),
+      SPH_C32(0x8aeb81e3) },
+    { SPH_C32(0x24ae0000), SPH_C32(0xc61a003c), SPH_C32(0xa42b6000),
+      SPH_C32(0x06720000), SPH_C32(0x78d45ada), SPH_C32(0x44493815),
+      SPH_C32(0x4049b15a), SPH_C32(0x6b6fc3b4), SPH_C32(0x558d0000),
+      SPH_C32(0xe0a70016), SPH_C32(0xe7a88000), SPH_C32(0x70dc0000),
+      SPH_C32(0x2dc318c2), SPH_C32(0x1359e29f), SPH_C32(0xe04f59f8),
+      SPH_C32(0x9cf65b5a) },
+    { SPH_C32(0xa2d70000), SPH_C32(0xf923003e), SPH_C32(0x45b18000),
+      SPH_C32(0x9e240000), SPH_C32(0xedb13dd4), SPH_C32(0x0ac1f0ff),
+      SPH_C32(0x9394f81e), SPH_C32(0x7d72190d), SPH_C32(0x653a0000),
+      SPH_C32(0x05770016), SPH_C32(0x135ce000), SPH_C32(0x32180000),
+      SPH_C32(0x4e7b25a8), SPH_C32(0x6be376ff), SPH_C32(0xc1e0f812),
+      SPH_C32(0x2c53436e) },
+    { SPH_C32(0xe3430000), SPH_C32(0x3a4e0014), SPH_C32(0xf2c60000),
+      SPH_C32(0xaa4e0000), SPH_C32(0xdb1e42a6), SPH_C32(0x256bbe15),
+      SPH_C32(0x123db156), SPH_C32(0x3a4e99d7), SPH_C32(0xf75a0000),
+      SPH_C32(0x19840028), SPH_C32(0xa2190000), SPH_C32(0xeef80000),
+      SPH_C32(0xc0722516), SPH_C32(0x19981260), SPH_C32(0x73dba1e6),
+      SPH_C32(0xe1844257) },
+    { SPH_C32(0x653a0000), SPH_C32(0x05770016), SPH_C32(0x135ce000),
+      SPH_C32(0x32180000), SPH_C32(0x4e7b25a8), SPH_C32(0x6be376ff),
+      SPH_C32(0xc1e0f812), SPH_C32(0x2c53436e), SPH_C32(0xc7ed0000),
+      SPH_C32(0xfc540028), SPH_C32(0x56ed6000), SPH_C32(0xac3c0000),
+      SPH_C32(0xa3ca187c), SPH_C32(0x61228600), SPH_C32(0x5274000c),
+      SPH_C32(0x51215a63) },
+    { SPH_C32(0xd3f40000), SPH_C32(0xdf9e0014), SPH_C32(0x06326000),
+      SPH_C32(0xe88a0000), SPH_C32(0xb8a67fcc), SPH_C32(0x5dd12a75),
+      SPH_C32(0x339210bc), SPH_C32(0x8aeb81e3), SPH_C32(0x41940000),
+      SPH_C32(0xc36d002a), SPH_C32(0xb7778000), SPH_C32(0x346a0000),
+      SPH_C32(0x36af7f72), SPH_C32(0x2faa4eea), SPH_C32(0x81a94948),
+      SPH_C32(0x473c80da) },
+    { SPH_C32(0x558d0000), SPH_C32(0xe0a70016), SPH_C32(0xe7a88000),
+      SPH_C32(0x70dc0000), SPH_C32(0x2dc318c2), SPH_C32(0x1359e29f),
+      SPH_C32(0xe04f59f8), SPH_C32(0x9cf65b5a), SPH_C32(0x71230000),
+      SPH_C32(0x26bd002a), SPH_C32(0x4383e000), SPH_C32(0x76ae0000),
+      SPH_C32(0x55174218), SPH_C32(0x5710da8a), SPH_C32(0xa006e8a2),
+      SPH_C32(0xf79998ee) },
+    { SPH_C32(0xf75a0000), SPH_C32(0x19840028), SPH_C32(0xa2190000),
+      SPH_C32(0xeef80000), SPH_C32(0xc0722516), SPH_C32(0x19981260),
+      SPH_C32(0x73dba1e6), SPH_C32(0xe1844257), SPH_C32(0x14190000),
+      SPH_C32(0x23ca003c), SPH_C32(0x50df0000), SPH_C32(0x44b60000),
+      SPH_C32(0x1b6c67b0), SPH_C32(0x3cf3ac75), SPH_C32(0x61e610b0),
+      SPH_C32(0xdbcadb80) },
+    { SPH_C32(0x71230000), SPH_C32(0x26bd002a), SPH_C32(0x4383e000),
+      SPH_C32(0x76ae0000), SPH_C32(0x55174218), SPH_C32(0x5710da8a),
+      SPH_C32(0xa006e8a2), SPH_C32(0xf79998ee), SPH_C32(0x24ae0000),
+      SPH_C32(0xc61a003c), SPH_C32(0xa42b6000), SPH_C32(0x06720000),
+      SPH_C32(0x78d45ada), SPH_C32(0x44493815), SPH_C32(0x4049b15a),
+      SPH_C32(0x6b6fc3b4) },
+    { SPH_C32(0xc7ed0000), SPH_C32(0xfc540028), SPH_C32(0x56ed6000),
+      SPH_C32(0xac3c0000), SPH_C32(0xa3ca187c), SPH_C32(0x61228600),
+      SPH_C32(0x5274000c), SPH_C32(0x51215a63), SPH_C32(0xa2d70000),
+      SPH_C32(0xf923003e), SPH_C32(0x45b18000), SPH_C32(0x9e240000),
+      SPH_C32(0xedb13dd4), SPH_C32(0x0ac1f0ff), SPH_C32(0x9394f81e),
+      SPH_C32(0x7d72190d) },
+    { SPH_C32(0x41940000), SPH_C32(0xc36d002a), SPH_C32(0xb7778000),
+      SPH_C32(0x346a0000), SPH_C32(0x36af7f72), SPH_C32(0x2faa4eea),
+      SPH_C32(0x81a94948), SPH_C32(0x473c80da), SPH_C32(0x92600000),
+      SPH_C32(0x1cf3003e), SPH_C32(0xb145e000), SPH_C32(0xdce00000),
+      SPH_C32(0x8e0900be), SPH_C32(0x727b649f), SPH_C32(0xb23b59f4),
+      SPH_C32(0xcdd70139) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xac480000), SPH_C32(0x1ba60000), SPH_C32(0x45fb1380),
+      SPH_C32(0x03430000), SPH_C32(0x5a85316a), SPH_C32(0x1fb250b6),
+      SPH_C32(0xfe72c7fe), SPH_C32(0x91e478f6), SPH_C32(0x1e4e0000),
+      SPH_C32(0xdecf0000), SPH_C32(0x6df80180), SPH_C32(0x77240000),
+      SPH_C32(0xec47079e), SPH_C32(0xf4a0694e), SPH_C32(0xcda31812),
+      SPH_C32(0x98aa496e) },
+    { SPH_C32(0x1e4e0000), SPH_C32(0xdecf0000), SPH_C32(0x6df80180),
+      SPH_C32(0x77240000), SPH_C32(0xec47079e), SPH_C32(0xf4a0694e),
+      SPH_C32(0xcda31812), SPH_C32(0x98aa496e), SPH_C32(0xb2060000),
+      SPH_C32(0xc5690000), SPH_C32(0x28031200), SPH_C32(0x74670000),
+      SPH_C32(0xb6c236f4), SPH_C32(0xeb1239f8), SPH_C32(0x33d1dfec),
+      SPH_C32(0x094e3198) },
+    { SPH_C32(0xb2060000), SPH_C32(0xc5690000), SPH_C32(0x28031200),
+      SPH_C32(0x74670000), SPH_C32(0xb6c236f4), SPH_C32(0xeb1239f8),
+      SPH_C32(0x33d1dfec), SPH_C32(0x094e3198), SPH_C32(0xac480000),
+      SPH_C32(0x1ba60000), SPH_C32(0x45fb1380), SPH_C32(0x03430000),
+      SPH_C32(0x5a85316a), SPH_C32(0x1fb250b6), SPH_C32(0xfe72c7fe),
+      SPH_C32(0x91e478f6) },
+    { SPH_C32(0xaec30000), SPH_C32(0x9c4f0001), SPH_C32(0x79d1e000),
+      SPH_C32(0x2c150000), SPH_C32(0x45cc75b3), SPH_C32(0x6650b736),
+      SPH_C32(0xab92f78f), SPH_C32(0xa312567b), SPH_C32(0xdb250000),
+      SPH_C32(0x09290000), SPH_C32(0x49aac000), SPH_C32(0x81e10000),
+      SPH_C32(0xcafe6b59), SPH_C32(0x42793431), SPH_C32(0x43566b76),
+      SPH_C32(0xe86cba2e) },
+    { SPH_C32(0x028b0000), SPH_C32(0x87e90001), SPH_C32(0x3c2af380),
+      SPH_C32(0x2f560000), SPH_C32(0x1f4944d9), SPH_C32(0x79e2e780),
+      SPH_C32(0x55e03071), SPH_C32(0x32f62e8d), SPH_C32(0xc56b0000),
+      SPH_C32(0xd7e60000), SPH_C32(0x2452c180), SPH_C32(0xf6c50000),
+      SPH_C32(0x26b96cc7), SPH_C32(0xb6d95d7f), SPH_C32(0x8ef57364),
+      SPH_C32(0x70c6f340) },
+    { SPH_C32(0xb08d0000), SPH_C32(0x42800001), SPH_C32(0x1429e180),
+      SPH_C32(0x5b310000), SPH_C32(0xa98b722d), SPH_C32(0x92f0de78),
+      SPH_C32(0x6631ef9d), SPH_C32(0x3bb81f15), SPH_C32(0x69230000),
+      SPH_C32(0xcc400000), SPH_C32(0x61a9d200), SPH_C32(0xf5860000),
+      SPH_C32(0x7c3c5dad), SPH_C32(0xa96b0dc9), SPH_C32(0x7087b49a),
+      SPH_C32(0xe1228bb6) },
+    { SPH_C32(0x1cc50000), SPH_C32(0x59260001), SPH_C32(0x51d2f200),
+      SPH_C32(0x58720000), SPH_C32(0xf30e4347), SPH_C32(0x8d428ece),
+      SPH_C32(0x98432863), SPH_C32(0xaa5c67e3), SPH_C32(0x776d0000),
+      SPH_C32(0x128f0000), SPH_C32(0x0c51d380), SPH_C32(0x82a20000),
+      SPH_C32(0x907b5a33), SPH_C32(0x5dcb6487), SPH_C32(0xbd24ac88),
+      SPH_C32(0x7988c2d8) },
+    { SPH_C32(0xdb250000), SPH_C32(0x09290000), SPH_C32(0x49aac000),
+      SPH_C32(0x81e10000), SPH_C32(0xcafe6b59), SPH_C32(0x42793431),
+      SPH_C32(0x43566b76), SPH_C32(0xe86cba2e), SPH_C32(0x75e60000),
+      SPH_C32(0x95660001), SPH_C32(0x307b2000), SPH_C32(0xadf40000),
+      SPH_C32(0x8f321eea), SPH_C32(0x24298307), SPH_C32(0xe8c49cf9),
+      SPH_C32(0x4b7eec55) },
+    { SPH_C32(0x776d0000), SPH_C32(0x128f0000), SPH_C32(0x0c51d380),
+      SPH_C32(0x82a20000), SPH_C32(0x907b5a33), SPH_C32(0x5dcb6487),
+      SPH_C32(0xbd24ac88), SPH_C32(0x7988c2d8), SPH_C32(0x6ba80000),
+      SPH_C32(0x4ba90001), SPH_C32(0x5d832180), SPH_C32(0xdad00000),
+      SPH_C32(0x63751974), SPH_C32(0xd089ea49), SPH_C32(0x256784eb),
+      SPH_C32(0xd3d4a53b) },
+    { SPH_C32(0xc56b0000), SPH_C32(0xd7e60000), SPH_C32(0x2452c180),
+      SPH_C32(0xf6c50000), SPH_C32(0x26b96cc7), SPH_C32(0xb6d95d7f),
+      SPH_C32(0x8ef57364), SPH_C32(0x70c6f340), SPH_C32(0xc7e00000),
+      SPH_C32(0x500f0001), SPH_C32(0x18783200), SPH_C32(0xd9930000),
+      SPH_C32(0x39f0281e), SPH_C32(0xcf3bbaff), SPH_C32(0xdb154315),
+      SPH_C32(0x4230ddcd) },
+    { SPH_C32(0x69230000), SPH_C32(0xcc400000), SPH_C32(0x61a9d200),
+      SPH_C32(0xf5860000), SPH_C32(0x7c3c5dad), SPH_C32(0xa96b0dc9),
+      SPH_C32(0x7087b49a), SPH_C32(0xe1228bb6), SPH_C32(0xd9ae0000),
+      SPH_C32(0x8ec00001), SPH_C32(0x75803380), SPH_C32(0xaeb70000),
+      SPH_C32(0xd5b72f80), SPH_C32(0x3b9bd3b1), SPH_C32(0x16b65b07),
+      SPH_C32(0xda9a94a3) },
+    { SPH_C32(0x75e60000), SPH_C32(0x95660001), SPH_C32(0x307b2000),
+      SPH_C32(0xadf40000), SPH_C32(0x8f321eea), SPH_C32(0x24298307),
+      SPH_C32(0xe8c49cf9), SPH_C32(0x4b7eec55), SPH_C32(0xaec30000),
+      SPH_C32(0x9c4f0001), SPH_C32(0x79d1e000), SPH_C32(0x2c150000),
+      SPH_C32(0x45cc75b3), SPH_C32(0x6650b736), SPH_C32(0xab92f78f),
+      SPH_C32(0xa312567b) },
+    { SPH_C32(0xd9ae0000), SPH_C32(0x8ec00001), SPH_C32(0x75803380),
+      SPH_C32(0xaeb70000), SPH_C32(0xd5b72f80), SPH_C32(0x3b9bd3b1),
+      SPH_C32(0x16b65b07), SPH_C32(0xda9a94a3), SPH_C32(0xb08d0000),
+      SPH_C32(0x42800001), SPH_C32(0x1429e180), SPH_C32(0x5b310000),
+      SPH_C32(0xa98b722d), SPH_C32(0x92f0de78), SPH_C32(0x6631ef9d),
+      SPH_C32(0x3bb81f15) },
+    { SPH_C32(0x6ba80000), SPH_C32(0x4ba90001), SPH_C32(0x5d832180),
+      SPH_C32(0xdad00000), SPH_C32(0x63751974), SPH_C32(0xd089ea49),
+      SPH_C32(0x256784eb), SPH_C32(0xd3d4a53b), SPH_C32(0x1cc50000),
+      SPH_C32(0x59260001), SPH_C32(0x51d2f200), SPH_C32(0x58720000),
+      SPH_C32(0xf30e4347), SPH_C32(0x8d428ece), SPH_C32(0x98432863),
+      SPH_C32(0xaa5c67e3) },
+    { SPH_C32(0xc7e00000), SPH_C32(0x500f0001), SPH_C32(0x18783200),
+      SPH_C32(0xd9930000), SPH_C32(0x39f0281e), SPH_C32(0xcf3bbaff),
+      SPH_C32(0xdb154315), SPH_C32(0x4230ddcd), SPH_C32(0x028b0000),
+      SPH_C32(0x87e90001), SPH_C32(0x3c2af380), SPH_C32(0x2f560000),
+      SPH_C32(0x1f4944d9), SPH_C32(0x79e2e780), SPH_C32(0x55e03071),
+      SPH_C32(0x32f62e8d) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xcc140000), SPH_C32(0xa5630000), SPH_C32(0x5ab90780),
+      SPH_C32(0x3b500000), SPH_C32(0x4bd013ff), SPH_C32(0x879b3418),
+      SPH_C32(0x694348c1), SPH_C32(0xca5a87fe), SPH_C32(0x819e0000),
+      SPH_C32(0xec570000), SPH_C32(0x66320280), SPH_C32(0x95f30000),
+      SPH_C32(0x5da92802), SPH_C32(0x48f43cbc), SPH_C32(0xe65aa22d),
+      SPH_C32(0x8e67b7fa) },
+    { SPH_C32(0x819e0000), SPH_C32(0xec570000), SPH_C32(0x66320280),
+      SPH_C32(0x95f30000), SPH_C32(0x5da92802), SPH_C32(0x48f43cbc),
+      SPH_C32(0xe65aa22d), SPH_C32(0x8e67b7fa), SPH_C32(0x4d8a0000),
+      SPH_C32(0x49340000), SPH_C32(0x3c8b0500), SPH_C32(0xaea30000),
+      SPH_C32(0x16793bfd), SPH_C32(0xcf6f08a4), SPH_C32(0x8f19eaec),
+      SPH_C32(0x443d3004) },
+    { SPH_C32(0x4d8a0000), SPH_C32(0x49340000), SPH_C32(0x3c8b0500),
+      SPH_C32(0xaea30000), SPH_C32(0x16793bfd), SPH_C32(0xcf6f08a4),
+      SPH_C32(0x8f19eaec), SPH_C32(0x443d3004), SPH_C32(0xcc140000),
+      SPH_C32(0xa5630000), SPH_C32(0x5ab90780), SPH_C32(0x3b500000),
+      SPH_C32(0x4bd013ff), SPH_C32(0x879b3418), SPH_C32(0x694348c1),
+      SPH_C32(0xca5a87fe) },
+    { SPH_C32(0x78230000), SPH_C32(0x12fc0000), SPH_C32(0xa93a0b80),
+      SPH_C32(0x90a50000), SPH_C32(0x713e2879), SPH_C32(0x7ee98924),
+      SPH_C32(0xf08ca062), SPH_C32(0x636f8bab), SPH_C32(0x02af0000),
+      SPH_C32(0xb7280000), SPH_C32(0xba1c0300), SPH_C32(0x56980000),
+      SPH_C32(0xba8d45d3), SPH_C32(0x8048c667), SPH_C32(0xa95c149a),
+      SPH_C32(0xf4f6ea7b) },
+    { SPH_C32(0xb4370000), SPH_C32(0xb79f0000), SPH_C32(0xf3830c00),
+      SPH_C32(0xabf50000), SPH_C32(0x3aee3b86), SPH_C32(0xf972bd3c),
+      SPH_C32(0x99cfe8a3), SPH_C32(0xa9350c55), SPH_C32(0x83310000),
+      SPH_C32(0x5b7f0000), SPH_C32(0xdc2e0180), SPH_C32(0xc36b0000),
+      SPH_C32(0xe7246dd1), SPH_C32(0xc8bcfadb), SPH_C32(0x4f06b6b7),
+      SPH_C32(0x7a915d81) },
+    { SPH_C32(0xf9bd0000), SPH_C32(0xfeab0000), SPH_C32(0xcf080900),
+      SPH_C32(0x05560000), SPH_C32(0x2c97007b), SPH_C32(0x361db598),
+      SPH_C32(0x16d6024f), SPH_C32(0xed083c51), SPH_C32(0x4f250000),
+      SPH_C32(0xfe1c0000), SPH_C32(0x86970600), SPH_C32(0xf83b0000),
+      SPH_C32(0xacf47e2e), SPH_C32(0x4f27cec3), SPH_C32(0x2645fe76),
+      SPH_C32(0xb0cbda7f) },
+    { SPH_C32(0x35a90000), SPH_C32(0x5bc80000), SPH_C32(0x95b10e80),
+      SPH_C32(0x3e060000), SPH_C32(0x67471384), SPH_C32(0xb1868180),
+      SPH_C32(0x7f954a8e), SPH_C32(0x2752bbaf), SPH_C32(0xcebb0000),
+      SPH_C32(0x124b0000), SPH_C32(0xe0a50480), SPH_C32(0x6dc80000),
+      SPH_C32(0xf15d562c), SPH_C32(0x07d3f27f), SPH_C32(0xc01f5c5b),
+      SPH_C32(0x3eac6d85) },
+    { SPH_C32(0x02af0000), SPH_C32(0xb7280000), SPH_C32(0xba1c0300),
+      SPH_C32(0x56980000), SPH_C32(0xba8d45d3), SPH_C32(0x8048c667),
+      SPH_C32(0xa95c149a), SPH_C32(0xf4f6ea7b), SPH_C32(0x7a8c0000),
+      SPH_C32(0xa5d40000), SPH_C32(0x13260880), SPH_C32(0xc63d0000),
+      SPH_C32(0xcbb36daa), SPH_C32(0xfea14f43), SPH_C32(0x59d0b4f8),
+      SPH_C32(0x979961d0) },
+    { SPH_C32(0xcebb0000), SPH_C32(0x124b0000), SPH_C32(0xe0a50480),
+      SPH_C32(0x6dc80000), SPH_C32(0xf15d562c), SPH_C32(0x07d3f27f),
+      SPH_C32(0xc01f5c5b), SPH_C32(0x3eac6d85), SPH_C32(0xfb120000),
+      SPH_C32(0x49830000), SPH_C32(0x75140a00), SPH_C32(0x53ce0000),
+      SPH_C32(0x961a45a8), SPH_C32(0xb65573ff), SPH_C32(0xbf8a16d5),
+      SPH_C32(0x19fed62a) },
+    { SPH_C32(0x83310000), SPH_C32(0x5b7f0000), SPH_C32(0xdc2e0180),
+      SPH_C32(0xc36b0000), SPH_C32(0xe7246dd1), SPH_C32(0xc8bcfadb),
+      SPH_C32(0x4f06b6b7), SPH_C32(0x7a915d81), SPH_C32(0x37060000),
+      SPH_C32(0xece00000), SPH_C32(0x2fad0d80), SPH_C32(0x689e0000),
+      SPH_C32(0xddca5657), SPH_C32(0x31ce47e7), SPH_C32(0xd6c95e14),
+      SPH_C32(0xd3a451d4) },
+    { SPH_C32(0x4f250000), SPH_C32(0xfe1c0000), SPH_C32(0x86970600),
+      SPH_C32(0xf83b0000), SPH_C32(0xacf47e2e), SPH_C32(0x4f27cec3),
+      SPH_C32(0x2645fe76), SPH_C32(0xb0cbda7f), SPH_C32(0xb6980000),
+      SPH_C32(0x00b70000), SPH_C32(0x499f0f00), SPH_C32(0xfd6d0000),
+      SPH_C32(0x80637e55), SPH_C32(0x793a7b5b), SPH_C32(0x3093fc39),
+      SPH_C32(0x5dc3e62e) },
+    { SPH_C32(0x7a8c0000), SPH_C32(0xa5d40000), SPH_C32(0x13260880),
+      SPH_C32(0xc63d0000), SPH_C32(0xcbb36daa), SPH_C32(0xfea14f43),
+      SPH_C32(0x59d0b4f8), SPH_C32(0x979961d0), SPH_C32(0x78230000),
+      SPH_C32(0x12fc0000), SPH_C32(0xa93a0b80), SPH_C32(0x90a50000),
+      SPH_C32(0x713e2879), SPH_C32(0x7ee98924), SPH_C32(0xf08ca062),
+      SPH_C32(0x636f8bab) },
+    { SPH_C32(0xb6980000), SPH_C32(0x00b70000), SPH_C32(0x499f0f00),
+      SPH_C32(0xfd6d0000), SPH_C32(0x80637e55), SPH_C32(0x793a7b5b),
+      SPH_C32(0x3093fc39), SPH_C32(0x5dc3e62e), SPH_C32(0xf9bd0000),
+      SPH_C32(0xfeab0000), SPH_C32(0xcf080900), SPH_C32(0x05560000),
+      SPH_C32(0x2c97007b), SPH_C32(0x361db598), SPH_C32(0x16d6024f),
+      SPH_C32(0xed083c51) },
+    { SPH_C32(0xfb120000), SPH_C32(0x49830000), SPH_C32(0x75140a00),
+      SPH_C32(0x53ce0000), SPH_C32(0x961a45a8), SPH_C32(0xb65573ff),
+      SPH_C32(0xbf8a16d5), SPH_C32(0x19fed62a), SPH_C32(0x35a90000),
+      SPH_C32(0x5bc80000), SPH_C32(0x95b10e80), SPH_C32(0x3e060000),
+      SPH_C32(0x67471384), SPH_C32(0xb1868180), SPH_C32(0x7f954a8e),
+      SPH_C32(0x2752bbaf) },
+    { SPH_C32(0x37060000), SPH_C32(0xece00000), SPH_C32(0x2fad0d80),
+      SPH_C32(0x689e0000), SPH_C32(0xddca5657), SPH_C32(0x31ce47e7),
+      SPH_C32(0xd6c95e14), SPH_C32(0xd3a451d4), SPH_C32(0xb4370000),
+      SPH_C32(0xb79f0000), SPH_C32(0xf3830c00), SPH_C32(0xabf50000),
+      SPH_C32(0x3aee3b86), SPH_C32(0xf972bd3c), SPH_C32(0x99cfe8a3),
+      SPH_C32(0xa9350c55) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x88980000), SPH_C32(0x1f940000), SPH_C32(0x7fcf002e),
+      SPH_C32(0xfb4e0000), SPH_C32(0xf158079a), SPH_C32(0x61ae9167),
+      SPH_C32(0xa895706c), SPH_C32(0xe6107494), SPH_C32(0x0bc20000),
+      SPH_C32(0xdb630000), SPH_C32(0x7e88000c), SPH_C32(0x15860000),
+      SPH_C32(0x91fd48f3), SPH_C32(0x7581bb43), SPH_C32(0xf460449e),
+      SPH_C32(0xd8b61463) },
+    { SPH_C32(0x0bc20000), SPH_C32(0xdb630000), SPH_C32(0x7e88000c),
+      SPH_C32(0x15860000), SPH_C32(0x91fd48f3), SPH_C32(0x7581bb43),
+      SPH_C32(0xf460449e), SPH_C32(0xd8b61463), SPH_C32(0x835a0000),
+      SPH_C32(0xc4f70000), SPH_C32(0x01470022), SPH_C32(0xeec80000),
+      SPH_C32(0x60a54f69), SPH_C32(0x142f2a24), SPH_C32(0x5cf534f2),
+      SPH_C32(0x3ea660f7) },
+    { SPH_C32(0x835a0000), SPH_C32(0xc4f70000), SPH_C32(0x01470022),
+      SPH_C32(0xeec80000), SPH_C32(0x60a54f69), SPH_C32(0x142f2a24),
+      SPH_C32(0x5cf534f2), SPH_C32(0x3ea660f7), SPH_C32(0x88980000),
+      SPH_C32(0x1f940000), SPH_C32(0x7fcf002e), SPH_C32(0xfb4e0000),
+      SPH_C32(0xf158079a), SPH_C32(0x61ae9167), SPH_C32(0xa895706c),
+      SPH_C32(0xe6107494) },
+    { SPH_C32(0x52500000), SPH_C32(0x29540000), SPH_C32(0x6a61004e),
+      SPH_C32(0xf0ff0000), SPH_C32(0x9a317eec), SPH_C32(0x452341ce),
+      SPH_C32(0xcf568fe5), SPH_C32(0x5303130f), SPH_C32(0x538d0000),
+      SPH_C32(0xa9fc0000), SPH_C32(0x9ef70006), SPH_C32(0x56ff0000),
+      SPH_C32(0x0ae4004e), SPH_C32(0x92c5cdf9), SPH_C32(0xa9444018),
+      SPH_C32(0x7f975691) },
+    { SPH_C32(0xdac80000), SPH_C32(0x36c00000), SPH_C32(0x15ae0060),
+      SPH_C32(0x0bb10000), SPH_C32(0x6b697976), SPH_C32(0x248dd0a9),
+      SPH_C32(0x67c3ff89), SPH_C32(0xb513679b), SPH_C32(0x584f0000),
+      SPH_C32(0x729f0000), SPH_C32(0xe07f000a), SPH_C32(0x43790000),
+      SPH_C32(0x9b1948bd), SPH_C32(0xe74476ba), SPH_C32(0x5d240486),
+      SPH_C32(0xa72142f2) },
+    { SPH_C32(0x59920000), SPH_C32(0xf2370000), SPH_C32(0x14e90042),
+      SPH_C32(0xe5790000), SPH_C32(0x0bcc361f), SPH_C32(0x30a2fa8d),
+      SPH_C32(0x3b36cb7b), SPH_C32(0x8bb5076c), SPH_C32(0xd0d70000),
+      SPH_C32(0x6d0b0000), SPH_C32(0x9fb00024), SPH_C32(0xb8370000),
+      SPH_C32(0x6a414f27), SPH_C32(0x86eae7dd), SPH_C32(0xf5b174ea),
+      SPH_C32(0x41313666) },
+    { SPH_C32(0xd10a0000), SPH_C32(0xeda30000), SPH_C32(0x6b26006c),
+      SPH_C32(0x1e370000), SPH_C32(0xfa943185), SPH_C32(0x510c6bea),
+      SPH_C32(0x93a3bb17), SPH_C32(0x6da573f8), SPH_C32(0xdb150000),
+      SPH_C32(0xb6680000), SPH_C32(0xe1380028), SPH_C32(0xadb10000),
+      SPH_C32(0xfbbc07d4), SPH_C32(0xf36b5c9e), SPH_C32(0x01d13074),
+      SPH_C32(0x99872205) },
+    { SPH_C32(0x538d0000), SPH_C32(0xa9fc0000), SPH_C32(0x9ef70006),
+      SPH_C32(0x56ff0000), SPH_C32(0x0ae4004e), SPH_C32(0x92c5cdf9),
+      SPH_C32(0xa9444018), SPH_C32(0x7f975691), SPH_C32(0x01dd0000),
+      SPH_C32(0x80a80000), SPH_C32(0xf4960048), SPH_C32(0xa6000000),
+      SPH_C32(0x90d57ea2), SPH_C32(0xd7e68c37), SPH_C32(0x6612cffd),
+      SPH_C32(0x2c94459e) },
+    { SPH_C32(0xdb150000), SPH_C32(0xb6680000), SPH_C32(0xe1380028),
+      SPH_C32(0xadb10000), SPH_C32(0xfbbc07d4), SPH_C32(0xf36b5c9e),
+      SPH_C32(0x01d13074), SPH_C32(0x99872205), SPH_C32(0x0a1f0000),
+      SPH_C32(0x5bcb0000), SPH_C32(0x8a1e0044), SPH_C32(0xb3860000),
+      SPH_C32(0x01283651), SPH_C32(0xa2673774), SPH_C32(0x92728b63),
+      SPH_C32(0xf42251fd) },
+    { SPH_C32(0x584f0000), SPH_C32(0x729f0000), SPH_C32(0xe07f000a),
+      SPH_C32(0x43790000), SPH_C32(0x9b1948bd), SPH_C32(0xe74476ba),
+      SPH_C32(0x5d240486), SPH_C32(0xa72142f2), SPH_C32(0x82870000),
+      SPH_C32(0x445f0000), SPH_C32(0xf5d1006a), SPH_C32(0x48c80000),
+      SPH_C32(0xf07031cb), SPH_C32(0xc3c9a613), SPH_C32(0x3ae7fb0f),
+      SPH_C32(0x12322569) },
+    { SPH_C32(0xd0d70000), SPH_C32(0x6d0b0000), SPH_C32(0x9fb00024),
+      SPH_C32(0xb8370000), SPH_C32(0x6a414f27), SPH_C32(0x86eae7dd),
+      SPH_C32(0xf5b174ea), SPH_C32(0x41313666), SPH_C32(0x89450000),
+      SPH_C32(0x9f3c0000), SPH_C32(0x8b590066), SPH_C32(0x5d4e0000),
+      SPH_C32(0x618d7938), SPH_C32(0xb6481d50), SPH_C32(0xce87bf91),
+      SPH_C32(0xca84310a) },
+    { SPH_C32(0x01dd0000), SPH_C32(0x80a80000), SPH_C32(0xf4960048),
+      SPH_C32(0xa6000000), SPH_C32(0x90d57ea2), SPH_C32(0xd7e68c37),
+      SPH_C32(0x6612cffd), SPH_C32(0x2c94459e), SPH_C32(0x52500000),
+      SPH_C32(0x29540000), SPH_C32(0x6a61004e), SPH_C32(0xf0ff0000),
+      SPH_C32(0x9a317eec), SPH_C32(0x452341ce), SPH_C32(0xcf568fe5),
+      SPH_C32(0x5303130f) },
+    { SPH_C32(0x89450000), SPH_C32(0x9f3c0000), SPH_C32(0x8b590066),
+      SPH_C32(0x5d4e0000), SPH_C32(0x618d7938), SPH_C32(0xb6481d50),
+      SPH_C32(0xce87bf91), SPH_C32(0xca84310a), SPH_C32(0x59920000),
+      SPH_C32(0xf2370000), SPH_C32(0x14e90042), SPH_C32(0xe5790000),
+      SPH_C32(0x0bcc361f), SPH_C32(0x30a2fa8d), SPH_C32(0x3b36cb7b),
+      SPH_C32(0x8bb5076c) },
+    { SPH_C32(0x0a1f0000), SPH_C32(0x5bcb0000), SPH_C32(0x8a1e0044),
+      SPH_C32(0xb3860000), SPH_C32(0x01283651), SPH_C32(0xa2673774),
+      SPH_C32(0x92728b63), SPH_C32(0xf42251fd), SPH_C32(0xd10a0000),
+      SPH_C32(0xeda30000), SPH_C32(0x6b26006c), SPH_C32(0x1e370000),
+      SPH_C32(0xfa943185), SPH_C32(0x510c6bea), SPH_C32(0x93a3bb17),
+      SPH_C32(0x6da573f8) },
+    { SPH_C32(0x82870000), SPH_C32(0x445f0000), SPH_C32(0xf5d1006a),
+      SPH_C32(0x48c80000), SPH_C32(0xf07031cb), SPH_C32(0xc3c9a613),
+      SPH_C32(0x3ae7fb0f), SPH_C32(0x12322569), SPH_C32(0xdac80000),
+      SPH_C32(0x36c00000), SPH_C32(0x15ae0060), SPH_C32(0x0bb10000),
+      SPH_C32(0x6b697976), SPH_C32(0x248dd0a9), SPH_C32(0x67c3ff89),
+      SPH_C32(0xb513679b) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x58430000), SPH_C32(0x807e0000), SPH_C32(0x78330001),
+      SPH_C32(0xc66b3800), SPH_C32(0xe7375cdc), SPH_C32(0x79ad3fdd),
+      SPH_C32(0xac73fe6f), SPH_C32(0x3a4479b1), SPH_C32(0x1d5a0000),
+      SPH_C32(0x2b720000), SPH_C32(0x488d0000), SPH_C32(0xaf611800),
+      SPH_C32(0x25cb2ec5), SPH_C32(0xc879bfd0), SPH_C32(0x81a20429),
+      SPH_C32(0x1e7536a6) },
+    { SPH_C32(0x1d5a0000), SPH_C32(0x2b720000), SPH_C32(0x488d0000),
+      SPH_C32(0xaf611800), SPH_C32(0x25cb2ec5), SPH_C32(0xc879bfd0),
+      SPH_C32(0x81a20429), SPH_C32(0x1e7536a6), SPH_C32(0x45190000),
+      SPH_C32(0xab0c0000), SPH_C32(0x30be0001), SPH_C32(0x690a2000),
+      SPH_C32(0xc2fc7219), SPH_C32(0xb1d4800d), SPH_C32(0x2dd1fa46),
+      SPH_C32(0x24314f17) },
+    { SPH_C32(0x45190000), SPH_C32(0xab0c0000), SPH_C32(0x30be0001),
+      SPH_C32(0x690a2000), SPH_C32(0xc2fc7219), SPH_C32(0xb1d4800d),
+      SPH_C32(0x2dd1fa46), SPH_C32(0x24314f17), SPH_C32(0x58430000),
+      SPH_C32(0x807e0000), SPH_C32(0x78330001), SPH_C32(0xc66b3800),
+      SPH_C32(0xe7375cdc), SPH_C32(0x79ad3fdd), SPH_C32(0xac73fe6f),
+      SPH_C32(0x3a4479b1) },
+    { SPH_C32(0xa53b0000), SPH_C32(0x14260000), SPH_C32(0x4e30001e),
+      SPH_C32(0x7cae0000), SPH_C32(0x8f9e0dd5), SPH_C32(0x78dfaa3d),
+      SPH_C32(0xf73168d8), SPH_C32(0x0b1b4946), SPH_C32(0x07ed0000),
+      SPH_C32(0xb2500000), SPH_C32(0x8774000a), SPH_C32(0x970d0000),
+      SPH_C32(0x437223ae), SPH_C32(0x48c76ea4), SPH_C32(0xf4786222),
+      SPH_C32(0x9075b1ce) },
+    { SPH_C32(0xfd780000), SPH_C32(0x94580000), SPH_C32(0x3603001f),
+      SPH_C32(0xbac53800), SPH_C32(0x68a95109), SPH_C32(0x017295e0),
+      SPH_C32(0x5b4296b7), SPH_C32(0x315f30f7), SPH_C32(0x1ab70000),
+      SPH_C32(0x99220000), SPH_C32(0xcff9000a), SPH_C32(0x386c1800),
+      SPH_C32(0x66b90d6b), SPH_C32(0x80bed174), SPH_C32(0x75da660b),
+      SPH_C32(0x8e008768) },
+    { SPH_C32(0xb8610000), SPH_C32(0x3f540000), SPH_C32(0x06bd001e),
+      SPH_C32(0xd3cf1800), SPH_C32(0xaa552310), SPH_C32(0xb0a615ed),
+      SPH_C32(0x76936cf1), SPH_C32(0x156e7fe0), SPH_C32(0x42f40000),
+      SPH_C32(0x195c0000), SPH_C32(0xb7ca000b), SPH_C32(0xfe072000),
+      SPH_C32(0x818e51b7), SPH_C32(0xf913eea9), SPH_C32(0xd9a99864),
+      SPH_C32(0xb444fed9) },
+    { SPH_C32(0xe0220000), SPH_C32(0xbf2a0000), SPH_C32(0x7e8e001f),
+      SPH_C32(0x15a42000), SPH_C32(0x4d627fcc), SPH_C32(0xc90b2a30),
+      SPH_C32(0xdae0929e), SPH_C32(0x2f2a0651), SPH_C32(0x5fae0000),
+      SPH_C32(0x322e0000), SPH_C32(0xff47000b), SPH_C32(0x51663800),
+      SPH_C32(0xa4457f72), SPH_C32(0x316a5179), SPH_C32(0x580b9c4d),
+      SPH_C32(0xaa31c87f) },
+    { SPH_C32(0x07ed0000), SPH_C32(0xb2500000), SPH_C32(0x8774000a),
+      SPH_C32(0x970d0000), SPH_C32(0x437223ae), SPH_C32(0x48c76ea4),
+      SPH_C32(0xf4786222), SPH_C32(0x9075b1ce), SPH_C32(0xa2d60000),
+      SPH_C32(0xa6760000), SPH_C32(0xc9440014), SPH_C32(0xeba30000),
+      SPH_C32(0xccec2e7b), SPH_C32(0x3018c499), SPH_C32(0x03490afa),
+      SPH_C32(0x9b6ef888) },
+    { SPH_C32(0x5fae0000), SPH_C32(0x322e0000), SPH_C32(0xff47000b),
+      SPH_C32(0x51663800), SPH_C32(0xa4457f72), SPH_C32(0x316a5179),
+      SPH_C32(0x580b9c4d), SPH_C32(0xaa31c87f), SPH_C32(0xbf8c0000),
+      SPH_C32(0x8d040000), SPH_C32(0x81c90014), SPH_C32(0x44c21800),
+      SPH_C32(0xe92700be), SPH_C32(0xf8617b49), SPH_C32(0x82eb0ed3),
+      SPH_C32(0x851bce2e) },
+    { SPH_C32(0x1ab70000), SPH_C32(0x99220000), SPH_C32(0xcff9000a),
+      SPH_C32(0x386c1800), SPH_C32(0x66b90d6b), SPH_C32(0x80bed174),
+      SPH_C32(0x75da660b), SPH_C32(0x8e008768), SPH_C32(0xe7cf0000),
+      SPH_C32(0x0d7a0000), SPH_C32(0xf9fa0015), SPH_C32(0x82a92000),
+      SPH_C32(0x0e105c62), SPH_C32(0x81cc4494), SPH_C32(0x2e98f0bc),
+      SPH_C32(0xbf5fb79f) },
+    { SPH_C32(0x42f40000), SPH_C32(0x195c0000), SPH_C32(0xb7ca000b),
+      SPH_C32(0xfe072000), SPH_C32(0x818e51b7), SPH_C32(0xf913eea9),
+      SPH_C32(0xd9a99864), SPH_C32(0xb444fed9), SPH_C32(0xfa950000),
+      SPH_C32(0x26080000), SPH_C32(0xb1770015), SPH_C32(0x2dc83800),
+      SPH_C32(0x2bdb72a7), SPH_C32(0x49b5fb44), SPH_C32(0xaf3af495),
+      SPH_C32(0xa12a8139) },
+    { SPH_C32(0xa2d60000), SPH_C32(0xa6760000), SPH_C32(0xc9440014),
+      SPH_C32(0xeba30000), SPH_C32(0xccec2e7b), SPH_C32(0x3018c499),
+      SPH_C32(0x03490afa), SPH_C32(0x9b6ef888), SPH_C32(0xa53b0000),
+      SPH_C32(0x14260000), SPH_C32(0x4e30001e), SPH_C32(0x7cae0000),
+      SPH_C32(0x8f9e0dd5), SPH_C32(0x78dfaa3d), SPH_C32(0xf73168d8),
+      SPH_C32(0x0b1b4946) },
+    { SPH_C32(0xfa950000), SPH_C32(0x26080000), SPH_C32(0xb1770015),
+      SPH_C32(0x2dc83800), SPH_C32(0x2bdb72a7), SPH_C32(0x49b5fb44),
+      SPH_C32(0xaf3af495), SPH_C32(0xa12a8139), SPH_C32(0xb8610000),
+      SPH_C32(0x3f540000), SPH_C32(0x06bd001e), SPH_C32(0xd3cf1800),
+      SPH_C32(0xaa552310), SPH_C32(0xb0a615ed), SPH_C32(0x76936cf1),
+      SPH_C32(0x156e7fe0) },
+    { SPH_C32(0xbf8c0000), SPH_C32(0x8d040000), SPH_C32(0x81c90014),
+      SPH_C32(0x44c21800), SPH_C32(0xe92700be), SPH_C32(0xf8617b49),
+      SPH_C32(0x82eb0ed3), SPH_C32(0x851bce2e), SPH_C32(0xe0220000),
+      SPH_C32(0xbf2a0000), SPH_C32(0x7e8e001f), SPH_C32(0x15a42000),
+      SPH_C32(0x4d627fcc), SPH_C32(0xc90b2a30), SPH_C32(0xdae0929e),
+      SPH_C32(0x2f2a0651) },
+    { SPH_C32(0xe7cf0000), SPH_C32(0x0d7a0000), SPH_C32(0xf9fa0015),
+      SPH_C32(0x82a92000), SPH_C32(0x0e105c62), SPH_C32(0x81cc4494),
+      SPH_C32(0x2e98f0bc), SPH_C32(0xbf5fb79f), SPH_C32(0xfd780000),
+      SPH_C32(0x94580000), SPH_C32(0x3603001f), SPH_C32(0xbac53800),
+      SPH_C32(0x68a95109), SPH_C32(0x017295e0), SPH_C32(0x5b4296b7),
+      SPH_C32(0x315f30f7) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x02f20000), SPH_C32(0xa2810000), SPH_C32(0x873f0000),
+      SPH_C32(0xe36c7800), SPH_C32(0x1e1d74ef), SPH_C32(0x073d2bd6),
+      SPH_C32(0xc4c23237), SPH_C32(0x7f32259e), SPH_C32(0xbadd0000),
+      SPH_C32(0x13ad0000), SPH_C32(0xb7e70000), SPH_C32(0xf7282800),
+      SPH_C32(0xdf45144d), SPH_C32(0x361ac33a), SPH_C32(0xea5a8d14),
+      SPH_C32(0x2a2c18f0) },
+    { SPH_C32(0xbadd0000), SPH_C32(0x13ad0000), SPH_C32(0xb7e70000),
+      SPH_C32(0xf7282800), SPH_C32(0xdf45144d), SPH_C32(0x361ac33a),
+      SPH_C32(0xea5a8d14), SPH_C32(0x2a2c18f0), SPH_C32(0xb82f0000),
+      SPH_C32(0xb12c0000), SPH_C32(0x30d80000), SPH_C32(0x14445000),
+      SPH_C32(0xc15860a2), SPH_C32(0x3127e8ec), SPH_C32(0x2e98bf23),
+      SPH_C32(0x551e3d6e) },
+    { SPH_C32(0xb82f0000), SPH_C32(0xb12c0000), SPH_C32(0x30d80000),
+      SPH_C32(0x14445000), SPH_C32(0xc15860a2), SPH_C32(0x3127e8ec),
+      SPH_C32(0x2e98bf23), SPH_C32(0x551e3d6e), SPH_C32(0x02f20000),
+      SPH_C32(0xa2810000), SPH_C32(0x873f0000), SPH_C32(0xe36c7800),
+      SPH_C32(0x1e1d74ef), SPH_C32(0x073d2bd6), SPH_C32(0xc4c23237),
+      SPH_C32(0x7f32259e) },
+    { SPH_C32(0x1e6c0000), SPH_C32(0xc4420000), SPH_C32(0x8a2e0000),
+      SPH_C32(0xbcb6b800), SPH_C32(0x2c4413b6), SPH_C32(0x8bfdd3da),
+      SPH_C32(0x6a0c1bc8), SPH_C32(0xb99dc2eb), SPH_C32(0x92560000),
+      SPH_C32(0x1eda0000), SPH_C32(0xea510000), SPH_C32(0xe8b13000),
+      SPH_C32(0xa93556a5), SPH_C32(0xebfb6199), SPH_C32(0xb15c2254),
+      SPH_C32(0x33c5244f) },
+    { SPH_C32(0x1c9e0000), SPH_C32(0x66c30000), SPH_C32(0x0d110000),
+      SPH_C32(0x5fdac000), SPH_C32(0x32596759), SPH_C32(0x8cc0f80c),
+      SPH_C32(0xaece29ff), SPH_C32(0xc6afe775), SPH_C32(0x288b0000),
+      SPH_C32(0x0d770000), SPH_C32(0x5db60000), SPH_C32(0x1f991800),
+      SPH_C32(0x767042e8), SPH_C32(0xdde1a2a3), SPH_C32(0x5b06af40),
+      SPH_C32(0x19e93cbf) },
+    { SPH_C32(0xa4b10000), SPH_C32(0xd7ef0000), SPH_C32(0x3dc90000),
+      SPH_C32(0x4b9e9000), SPH_C32(0xf30107fb), SPH_C32(0xbde710e0),
+      SPH_C32(0x805696dc), SPH_C32(0x93b1da1b), SPH_C32(0x2a790000),
+      SPH_C32(0xaff60000), SPH_C32(0xda890000), SPH_C32(0xfcf56000),
+      SPH_C32(0x686d3607), SPH_C32(0xdadc8975), SPH_C32(0x9fc49d77),
+      SPH_C32(0x66db1921) },
+    { SPH_C32(0xa6430000), SPH_C32(0x756e0000), SPH_C32(0xbaf60000),
+      SPH_C32(0xa8f2e800), SPH_C32(0xed1c7314), SPH_C32(0xbada3b36),
+      SPH_C32(0x4494a4eb), SPH_C32(0xec83ff85), SPH_C32(0x90a40000),
+      SPH_C32(0xbc5b0000), SPH_C32(0x6d6e0000), SPH_C32(0x0bdd4800),
+      SPH_C32(0xb728224a), SPH_C32(0xecc64a4f), SPH_C32(0x759e1063),
+      SPH_C32(0x4cf701d1) },
+    { SPH_C32(0x92560000), SPH_C32(0x1eda0000), SPH_C32(0xea510000),
+      SPH_C32(0xe8b13000), SPH_C32(0xa93556a5), SPH_C32(0xebfb6199),
+      SPH_C32(0xb15c2254), SPH_C32(0x33c5244f), SPH_C32(0x8c3a0000),
+      SPH_C32(0xda980000), SPH_C32(0x607f0000), SPH_C32(0x54078800),
+      SPH_C32(0x85714513), SPH_C32(0x6006b243), SPH_C32(0xdb50399c),
+      SPH_C32(0x8a58e6a4) },
+    { SPH_C32(0x90a40000), SPH_C32(0xbc5b0000), SPH_C32(0x6d6e0000),
+      SPH_C32(0x0bdd4800), SPH_C32(0xb728224a), SPH_C32(0xecc64a4f),
+      SPH_C32(0x759e1063), SPH_C32(0x4cf701d1), SPH_C32(0x36e70000),
+      SPH_C32(0xc9350000), SPH_C32(0xd7980000), SPH_C32(0xa32fa000),
+      SPH_C32(0x5a34515e), SPH_C32(0x561c7179), SPH_C32(0x310ab488),
+      SPH_C32(0xa074fe54) },
+    { SPH_C32(0x288b0000), SPH_C32(0x0d770000), SPH_C32(0x5db60000),
+      SPH_C32(0x1f991800), SPH_C32(0x767042e8), SPH_C32(0xdde1a2a3),
+      SPH_C32(0x5b06af40), SPH_C32(0x19e93cbf), SPH_C32(0x34150000),
+      SPH_C32(0x6bb40000), SPH_C32(0x50a70000), SPH_C32(0x4043d800),
+      SPH_C32(0x442925b1), SPH_C32(0x51215aaf), SPH_C32(0xf5c886bf),
+      SPH_C32(0xdf46dbca) },
+    { SPH_C32(0x2a790000), SPH_C32(0xaff60000), SPH_C32(0xda890000),
+      SPH_C32(0xfcf56000), SPH_C32(0x686d3607), SPH_C32(0xdadc8975),
+      SPH_C32(0x9fc49d77), SPH_C32(0x66db1921), SPH_C32(0x8ec80000),
+      SPH_C32(0x78190000), SPH_C32(0xe7400000), SPH_C32(0xb76bf000),
+      SPH_C32(0x9b6c31fc), SPH_C32(0x673b9995), SPH_C32(0x1f920bab),
+      SPH_C32(0xf56ac33a) },
+    { SPH_C32(0x8c3a0000), SPH_C32(0xda980000), SPH_C32(0x607f0000),
+      SPH_C32(0x54078800), SPH_C32(0x85714513), SPH_C32(0x6006b243),
+      SPH_C32(0xdb50399c), SPH_C32(0x8a58e6a4), SPH_C32(0x1e6c0000),
+      SPH_C32(0xc4420000), SPH_C32(0x8a2e0000), SPH_C32(0xbcb6b800),
+      SPH_C32(0x2c4413b6), SPH_C32(0x8bfdd3da), SPH_C32(0x6a0c1bc8),
+      SPH_C32(0xb99dc2eb) },
+    { SPH_C32(0x8ec80000), SPH_C32(0x78190000), SPH_C32(0xe7400000),
+      SPH_C32(0xb76bf000), SPH_C32(0x9b6c31fc), SPH_C32(0x673b9995),
+      SPH_C32(0x1f920bab), SPH_C32(0xf56ac33a), SPH_C32(0xa4b10000),
+      SPH_C32(0xd7ef0000), SPH_C32(0x3dc90000), SPH_C32(0x4b9e9000),
+      SPH_C32(0xf30107fb), SPH_C32(0xbde710e0), SPH_C32(0x805696dc),
+      SPH_C32(0x93b1da1b) },
+    { SPH_C32(0x36e70000), SPH_C32(0xc9350000), SPH_C32(0xd7980000),
+      SPH_C32(0xa32fa000), SPH_C32(0x5a34515e), SPH_C32(0x561c7179),
+      SPH_C32(0x310ab488), SPH_C32(0xa074fe54), SPH_C32(0xa6430000),
+      SPH_C32(0x756e0000), SPH_C32(0xbaf60000), SPH_C32(0xa8f2e800),
+      SPH_C32(0xed1c7314), SPH_C32(0xbada3b36), SPH_C32(0x4494a4eb),
+      SPH_C32(0xec83ff85) },
+    { SPH_C32(0x34150000), SPH_C32(0x6bb40000), SPH_C32(0x50a70000),
+      SPH_C32(0x4043d800), SPH_C32(0x442925b1), SPH_C32(0x51215aaf),
+      SPH_C32(0xf5c886bf), SPH_C32(0xdf46dbca), SPH_C32(0x1c9e0000),
+      SPH_C32(0x66c30000), SPH_C32(0x0d110000), SPH_C32(0x5fdac000),
+      SPH_C32(0x32596759), SPH_C32(0x8cc0f80c), SPH_C32(0xaece29ff),
+      SPH_C32(0xc6afe775) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0xe6280000), SPH_C32(0x4c4b0000), SPH_C32(0xa8550000),
+      SPH_C32(0xd3d002e0), SPH_C32(0xd86130b8), SPH_C32(0x98a7b0da),
+      SPH_C32(0x289506b4), SPH_C32(0xd75a4897), SPH_C32(0xf0c50000),
+      SPH_C32(0x59230000), SPH_C32(0x45820000), SPH_C32(0xe18d00c0),
+      SPH_C32(0x3b6d0631), SPH_C32(0xc2ed5699), SPH_C32(0xcbe0fe1c),
+      SPH_C32(0x56a7b19f) },
+    { SPH_C32(0xf0c50000), SPH_C32(0x59230000), SPH_C32(0x45820000),
+      SPH_C32(0xe18d00c0), SPH_C32(0x3b6d0631), SPH_C32(0xc2ed5699),
+      SPH_C32(0xcbe0fe1c), SPH_C32(0x56a7b19f), SPH_C32(0x16ed0000),
+      SPH_C32(0x15680000), SPH_C32(0xedd70000), SPH_C32(0x325d0220),
+      SPH_C32(0xe30c3689), SPH_C32(0x5a4ae643), SPH_C32(0xe375f8a8),
+      SPH_C32(0x81fdf908) },
+    { SPH_C32(0x16ed0000), SPH_C32(0x15680000), SPH_C32(0xedd70000),
+      SPH_C32(0x325d0220), SPH_C32(0xe30c3689), SPH_C32(0x5a4ae643),
+      SPH_C32(0xe375f8a8), SPH_C32(0x81fdf908), SPH_C32(0xe6280000),
+      SPH_C32(0x4c4b0000), SPH_C32(0xa8550000), SPH_C32(0xd3d002e0),
+      SPH_C32(0xd86130b8), SPH_C32(0x98a7b0da), SPH_C32(0x289506b4),
+      SPH_C32(0xd75a4897) },
+    { SPH_C32(0xb4310000), SPH_C32(0x77330000), SPH_C32(0xb15d0000),
+      SPH_C32(0x7fd004e0), SPH_C32(0x78a26138), SPH_C32(0xd116c35d),
+      SPH_C32(0xd256d489), SPH_C32(0x4e6f74de), SPH_C32(0xe3060000),
+      SPH_C32(0xbdc10000), SPH_C32(0x87130000), SPH_C32(0xbff20060),
+      SPH_C32(0x2eba0a1a), SPH_C32(0x8db53751), SPH_C32(0x73c5ab06),
+      SPH_C32(0x5bd61539) },
+    { SPH_C32(0x52190000), SPH_C32(0x3b780000), SPH_C32(0x19080000),
+      SPH_C32(0xac000600), SPH_C32(0xa0c35180), SPH_C32(0x49b17387),
+      SPH_C32(0xfac3d23d), SPH_C32(0x99353c49), SPH_C32(0x13c30000),
+      SPH_C32(0xe4e20000), SPH_C32(0xc2910000), SPH_C32(0x5e7f00a0),
+      SPH_C32(0x15d70c2b), SPH_C32(0x4f5861c8), SPH_C32(0xb825551a),
+      SPH_C32(0x0d71a4a6) },
+    { SPH_C32(0x44f40000), SPH_C32(0x2e100000), SPH_C32(0xf4df0000),
+      SPH_C32(0x9e5d0420), SPH_C32(0x43cf6709), SPH_C32(0x13fb95c4),
+      SPH_C32(0x19b62a95), SPH_C32(0x18c8c541), SPH_C32(0xf5eb0000),
+      SPH_C32(0xa8a90000), SPH_C32(0x6ac40000), SPH_C32(0x8daf0240),
+      SPH_C32(0xcdb63c93), SPH_C32(0xd7ffd112), SPH_C32(0x90b053ae),
+      SPH_C32(0xda2bec31) },
+    { SPH_C32(0xa2dc0000), SPH_C32(0x625b0000), SPH_C32(0x5c8a0000),
+      SPH_C32(0x4d8d06c0), SPH_C32(0x9bae57b1), SPH_C32(0x8b5c251e),
+      SPH_C32(0x31232c21), SPH_C32(0xcf928dd6), SPH_C32(0x052e0000),
+      SPH_C32(0xf18a0000), SPH_C32(0x2f460000), SPH_C32(0x6c220280),
+      SPH_C32(0xf6db3aa2), SPH_C32(0x1512878b), SPH_C32(0x5b50adb2),
+      SPH_C32(0x8c8c5dae) },
+    { SPH_C32(0xe3060000), SPH_C32(0xbdc10000), SPH_C32(0x87130000),
+      SPH_C32(0xbff20060), SPH_C32(0x2eba0a1a), SPH_C32(0x8db53751),
+      SPH_C32(0x73c5ab06), SPH_C32(0x5bd61539), SPH_C32(0x57370000),
+      SPH_C32(0xcaf20000), SPH_C32(0x364e0000), SPH_C32(0xc0220480),
+      SPH_C32(0x56186b22), SPH_C32(0x5ca3f40c), SPH_C32(0xa1937f8f),
+      SPH_C32(0x15b961e7) },
+    { SPH_C32(0x052e0000), SPH_C32(0xf18a0000), SPH_C32(0x2f460000),
+      SPH_C32(0x6c220280), SPH_C32(0xf6db3aa2), SPH_C32(0x1512878b),
+      SPH_C32(0x5b50adb2), SPH_C32(0x8c8c5dae), SPH_C32(0xa7f20000),
+      SPH_C32(0x93d10000), SPH_C32(0x73cc0000), SPH_C32(0x21af0440),
+      SPH_C32(0x6d756d13), SPH_C32(0x9e4ea295), SPH_C32(0x6a738193),
+      SPH_C32(0x431ed078) },
+    { SPH_C32(0x13c30000), SPH_C32(0xe4e20000), SPH_C32(0xc2910000),
+      SPH_C32(0x5e7f00a0), SPH_C32(0x15d70c2b), SPH_C32(0x4f5861c8),
+      SPH_C32(0xb825551a), SPH_C32(0x0d71a4a6), SPH_C32(0x41da0000),
+      SPH_C32(0xdf9a0000), SPH_C32(0xdb990000), SPH_C32(0xf27f06a0),
+      SPH_C32(0xb5145dab), SPH_C32(0x06e9124f), SPH_C32(0x42e68727),
+      SPH_C32(0x944498ef) },
+    { SPH_C32(0xf5eb0000), SPH_C32(0xa8a90000), SPH_C32(0x6ac40000),
+      SPH_C32(0x8daf0240), SPH_C32(0xcdb63c93), SPH_C32(0xd7ffd112),
+      SPH_C32(0x90b053ae), SPH_C32(0xda2bec31), SPH_C32(0xb11f0000),
+      SPH_C32(0x86b90000), SPH_C32(0x9e1b0000), SPH_C32(0x13f20660),
+      SPH_C32(0x8e795b9a), SPH_C32(0xc40444d6), SPH_C32(0x8906793b),
+      SPH_C32(0xc2e32970) },
+    { SPH_C32(0x57370000), SPH_C32(0xcaf20000), SPH_C32(0x364e0000),
+      SPH_C32(0xc0220480), SPH_C32(0x56186b22), SPH_C32(0x5ca3f40c),
+      SPH_C32(0xa1937f8f), SPH_C32(0x15b961e7), SPH_C32(0xb4310000),
+      SPH_C32(0x77330000), SPH_C32(0xb15d0000), SPH_C32(0x7fd004e0),
+      SPH_C32(0x78a26138), SPH_C32(0xd116c35d), SPH_C32(0xd256d489),
+      SPH_C32(0x4e6f74de) },
+    { SPH_C32(0xb11f0000), SPH_C32(0x86b90000), SPH_C32(0x9e1b0000),
+      SPH_C32(0x13f20660), SPH_C32(0x8e795b9a), SPH_C32(0xc40444d6),
+      SPH_C32(0x8906793b), SPH_C32(0xc2e32970), SPH_C32(0x44f40000),
+      SPH_C32(0x2e100000), SPH_C32(0xf4df0000), SPH_C32(0x9e5d0420),
+      SPH_C32(0x43cf6709), SPH_C32(0x13fb95c4), SPH_C32(0x19b62a95),
+      SPH_C32(0x18c8c541) },
+    { SPH_C32(0xa7f20000), SPH_C32(0x93d10000), SPH_C32(0x73cc0000),
+      SPH_C32(0x21af0440), SPH_C32(0x6d756d13), SPH_C32(0x9e4ea295),
+      SPH_C32(0x6a738193), SPH_C32(0x431ed078), SPH_C32(0xa2dc0000),
+      SPH_C32(0x625b0000), SPH_C32(0x5c8a0000), SPH_C32(0x4d8d06c0),
+      SPH_C32(0x9bae57b1), SPH_C32(0x8b5c251e), SPH_C32(0x31232c21),
+      SPH_C32(0xcf928dd6) },
+    { SPH_C32(0x41da0000), SPH_C32(0xdf9a0000), SPH_C32(0xdb990000),
+      SPH_C32(0xf27f06a0), SPH_C32(0xb5145dab), SPH_C32(0x06e9124f),
+      SPH_C32(0x42e68727), SPH_C32(0x944498ef), SPH_C32(0x52190000),
+      SPH_C32(0x3b780000), SPH_C32(0x19080000), SPH_C32(0xac000600),
+      SPH_C32(0xa0c35180), SPH_C32(0x49b17387), SPH_C32(0xfac3d23d),
+      SPH_C32(0x99353c49) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x5fa80000), SPH_C32(0x56030000), SPH_C32(0x43ae0000),
+      SPH_C32(0x64f30013), SPH_C32(0x257e86bf), SPH_C32(0x1311944e),
+      SPH_C32(0x541e95bf), SPH_C32(0x8ea4db69), SPH_C32(0x00440000),
+      SPH_C32(0x7f480000), SPH_C32(0xda7c0000), SPH_C32(0x2a230001),
+      SPH_C32(0x3badc9cc), SPH_C32(0xa9b69c87), SPH_C32(0x030a9e60),
+      SPH_C32(0xbe0a679e) },
+    { SPH_C32(0x00440000), SPH_C32(0x7f480000), SPH_C32(0xda7c0000),
+      SPH_C32(0x2a230001), SPH_C32(0x3badc9cc), SPH_C32(0xa9b69c87),
+      SPH_C32(0x030a9e60), SPH_C32(0xbe0a679e), SPH_C32(0x5fec0000),
+      SPH_C32(0x294b0000), SPH_C32(0x99d20000), SPH_C32(0x4ed00012),
+      SPH_C32(0x1ed34f73), SPH_C32(0xbaa708c9), SPH_C32(0x57140bdf),
+      SPH_C32(0x30aebcf7) },
+    { SPH_C32(0x5fec0000), SPH_C32(0x294b0000), SPH_C32(0x99d20000),
+      SPH_C32(0x4ed00012), SPH_C32(0x1ed34f73), SPH_C32(0xbaa708c9),
+      SPH_C32(0x57140bdf), SPH_C32(0x30aebcf7), SPH_C32(0x5fa80000),
+      SPH_C32(0x56030000), SPH_C32(0x43ae0000), SPH_C32(0x64f30013),
+      SPH_C32(0x257e86bf), SPH_C32(0x1311944e), SPH_C32(0x541e95bf),
+      SPH_C32(0x8ea4db69) },
+    { SPH_C32(0xee930000), SPH_C32(0xd6070000), SPH_C32(0x92c10000),
+      SPH_C32(0x2b9801e0), SPH_C32(0x9451287c), SPH_C32(0x3b6cfb57),
+      SPH_C32(0x45312374), SPH_C32(0x201f6a64), SPH_C32(0x7b280000),
+      SPH_C32(0x57420000), SPH_C32(0xa9e50000), SPH_C32(0x634300a0),
+      SPH_C32(0x9edb442f), SPH_C32(0x6d9995bb), SPH_C32(0x27f83b03),
+      SPH_C32(0xc7ff60f0) },
+    { SPH_C32(0xb13b0000), SPH_C32(0x80040000), SPH_C32(0xd16f0000),
+      SPH_C32(0x4f6b01f3), SPH_C32(0xb12faec3), SPH_C32(0x287d6f19),
+      SPH_C32(0x112fb6cb), SPH_C32(0xaebbb10d), SPH_C32(0x7b6c0000),
+      SPH_C32(0x280a0000), SPH_C32(0x73990000), SPH_C32(0x496000a1),
+      SPH_C32(0xa5768de3), SPH_C32(0xc42f093c), SPH_C32(0x24f2a563),
+      SPH_C32(0x79f5076e) },
+    { SPH_C32(0xeed70000), SPH_C32(0xa94f0000), SPH_C32(0x48bd0000),
+      SPH_C32(0x01bb01e1), SPH_C32(0xaffce1b0), SPH_C32(0x92da67d0),
+      SPH_C32(0x463bbd14), SPH_C32(0x9e150dfa), SPH_C32(0x24c40000),
+      SPH_C32(0x7e090000), SPH_C32(0x30370000), SPH_C32(0x2d9300b2),
+      SPH_C32(0x80080b5c), SPH_C32(0xd73e9d72), SPH_C32(0x70ec30dc),
+      SPH_C32(0xf751dc07) },
+    { SPH_C32(0xb17f0000), SPH_C32(0xff4c0000), SPH_C32(0x0b130000),
+      SPH_C32(0x654801f2), SPH_C32(0x8a82670f), SPH_C32(0x81cbf39e),
+      SPH_C32(0x122528ab), SPH_C32(0x10b1d693), SPH_C32(0x24800000),
+      SPH_C32(0x01410000), SPH_C32(0xea4b0000), SPH_C32(0x07b000b3),
+      SPH_C32(0xbba5c290), SPH_C32(0x7e8801f5), SPH_C32(0x73e6aebc),
+      SPH_C32(0x495bbb99) },
+    { SPH_C32(0x7b280000), SPH_C32(0x57420000), SPH_C32(0xa9e50000),
+      SPH_C32(0x634300a0), SPH_C32(0x9edb442f), SPH_C32(0x6d9995bb),
+      SPH_C32(0x27f83b03), SPH_C32(0xc7ff60f0), SPH_C32(0x95bb0000),
+      SPH_C32(0x81450000), SPH_C32(0x3b240000), SPH_C32(0x48db0140),
+      SPH_C32(0x0a8a6c53), SPH_C32(0x56f56eec), SPH_C32(0x62c91877),
+      SPH_C32(0xe7e00a94) },
+    { SPH_C32(0x24800000), SPH_C32(0x01410000), SPH_C32(0xea4b0000),
+      SPH_C32(0x07b000b3), SPH_C32(0xbba5c290), SPH_C32(0x7e8801f5),
+      SPH_C32(0x73e6aebc), SPH_C32(0x495bbb99), SPH_C32(0x95ff0000),
+      SPH_C32(0xfe0d0000), SPH_C32(0xe1580000), SPH_C32(0x62f80141),
+      SPH_C32(0x3127a59f), SPH_C32(0xff43f26b), SPH_C32(0x61c38617),
+      SPH_C32(0x59ea6d0a) },
+    { SPH_C32(0x7b6c0000), SPH_C32(0x280a0000), SPH_C32(0x73990000),
+      SPH_C32(0x496000a1), SPH_C32(0xa5768de3), SPH_C32(0xc42f093c),
+      SPH_C32(0x24f2a563), SPH_C32(0x79f5076e), SPH_C32(0xca570000),
+      SPH_C32(0xa80e0000), SPH_C32(0xa2f60000), SPH_C32(0x060b0152),
+      SPH_C32(0x14592320), SPH_C32(0xec526625), SPH_C32(0x35dd13a8),
+      SPH_C32(0xd74eb663) },
+    { SPH_C32(0x24c40000), SPH_C32(0x7e090000), SPH_C32(0x30370000),
+      SPH_C32(0x2d9300b2), SPH_C32(0x80080b5c), SPH_C32(0xd73e9d72),
+      SPH_C32(0x70ec30dc), SPH_C32(0xf751dc07), SPH_C32(0xca130000),
+      SPH_C32(0xd7460000), SPH_C32(0x788a0000), SPH_C32(0x2c280153),
+      SPH_C32(0x2ff4eaec), SPH_C32(0x45e4faa2), SPH_C32(0x36d78dc8),
+      SPH_C32(0x6944d1fd) },
+    { SPH_C32(0x95bb0000), SPH_C32(0x81450000), SPH_C32(0x3b240000),
+      SPH_C32(0x48db0140), SPH_C32(0x0a8a6c53), SPH_C32(0x56f56eec),
+      SPH_C32(0x62c91877), SPH_C32(0xe7e00a94), SPH_C32(0xee930000),
+      SPH_C32(0xd6070000), SPH_C32(0x92c10000), SPH_C32(0x2b9801e0),
+      SPH_C32(0x9451287c), SPH_C32(0x3b6cfb57), SPH_C32(0x45312374),
+      SPH_C32(0x201f6a64) },
+    { SPH_C32(0xca130000), SPH_C32(0xd7460000), SPH_C32(0x788a0000),
+      SPH_C32(0x2c280153), SPH_C32(0x2ff4eaec), SPH_C32(0x45e4faa2),
+      SPH_C32(0x36d78dc8), SPH_C32(0x6944d1fd), SPH_C32(0xeed70000),
+      SPH_C32(0xa94f0000), SPH_C32(0x48bd0000), SPH_C32(0x01bb01e1),
+      SPH_C32(0xaffce1b0), SPH_C32(0x92da67d0), SPH_C32(0x463bbd14),
+      SPH_C32(0x9e150dfa) },
+    { SPH_C32(0x95ff0000), SPH_C32(0xfe0d0000), SPH_C32(0xe1580000),
+      SPH_C32(0x62f80141), SPH_C32(0x3127a59f), SPH_C32(0xff43f26b),
+      SPH_C32(0x61c38617), SPH_C32(0x59ea6d0a), SPH_C32(0xb17f0000),
+      SPH_C32(0xff4c0000), SPH_C32(0x0b130000), SPH_C32(0x654801f2),
+      SPH_C32(0x8a82670f), SPH_C32(0x81cbf39e), SPH_C32(0x122528ab),
+      SPH_C32(0x10b1d693) },
+    { SPH_C32(0xca570000), SPH_C32(0xa80e0000), SPH_C32(0xa2f60000),
+      SPH_C32(0x060b0152), SPH_C32(0x14592320), SPH_C32(0xec526625),
+      SPH_C32(0x35dd13a8), SPH_C32(0xd74eb663), SPH_C32(0xb13b0000),
+      SPH_C32(0x80040000), SPH_C32(0xd16f0000), SPH_C32(0x4f6b01f3),
+      SPH_C32(0xb12faec3), SPH_C32(0x287d6f19), SPH_C32(0x112fb6cb),
+      SPH_C32(0xaebbb10d) }
+  },
+  {
+    { SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000), SPH_C32(0x00000000), SPH_C32(0x00000000),
+      SPH_C32(0x00000000) },
+    { SPH_C32(0x033d0000), SPH_C32(0x08b30000), SPH_C32(0xf33a0000),
+      SPH_C32(0x3ac20007), SPH_C32(0x51298a50), SPH_C32(0x6b6e661f),
+      SPH_C32(0x0ea5cfe3), SPH_C32(0xe6da7ffe), SPH_C32(0xa8da0000),
+      SPH_C32(0x96be0000), SPH_C32(0x5c1d0000), SPH_C32(0x07da0002),
+      SPH_C32(0x7d669583), SPH_C32(0x1f98708a), SPH_C32(0xbb668808),
+      SPH_C32(0xda878000) },
+    { SPH_C32(0xa8da0000), SPH_C32(0x96be0000), SPH_C32(0x5c1d0000),
+      SPH_C32(0x07da0002), SPH_C32(0x7d669583), SPH_C32(0x1f98708a),
+      SPH_C32(0xbb668808), SPH_C32(0xda878000), SPH_C32(0xabe70000),
+      SPH_C32(0x9e0d0000), SPH_C32(0xaf270000), SPH_C32(0x3d180005),
+      SPH_C32(0x2c4f1fd3), SPH_C32(0x74f61695), SPH_C32(0xb5c347eb),
+      SPH_C32(0x3c5dfffe) },
+    { SPH_C32(0xabe70000), SPH_C32(0x9e0d0000), SPH_C32(0xaf270000),
+      SPH_C32(0x3d180005), SPH_C32(0x2c4f1fd3), SPH_C32(0x74f61695),
+      SPH_C32(0xb5c347eb), SPH_C32(0x3c5dfffe), SPH_C32(0x033d0000),
+      SPH_C32(0x08b30000), SPH_C32(0xf33a0000), SPH_C32(0x3ac20007),
+      SPH_C32(0x51298a50), SPH_C32(0x6b6e661f), SPH_C32(0x0ea5cfe3),
+      SPH_C32(0xe6da7ffe) },
+    { SPH_C32(0x01930000), SPH_C32(0xe7820000), SPH_C32(0xedfb0000),
+      SPH_C32(0xcf0c000b), SPH_C32(0x8dd08d58), SPH_C32(0xbca3b42e),
+      SPH_C32(0x063661e1), SPH_C32(0x536f9e7b), SPH_C32(0x92280000),
+      SPH_C32(0xdc850000), SPH_C32(0x57fa0000), SPH_C32(0x56dc0003),
+      SPH_C32(0xbae92316), SPH_C32(0x5aefa30c), SPH_C32(0x90cef752),
+      SPH_C32(0x7b1675d7) },
+    { SPH_C32(0x02ae0000), SPH_C32(0xef310000), SPH_C32(0x1ec10000),
+      SPH_C32(0xf5ce000c), SPH_C32(0xdcf90708), SPH_C32(0xd7cdd231),
+      SPH_C32(0x0893ae02), SPH_C32(0xb5b5e185), SPH_C32(0x3af20000),
+      SPH_C32(0x4a3b0000), SPH_C32(0x0be70000), SPH_C32(0x51060001),
+      SPH_C32(0xc78fb695), SPH_C32(0x4577d386), SPH_C32(0x2ba87f5a),
+      SPH_C32(0xa191f5d7) },
+    { SPH_C32(0xa9490000), SPH_C32(0x713c0000), SPH_C32(0xb1e60000),
+      SPH_C32(0xc8d60009), SPH_C32(0xf0b618db), SPH_C32(0xa33bc4a4),
+      SPH_C32(0xbd50e9e9), SPH_C32(0x89e81e7b), SPH_C32(0x39cf0000),
+      SPH_C32(0x42880000), SPH_C32(0xf8dd0000), SPH_C32(0x6bc40006),
+      SPH_C32(0x96a63cc5), SPH_C32(0x2e19b599), SPH_C32(0x250db0b9),
+      SPH_C32(0x474b8a29) },
+    { SPH_C32(0xaa740000), SPH_C32(0x798f0000), SPH_C32(0x42dc0000),
+      SPH_C32(0xf214000e), SPH_C32(0xa19f928b), SPH_C32(0xc855a2bb),
+      SPH_C32(0xb3f5260a), SPH_C32(0x6f326185), SPH_C32(0x91150000),
+      SPH_C32(0xd4360000), SPH_C32(0xa4c00000), SPH_C32(0x6c1e0004),
+      SPH_C32(0xebc0a946), SPH_C32(0x3181c513), SPH_C32(0x9e6b38b1),
+      SPH_C32(0x9dcc0a29) },
+    { SPH_C32(0x92280000), SPH_C32(0xdc850000), SPH_C32(0x57fa0000),
+      SPH_C32(0x56dc0003), SPH_C32(0xbae92316), SPH_C32(0x5aefa30c),
+      SPH_C32(0x90cef752), SPH_C32(0x7b1675d7), SPH_C32(0x93bb0000),
+      SPH_C32(0x3b070000), SPH_C32(0xba010000), SPH_C32(0x99d00008),
+      SPH_C32(0x3739ae4e), SPH_C32(0xe64c1722), SPH_C32(0x96f896b3),
+      SPH_C32(0x2879ebac) },
+    { SPH_C32(0x91150000), SPH_C32(0xd4360000), SPH_C32(0xa4c00000),
+      SPH_C32(0x6c1e0004), SPH_C32(0xebc0a946), SPH_C32(0x3181c513),
+      SPH_C32(0x9e6b38b1), SPH_C32(0x9dcc0a29), SPH_C32(0x3b610000),
+      SPH_C32(0xadb90000), SPH_C32(0xe61c0000), SPH_C32(0x9e0a000a),
+      SPH_C32(0x4a5f3bcd), SPH_C32(0xf9d467a8), SPH_C32(0x2d9e1ebb),
+      SPH_C32(0xf2fe6bac) },
+    { SPH_C32(0x3af20000), SPH_C32(0x4a3b0000), SPH_C32(0x0be70000),
+      SPH_C32(0x51060001), SPH_C32(0xc78fb695), SPH_C32(0x4577d386),
+      SPH_C32(0x2ba87f5a), SPH_C32(0xa191f5d7), SPH_C32(0x385c0000),
+      SPH_C32(0xa50a0000), SPH_C32(0x15260000), SPH_C32(0xa4c8000d),
+      SPH_C32(0x1b76b19d), SPH_C32(0x92ba01b7), SPH_C32(0x233bd158),
+      SPH_C32(0x14241452) },
+    { SPH_C32(0x39cf0000), SPH_C32(0x42880000), SPH_C32(0xf8dd0000),
+      SPH_C32(0x6bc40006), SPH_C32(0x96a63cc5), SPH_C32(0x2e19b599),
+      SPH_C32(0x250db0b9), SPH_C32(0x474b8a29), SPH_C32(0x90860000),
+      SPH_C32(0x33b40000), SPH_C32(0x493b0000), SPH_C32(0xa312000f),
+      SPH_C32(0x6610241e), SPH_C32(0x8d22713d), SPH_C32(0x985d5950),
+      SPH_C32(0xcea39452) },
+    { SPH_C32(0x93bb0000), SPH_C32(0x3b070000), SPH_C32(0xba010000),
+      SPH_C32(0x99d00008), SPH_C32(0x3739ae4e), SPH_C32(0xe64c1722),
+      SPH_C32(0x96f896b3), SPH_C32(0x2879ebac), SPH_C32(0x01930000),
+      SPH_C32(0xe7820000), SPH_C32(0xedfb0000), SPH_C32(0xcf0c000b),
+      SPH_C32(0x8dd08d58), SPH_C32(0xbca3b42e), SPH_C32(0x063661e1),
+      SPH_C32(0x536f9e7b) },
+    { SPH_C32(0x90860000), SPH_C32(0x33b40000), SPH_C32(0x493b0000),
+      SPH_C32(0xa312000f), SPH_C32(0x6610241e), SPH_C32(0x8d22713d),
+      SPH_C32(0x985d5950), SPH_C32(0xcea39452), SPH_C32(0xa9490000),
+      SPH_C32(0x713c0000), SPH_C32(0xb1e60000), SPH_C32(0xc8d60009),
+      SPH_C32(0xf0b618db), SPH_C32(0xa33bc4a4), SPH_C32(0xbd50e9e9),
+      SPH_C32(0x89e81e7b) },
+    { SPH_C32(0x3b610000), SPH_C32(0xadb90000), SPH_C32(0xe61c0000),
+      SPH_C32(0x9e0a000a), SPH_C32(0x4a5f3bcd), SPH_C32(0xf9d467a8),
+      SPH_C32(0x2d9e1ebb), SPH_C32(0xf2fe6bac), SPH_C32(0xaa740000),
+      SPH_C32(0x798f0000), SPH_C32(0x42dc0000), SPH_C32(0xf214000e),
+      SPH_C32(0xa19f928b), SPH_C32(0xc855a2bb), SPH_C32(0xb3f5260a),
+      SPH_C32(0x6f326185) },
+    { SPH_C32(0x385c0000), SPH_C32(0xa50a0000), SPH_C32(0x15260000),
+      SPH_C32(0xa4c8000d), SPH_C32(0x1b76b19d), SPH_C32(0x92ba01b7),
+      SPH_C32(0x233bd158), SPH_C32(0x14241452), SPH_C32(0x02ae0000),
+      SPH_C32(0xef310000), SPH_C32(0x1ec10000), SPH_C32(0xf5ce000c),
+      SPH_C32(0xdcf90708), SPH_C32(0xd7cdd231), SPH_C32(0x0893ae02),
+      SPH_C32(0xb5b5e185) }
+  }
+};
+
+#define INPUT_BIG   do { \
+    __constant const sph_u32 *rp; \
+    unsigned u; \
+    m0 = 0; \
+    m1 = 0; \
+    m2 = 0; \
+    m3 = 0; \
+    m4 = 0; \
+    m5 = 0; \
+    m6 = 0; \
+    m7 = 0; \
+    m8 = 0; \
+    m9 = 0; \
+    mA = 0; \
+    mB = 0; \
+    mC = 0; \
+    mD = 0; \
+    mE = 0; \
+    mF = 0; \
+    for (u = 0; u < 16; u ++) { \
+      rp = &T512_N4[u][(buf((u >> 1)) >> ((~u & 1) << 2)) & 0x0f][0]; \
+      m0 ^= rp[0]; \
+      m1 ^= rp[1]; \
+      m2 ^= rp[2]; \
+      m3 ^= rp[3]; \
+      m4 ^= rp[4]; \
+      m5 ^= rp[5]; \
+      m6 ^= rp[6]; \
+      m7 ^= rp[7]; \
+      m8 ^= rp[8]; \
+      m9 ^= rp[9]; \
+      mA ^= rp[10]; \
+      mB ^= rp[11]; \
+      mC ^= rp[12]; \
+      mD ^= rp[13]; \
+      mE ^= rp[14]; \
+      mF ^= rp[15]; \
+    } \
+  } while (0)
+
+#endif
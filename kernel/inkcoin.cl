@@ -69,12 +69,20 @@ typedef long sph_s64;
 #define SPH_SIMD_NOCOPY 0
 #define SPH_KECCAK_NOCOPY 0
 #define SPH_COMPACT_BLAKE_64 0
+#ifndef SPH_LUFFA_PARALLEL
 #define SPH_LUFFA_PARALLEL 0
+#endif
+#ifndef SPH_SMALL_FOOTPRINT_GROESTL
 #define SPH_SMALL_FOOTPRINT_GROESTL 0
+#endif
 #define SPH_GROESTL_BIG_ENDIAN 0
 
+#ifndef SPH_CUBEHASH_UNROLL
 #define SPH_CUBEHASH_UNROLL 0
+#endif
+#ifndef SPH_KECCAK_UNROLL
 #define SPH_KECCAK_UNROLL   0
+#endif
 
 #include "shavite.cl"
 
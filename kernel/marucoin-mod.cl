@@ -72,11 +72,25 @@ typedef int sph_s32;
 #define SPH_SIMD_NOCOPY 0
 #define SPH_KECCAK_NOCOPY 0
 #define SPH_COMPACT_BLAKE_64 0
+#ifndef SPH_LUFFA_PARALLEL
 #define SPH_LUFFA_PARALLEL 0
+#endif
+#ifndef SPH_SMALL_FOOTPRINT_GROESTL
 #define SPH_SMALL_FOOTPRINT_GROESTL 0
+#endif
 #define SPH_GROESTL_BIG_ENDIAN 0
+#ifndef SPH_CUBEHASH_UNROLL
 #define SPH_CUBEHASH_UNROLL 0
+#endif
+#ifndef GROESTL_LOCAL_TABLES
+#define GROESTL_LOCAL_TABLES 1
+#endif
+#ifndef ECHO_LOCAL_TABLES
+#define ECHO_LOCAL_TABLES 1
+#endif
+#ifndef SPH_KECCAK_UNROLL
 #define SPH_KECCAK_UNROLL   1
+#endif
 #if !defined SPH_HAMSI_EXPAND_BIG
   #define SPH_HAMSI_EXPAND_BIG 1
 #endif
@@ -453,21 +467,29 @@ __kernel void search2(__global hash_t* hashes)
   uint gid = get_global_id(0);
   __global hash_t *hash = &(hashes[gid-get_global_offset(0)]);
 
-  __local sph_u64 T0_L[256], T1_L[256], T2_L[256], T3_L[256], T4_L[256], T5_L[256], T6_L[256], T7_L[256];
+#if GROESTL_LOCAL_TABLES
+  __local sph_u64 T0_L[256], T4_L[256];
+#if !SPH_SMALL_FOOTPRINT_GROESTL
+  __local sph_u64 T1_L[256], T2_L[256], T3_L[256], T5_L[256], T6_L[256], T7_L[256];
+#endif
+#endif
 
   int init = get_local_id(0);
   int step = get_local_size(0);
 
+#if GROESTL_LOCAL_TABLES
   for (int i = init; i < 256; i += step)
   {
     T0_L[i] = T0[i];
     T4_L[i] = T4[i];
+#if !SPH_SMALL_FOOTPRINT_GROESTL
     T1_L[i] = T1[i];
     T2_L[i] = T2[i];
     T3_L[i] = T3[i];
     T5_L[i] = T5[i];
     T6_L[i] = T6[i];
     T7_L[i] = T7[i];
+#endif
   }
 
   barrier(CLK_LOCAL_MEM_FENCE);
@@ -480,6 +502,7 @@ __kernel void search2(__global hash_t* hashes)
   #define T5 T5_L
   #define T6 T6_L
   #define T7 T7_L
+#endif
 
   // groestl
   sph_u64 H[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x0002000000000000};
@@ -1018,11 +1041,16 @@ __kernel void search10(__global hash_t* hashes)
   uint offset = get_global_offset(0);
   __global hash_t *hash = &(hashes[gid-offset]);
 
+#if ECHO_LOCAL_TABLES
   __local sph_u32 AES0[256], AES1[256], AES2[256], AES3[256];
+#else
+  __constant const sph_u32 *AES0 = AES0_C, *AES1 = AES1_C, *AES2 = AES2_C, *AES3 = AES3_C;
+#endif
 
   int init = get_local_id(0);
   int step = get_local_size(0);
 
+#if ECHO_LOCAL_TABLES
   for (int i = init; i < 256; i += step)
   {
     AES0[i] = AES0_C[i];
@@ -1032,6 +1060,7 @@ __kernel void search10(__global hash_t* hashes)
   }
 
   barrier(CLK_LOCAL_MEM_FENCE);
+#endif
 
   for (int i = 0; i < 8; i++)
     hash->h8[i] = hashes[gid-offset].h8[i];
@@ -1,3 +1,5 @@
+#include "multi_header.cl"
+
 #define ARGS_25(x) x ## 0, x ## 1, x ## 2, x ## 3, x ## 4, x ## 5, x ## 6, x ## 7, x ## 8, x ## 9, x ## 10, x ## 11, x ## 12, x ## 13, x ## 14, x ## 15, x ## 16, x ## 17, x ## 18, x ## 19, x ## 20, x ## 21, x ## 22, x ## 23, x ## 24
 
 __constant uint2 keccak_round_constants[24] =
@@ -89,6 +91,7 @@ __kernel void search(__global const uint2*restrict in, __global uint*restrict ou
 {
   uint2 ARGS_25(state);
 
+  in = SELECT_HEADER(in);
   state0 = in[0];
   state1 = in[1];
   state2 = in[2];
@@ -98,7 +101,7 @@ __kernel void search(__global const uint2*restrict in, __global uint*restrict ou
   state6 = in[6];
   state7 = in[7];
   state8 = in[8];
-  state9 = (uint2)(in[9].x,get_global_id(0));
+  state9 = (uint2)(in[9].x,(uint)get_global_id(0));
   state10 = (uint2)(1,0);
   state11 = 0;
   state12 = 0;
@@ -118,10 +121,10 @@ __kernel void search(__global const uint2*restrict in, __global uint*restrict ou
   keccak_block_noabsorb(ARGS_25(&state));
 
 #define FOUND (0x0F)
-#define SETFOUND(Xnonce) output[output[FOUND]++] = Xnonce
+#define SETFOUND(Xnonce) SETFOUND_HEADER(FOUND, Xnonce)
 
   if ((state3.y & 0xFFFFFFF0U) == 0)
   {
-    SETFOUND(get_global_id(0));
+    SETFOUND((uint)get_global_id(0));
   }
 }
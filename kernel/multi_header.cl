@@ -0,0 +1,33 @@
+/*
+ * Multi-header launches, see --gpu-nonce2. Built with MULTI_HEADER the
+ * global id of a search kernel is a 64-bit position in the headers of a
+ * nonce2 range: the low word is the nonce and the high word the index of
+ * the 80 byte header it is of, so one launch can run on past the end of a
+ * header into the next. Each result then takes two output words, the nonce
+ * and the header index, leaving half the slots below the counter usable.
+ */
+
+#ifndef MULTI_HEADER_CL
+#define MULTI_HEADER_CL
+
+#ifndef MULTI_HEADER
+  #define MULTI_HEADER 0
+#endif
+
+#if MULTI_HEADER
+  #define HEADER_INDEX ((uint)(get_global_id(0) >> 32))
+  /* Header of this work-item in the buffer p points to the first of */
+  #define SELECT_HEADER(p) ((p) + (size_t)HEADER_INDEX * (80 / sizeof(*(p))))
+  #define SETFOUND_HEADER(found, nonce) do { \
+      uint mh_slot = output[found]++; \
+      if (mh_slot < (found) / 2) { \
+        output[mh_slot * 2] = (nonce); \
+        output[mh_slot * 2 + 1] = HEADER_INDEX; \
+      } \
+    } while (0)
+#else
+  #define SELECT_HEADER(p) (p)
+  #define SETFOUND_HEADER(found, nonce) output[output[found]++] = (nonce)
+#endif
+
+#endif // MULTI_HEADER_CL
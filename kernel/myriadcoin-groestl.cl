@@ -65,8 +65,15 @@ typedef long sph_s64;
 
 #define SPH_ECHO_64 1
 #define SPH_SIMD_NOCOPY 0
+#ifndef SPH_LUFFA_PARALLEL
 #define SPH_LUFFA_PARALLEL 0
+#endif
+#ifndef SPH_CUBEHASH_UNROLL
 #define SPH_CUBEHASH_UNROLL 0
+#endif
+#ifndef GROESTL_LOCAL_TABLES
+#define GROESTL_LOCAL_TABLES 1
+#endif
 
 #include "groestl.cl"
 
@@ -135,19 +142,27 @@ __kernel void search(__global unsigned char* block, volatile __global uint* outp
     ulong h8[8];
   } hash;
 
-  __local sph_u64 T0_L[256], T1_L[256], T2_L[256], T3_L[256], T4_L[256], T5_L[256], T6_L[256], T7_L[256];
+#if GROESTL_LOCAL_TABLES
+  __local sph_u64 T0_L[256], T4_L[256];
+#if !SPH_SMALL_FOOTPRINT_GROESTL
+  __local sph_u64 T1_L[256], T2_L[256], T3_L[256], T5_L[256], T6_L[256], T7_L[256];
+#endif
+#endif
   int init = get_local_id(0);
   int step = get_local_size(0);
+#if GROESTL_LOCAL_TABLES
   for (int i = init; i < 256; i += step)
   {
     T0_L[i] = T0[i];
+    T4_L[i] = T4[i];
+#if !SPH_SMALL_FOOTPRINT_GROESTL
     T1_L[i] = T1[i];
     T2_L[i] = T2[i];
     T3_L[i] = T3[i];
-    T4_L[i] = T4[i];
     T5_L[i] = T5[i];
     T6_L[i] = T6[i];
     T7_L[i] = T7[i];
+#endif
   }
   barrier(CLK_LOCAL_MEM_FENCE);
 
@@ -159,6 +174,7 @@ __kernel void search(__global unsigned char* block, volatile __global uint* outp
 #define T5 T5_L
 #define T6 T6_L
 #define T7 T7_L
+#endif
 
   // groestl
 
@@ -0,0 +1,145 @@
+/*
+ * Derives the block headers of a range of stratum nonce2 values on the
+ * device, see --gpu-nonce2. One work-item per nonce2 puts it into the
+ * coinbase, hashes the coinbase, walks the merkle branches and writes the
+ * header with the new merkle root in the word order the search kernels
+ * read CLbuffer0 in.
+ */
+
+#define SWAP4(x) as_uint(as_uchar4(x).wzyx)
+
+#define SHR(x, n) ((x) >> (n))
+#define ROTR(x, n) rotate((uint)(x), (uint)(32 - (n)))
+
+#define S0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define S1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define s0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ SHR(x, 3))
+#define s1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ SHR(x, 10))
+
+#define CH(x, y, z) bitselect((z), (y), (x))
+#define MAJ(x, y, z) bitselect((x), (y), ((z) ^ (x)))
+
+__constant uint K256[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+__constant uint H256[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+/* Compresses the big endian words of one block into state */
+static void sha256_block(uint *state, uint *w)
+{
+  uint a = state[0], b = state[1], c = state[2], d = state[3];
+  uint e = state[4], f = state[5], g = state[6], h = state[7];
+  uint t1, t2;
+  int i;
+
+  for (i = 0; i < 64; i++) {
+    if (i >= 16)
+      w[i & 15] += s1(w[(i + 14) & 15]) + w[(i + 9) & 15] + s0(w[(i + 1) & 15]);
+    t1 = h + S1(e) + CH(e, f, g) + K256[i] + w[i & 15];
+    t2 = S0(a) + MAJ(a, b, c);
+    h = g; g = f; f = e; e = d + t1;
+    d = c; c = b; b = a; a = t1 + t2;
+  }
+
+  state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+  state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+/* Hashes the 8 words of a digest into it */
+static void sha256_digest(uint *hash)
+{
+  uint w[16];
+  int i;
+
+  for (i = 0; i < 8; i++) {
+    w[i] = hash[i];
+    hash[i] = H256[i];
+  }
+  w[8] = 0x80000000;
+  for (i = 9; i < 15; i++)
+    w[i] = 0;
+  w[15] = 256;
+  sha256_block(hash, w);
+}
+
+/* Byte p of the padded coinbase with nonce2 in place, little endian the
+ * way the host fills it in */
+static uchar coinbase_byte(__global const uchar *job, uint cb_len, uint nonce2_offset, uint n2size, ulong nonce2, uint p)
+{
+  if (p < cb_len) {
+    if (p - nonce2_offset < n2size)
+      return (uchar)(nonce2 >> (8 * (p - nonce2_offset)));
+    return job[p];
+  }
+  return p == cb_len ? 0x80 : 0;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void nonce2_headers(__global const uchar *job, const uint cb_len, const uint nonce2_offset, const uint n2size,
+                             const uint merkles, const uint merkle_word, const uint cb_sha256d, const ulong nonce2,
+                             const uint count, __global const uint *header, __global uint *headers)
+{
+  uint gid = get_global_id(0);
+  __global const uchar *branch = job + cb_len;
+  uint hash[8], w[16];
+  uint blocks, blk, i, j;
+
+  if (gid >= count)
+    return;
+
+  /* Coinbase with this nonce2, the bit length goes in the last 8 bytes */
+  for (i = 0; i < 8; i++)
+    hash[i] = H256[i];
+  blocks = (cb_len + 9 + 63) / 64;
+  for (blk = 0; blk < blocks; blk++) {
+    for (i = 0; i < 16; i++) {
+      uint p = blk * 64 + i * 4;
+
+      w[i] = ((uint)coinbase_byte(job, cb_len, nonce2_offset, n2size, nonce2 + gid, p) << 24) |
+             ((uint)coinbase_byte(job, cb_len, nonce2_offset, n2size, nonce2 + gid, p + 1) << 16) |
+             ((uint)coinbase_byte(job, cb_len, nonce2_offset, n2size, nonce2 + gid, p + 2) << 8) |
+             (uint)coinbase_byte(job, cb_len, nonce2_offset, n2size, nonce2 + gid, p + 3);
+    }
+    if (blk == blocks - 1)
+      w[15] = cb_len * 8;
+    sha256_block(hash, w);
+  }
+  if (cb_sha256d)
+    sha256_digest(hash);
+
+  /* Merkle branches, SHA-256d of the root followed by the branch */
+  for (j = 0; j < merkles; j++, branch += 32) {
+    uint state[8];
+
+    for (i = 0; i < 8; i++) {
+      w[i] = hash[i];
+      w[i + 8] = ((uint)branch[i * 4] << 24) | ((uint)branch[i * 4 + 1] << 16) |
+                 ((uint)branch[i * 4 + 2] << 8) | (uint)branch[i * 4 + 3];
+      state[i] = H256[i];
+    }
+    sha256_block(state, w);
+    w[0] = 0x80000000;
+    for (i = 1; i < 15; i++)
+      w[i] = 0;
+    w[15] = 512;
+    sha256_block(state, w);
+    for (i = 0; i < 8; i++)
+      hash[i] = state[i];
+    sha256_digest(hash);
+  }
+
+  for (i = 0; i < 20; i++)
+    headers[gid * 20 + i] = header[i];
+  for (i = 0; i < 8; i++)
+    headers[gid * 20 + merkle_word + i] = SWAP4(hash[i]);
+}
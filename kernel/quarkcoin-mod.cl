@@ -0,0 +1,718 @@
+/*
+ * QuarkCoin kernel implementation, split into one kernel per stage.
+ *
+ * ==========================(LICENSE BEGIN)============================
+ *
+ * Copyright (c) 2014  phm
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ===========================(LICENSE END)=============================
+ *
+ * @author   phm <phm@inbox.com>
+ */
+
+/*
+ * The quark chain picks one of two hash functions three times depending on
+ * bit 3 of the previous hash. Run in a single kernel every wavefront pays
+ * for both sides of each pick. Here every stage is its own kernel and the
+ * kernel ending before a pick sorts the hash indices into a taken and a
+ * not taken list. The two kernels of the pick then walk their own list
+ * only, so all the lanes of a wavefront run the same function and the
+ * wavefronts past the end of a list return at once.
+ *
+ * branches holds BRANCH_HEADER counters, the taken and not taken list
+ * lengths of each pick, followed by the two lists of get_global_size(0)
+ * entries each. The lists are reused by every pick, which is safe as the
+ * kernels run on an in-order queue.
+ *
+ * animecoin-mod.cl includes this file with ANIMECOIN_MOD defined, which
+ * only swaps the first two stages to bmw over the header, then blake.
+ */
+
+#ifndef QUARKCOIN_MOD_CL
+#define QUARKCOIN_MOD_CL
+
+#if __ENDIAN_LITTLE__
+#define SPH_LITTLE_ENDIAN 1
+#else
+#define SPH_BIG_ENDIAN 1
+#endif
+
+#define SPH_UPTR sph_u64
+
+typedef unsigned int sph_u32;
+typedef int sph_s32;
+#ifndef __OPENCL_VERSION__
+typedef unsigned long long sph_u64;
+typedef long long sph_s64;
+#else
+typedef unsigned long sph_u64;
+typedef long sph_s64;
+#endif
+
+#define SPH_64 1
+#define SPH_64_TRUE 1
+
+#define SPH_C32(x)    ((sph_u32)(x ## U))
+#define SPH_T32(x)    ((x) & SPH_C32(0xFFFFFFFF))
+#define SPH_ROTL32(x, n)   SPH_T32(((x) << (n)) | ((x) >> (32 - (n))))
+#define SPH_ROTR32(x, n)   SPH_ROTL32(x, (32 - (n)))
+
+#define SPH_C64(x)    ((sph_u64)(x ## UL))
+#define SPH_T64(x)    ((x) & SPH_C64(0xFFFFFFFFFFFFFFFF))
+#define SPH_ROTL64(x, n)   SPH_T64(((x) << (n)) | ((x) >> (64 - (n))))
+#define SPH_ROTR64(x, n)   SPH_ROTL64(x, (64 - (n)))
+
+#define SPH_ECHO_64 1
+#define SPH_KECCAK_64 1
+#define SPH_JH_64 1
+#define SPH_SIMD_NOCOPY 0
+#define SPH_KECCAK_NOCOPY 0
+#define SPH_COMPACT_BLAKE_64 0
+#ifndef SPH_LUFFA_PARALLEL
+#define SPH_LUFFA_PARALLEL 0
+#endif
+#ifndef SPH_SMALL_FOOTPRINT_GROESTL
+#define SPH_SMALL_FOOTPRINT_GROESTL 0
+#endif
+#define SPH_GROESTL_BIG_ENDIAN 0
+
+#ifndef SPH_CUBEHASH_UNROLL
+#define SPH_CUBEHASH_UNROLL 0
+#endif
+#ifndef SPH_KECCAK_UNROLL
+#define SPH_KECCAK_UNROLL   0
+#endif
+
+#include "blake.cl"
+#include "bmw.cl"
+#include "groestl.cl"
+#include "jh.cl"
+#include "keccak.cl"
+#include "skein.cl"
+
+#define SWAP4(x) as_uint(as_uchar4(x).wzyx)
+#define SWAP8(x) as_ulong(as_uchar8(x).s76543210)
+
+#if SPH_BIG_ENDIAN
+  #define DEC64E(x) (x)
+  #define DEC64BE(x) (*(const __global sph_u64 *) (x));
+  #define DEC64LE(x) SWAP8(*(const __global sph_u64 *) (x));
+#else
+  #define DEC64E(x) SWAP8(x)
+  #define DEC64BE(x) SWAP8(*(const __global sph_u64 *) (x));
+  #define DEC64LE(x) (*(const __global sph_u64 *) (x));
+#endif
+
+/* Counters ahead of the lists in branches, the list lengths of each pick
+ * are at 2 * pick (taken) and 2 * pick + 1 (not taken) */
+#define BRANCH_HEADER 8
+
+#define BRANCH_TAKEN(hash) (((hash).h1[7] & 0x8) != 0)
+
+typedef union {
+  unsigned char h1[64];
+  uint h4[16];
+  ulong h8[8];
+} hash_t;
+
+void blake512_64(hash_t *hash)
+{
+  sph_u64 H0 = SPH_C64(0x6A09E667F3BCC908), H1 = SPH_C64(0xBB67AE8584CAA73B);
+  sph_u64 H2 = SPH_C64(0x3C6EF372FE94F82B), H3 = SPH_C64(0xA54FF53A5F1D36F1);
+  sph_u64 H4 = SPH_C64(0x510E527FADE682D1), H5 = SPH_C64(0x9B05688C2B3E6C1F);
+  sph_u64 H6 = SPH_C64(0x1F83D9ABFB41BD6B), H7 = SPH_C64(0x5BE0CD19137E2179);
+  sph_u64 S0 = 0, S1 = 0, S2 = 0, S3 = 0;
+  sph_u64 T0 = SPH_C64(0xFFFFFFFFFFFFFC00) + (64 << 3), T1 = 0xFFFFFFFFFFFFFFFF;;
+
+  if ((T0 = SPH_T64(T0 + 1024)) < 1024)
+  {
+    T1 = SPH_T64(T1 + 1);
+  }
+  sph_u64 M0, M1, M2, M3, M4, M5, M6, M7;
+  sph_u64 M8, M9, MA, MB, MC, MD, ME, MF;
+  sph_u64 V0, V1, V2, V3, V4, V5, V6, V7;
+  sph_u64 V8, V9, VA, VB, VC, VD, VE, VF;
+  M0 = hash->h8[0];
+  M1 = hash->h8[1];
+  M2 = hash->h8[2];
+  M3 = hash->h8[3];
+  M4 = hash->h8[4];
+  M5 = hash->h8[5];
+  M6 = hash->h8[6];
+  M7 = hash->h8[7];
+  M8 = 0x8000000000000000;
+  M9 = 0;
+  MA = 0;
+  MB = 0;
+  MC = 0;
+  MD = 1;
+  ME = 0;
+  MF = 0x200;
+
+  COMPRESS64;
+
+  hash->h8[0] = H0;
+  hash->h8[1] = H1;
+  hash->h8[2] = H2;
+  hash->h8[3] = H3;
+  hash->h8[4] = H4;
+  hash->h8[5] = H5;
+  hash->h8[6] = H6;
+  hash->h8[7] = H7;
+}
+
+/* mv holds the byte swapped message words and padding */
+void bmw512(hash_t *hash, sph_u64 *mv)
+{
+  sph_u64 BMW_H[16];
+  for(unsigned u = 0; u < 16; u++)
+    BMW_H[u] = BMW_IV512[u];
+
+  sph_u64 BMW_h1[16], BMW_h2[16];
+
+#define M(x)    (mv[x])
+#define H(x)    (BMW_H[x])
+#define dH(x)   (BMW_h2[x])
+
+  FOLDb;
+
+#undef M
+#undef H
+#undef dH
+
+#define M(x)    (BMW_h2[x])
+#define H(x)    (final_b[x])
+#define dH(x)   (BMW_h1[x])
+
+  FOLDb;
+
+#undef M
+#undef H
+#undef dH
+
+  hash->h8[0] = SWAP8(BMW_h1[8]);
+  hash->h8[1] = SWAP8(BMW_h1[9]);
+  hash->h8[2] = SWAP8(BMW_h1[10]);
+  hash->h8[3] = SWAP8(BMW_h1[11]);
+  hash->h8[4] = SWAP8(BMW_h1[12]);
+  hash->h8[5] = SWAP8(BMW_h1[13]);
+  hash->h8[6] = SWAP8(BMW_h1[14]);
+  hash->h8[7] = SWAP8(BMW_h1[15]);
+}
+
+void bmw512_64(hash_t *hash)
+{
+  sph_u64 mv[16];
+
+  mv[ 0] = SWAP8(hash->h8[0]);
+  mv[ 1] = SWAP8(hash->h8[1]);
+  mv[ 2] = SWAP8(hash->h8[2]);
+  mv[ 3] = SWAP8(hash->h8[3]);
+  mv[ 4] = SWAP8(hash->h8[4]);
+  mv[ 5] = SWAP8(hash->h8[5]);
+  mv[ 6] = SWAP8(hash->h8[6]);
+  mv[ 7] = SWAP8(hash->h8[7]);
+  mv[ 8] = 0x80;
+  mv[ 9] = 0;
+  mv[10] = 0;
+  mv[11] = 0;
+  mv[12] = 0;
+  mv[13] = 0;
+  mv[14] = 0;
+  mv[15] = 0x200;
+
+  bmw512(hash, mv);
+}
+
+void groestl512_64(hash_t *hash)
+{
+  sph_u64 H[16];
+  for (unsigned int u = 0; u < 15; u ++)
+    H[u] = 0;
+#if USE_LE
+  H[15] = ((sph_u64)(512 & 0xFF) << 56) | ((sph_u64)(512 & 0xFF00) << 40);
+#else
+  H[15] = (sph_u64)512;
+#endif
+
+  sph_u64 g[16], m[16];
+  m[0] = DEC64E(hash->h8[0]);
+  m[1] = DEC64E(hash->h8[1]);
+  m[2] = DEC64E(hash->h8[2]);
+  m[3] = DEC64E(hash->h8[3]);
+  m[4] = DEC64E(hash->h8[4]);
+  m[5] = DEC64E(hash->h8[5]);
+  m[6] = DEC64E(hash->h8[6]);
+  m[7] = DEC64E(hash->h8[7]);
+  for (unsigned int u = 0; u < 8; u ++)
+    g[u] = m[u] ^ H[u];
+  m[8] = 0x80; g[8] = m[8] ^ H[8];
+  m[9] = 0; g[9] = m[9] ^ H[9];
+  m[10] = 0; g[10] = m[10] ^ H[10];
+  m[11] = 0; g[11] = m[11] ^ H[11];
+  m[12] = 0; g[12] = m[12] ^ H[12];
+  m[13] = 0; g[13] = m[13] ^ H[13];
+  m[14] = 0; g[14] = m[14] ^ H[14];
+  m[15] = 0x100000000000000; g[15] = m[15] ^ H[15];
+  PERM_BIG_P(g);
+  PERM_BIG_Q(m);
+  for (unsigned int u = 0; u < 16; u ++)
+    H[u] ^= g[u] ^ m[u];
+  sph_u64 xH[16];
+  for (unsigned int u = 0; u < 16; u ++)
+    xH[u] = H[u];
+  PERM_BIG_P(xH);
+  for (unsigned int u = 0; u < 16; u ++)
+    H[u] ^= xH[u];
+  for (unsigned int u = 0; u < 8; u ++)
+    hash->h8[u] = DEC64E(H[u + 8]);
+}
+
+void skein512_64(hash_t *hash)
+{
+  sph_u64 h0 = SPH_C64(0x4903ADFF749C51CE), h1 = SPH_C64(0x0D95DE399746DF03), h2 = SPH_C64(0x8FD1934127C79BCE), h3 = SPH_C64(0x9A255629FF352CB1), h4 = SPH_C64(0x5DB62599DF6CA7B0), h5 = SPH_C64(0xEABE394CA9D5C3F4), h6 = SPH_C64(0x991112C71A75B523), h7 = SPH_C64(0xAE18A40B660FCC33);
+  sph_u64 m0, m1, m2, m3, m4, m5, m6, m7;
+  sph_u64 bcount = 0;
+
+  m0 = SWAP8(hash->h8[0]);
+  m1 = SWAP8(hash->h8[1]);
+  m2 = SWAP8(hash->h8[2]);
+  m3 = SWAP8(hash->h8[3]);
+  m4 = SWAP8(hash->h8[4]);
+  m5 = SWAP8(hash->h8[5]);
+  m6 = SWAP8(hash->h8[6]);
+  m7 = SWAP8(hash->h8[7]);
+  UBI_BIG(480, 64);
+  bcount = 0;
+  m0 = m1 = m2 = m3 = m4 = m5 = m6 = m7 = 0;
+  UBI_BIG(510, 8);
+  hash->h8[0] = SWAP8(h0);
+  hash->h8[1] = SWAP8(h1);
+  hash->h8[2] = SWAP8(h2);
+  hash->h8[3] = SWAP8(h3);
+  hash->h8[4] = SWAP8(h4);
+  hash->h8[5] = SWAP8(h5);
+  hash->h8[6] = SWAP8(h6);
+  hash->h8[7] = SWAP8(h7);
+}
+
+void jh512_64(hash_t *hash)
+{
+  sph_u64 h0h = C64e(0x6fd14b963e00aa17), h0l = C64e(0x636a2e057a15d543), h1h = C64e(0x8a225e8d0c97ef0b), h1l = C64e(0xe9341259f2b3c361), h2h = C64e(0x891da0c1536f801e), h2l = C64e(0x2aa9056bea2b6d80), h3h = C64e(0x588eccdb2075baa6), h3l = C64e(0xa90f3a76baf83bf7);
+  sph_u64 h4h = C64e(0x0169e60541e34a69), h4l = C64e(0x46b58a8e2e6fe65a), h5h = C64e(0x1047a7d0c1843c24), h5l = C64e(0x3b6e71b12d5ac199), h6h = C64e(0xcf57f6ec9db1f856), h6l = C64e(0xa706887c5716b156), h7h = C64e(0xe3c2fcdfe68517fb), h7l = C64e(0x545a4678cc8cdd4b);
+  sph_u64 tmp;
+
+  for(int i = 0; i < 2; i++)
+  {
+    if (i == 0) {
+      h0h ^= DEC64E(hash->h8[0]);
+      h0l ^= DEC64E(hash->h8[1]);
+      h1h ^= DEC64E(hash->h8[2]);
+      h1l ^= DEC64E(hash->h8[3]);
+      h2h ^= DEC64E(hash->h8[4]);
+      h2l ^= DEC64E(hash->h8[5]);
+      h3h ^= DEC64E(hash->h8[6]);
+      h3l ^= DEC64E(hash->h8[7]);
+    } else if(i == 1) {
+      h4h ^= DEC64E(hash->h8[0]);
+      h4l ^= DEC64E(hash->h8[1]);
+      h5h ^= DEC64E(hash->h8[2]);
+      h5l ^= DEC64E(hash->h8[3]);
+      h6h ^= DEC64E(hash->h8[4]);
+      h6l ^= DEC64E(hash->h8[5]);
+      h7h ^= DEC64E(hash->h8[6]);
+      h7l ^= DEC64E(hash->h8[7]);
+
+      h0h ^= 0x80;
+      h3l ^= 0x2000000000000;
+    }
+    E8;
+  }
+  h4h ^= 0x80;
+  h7l ^= 0x2000000000000;
+
+  hash->h8[0] = DEC64E(h4h);
+  hash->h8[1] = DEC64E(h4l);
+  hash->h8[2] = DEC64E(h5h);
+  hash->h8[3] = DEC64E(h5l);
+  hash->h8[4] = DEC64E(h6h);
+  hash->h8[5] = DEC64E(h6l);
+  hash->h8[6] = DEC64E(h7h);
+  hash->h8[7] = DEC64E(h7l);
+}
+
+void keccak512_64(hash_t *hash)
+{
+  sph_u64 a00 = 0, a01 = 0, a02 = 0, a03 = 0, a04 = 0;
+  sph_u64 a10 = 0, a11 = 0, a12 = 0, a13 = 0, a14 = 0;
+  sph_u64 a20 = 0, a21 = 0, a22 = 0, a23 = 0, a24 = 0;
+  sph_u64 a30 = 0, a31 = 0, a32 = 0, a33 = 0, a34 = 0;
+  sph_u64 a40 = 0, a41 = 0, a42 = 0, a43 = 0, a44 = 0;
+
+  a10 = SPH_C64(0xFFFFFFFFFFFFFFFF);
+  a20 = SPH_C64(0xFFFFFFFFFFFFFFFF);
+  a31 = SPH_C64(0xFFFFFFFFFFFFFFFF);
+  a22 = SPH_C64(0xFFFFFFFFFFFFFFFF);
+  a23 = SPH_C64(0xFFFFFFFFFFFFFFFF);
+  a04 = SPH_C64(0xFFFFFFFFFFFFFFFF);
+
+  a00 ^= SWAP8(hash->h8[0]);
+  a10 ^= SWAP8(hash->h8[1]);
+  a20 ^= SWAP8(hash->h8[2]);
+  a30 ^= SWAP8(hash->h8[3]);
+  a40 ^= SWAP8(hash->h8[4]);
+  a01 ^= SWAP8(hash->h8[5]);
+  a11 ^= SWAP8(hash->h8[6]);
+  a21 ^= SWAP8(hash->h8[7]);
+  a31 ^= 0x8000000000000001;
+  KECCAK_F_1600;
+  // Finalize the "lane complement"
+  a10 = ~a10;
+  a20 = ~a20;
+
+  hash->h8[0] = SWAP8(a00);
+  hash->h8[1] = SWAP8(a10);
+  hash->h8[2] = SWAP8(a20);
+  hash->h8[3] = SWAP8(a30);
+  hash->h8[4] = SWAP8(a40);
+  hash->h8[5] = SWAP8(a01);
+  hash->h8[6] = SWAP8(a11);
+  hash->h8[7] = SWAP8(a21);
+}
+
+/* Appends hash index i to the taken or not taken list of pick. Every lane
+ * of the work group must call it. The lanes of a group are first counted
+ * in local memory so only one global atomic per list and group is needed */
+void branch_append(__global uint *branches, __local uint *group, uint pick, uint i, bool taken)
+{
+  uint side = taken ? 0 : 1;
+  uint slot;
+
+  if (get_local_id(0) == 0) {
+    group[0] = 0;
+    group[1] = 0;
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  slot = atomic_inc(&group[side]);
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (get_local_id(0) == 0) {
+    group[2] = atomic_add(&branches[2 * pick], group[0]);
+    group[3] = atomic_add(&branches[2 * pick + 1], group[1]);
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  branches[BRANCH_HEADER + side * get_global_size(0) + group[2 + side] + slot] = i;
+}
+
+/* Hash index the lane works on in a kernel of a pick, or false past the
+ * end of the list */
+bool branch_index(__global uint *branches, uint pick, bool taken, uint *i)
+{
+  uint side = taken ? 0 : 1;
+  uint n = get_global_id(0) - get_global_offset(0);
+
+  if (n >= branches[2 * pick + side])
+    return false;
+  *i = branches[BRANCH_HEADER + side * get_global_size(0) + n];
+  return true;
+}
+
+void check_target(hash_t *hash, uint i, __global uint *output, const ulong target)
+{
+  if (SWAP8(hash->h8[3]) <= target)
+    output[atomic_inc(output+0xFF)] = SWAP4((uint)get_global_offset(0) + i);
+}
+
+#ifndef ANIMECOIN_MOD
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search(__global unsigned char* block, __global hash_t* hashes, __global uint* branches)
+{
+  uint gid = get_global_id(0);
+  uint i = gid - get_global_offset(0);
+  hash_t hash;
+
+  if (i < BRANCH_HEADER)
+    branches[i] = 0;
+
+  // blake
+  sph_u64 H0 = SPH_C64(0x6A09E667F3BCC908), H1 = SPH_C64(0xBB67AE8584CAA73B);
+  sph_u64 H2 = SPH_C64(0x3C6EF372FE94F82B), H3 = SPH_C64(0xA54FF53A5F1D36F1);
+  sph_u64 H4 = SPH_C64(0x510E527FADE682D1), H5 = SPH_C64(0x9B05688C2B3E6C1F);
+  sph_u64 H6 = SPH_C64(0x1F83D9ABFB41BD6B), H7 = SPH_C64(0x5BE0CD19137E2179);
+  sph_u64 S0 = 0, S1 = 0, S2 = 0, S3 = 0;
+  sph_u64 T0 = SPH_C64(0xFFFFFFFFFFFFFC00) + (80 << 3), T1 = 0xFFFFFFFFFFFFFFFF;;
+
+  if ((T0 = SPH_T64(T0 + 1024)) < 1024)
+  {
+    T1 = SPH_T64(T1 + 1);
+  }
+  sph_u64 M0, M1, M2, M3, M4, M5, M6, M7;
+  sph_u64 M8, M9, MA, MB, MC, MD, ME, MF;
+  sph_u64 V0, V1, V2, V3, V4, V5, V6, V7;
+  sph_u64 V8, V9, VA, VB, VC, VD, VE, VF;
+  M0 = DEC64BE(block +   0);
+  M1 = DEC64BE(block +   8);
+  M2 = DEC64BE(block +  16);
+  M3 = DEC64BE(block +  24);
+  M4 = DEC64BE(block +  32);
+  M5 = DEC64BE(block +  40);
+  M6 = DEC64BE(block +  48);
+  M7 = DEC64BE(block +  56);
+  M8 = DEC64BE(block +  64);
+  M9 = DEC64BE(block +  72);
+  M9 &= 0xFFFFFFFF00000000;
+  M9 ^= SWAP4(gid);
+  MA = 0x8000000000000000;
+  MB = 0;
+  MC = 0;
+  MD = 1;
+  ME = 0;
+  MF = 0x280;
+
+  COMPRESS64;
+
+  hash.h8[0] = H0;
+  hash.h8[1] = H1;
+  hash.h8[2] = H2;
+  hash.h8[3] = H3;
+  hash.h8[4] = H4;
+  hash.h8[5] = H5;
+  hash.h8[6] = H6;
+  hash.h8[7] = H7;
+
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search1(__global hash_t* hashes, __global uint* branches)
+{
+  __local uint group[4];
+  uint i = get_global_id(0) - get_global_offset(0);
+  hash_t hash = hashes[i];
+
+  // bmw
+  bmw512_64(&hash);
+  hashes[i] = hash;
+
+  branch_append(branches, group, 0, i, BRANCH_TAKEN(hash));
+}
+
+#else
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search(__global unsigned char* block, __global hash_t* hashes, __global uint* branches)
+{
+  uint gid = get_global_id(0);
+  uint i = gid - get_global_offset(0);
+  hash_t hash;
+  sph_u64 mv[16];
+
+  if (i < BRANCH_HEADER)
+    branches[i] = 0;
+
+  // bmw
+  mv[0] = DEC64LE(block +   0);
+  mv[1] = DEC64LE(block +   8);
+  mv[2] = DEC64LE(block +  16);
+  mv[3] = DEC64LE(block +  24);
+  mv[4] = DEC64LE(block +  32);
+  mv[5] = DEC64LE(block +  40);
+  mv[6] = DEC64LE(block +  48);
+  mv[7] = DEC64LE(block +  56);
+  mv[8] = DEC64LE(block +  64);
+  mv[9] = DEC64LE(block +  72);
+  mv[9] &= 0x00000000FFFFFFFF;
+  mv[9] ^= ((sph_u64) gid) << 32;
+  mv[10] = 0x80;
+  mv[11] = 0;
+  mv[12] = 0;
+  mv[13] = 0;
+  mv[14] = 0;
+  mv[15] = 0x280;
+
+  bmw512(&hash, mv);
+
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search1(__global hash_t* hashes, __global uint* branches)
+{
+  __local uint group[4];
+  uint i = get_global_id(0) - get_global_offset(0);
+  hash_t hash = hashes[i];
+
+  // blake
+  blake512_64(&hash);
+  hashes[i] = hash;
+
+  branch_append(branches, group, 0, i, BRANCH_TAKEN(hash));
+}
+
+#endif // ANIMECOIN_MOD
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search2(__global hash_t* hashes, __global uint* branches)
+{
+  uint i;
+  hash_t hash;
+
+  if (!branch_index(branches, 0, true, &i))
+    return;
+
+  // groestl
+  hash = hashes[i];
+  groestl512_64(&hash);
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search3(__global hash_t* hashes, __global uint* branches)
+{
+  uint i;
+  hash_t hash;
+
+  if (!branch_index(branches, 0, false, &i))
+    return;
+
+  // skein
+  hash = hashes[i];
+  skein512_64(&hash);
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search4(__global hash_t* hashes, __global uint* branches)
+{
+  uint i = get_global_id(0) - get_global_offset(0);
+  hash_t hash = hashes[i];
+
+  // groestl
+  groestl512_64(&hash);
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search5(__global hash_t* hashes, __global uint* branches)
+{
+  __local uint group[4];
+  uint i = get_global_id(0) - get_global_offset(0);
+  hash_t hash = hashes[i];
+
+  // jh
+  jh512_64(&hash);
+  hashes[i] = hash;
+
+  branch_append(branches, group, 1, i, BRANCH_TAKEN(hash));
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search6(__global hash_t* hashes, __global uint* branches)
+{
+  uint i;
+  hash_t hash;
+
+  if (!branch_index(branches, 1, true, &i))
+    return;
+
+  // blake
+  hash = hashes[i];
+  blake512_64(&hash);
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search7(__global hash_t* hashes, __global uint* branches)
+{
+  uint i;
+  hash_t hash;
+
+  if (!branch_index(branches, 1, false, &i))
+    return;
+
+  // bmw
+  hash = hashes[i];
+  bmw512_64(&hash);
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search8(__global hash_t* hashes, __global uint* branches)
+{
+  uint i = get_global_id(0) - get_global_offset(0);
+  hash_t hash = hashes[i];
+
+  // keccak
+  keccak512_64(&hash);
+  hashes[i] = hash;
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search9(__global hash_t* hashes, __global uint* branches)
+{
+  __local uint group[4];
+  uint i = get_global_id(0) - get_global_offset(0);
+  hash_t hash = hashes[i];
+
+  // skein
+  skein512_64(&hash);
+  hashes[i] = hash;
+
+  branch_append(branches, group, 2, i, BRANCH_TAKEN(hash));
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search10(__global hash_t* hashes, __global uint* branches, __global uint* output, const ulong target)
+{
+  uint i;
+  hash_t hash;
+
+  if (!branch_index(branches, 2, true, &i))
+    return;
+
+  // keccak
+  hash = hashes[i];
+  keccak512_64(&hash);
+
+  check_target(&hash, i, output, target);
+}
+
+__attribute__((reqd_work_group_size(WORKSIZE, 1, 1)))
+__kernel void search11(__global hash_t* hashes, __global uint* branches, __global uint* output, const ulong target)
+{
+  uint i;
+  hash_t hash;
+
+  if (!branch_index(branches, 2, false, &i))
+    return;
+
+  // jh
+  hash = hashes[i];
+  jh512_64(&hash);
+
+  check_target(&hash, i, output, target);
+}
+
+#endif // QUARKCOIN_MOD_CL
@@ -35,6 +35,7 @@ typedef long sph_s64;
 #include "shavite.cl"
 #include "hamsi.cl"
 #include "panama.cl"
+#include "multi_header.cl"
 
 #define SWAP4(x) as_uint(as_uchar4(x).wzyx)
 #define SWAP8(x) as_ulong(as_uchar8(x).s76543210)
@@ -139,6 +140,7 @@ __kernel void search(__global unsigned char* block, volatile __global uint* outp
     hash[j] = 0;
 
   sph_u32 gid = get_global_id(0);
+  block = SELECT_HEADER(block);
 
   // fugue
   {
@@ -423,6 +425,6 @@ __kernel void search(__global unsigned char* block, volatile __global uint* outp
 
     bool result = ((((sph_u64) state[16] << 32) | state[15]) <= target);
     if (result)
-      output[output[0xFF]++] = SWAP4(gid);
+      SETFOUND_HEADER(0xFF, SWAP4(gid));
   }
 }
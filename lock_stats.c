@@ -0,0 +1,444 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "miner.h"
+#include "lock_stats.h"
+#include "util.h"
+
+/*
+ * Everything here is called from inside mutex_lock and friends, so it only
+ * ever uses the raw pthread calls. Going through the wrappers would recurse.
+ */
+
+/* Record lock contention per call site, see lock_stats_lock */
+bool opt_lock_stats;
+
+/* Call sites tracked, a few hundred exist */
+#define LOCK_STATS_SITES 1024
+/* Locks one thread can hold at once and still have their hold timed */
+#define LOCK_STATS_HELD 32
+
+struct lock_site {
+  pthread_mutex_t lock;
+  struct lock_site_stats stats;
+};
+
+struct lock_held {
+  void *lock;
+  struct lock_site *site;
+  struct timeval tv_got;
+};
+
+/* Locks the calling thread took while recording */
+struct lock_thread {
+  unsigned int generation;
+  int n_held;
+  struct lock_held held[LOCK_STATS_HELD];
+};
+
+static pthread_mutex_t sites_lock = PTHREAD_MUTEX_INITIALIZER;
+/* Open addressed on line and kind. Slots are only ever filled, under
+ * sites_lock, and a filled slot never changes */
+static struct lock_site * volatile sites[LOCK_STATS_SITES];
+static int n_sites;
+
+/* Bumped each time recording is turned on, so threads drop locks they
+ * were holding from before */
+static volatile unsigned int lock_generation;
+
+static pthread_once_t lock_once = PTHREAD_ONCE_INIT;
+static pthread_key_t lock_key;
+
+static const char *lock_kind_names[] = {
+  "Mutex",
+  "Read",
+  "Write",
+};
+
+static void lock_thread_free(void *arg)
+{
+  free(arg);
+}
+
+static void lock_key_create(void)
+{
+  if (unlikely(pthread_key_create(&lock_key, lock_thread_free)))
+    opt_lock_stats = false;
+}
+
+static struct lock_thread *lock_thread(void)
+{
+  struct lock_thread *thread;
+
+  pthread_once(&lock_once, lock_key_create);
+  thread = (struct lock_thread *)pthread_getspecific(lock_key);
+  if (unlikely(!thread)) {
+    thread = (struct lock_thread *)calloc(1, sizeof(struct lock_thread));
+    if (unlikely(!thread))
+      return NULL;
+    thread->generation = lock_generation;
+    pthread_setspecific(lock_key, thread);
+  }
+  if (unlikely(thread->generation != lock_generation)) {
+    thread->generation = lock_generation;
+    thread->n_held = 0;
+  }
+
+  return thread;
+}
+
+static bool site_matches(struct lock_site *site, enum lock_kind kind, const char *name, const char *file, const int line)
+{
+  /* The same literal can have several copies, compare contents too */
+  return site->stats.line == line && site->stats.kind == kind &&
+         (site->stats.file == file || !strcmp(site->stats.file, file)) &&
+         (site->stats.name == name || !strcmp(site->stats.name, name));
+}
+
+static struct lock_site *find_site(enum lock_kind kind, const char *name, const char *file, const char *func, const int line)
+{
+  unsigned int slot = ((unsigned int)line * 3 + kind) % LOCK_STATS_SITES;
+  struct lock_site *site;
+  int probes;
+
+  for (probes = 0; probes < LOCK_STATS_SITES; probes++) {
+    site = sites[slot];
+    if (!site)
+      break;
+    if (site_matches(site, kind, name, file, line))
+      return site;
+    slot = (slot + 1) % LOCK_STATS_SITES;
+  }
+
+  /* First time at this site, add it unless another thread just did */
+  pthread_mutex_lock(&sites_lock);
+  for (; probes < LOCK_STATS_SITES; probes++) {
+    site = sites[slot];
+    if (!site)
+      break;
+    if (site_matches(site, kind, name, file, line)) {
+      pthread_mutex_unlock(&sites_lock);
+      return site;
+    }
+    slot = (slot + 1) % LOCK_STATS_SITES;
+  }
+  site = NULL;
+  if (probes < LOCK_STATS_SITES)
+    site = (struct lock_site *)calloc(1, sizeof(struct lock_site));
+  if (site) {
+    pthread_mutex_init(&site->lock, NULL);
+    site->stats.name = name;
+    site->stats.file = file;
+    site->stats.func = func;
+    site->stats.line = line;
+    site->stats.kind = kind;
+    sites[slot] = site;
+    n_sites++;
+  }
+  pthread_mutex_unlock(&sites_lock);
+
+  return site;
+}
+
+static int bucket_of(uint64_t us)
+{
+  int b = 0;
+
+  while (us && b < LOCK_STATS_BUCKETS - 1) {
+    us >>= 1;
+    b++;
+  }
+  return b;
+}
+
+static void lock_got(void *lock, struct lock_site *site, bool contended, struct timeval *tv_start)
+{
+  struct lock_thread *thread = lock_thread();
+  struct lock_held *held;
+  struct timeval now;
+  uint64_t wait_us = 0;
+
+  cgtime(&now);
+  if (contended)
+    wait_us = (uint64_t)us_tdiff(&now, tv_start);
+
+  pthread_mutex_lock(&site->lock);
+  site->stats.acquisitions++;
+  if (contended) {
+    site->stats.contended++;
+    site->stats.wait_us += wait_us;
+    if (wait_us > site->stats.wait_max_us)
+      site->stats.wait_max_us = wait_us;
+    site->stats.wait_buckets[bucket_of(wait_us)]++;
+  }
+  pthread_mutex_unlock(&site->lock);
+
+  if (unlikely(!thread || thread->n_held >= LOCK_STATS_HELD))
+    return;
+  held = &thread->held[thread->n_held++];
+  held->lock = lock;
+  held->site = site;
+  held->tv_got = now;
+}
+
+/* Takes the lock, trying first so an uncontended acquisition costs no
+ * clock read beyond the one that starts its hold time */
+void lock_stats_lock(void *lock, enum lock_kind kind, const char *name, const char *file, const char *func, const int line)
+{
+  struct lock_site *site = find_site(kind, name, file, func, line);
+  struct timeval tv_start;
+  bool contended = false;
+  int ret;
+
+  switch (kind) {
+    case LOCK_KIND_READ:
+      ret = pthread_rwlock_tryrdlock((pthread_rwlock_t *)lock);
+      if (ret) {
+        contended = true;
+        cgtime(&tv_start);
+        ret = pthread_rwlock_rdlock((pthread_rwlock_t *)lock);
+      }
+      break;
+    case LOCK_KIND_WRITE:
+      ret = pthread_rwlock_trywrlock((pthread_rwlock_t *)lock);
+      if (ret) {
+        contended = true;
+        cgtime(&tv_start);
+        ret = pthread_rwlock_wrlock((pthread_rwlock_t *)lock);
+      }
+      break;
+    case LOCK_KIND_MUTEX:
+    default:
+      ret = pthread_mutex_trylock((pthread_mutex_t *)lock);
+      if (ret) {
+        contended = true;
+        cgtime(&tv_start);
+        ret = pthread_mutex_lock((pthread_mutex_t *)lock);
+      }
+      break;
+  }
+  if (unlikely(ret))
+    quitfrom(1, file, func, line, "WTF %s ERROR ON LOCK! errno=%d",
+             kind == LOCK_KIND_MUTEX ? "MUTEX" : kind == LOCK_KIND_READ ? "RDLOCK" : "WRLOCK", ret);
+
+  if (likely(site))
+    lock_got(lock, site, contended, &tv_start);
+}
+
+void lock_stats_trylock(int ret, void *lock, enum lock_kind kind, const char *name, const char *file, const char *func, const int line)
+{
+  struct lock_site *site = find_site(kind, name, file, func, line);
+
+  if (unlikely(!site))
+    return;
+
+  if (!ret)
+    lock_got(lock, site, false, NULL);
+  else {
+    pthread_mutex_lock(&site->lock);
+    site->stats.try_failed++;
+    pthread_mutex_unlock(&site->lock);
+  }
+}
+
+/* Ends the hold of lock and adds it to the site that took it, returns
+ * that site */
+static struct lock_site *end_hold(void *lock)
+{
+  struct lock_thread *thread = lock_thread();
+  struct lock_site *site;
+  struct timeval now;
+  uint64_t hold_us;
+  int i;
+
+  if (unlikely(!thread))
+    return NULL;
+
+  for (i = thread->n_held - 1; i >= 0; i--) {
+    if (thread->held[i].lock == lock)
+      break;
+  }
+  /* Taken before recording was turned on, or too deeply nested */
+  if (i < 0)
+    return NULL;
+
+  cgtime(&now);
+  site = thread->held[i].site;
+  hold_us = (uint64_t)us_tdiff(&now, &thread->held[i].tv_got);
+  memmove(&thread->held[i], &thread->held[i + 1], (thread->n_held - i - 1) * sizeof(struct lock_held));
+  thread->n_held--;
+
+  pthread_mutex_lock(&site->lock);
+  site->stats.hold_us += hold_us;
+  if (hold_us > site->stats.hold_max_us)
+    site->stats.hold_max_us = hold_us;
+  site->stats.hold_buckets[bucket_of(hold_us)]++;
+  pthread_mutex_unlock(&site->lock);
+
+  return site;
+}
+
+/* Called just before the lock is released */
+void lock_stats_unlock(void *lock)
+{
+  end_hold(lock);
+}
+
+/* A condition wait releases the mutex while asleep, so the hold ends
+ * before it and a new one of the same site starts once it returns. The
+ * wait counts as neither hold nor acquisition */
+void *lock_stats_cond_release(void *lock)
+{
+  return end_hold(lock);
+}
+
+void lock_stats_cond_reacquire(void *lock, void *site)
+{
+  struct lock_thread *thread = lock_thread();
+  struct lock_held *held;
+
+  if (unlikely(!thread || thread->n_held >= LOCK_STATS_HELD))
+    return;
+  held = &thread->held[thread->n_held++];
+  held->lock = lock;
+  held->site = (struct lock_site *)site;
+  cgtime(&held->tv_got);
+}
+
+void lock_stats_enable(bool enable)
+{
+  if (enable && !opt_lock_stats)
+    lock_generation++;
+  opt_lock_stats = enable;
+}
+
+void lock_stats_reset(void)
+{
+  int i;
+
+  for (i = 0; i < LOCK_STATS_SITES; i++) {
+    struct lock_site *site = sites[i];
+    struct lock_site_stats *stats;
+
+    if (!site)
+      continue;
+    stats = &site->stats;
+    pthread_mutex_lock(&site->lock);
+    stats->acquisitions = stats->contended = stats->try_failed = 0;
+    stats->wait_us = stats->wait_max_us = 0;
+    stats->hold_us = stats->hold_max_us = 0;
+    memset(stats->wait_buckets, 0, sizeof(stats->wait_buckets));
+    memset(stats->hold_buckets, 0, sizeof(stats->hold_buckets));
+    pthread_mutex_unlock(&site->lock);
+  }
+}
+
+static int site_wait_cmp(const void *a, const void *b)
+{
+  const struct lock_site_stats *sa = (const struct lock_site_stats *)a;
+  const struct lock_site_stats *sb = (const struct lock_site_stats *)b;
+
+  if (sa->wait_us != sb->wait_us)
+    return sa->wait_us > sb->wait_us ? -1 : 1;
+  if (sa->acquisitions != sb->acquisitions)
+    return sa->acquisitions > sb->acquisitions ? -1 : 1;
+  return 0;
+}
+
+struct lock_site_stats *lock_stats_snapshot(int *count)
+{
+  struct lock_site_stats *snapshot;
+  int i, n = 0, size;
+
+  pthread_mutex_lock(&sites_lock);
+  size = n_sites;
+  pthread_mutex_unlock(&sites_lock);
+
+  snapshot = (struct lock_site_stats *)calloc(size ? size : 1, sizeof(struct lock_site_stats));
+  if (unlikely(!snapshot)) {
+    *count = 0;
+    return NULL;
+  }
+
+  /* Sites added since n_sites was read are left for the next snapshot */
+  for (i = 0; i < LOCK_STATS_SITES && n < size; i++) {
+    struct lock_site *site = sites[i];
+
+    if (!site)
+      continue;
+    pthread_mutex_lock(&site->lock);
+    memcpy(&snapshot[n++], &site->stats, sizeof(struct lock_site_stats));
+    pthread_mutex_unlock(&site->lock);
+  }
+  qsort(snapshot, n, sizeof(struct lock_site_stats), site_wait_cmp);
+
+  *count = n;
+  return snapshot;
+}
+
+/* Non-empty buckets as "<upper bound in us>:<count>" */
+static void format_buckets(char *buf, size_t siz, uint64_t *buckets)
+{
+  size_t used = 0;
+  int b;
+
+  buf[0] = '\0';
+  for (b = 0; b < LOCK_STATS_BUCKETS && used < siz; b++) {
+    if (!buckets[b])
+      continue;
+    used += snprintf(buf + used, siz - used, "%s%llu:%"PRIu64,
+                     used ? "," : "", 1ULL << b, buckets[b]);
+  }
+}
+
+struct api_data *lock_stats_api_site(struct lock_site_stats *stats, struct api_data *root)
+{
+  char wait_hist[LOCK_STATS_BUCKETS * 24], hold_hist[LOCK_STATS_BUCKETS * 24];
+  double contended, wait_ms, hold_ms, avg_wait_us, avg_hold_us;
+  uint64_t holds = 0;
+  int b;
+
+  for (b = 0; b < LOCK_STATS_BUCKETS; b++)
+    holds += stats->hold_buckets[b];
+
+  contended = stats->acquisitions ? (double)stats->contended * 100.0 / stats->acquisitions : 0.0;
+  wait_ms = (double)stats->wait_us / 1000.0;
+  hold_ms = (double)stats->hold_us / 1000.0;
+  avg_wait_us = stats->contended ? (double)stats->wait_us / stats->contended : 0.0;
+  avg_hold_us = holds ? (double)stats->hold_us / holds : 0.0;
+  format_buckets(wait_hist, sizeof(wait_hist), stats->wait_buckets);
+  format_buckets(hold_hist, sizeof(hold_hist), stats->hold_buckets);
+
+  root = api_add_const(root, "Lock", stats->name, false);
+  root = api_add_const(root, "Type", lock_kind_names[stats->kind], false);
+  root = api_add_const(root, "File", stats->file, false);
+  root = api_add_const(root, "Function", stats->func, false);
+  root = api_add_int(root, "Line", &stats->line, true);
+  root = api_add_uint64(root, "Acquisitions", &stats->acquisitions, true);
+  root = api_add_uint64(root, "Contended", &stats->contended, true);
+  root = api_add_percent(root, "Contended %", &contended, true);
+  root = api_add_uint64(root, "Try Failed", &stats->try_failed, true);
+  root = api_add_double(root, "Wait Total ms", &wait_ms, true);
+  root = api_add_double(root, "Wait Avg us", &avg_wait_us, true);
+  root = api_add_uint64(root, "Wait Max us", &stats->wait_max_us, true);
+  root = api_add_string(root, "Wait Histogram", wait_hist, true);
+  root = api_add_double(root, "Hold Total ms", &hold_ms, true);
+  root = api_add_double(root, "Hold Avg us", &avg_hold_us, true);
+  root = api_add_uint64(root, "Hold Max us", &stats->hold_max_us, true);
+  root = api_add_string(root, "Hold Histogram", hold_hist, true);
+
+  return root;
+}
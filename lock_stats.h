@@ -0,0 +1,43 @@
+#ifndef LOCK_STATS_H
+#define LOCK_STATS_H
+
+#include "miner.h"
+
+/* Histogram buckets, bucket b counts waits or holds shorter than 2^b
+ * microseconds */
+#define LOCK_STATS_BUCKETS 24
+
+/* Figures of one lock call site, e.g. a single cg_wlock(&pool->data_lock) */
+struct lock_site_stats {
+  const char *name;
+  const char *file;
+  const char *func;
+  int line;
+  enum lock_kind kind;
+
+  uint64_t acquisitions;
+  uint64_t contended;   /* Acquisitions that had to wait */
+  uint64_t try_failed;  /* Trylocks that found the lock held */
+  uint64_t wait_us;
+  uint64_t wait_max_us;
+  uint64_t hold_us;
+  uint64_t hold_max_us;
+  uint64_t wait_buckets[LOCK_STATS_BUCKETS]; /* Contended acquisitions only */
+  uint64_t hold_buckets[LOCK_STATS_BUCKETS];
+};
+
+/* Turns recording on or off at runtime. Locks taken before it was turned
+ * on are not timed when they are released */
+extern void lock_stats_enable(bool enable);
+
+/* Clears the figures of every call site */
+extern void lock_stats_reset(void);
+
+/* Copies the figures of every call site seen, most total wait first. The
+ * caller frees the array */
+extern struct lock_site_stats *lock_stats_snapshot(int *count);
+
+/* Adds the figures of one call site to root */
+extern struct api_data *lock_stats_api_site(struct lock_site_stats *stats, struct api_data *root);
+
+#endif /* LOCK_STATS_H */
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+#include "miner.h"
+#include "findnonce.h"
+#include "lowmem.h"
+
+/* Bound memory use with preallocated pools, and cache fewer shares */
+bool opt_lowmem;
+
+/* Result sets of one thread that may wait for postcalc at once */
+#define LOWMEM_POSTCALC_PER_THREAD 4
+/* Shares of one pool that may wait to be submitted at once */
+#define LOWMEM_SUBMITS_PER_POOL 32
+
+/* Free objects are chained through their first word */
+struct lowmem_objpool {
+  pthread_mutex_t lock;
+  char *block;
+  char *end;
+  void *free_list;
+  struct lowmem_stats stats;
+};
+
+static struct lowmem_objpool objpools[LOWMEM_POOLS] = {
+  [LOWMEM_WORK] =    { .stats = { "Work", sizeof(struct work) } },
+  [LOWMEM_TQ_ENT] =  { .stats = { "Queue Entry", sizeof(struct tq_ent) } },
+  [LOWMEM_PC_DATA] = { .stats = { "Postcalc", sizeof(struct pc_data) } },
+};
+
+static void objpool_init(struct lowmem_objpool *pool, int capacity)
+{
+  size_t size = pool->stats.size;
+  int i;
+
+  /* Room for the free list link and aligned for any member */
+  size = (MAX(size, sizeof(void *)) + 15) & ~(size_t)15;
+  pool->block = (char *)calloc(capacity, size);
+  if (unlikely(!pool->block))
+    quit(1, "Failed to calloc %s pool in lowmem_init", pool->stats.name);
+  pool->end = pool->block + (size_t)capacity * size;
+
+  for (i = capacity - 1; i >= 0; i--) {
+    void *obj = pool->block + (size_t)i * size;
+
+    *(void **)obj = pool->free_list;
+    pool->free_list = obj;
+  }
+
+  mutex_init(&pool->lock);
+  pool->stats.capacity = capacity;
+}
+
+void lowmem_init(int mining_threads, int queue, int pools)
+{
+  int capacity[LOWMEM_POOLS];
+  int i;
+
+  if (!opt_lowmem)
+    return;
+
+  /* Staged work and the copies taken from it, plus what each thread holds,
+   * the copies it hands to postcalc and the shares waiting to be sent */
+  capacity[LOWMEM_WORK] = 2 * (queue + mining_threads) +
+                          mining_threads * (2 + LOWMEM_POSTCALC_PER_THREAD) +
+                          pools * LOWMEM_SUBMITS_PER_POOL;
+  /* Shares queued to stratum threads and GPU restart requests */
+  capacity[LOWMEM_TQ_ENT] = pools * LOWMEM_SUBMITS_PER_POOL + mining_threads;
+  capacity[LOWMEM_PC_DATA] = mining_threads * LOWMEM_POSTCALC_PER_THREAD;
+
+  for (i = 0; i < LOWMEM_POOLS; i++) {
+    objpool_init(&objpools[i], capacity[i]);
+    applog(LOG_INFO, "Preallocated %d %s objects of %d bytes", capacity[i],
+           objpools[i].stats.name, (int)objpools[i].stats.size);
+  }
+}
+
+void *lowmem_alloc(enum lowmem_pool id)
+{
+  struct lowmem_objpool *pool = &objpools[id];
+  uint64_t exhausted = 0;
+  void *obj = NULL;
+
+  if (!pool->block)
+    return calloc(1, pool->stats.size);
+
+  mutex_lock(&pool->lock);
+  pool->stats.allocs++;
+  if (pool->free_list) {
+    obj = pool->free_list;
+    pool->free_list = *(void **)obj;
+    if (++pool->stats.in_use > pool->stats.high_water)
+      pool->stats.high_water = pool->stats.in_use;
+  } else
+    exhausted = ++pool->stats.exhausted;
+  mutex_unlock(&pool->lock);
+
+  if (obj) {
+    memset(obj, 0, pool->stats.size);
+    return obj;
+  }
+
+  if (exhausted == 1)
+    applog(LOG_WARNING, "%s pool exhausted at %d objects, using the heap", pool->stats.name,
+           pool->stats.capacity);
+  return calloc(1, pool->stats.size);
+}
+
+void lowmem_free(enum lowmem_pool id, void *obj)
+{
+  struct lowmem_objpool *pool = &objpools[id];
+
+  if (!obj)
+    return;
+
+  /* Objects from before lowmem_init or from the heap once exhausted */
+  if ((char *)obj < pool->block || (char *)obj >= pool->end) {
+    free(obj);
+    return;
+  }
+
+  mutex_lock(&pool->lock);
+  *(void **)obj = pool->free_list;
+  pool->free_list = obj;
+  pool->stats.in_use--;
+  mutex_unlock(&pool->lock);
+}
+
+void lowmem_get_stats(enum lowmem_pool id, struct lowmem_stats *stats)
+{
+  struct lowmem_objpool *pool = &objpools[id];
+
+  if (!pool->block) {
+    memcpy(stats, &pool->stats, sizeof(struct lowmem_stats));
+    return;
+  }
+
+  mutex_lock(&pool->lock);
+  memcpy(stats, &pool->stats, sizeof(struct lowmem_stats));
+  mutex_unlock(&pool->lock);
+}
+
+long lowmem_peak_rss(void)
+{
+#ifndef WIN32
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage))
+    return 0;
+#ifdef __APPLE__
+  /* Bytes rather than KiB */
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#else
+  return 0;
+#endif
+}
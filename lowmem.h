@@ -0,0 +1,48 @@
+#ifndef LOWMEM_H
+#define LOWMEM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Hot path objects that --lowmem serves from fixed capacity pools,
+ * preallocated once the devices and pools are known. All of them may carry
+ * found shares, so an exhausted pool is counted and served from the heap
+ * rather than dropping anything */
+enum lowmem_pool {
+  LOWMEM_WORK,    /* struct work */
+  LOWMEM_TQ_ENT,  /* Thread queue entries: shares to submit, GPU restarts */
+  LOWMEM_PC_DATA, /* Result sets waiting for postcalc */
+  LOWMEM_POOLS
+};
+
+/* Stratum lines longer than this are dropped with --lowmem, which bounds
+ * the socket buffer, the line copies and the JSON parsed from them */
+#define LOWMEM_LINE_MAX (256 * 1024)
+
+struct lowmem_stats {
+  const char *name;
+  size_t size;
+  int capacity;         /* 0 unless --lowmem */
+  int in_use;
+  int high_water;
+  uint64_t allocs;
+  uint64_t exhausted;   /* Allocations served from the heap */
+};
+
+extern bool opt_lowmem;
+
+/* Preallocates the pools for mining_threads threads, a staged queue of
+ * queue work items and pools mining pools. Does nothing without --lowmem */
+extern void lowmem_init(int mining_threads, int queue, int pools);
+
+/* A zeroed object, NULL only when the heap is out of memory too */
+extern void *lowmem_alloc(enum lowmem_pool id);
+extern void lowmem_free(enum lowmem_pool id, void *obj);
+
+extern void lowmem_get_stats(enum lowmem_pool id, struct lowmem_stats *stats);
+
+/* Peak resident set size of the process in KiB, 0 where unknown */
+extern long lowmem_peak_rss(void);
+
+#endif /* LOWMEM_H */
@@ -229,7 +229,8 @@ static inline int fsync (int fd)
  * the *_PARSE_COMMANDS macros for each listed driver.
  */
 #define DRIVER_PARSE_COMMANDS(DRIVER_ADD_COMMAND) \
-  DRIVER_ADD_COMMAND(opencl)
+  DRIVER_ADD_COMMAND(opencl) \
+  DRIVER_ADD_COMMAND(cpu)
 
 #define DRIVER_ENUM(X) DRIVER_##X,
 #define DRIVER_PROTOTYPE(X) struct device_drv X##_drv;
@@ -301,6 +302,7 @@ struct gpu_adl {
   bool managed; /* Were the values ever changed on this card */
 
   int lastengine;
+  struct timeval tv_lastengine; /* When lastengine was set */
   int lasttemp;
   int targetfan;
   int targettemp;
@@ -488,6 +490,27 @@ struct sgminer_pool_stats {
   uint64_t times_received;
   uint64_t bytes_received;
   uint64_t net_bytes_received;
+  uint64_t lines_dropped;
+};
+
+/* Build time implementation choices of the X-family kernels, passed to the
+ * compiler as defines by ocl/kernel_variant.c */
+enum kernel_variant_param {
+  KERNEL_VARIANT_GROESTL_SMALL,   /* SPH_SMALL_FOOTPRINT_GROESTL */
+  KERNEL_VARIANT_GROESTL_LOCAL,   /* GROESTL_LOCAL_TABLES, T0..T7 in __local */
+  KERNEL_VARIANT_ECHO_LOCAL,      /* ECHO_LOCAL_TABLES, AES0..AES3 in __local */
+  KERNEL_VARIANT_CUBEHASH_UNROLL, /* SPH_CUBEHASH_UNROLL */
+  KERNEL_VARIANT_KECCAK_UNROLL,   /* SPH_KECCAK_UNROLL */
+  KERNEL_VARIANT_LUFFA_PARALLEL,  /* SPH_LUFFA_PARALLEL */
+  KERNEL_VARIANT_HAMSI_EXPAND,    /* SPH_HAMSI_EXPAND_BIG, over --hamsi-expand-big */
+  KERNEL_VARIANT_HAMSI_COMPACT,   /* SPH_HAMSI_COMPACT, rolled big expansion */
+  KERNEL_VARIANT_PARAMS
+};
+
+struct kernel_variant {
+  uint32_t set; /* Bit per parameter given a value, others use the kernel's default */
+  int8_t value[KERNEL_VARIANT_PARAMS];
+  bool autoselect; /* Benchmark the values not set before the first build */
 };
 
 struct cgpu_info {
@@ -496,6 +519,7 @@ struct cgpu_info {
   int device_id;
   char *name;  /* GPU family codename. */
   char *device_path;
+  char pci_slot[16]; /* PCIe bus:device.function, empty if unknown */
   void *device_data;
 
   enum dev_enable deven;
@@ -531,6 +555,10 @@ struct cgpu_info {
   int opt_lg, lookup_gap;
   size_t opt_tc, thread_concurrency;
   size_t shaders;
+  /* Bumped by reconfigure_devices() when the settings above change, the
+   * threads of the device catch up with them between two rounds */
+  unsigned int reconfig_gen;
+  struct kernel_variant kernel_variant;
   struct timeval tv_gpustart;
   int intervals;
 
@@ -583,6 +611,11 @@ struct cgpu_info {
 
 extern bool add_cgpu(struct cgpu_info*);
 
+struct tq_ent {
+  void      *data;
+  struct list_head  q_node;
+};
+
 struct thread_q {
   struct list_head  q;
 
@@ -763,111 +796,144 @@ extern void api_initlock(void *lock, enum cglock_typ typ, const char *file, cons
 #define INITLOCK(_typ, _lock, _file, _func, _line)
 #endif
 
-#define mutex_lock(_lock) _mutex_lock(_lock, __FILE__, __func__, __LINE__)
-#define mutex_unlock_noyield(_lock) _mutex_unlock_noyield(_lock, __FILE__, __func__, __LINE__)
-#define mutex_unlock(_lock) _mutex_unlock(_lock, __FILE__, __func__, __LINE__)
-#define mutex_trylock(_lock) _mutex_trylock(_lock, __FILE__, __func__, __LINE__)
-#define wr_lock(_lock) _wr_lock(_lock, __FILE__, __func__, __LINE__)
-#define wr_trylock(_lock) _wr_trylock(_lock, __FILE__, __func__, __LINE__)
-#define rd_lock(_lock) _rd_lock(_lock, __FILE__, __func__, __LINE__)
-#define rw_unlock(_lock) _rw_unlock(_lock, __FILE__, __func__, __LINE__)
-#define rd_unlock_noyield(_lock) _rd_unlock_noyield(_lock, __FILE__, __func__, __LINE__)
-#define wr_unlock_noyield(_lock) _wr_unlock_noyield(_lock, __FILE__, __func__, __LINE__)
-#define rd_unlock(_lock) _rd_unlock(_lock, __FILE__, __func__, __LINE__)
-#define wr_unlock(_lock) _wr_unlock(_lock, __FILE__, __func__, __LINE__)
+/*
+ * Runtime lock contention stats per lock call site, see lock_stats.c
+ * Always compiled in and off by default, enabled with --lock-stats or
+ * the lockstats API command. While off each lock only tests opt_lock_stats
+ */
+enum lock_kind {
+  LOCK_KIND_MUTEX,
+  LOCK_KIND_READ,
+  LOCK_KIND_WRITE
+};
+
+extern bool opt_lock_stats;
+
+extern void lock_stats_lock(void *lock, enum lock_kind kind, const char *name, const char *file, const char *func, const int line);
+extern void lock_stats_trylock(int ret, void *lock, enum lock_kind kind, const char *name, const char *file, const char *func, const int line);
+extern void lock_stats_unlock(void *lock);
+extern void *lock_stats_cond_release(void *lock);
+extern void lock_stats_cond_reacquire(void *lock, void *site);
+
+#define mutex_lock(_lock) _mutex_lock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define mutex_unlock_noyield(_lock) _mutex_unlock_noyield(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define mutex_unlock(_lock) _mutex_unlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define mutex_trylock(_lock) _mutex_trylock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define wr_lock(_lock) _wr_lock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define wr_trylock(_lock) _wr_trylock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define rd_lock(_lock) _rd_lock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define rw_unlock(_lock) _rw_unlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define rd_unlock_noyield(_lock) _rd_unlock_noyield(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define wr_unlock_noyield(_lock) _wr_unlock_noyield(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define rd_unlock(_lock) _rd_unlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define wr_unlock(_lock) _wr_unlock(_lock, #_lock, __FILE__, __func__, __LINE__)
 #define mutex_init(_lock) _mutex_init(_lock, __FILE__, __func__, __LINE__)
 #define rwlock_init(_lock) _rwlock_init(_lock, __FILE__, __func__, __LINE__)
 #define cglock_init(_lock) _cglock_init(_lock, __FILE__, __func__, __LINE__)
-#define cg_rlock(_lock) _cg_rlock(_lock, __FILE__, __func__, __LINE__)
-#define cg_ilock(_lock) _cg_ilock(_lock, __FILE__, __func__, __LINE__)
-#define cg_ulock(_lock) _cg_ulock(_lock, __FILE__, __func__, __LINE__)
-#define cg_wlock(_lock) _cg_wlock(_lock, __FILE__, __func__, __LINE__)
-#define cg_dwlock(_lock) _cg_dwlock(_lock, __FILE__, __func__, __LINE__)
-#define cg_dwilock(_lock) _cg_dwilock(_lock, __FILE__, __func__, __LINE__)
-#define cg_dlock(_lock) _cg_dlock(_lock, __FILE__, __func__, __LINE__)
-#define cg_runlock(_lock) _cg_runlock(_lock, __FILE__, __func__, __LINE__)
-#define cg_ruwlock(_lock) _cg_ruwlock(_lock, __FILE__, __func__, __LINE__)
-#define cg_wunlock(_lock) _cg_wunlock(_lock, __FILE__, __func__, __LINE__)
-
-static inline void _mutex_lock(pthread_mutex_t *lock, const char *file, const char *func, const int line)
+#define cg_rlock(_lock) _cg_rlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_ilock(_lock) _cg_ilock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_ulock(_lock) _cg_ulock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_wlock(_lock) _cg_wlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_dwlock(_lock) _cg_dwlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_dwilock(_lock) _cg_dwilock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_dlock(_lock) _cg_dlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_runlock(_lock) _cg_runlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_ruwlock(_lock) _cg_ruwlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+#define cg_wunlock(_lock) _cg_wunlock(_lock, #_lock, __FILE__, __func__, __LINE__)
+
+static inline void _mutex_lock(pthread_mutex_t *lock, const char *name, const char *file, const char *func, const int line)
 {
   GETLOCK(lock, file, func, line);
-  if (unlikely(pthread_mutex_lock(lock)))
+  if (unlikely(opt_lock_stats))
+    lock_stats_lock((void *)lock, LOCK_KIND_MUTEX, name, file, func, line);
+  else if (unlikely(pthread_mutex_lock(lock)))
     quitfrom(1, file, func, line, "WTF MUTEX ERROR ON LOCK! errno=%d", errno);
   GOTLOCK(lock, file, func, line);
 }
 
-static inline void _mutex_unlock_noyield(pthread_mutex_t *lock, const char *file, const char *func, const int line)
+static inline void _mutex_unlock_noyield(pthread_mutex_t *lock, const char *name, const char *file, const char *func, const int line)
 {
+  if (unlikely(opt_lock_stats))
+    lock_stats_unlock((void *)lock);
   if (unlikely(pthread_mutex_unlock(lock)))
     quitfrom(1, file, func, line, "WTF MUTEX ERROR ON UNLOCK! errno=%d", errno);
   GUNLOCK(lock, file, func, line);
 }
 
-static inline void _mutex_unlock(pthread_mutex_t *lock, const char *file, const char *func, const int line)
+static inline void _mutex_unlock(pthread_mutex_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _mutex_unlock_noyield(lock, file, func, line);
+  _mutex_unlock_noyield(lock, name, file, func, line);
   sched_yield();
 }
 
-static inline int _mutex_trylock(pthread_mutex_t *lock, __maybe_unused const char *file, __maybe_unused const char *func, __maybe_unused const int line)
+static inline int _mutex_trylock(pthread_mutex_t *lock, const char *name, __maybe_unused const char *file, __maybe_unused const char *func, __maybe_unused const int line)
 {
   TRYLOCK(lock, file, func, line);
   int ret = pthread_mutex_trylock(lock);
   DIDLOCK(ret, lock, file, func, line);
+  if (unlikely(opt_lock_stats))
+    lock_stats_trylock(ret, (void *)lock, LOCK_KIND_MUTEX, name, file, func, line);
   return ret;
 }
 
-static inline void _wr_lock(pthread_rwlock_t *lock, const char *file, const char *func, const int line)
+static inline void _wr_lock(pthread_rwlock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
   GETLOCK(lock, file, func, line);
-  if (unlikely(pthread_rwlock_wrlock(lock)))
+  if (unlikely(opt_lock_stats))
+    lock_stats_lock((void *)lock, LOCK_KIND_WRITE, name, file, func, line);
+  else if (unlikely(pthread_rwlock_wrlock(lock)))
     quitfrom(1, file, func, line, "WTF WRLOCK ERROR ON LOCK! errno=%d", errno);
   GOTLOCK(lock, file, func, line);
 }
 
-static inline int _wr_trylock(pthread_rwlock_t *lock, __maybe_unused const char *file, __maybe_unused const char *func, __maybe_unused const int line)
+static inline int _wr_trylock(pthread_rwlock_t *lock, const char *name, __maybe_unused const char *file, __maybe_unused const char *func, __maybe_unused const int line)
 {
   TRYLOCK(lock, file, func, line);
   int ret = pthread_rwlock_trywrlock(lock);
   DIDLOCK(ret, lock, file, func, line);
+  if (unlikely(opt_lock_stats))
+    lock_stats_trylock(ret, (void *)lock, LOCK_KIND_WRITE, name, file, func, line);
   return ret;
 }
 
-static inline void _rd_lock(pthread_rwlock_t *lock, const char *file, const char *func, const int line)
+static inline void _rd_lock(pthread_rwlock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
   GETLOCK(lock, file, func, line);
-  if (unlikely(pthread_rwlock_rdlock(lock)))
+  if (unlikely(opt_lock_stats))
+    lock_stats_lock((void *)lock, LOCK_KIND_READ, name, file, func, line);
+  else if (unlikely(pthread_rwlock_rdlock(lock)))
     quitfrom(1, file, func, line, "WTF RDLOCK ERROR ON LOCK! errno=%d", errno);
   GOTLOCK(lock, file, func, line);
 }
 
-static inline void _rw_unlock(pthread_rwlock_t *lock, const char *file, const char *func, const int line)
+static inline void _rw_unlock(pthread_rwlock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
+  if (unlikely(opt_lock_stats))
+    lock_stats_unlock((void *)lock);
   if (unlikely(pthread_rwlock_unlock(lock)))
     quitfrom(1, file, func, line, "WTF RWLOCK ERROR ON UNLOCK! errno=%d", errno);
   GUNLOCK(lock, file, func, line);
 }
 
-static inline void _rd_unlock_noyield(pthread_rwlock_t *lock, const char *file, const char *func, const int line)
+static inline void _rd_unlock_noyield(pthread_rwlock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _rw_unlock(lock, file, func, line);
+  _rw_unlock(lock, name, file, func, line);
 }
 
-static inline void _wr_unlock_noyield(pthread_rwlock_t *lock, const char *file, const char *func, const int line)
+static inline void _wr_unlock_noyield(pthread_rwlock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _rw_unlock(lock, file, func, line);
+  _rw_unlock(lock, name, file, func, line);
 }
 
-static inline void _rd_unlock(pthread_rwlock_t *lock, const char *file, const char *func, const int line)
+static inline void _rd_unlock(pthread_rwlock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _rw_unlock(lock, file, func, line);
+  _rw_unlock(lock, name, file, func, line);
   sched_yield();
 }
 
-static inline void _wr_unlock(pthread_rwlock_t *lock, const char *file, const char *func, const int line)
+static inline void _wr_unlock(pthread_rwlock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _rw_unlock(lock, file, func, line);
+  _rw_unlock(lock, name, file, func, line);
   sched_yield();
 }
 
@@ -878,6 +944,27 @@ static inline void _mutex_init(pthread_mutex_t *lock, const char *file, const ch
   INITLOCK(lock, CGLOCK_MUTEX, file, func, line);
 }
 
+/* Waits on cond, keeping the time asleep out of the hold time of lock */
+static inline int _cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock, const struct timespec *abstime)
+{
+  void *site = NULL;
+  int ret;
+
+  if (unlikely(opt_lock_stats))
+    site = lock_stats_cond_release(lock);
+  if (abstime)
+    ret = pthread_cond_timedwait(cond, lock, abstime);
+  else
+    ret = pthread_cond_wait(cond, lock);
+  if (unlikely(site))
+    lock_stats_cond_reacquire(lock, site);
+
+  return ret;
+}
+
+#define cond_wait(_cond, _lock) _cond_wait(_cond, _lock, NULL)
+#define cond_timedwait(_cond, _lock, _abstime) _cond_wait(_cond, _lock, _abstime)
+
 static inline void mutex_destroy(pthread_mutex_t *lock)
 {
   /* Ignore return code. This only invalidates the mutex on linux but
@@ -910,74 +997,75 @@ static inline void cglock_destroy(cglock_t *lock)
 }
 
 /* Read lock variant of cglock. Cannot be promoted. */
-static inline void _cg_rlock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_rlock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _mutex_lock(&lock->mutex, file, func, line);
-  _rd_lock(&lock->rwlock, file, func, line);
-  _mutex_unlock_noyield(&lock->mutex, file, func, line);
+  _mutex_lock(&lock->mutex, name, file, func, line);
+  _rd_lock(&lock->rwlock, name, file, func, line);
+  _mutex_unlock_noyield(&lock->mutex, name, file, func, line);
 }
 
 /* Intermediate variant of cglock - behaves as a read lock but can be promoted
  * to a write lock or demoted to read lock. */
-static inline void _cg_ilock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_ilock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _mutex_lock(&lock->mutex, file, func, line);
+  _mutex_lock(&lock->mutex, name, file, func, line);
 }
 
 /* Upgrade intermediate variant to a write lock */
-static inline void _cg_ulock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_ulock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _wr_lock(&lock->rwlock, file, func, line);
+  _wr_lock(&lock->rwlock, name, file, func, line);
 }
 
 /* Write lock variant of cglock */
-static inline void _cg_wlock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_wlock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _mutex_lock(&lock->mutex, file, func, line);
-  _wr_lock(&lock->rwlock, file, func, line);
+  _mutex_lock(&lock->mutex, name, file, func, line);
+  _wr_lock(&lock->rwlock, name, file, func, line);
 }
 
 /* Downgrade write variant to a read lock */
-static inline void _cg_dwlock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_dwlock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _wr_unlock_noyield(&lock->rwlock, file, func, line);
-  _rd_lock(&lock->rwlock, file, func, line);
-  _mutex_unlock_noyield(&lock->mutex, file, func, line);
+  _wr_unlock_noyield(&lock->rwlock, name, file, func, line);
+  _rd_lock(&lock->rwlock, name, file, func, line);
+  _mutex_unlock_noyield(&lock->mutex, name, file, func, line);
 }
 
 /* Demote a write variant to an intermediate variant */
-static inline void _cg_dwilock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_dwilock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _wr_unlock(&lock->rwlock, file, func, line);
+  _wr_unlock(&lock->rwlock, name, file, func, line);
 }
 
 /* Downgrade intermediate variant to a read lock */
-static inline void _cg_dlock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_dlock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _rd_lock(&lock->rwlock, file, func, line);
-  _mutex_unlock_noyield(&lock->mutex, file, func, line);
+  _rd_lock(&lock->rwlock, name, file, func, line);
+  _mutex_unlock_noyield(&lock->mutex, name, file, func, line);
 }
 
-static inline void _cg_runlock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_runlock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _rd_unlock(&lock->rwlock, file, func, line);
+  _rd_unlock(&lock->rwlock, name, file, func, line);
 }
 
 /* This drops the read lock and grabs a write lock. It does NOT protect data
  * between the two locks! */
-static inline void _cg_ruwlock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_ruwlock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _rd_unlock_noyield(&lock->rwlock, file, func, line);
-  _cg_wlock(lock, file, func, line);
+  _rd_unlock_noyield(&lock->rwlock, name, file, func, line);
+  _cg_wlock(lock, name, file, func, line);
 }
 
-static inline void _cg_wunlock(cglock_t *lock, const char *file, const char *func, const int line)
+static inline void _cg_wunlock(cglock_t *lock, const char *name, const char *file, const char *func, const int line)
 {
-  _wr_unlock_noyield(&lock->rwlock, file, func, line);
-  _mutex_unlock(&lock->mutex, file, func, line);
+  _wr_unlock_noyield(&lock->rwlock, name, file, func, line);
+  _mutex_unlock(&lock->mutex, name, file, func, line);
 }
 
 struct pool;
+struct share_table;
 
 #define API_MCAST_CODE "FTW"
 #define API_MCAST_ADDR "224.0.0.75"
@@ -1003,6 +1091,7 @@ extern struct schedtime schedstop;
 extern char *sgminer_path;
 extern int opt_shares;
 extern bool opt_fail_only;
+extern int opt_hot_standby;
 extern bool opt_autofan;
 extern bool opt_autoengine;
 extern bool use_curses;
@@ -1144,6 +1233,8 @@ extern int total_getworks, total_stale, total_discarded;
 extern double total_diff_accepted, total_diff_rejected, total_diff_stale;
 extern unsigned int local_work;
 extern unsigned int total_go, total_ro;
+extern unsigned int total_failovers;
+extern double last_failover_gap, max_failover_gap;
 extern const int opt_cutofftemp;
 extern int opt_log_interval;
 extern unsigned long long global_hashrate;
@@ -1208,8 +1299,10 @@ struct stratum_work {
   bool clean;
 
   size_t cb_len;
+  size_t cb_alloc;      /* Allocated size of pool->coinbase from notifies */
   size_t header_len;
   int merkles;
+  int merkles_alloc;    /* Allocated entries of merkle_bin */
   double diff;
 };
 
@@ -1240,6 +1333,7 @@ struct pool {
   bool submit_fail;
   bool idle;
   bool lagging;
+  bool hot_standby; /* Kept subscribed as a backup, see --hot-standby */
   bool probed;
   enum pool_state state;
   bool submit_old;
@@ -1316,6 +1410,7 @@ struct pool {
   SOCKETTYPE sock;
   char *sockbuf;
   size_t sockbuf_size;
+  bool sockbuf_discard; /* --lowmem dropping the rest of an oversized line */
   char *sockaddr_url; /* stripped url used for sockaddr */
   char *sockaddr_proxy_url;
   char *sockaddr_proxy_port;
@@ -1334,7 +1429,9 @@ struct pool {
   pthread_t stratum_rthread;
   pthread_mutex_t stratum_lock;
   struct thread_q *stratum_q;
-  int sshares; /* stratum shares submitted waiting on response */
+  struct share_table *share_table; /* stratum shares submitted waiting on response */
+  FILE *record_file; /* --stratum-record session log */
+  bool record_failed;
 
   /* GBT variables */
   bool has_gbt;
@@ -1409,6 +1506,15 @@ struct work {
   char    *coinbase;
   int   gbt_txns;
 
+  /* --gpu-nonce2 values reserved from nonce2 on, and the coinbase with the
+   * merkle branches after it the device derives their headers from */
+  int   nonce2_range;
+  unsigned char *n2_job;
+  size_t    n2_cb_len;
+  size_t    n2_offset;
+  int   n2_merkles;
+  int   n2_merkle_offset;
+
   unsigned int  work_block;
   int   id;
   UT_hash_handle  hh;
@@ -1447,6 +1553,7 @@ extern void inc_hw_errors(struct thr_info *thr);
 extern bool test_nonce(struct work *work, uint32_t nonce);
 extern bool submit_tested_work(struct thr_info *thr, struct work *work);
 extern bool submit_nonce(struct thr_info *thr, struct work *work, uint32_t nonce);
+extern bool submit_hashed_nonce(struct thr_info *thr, struct work *work, uint32_t nonce, const uint32_t *hash);
 extern struct work *get_work(struct thr_info *thr, const int thr_id);
 extern void _wlog(const char *str);
 extern void _wlogprint(const char *str);
@@ -1478,6 +1585,7 @@ extern void clean_work(struct work *work);
 extern void free_work(struct work *work);
 extern struct work *copy_work_noffset(struct work *base_work, int noffset);
 #define copy_work(work_in) copy_work_noffset(work_in, 0)
+extern void work_set_nonce2(struct work *work, uint64_t nonce2);
 extern struct cgpu_info *get_devices(int id);
 
 extern char *set_int_0_to_9999(const char *arg, int *i);
@@ -28,12 +28,17 @@
 #include <sys/time.h>
 #include <pthread.h>
 #include <unistd.h>
+#ifndef __APPLE_CC__
+#include <CL/cl_ext.h>
+#endif
 
 #include "findnonce.h"
 #include "algorithm.h"
 #include "ocl.h"
 #include "ocl/build_kernel.h"
 #include "ocl/binary_kernel.h"
+#include "ocl/kernel_profile.h"
+#include "ocl/gpu_nonce2.h"
 
 /* FIXME: only here for global config vars, replace with configuration.h
  * or similar as soon as config is in a struct instead of littered all
@@ -191,10 +196,48 @@ static bool get_opencl_bit_align_support(cl_device_id *device)
   return !!find;
 }
 
-_clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm)
+void release_cl_state(_clState *clState)
+{
+  unsigned int i;
+
+  if (!clState)
+    return;
+
+  if (clState->commandQueue)
+    clFinish(clState->commandQueue);
+  if (clState->outputBuffer)
+    clReleaseMemObject(clState->outputBuffer);
+  if (clState->CLbuffer0)
+    clReleaseMemObject(clState->CLbuffer0);
+  gpu_nonce2_release(clState);
+  if (clState->padbuffer8)
+    clReleaseMemObject(clState->padbuffer8);
+  if (clState->branchBuffer)
+    clReleaseMemObject(clState->branchBuffer);
+  if (clState->kernel)
+    clReleaseKernel(clState->kernel);
+  if (clState->extra_kernels) {
+    for (i = 0; i < clState->n_extra_kernels; i++) {
+      if (clState->extra_kernels[i])
+        clReleaseKernel(clState->extra_kernels[i]);
+    }
+    free(clState->extra_kernels);
+  }
+  if (clState->program)
+    clReleaseProgram(clState->program);
+  if (clState->commandQueue)
+    clReleaseCommandQueue(clState->commandQueue);
+  if (clState->context)
+    clReleaseContext(clState->context);
+  free(clState);
+}
+
+/* Sets up the OpenCL state for gpu, planning lookup gap and thread
+ * concurrency into cgpu. cgpu is normally &gpus[gpu], but may be a copy
+ * when a kernel is being prepared ahead of time. */
+static _clState *init_cl_state(struct cgpu_info *cgpu, unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm, bool alloc_padbuffer, bool profile)
 {
   _clState *clState = (_clState *)calloc(1, sizeof(_clState));
-  struct cgpu_info *cgpu = &gpus[gpu];
   cl_platform_id platform = NULL;
   char pbuff[256];
   build_kernel_data *build_data = (build_kernel_data *) alloca(sizeof(struct _build_kernel_data));
@@ -203,13 +246,16 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
   cl_uint numDevices;
   cl_int status;
 
-  if (!get_opencl_platform(opt_platform_id, &platform)) {
+  if (unlikely(!clState))
     return NULL;
+
+  if (!get_opencl_platform(opt_platform_id, &platform)) {
+    goto fail;
   }
 
   numDevices = clDevicesNum();
 
-  if (numDevices <= 0 ) return NULL;
+  if (numDevices <= 0 ) goto fail;
 
   devices = (cl_device_id *)alloca(numDevices*sizeof(cl_device_id));
 
@@ -218,7 +264,7 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
   status = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, numDevices, devices, NULL);
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Getting Device IDs (list)", status);
-    return NULL;
+    goto fail;
   }
 
   applog(LOG_INFO, "List of devices:");
@@ -228,7 +274,7 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
     status = clGetDeviceInfo(devices[i], CL_DEVICE_NAME, sizeof(pbuff), pbuff, NULL);
     if (status != CL_SUCCESS) {
       applog(LOG_ERR, "Error %d: Getting Device Info", status);
-      return NULL;
+      goto fail;
     }
 
     applog(LOG_INFO, "\t%i\t%s", i, pbuff);
@@ -241,19 +287,20 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
 
   if (gpu >= numDevices) {
     applog(LOG_ERR, "Invalid GPU %i", gpu);
-    return NULL;
+    goto fail;
   }
 
   status = create_opencl_context(&clState->context, &platform);
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Creating Context. (clCreateContextFromType)", status);
-    return NULL;
+    goto fail;
   }
 
-  status = create_opencl_command_queue(&clState->commandQueue, &clState->context, &devices[gpu], cgpu->algorithm.cq_properties);
+  status = create_opencl_command_queue(&clState->commandQueue, &clState->context, &devices[gpu],
+                                       cgpu->algorithm.cq_properties | ((opt_kernel_profile || profile) ? CL_QUEUE_PROFILING_ENABLE : 0));
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Creating Command Queue. (clCreateCommandQueue)", status);
-    return NULL;
+    goto fail;
   }
 
   clState->hasBitAlign = get_opencl_bit_align_support(&devices[gpu]);
@@ -261,14 +308,14 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
   status = clGetDeviceInfo(devices[gpu], CL_DEVICE_PREFERRED_VECTOR_WIDTH_INT, sizeof(cl_uint), (void *)&preferred_vwidth, NULL);
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Failed to clGetDeviceInfo when trying to get CL_DEVICE_PREFERRED_VECTOR_WIDTH_INT", status);
-    return NULL;
+    goto fail;
   }
   applog(LOG_DEBUG, "Preferred vector width reported %d", preferred_vwidth);
 
   status = clGetDeviceInfo(devices[gpu], CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(size_t), (void *)&clState->max_work_size, NULL);
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Failed to clGetDeviceInfo when trying to get CL_DEVICE_MAX_WORK_GROUP_SIZE", status);
-    return NULL;
+    goto fail;
   }
   applog(LOG_DEBUG, "Max work group size reported %d", (int)(clState->max_work_size));
 
@@ -276,7 +323,7 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
   status = clGetDeviceInfo(devices[gpu], CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(size_t), (void *)&compute_units, NULL);
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Failed to clGetDeviceInfo when trying to get CL_DEVICE_MAX_COMPUTE_UNITS", status);
-    return NULL;
+    goto fail;
   }
   // AMD architechture got 64 compute shaders per compute unit.
   // Source: http://www.amd.com/us/Documents/GCN_Architecture_whitepaper.pdf
@@ -286,10 +333,25 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
   status = clGetDeviceInfo(devices[gpu], CL_DEVICE_MAX_MEM_ALLOC_SIZE , sizeof(cl_ulong), (void *)&cgpu->max_alloc, NULL);
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Failed to clGetDeviceInfo when trying to get CL_DEVICE_MAX_MEM_ALLOC_SIZE", status);
-    return NULL;
+    goto fail;
   }
   applog(LOG_DEBUG, "Max mem alloc size is %lu", (long unsigned int)(cgpu->max_alloc));
 
+#ifdef CL_DEVICE_TOPOLOGY_AMD
+  {
+    cl_device_topology_amd topology;
+
+    /* Only AMD platforms report the PCIe slot, used by --affinity auto */
+    status = clGetDeviceInfo(devices[gpu], CL_DEVICE_TOPOLOGY_AMD, sizeof(topology), &topology, NULL);
+    if (status == CL_SUCCESS && topology.raw.type == CL_DEVICE_TOPOLOGY_TYPE_PCIE_AMD) {
+      snprintf(cgpu->pci_slot, sizeof(cgpu->pci_slot), "%02x:%02x.%x",
+               (unsigned char)topology.pcie.bus, (unsigned char)topology.pcie.device,
+               (unsigned char)topology.pcie.function);
+      applog(LOG_DEBUG, "Device is in PCIe slot %s", cgpu->pci_slot);
+    }
+  }
+#endif
+
   /* Create binary filename based on parameters passed to opencl
    * compiler to ensure we only load a binary that matches what
    * would have otherwise created. The filename is:
@@ -391,6 +453,12 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
   if (algorithm->set_compile_options)
     algorithm->set_compile_options(build_data, cgpu, algorithm);
 
+  clState->multi_header = gpu_nonce2_multi_header(algorithm, devices[gpu]);
+  if (clState->multi_header) {
+    strcat(build_data->compiler_options, " -D MULTI_HEADER=1");
+    strcat(build_data->binary_filename, "mh");
+  }
+
   strcat(build_data->binary_filename, ".bin");
 
   // Load program from file or build it if it doesn't exist
@@ -398,7 +466,7 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
     applog(LOG_NOTICE, "Building binary %s", build_data->binary_filename);
 
     if (!(clState->program = build_opencl_kernel(build_data, filename)))
-      return NULL;
+      goto fail;
 
     if (save_opencl_kernel(build_data, clState->program)) {
       /* Program needs to be rebuilt, because the binary was patched */
@@ -412,6 +480,8 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
     }
   }
 
+  clState->nfactor = algorithm->nfactor;
+
   // Load kernels
   applog(LOG_NOTICE, "Initialising kernel %s with%s bitalign, %spatched BFI, nfactor %d, n %d",
          filename, clState->hasBitAlign ? "" : "out", build_data->patch_bfi ? "" : "un",
@@ -421,38 +491,73 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
   clState->kernel = clCreateKernel(clState->program, "search", &status);
   if (status != CL_SUCCESS) {
     applog(LOG_ERR, "Error %d: Creating Kernel from program. (clCreateKernel)", status);
-    return NULL;
+    clState->kernel = NULL;
+    goto fail;
   }
 
 
   clState->n_extra_kernels = algorithm->n_extra_kernels;
+  clState->chain = algorithm->chain;
   if (clState->n_extra_kernels > 0) {
     unsigned int i;
     char kernel_name[9]; // max: search99 + 0x0
 
-    clState->extra_kernels = (cl_kernel *)malloc(sizeof(cl_kernel) * clState->n_extra_kernels);
+    clState->extra_kernels = (cl_kernel *)calloc(clState->n_extra_kernels, sizeof(cl_kernel));
+    if (unlikely(!clState->extra_kernels))
+      goto fail;
 
     for (i = 0; i < clState->n_extra_kernels; i++) {
       snprintf(kernel_name, 9, "%s%d", "search", i + 1);
       clState->extra_kernels[i] = clCreateKernel(clState->program, kernel_name, &status);
       if (status != CL_SUCCESS) {
         applog(LOG_ERR, "Error %d: Creating ExtraKernel #%d from program. (clCreateKernel)", status, i);
-        return NULL;
+        clState->extra_kernels[i] = NULL;
+        goto fail;
       }
     }
   }
 
-  size_t bufsize;
+  if (opt_gpu_nonce2 > 1 && gpu_nonce2_supported(algorithm))
+    gpu_nonce2_init(clState, build_data);
 
   if (algorithm->rw_buffer_size < 0) {
     size_t ipt = (algorithm->n / cgpu->lookup_gap +
             (algorithm->n % cgpu->lookup_gap > 0));
-    bufsize = 128 * ipt * cgpu->thread_concurrency;
+    clState->padbufsize = 128 * ipt * cgpu->thread_concurrency;
   } else
-    bufsize = (size_t) algorithm->rw_buffer_size;
+    clState->padbufsize = (size_t) algorithm->rw_buffer_size;
 
   clState->padbuffer8 = NULL;
 
+  if (alloc_padbuffer && !alloc_cl_padbuffer(clState, cgpu, gpu))
+    goto fail;
+
+  clState->CLbuffer0 = clCreateBuffer(clState->context, CL_MEM_READ_ONLY, 128, NULL, &status);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: clCreateBuffer (CLbuffer0)", status);
+    clState->CLbuffer0 = NULL;
+    goto fail;
+  }
+  clState->outputBuffer = clCreateBuffer(clState->context, CL_MEM_WRITE_ONLY, BUFFERSIZE, NULL, &status);
+
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: clCreateBuffer (outputBuffer)", status);
+    clState->outputBuffer = NULL;
+    goto fail;
+  }
+
+  return clState;
+
+fail:
+  release_cl_state(clState);
+  return NULL;
+}
+
+bool alloc_cl_padbuffer(_clState *clState, struct cgpu_info *cgpu, unsigned int gpu)
+{
+  size_t bufsize = clState->padbufsize;
+  cl_int status;
+
   if (bufsize > 0) {
     /* Use the max alloc value which has been rounded to a power of
      * 2 greater >= required amount earlier */
@@ -469,22 +574,25 @@ _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *alg
     clState->padbuffer8 = clCreateBuffer(clState->context, CL_MEM_READ_WRITE, bufsize, NULL, &status);
     if (status != CL_SUCCESS && !clState->padbuffer8) {
       applog(LOG_ERR, "Error %d: clCreateBuffer (padbuffer8), decrease TC or increase LG", status);
-      return NULL;
+      return false;
     }
   }
 
-  clState->CLbuffer0 = clCreateBuffer(clState->context, CL_MEM_READ_ONLY, 128, NULL, &status);
-  if (status != CL_SUCCESS) {
-    applog(LOG_ERR, "Error %d: clCreateBuffer (CLbuffer0)", status);
-    return NULL;
-  }
-  clState->outputBuffer = clCreateBuffer(clState->context, CL_MEM_WRITE_ONLY, BUFFERSIZE, NULL, &status);
+  return true;
+}
 
-  if (status != CL_SUCCESS) {
-    applog(LOG_ERR, "Error %d: clCreateBuffer (outputBuffer)", status);
-    return NULL;
-  }
+_clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm)
+{
+  return init_cl_state(&gpus[gpu], gpu, name, nameSize, algorithm, true, false);
+}
 
-  return clState;
+_clState *prepareCl(struct cgpu_info *cgpu, unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm)
+{
+  return init_cl_state(cgpu, gpu, name, nameSize, algorithm, false, false);
+}
+
+_clState *profileCl(struct cgpu_info *cgpu, unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm)
+{
+  return init_cl_state(cgpu, gpu, name, nameSize, algorithm, true, true);
 }
 
@@ -22,6 +22,21 @@ typedef struct __clState {
   cl_mem outputBuffer;
   cl_mem CLbuffer0;
   cl_mem padbuffer8;
+  size_t padbufsize;
+  cl_mem branchBuffer; /* Branch index lists of the split quark kernels */
+  size_t branchbufsize;
+  const algorithm_stage_t *chain;
+  /* --gpu-nonce2, see ocl/gpu_nonce2.h */
+  cl_program n2program;
+  cl_kernel n2kernel;
+  cl_mem n2jobBuffer;
+  size_t n2jobsize;
+  cl_mem n2templateBuffer;
+  cl_mem n2headerBuffer;
+  unsigned char *n2job; /* Coinbase and merkle branches on the device */
+  size_t n2joblen;
+  bool multi_header; /* Search kernel built with MULTI_HEADER */
+  uint8_t nfactor;
   unsigned char cldata[80];
   bool hasBitAlign;
   bool goffset;
@@ -33,5 +48,15 @@ typedef struct __clState {
 
 extern int clDevicesNum(void);
 extern _clState *initCl(unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm);
+/* Builds the kernel and plans the buffers for gpu using the settings in
+ * cgpu without allocating the padbuffer, see alloc_cl_padbuffer(). */
+extern _clState *prepareCl(struct cgpu_info *cgpu, unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm);
+/* Builds the kernel for gpu using the settings in cgpu, on a queue that
+ * records kernel execution times */
+extern _clState *profileCl(struct cgpu_info *cgpu, unsigned int gpu, char *name, size_t nameSize, algorithm_t *algorithm);
+extern bool alloc_cl_padbuffer(_clState *clState, struct cgpu_info *cgpu, unsigned int gpu);
+/* Releases everything in clState and clState itself, which may be only
+ * partly set up or NULL */
+extern void release_cl_state(_clState *clState);
 
 #endif /* OCL_H */
@@ -112,6 +112,7 @@ cl_program build_opencl_kernel(build_kernel_data *data, const char *filename)
   cl_int status;
   cl_program program = NULL;
   cl_program ret = NULL;
+  struct timeval tv_start, tv_end;
 
   if (!source)
     goto out;
@@ -123,7 +124,9 @@ cl_program build_opencl_kernel(build_kernel_data *data, const char *filename)
   }
 
   applog(LOG_DEBUG, "CompilerOptions: %s", data->compiler_options);
+  cgtime(&tv_start);
   status = clBuildProgram(program, 1, data->device, data->compiler_options, NULL, NULL);
+  cgtime(&tv_end);
 
   if (status != CL_SUCCESS) {
     size_t log_size;
@@ -138,6 +141,9 @@ cl_program build_opencl_kernel(build_kernel_data *data, const char *filename)
     goto out;
   }
 
+  /* Compare kernel variants by their build time */
+  applog(LOG_INFO, "Built %s in %.2f seconds", data->binary_filename, tdiff(&tv_end, &tv_start));
+
   ret = program;
 out:
   if (source) free(source);
@@ -195,6 +201,7 @@ bool save_opencl_kernel(build_kernel_data *data, cl_program program)
     applog(LOG_ERR, "OpenCL compiler generated a zero sized binary!");
     goto out;
   }
+  applog(LOG_INFO, "Binary %s is %d bytes", data->binary_filename, (int)(binary_sizes[slot]));
 
   /* Patch the kernel if the hardware supports BFI_INT but it needs to
    * be hacked in */
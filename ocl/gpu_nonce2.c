@@ -0,0 +1,227 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "miner.h"
+#include "algorithm.h"
+#include "sha2.h"
+#include "ocl/gpu_nonce2.h"
+#include "ocl/binary_kernel.h"
+
+/* Nonce2 values each stratum work item reserves for the device to derive
+ * headers for, 0 derives every header on the host */
+int opt_gpu_nonce2;
+
+#define HEADER_SIZE 80
+
+bool gpu_nonce2_supported(const algorithm_t *algorithm)
+{
+  if (algorithm->type == ALGO_SCRYPT || algorithm->type == ALGO_NSCRYPT)
+    return false;
+  return algorithm->gen_hash == gen_hash || algorithm->gen_hash == sha256;
+}
+
+bool gpu_nonce2_multi_header(const algorithm_t *algorithm, cl_device_id device)
+{
+  cl_uint address_bits = 0;
+
+  if (opt_gpu_nonce2 <= 1 || !gpu_nonce2_supported(algorithm))
+    return false;
+  /* The kernels that cover 2^32 nonces fastest, one header each */
+  if (algorithm->type != ALGO_KECCAK && algorithm->type != ALGO_TWE && algorithm->type != ALGO_FUGUE)
+    return false;
+  if (sizeof(size_t) < 8)
+    return false;
+  if (clGetDeviceInfo(device, CL_DEVICE_ADDRESS_BITS, sizeof(address_bits), &address_bits, NULL) != CL_SUCCESS)
+    return false;
+  return address_bits >= 64;
+}
+
+bool gpu_nonce2_init(_clState *clState, const build_kernel_data *base)
+{
+  build_kernel_data *data = (build_kernel_data *)alloca(sizeof(build_kernel_data));
+  cl_int status;
+
+  memcpy(data, base, sizeof(build_kernel_data));
+  strcpy(data->source_filename, "nonce2.cl");
+  strcpy(data->binary_filename, "nonce2");
+  strcat(data->binary_filename, data->platform);
+  data->patch_bfi = false;
+  set_base_compiler_options(data);
+  strcat(data->binary_filename, ".bin");
+
+  if (!(clState->n2program = load_opencl_binary_kernel(data))) {
+    applog(LOG_NOTICE, "Building binary %s", data->binary_filename);
+    if (!(clState->n2program = build_opencl_kernel(data, data->source_filename)))
+      goto fail;
+    save_opencl_kernel(data, clState->n2program);
+  }
+
+  clState->n2kernel = clCreateKernel(clState->n2program, "nonce2_headers", &status);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: Creating Kernel from program. (clCreateKernel)", status);
+    clState->n2kernel = NULL;
+    goto fail;
+  }
+
+  clState->n2templateBuffer = clCreateBuffer(clState->context, CL_MEM_READ_ONLY, HEADER_SIZE, NULL, &status);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: clCreateBuffer (n2templateBuffer)", status);
+    clState->n2templateBuffer = NULL;
+    goto fail;
+  }
+  clState->n2headerBuffer = clCreateBuffer(clState->context, CL_MEM_READ_WRITE,
+                                           (size_t)opt_gpu_nonce2 * HEADER_SIZE, NULL, &status);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: clCreateBuffer (n2headerBuffer)", status);
+    clState->n2headerBuffer = NULL;
+    goto fail;
+  }
+
+  return true;
+
+fail:
+  applog(LOG_WARNING, "GPU nonce2 kernel unavailable, deriving headers on the host");
+  gpu_nonce2_release(clState);
+  return false;
+}
+
+void gpu_nonce2_release(_clState *clState)
+{
+  if (clState->n2headerBuffer)
+    clReleaseMemObject(clState->n2headerBuffer);
+  if (clState->n2templateBuffer)
+    clReleaseMemObject(clState->n2templateBuffer);
+  if (clState->n2jobBuffer)
+    clReleaseMemObject(clState->n2jobBuffer);
+  if (clState->n2kernel)
+    clReleaseKernel(clState->n2kernel);
+  if (clState->n2program)
+    clReleaseProgram(clState->n2program);
+  free(clState->n2job);
+
+  clState->n2headerBuffer = clState->n2templateBuffer = clState->n2jobBuffer = NULL;
+  clState->n2kernel = NULL;
+  clState->n2program = NULL;
+  clState->n2job = NULL;
+  clState->n2jobsize = clState->n2joblen = 0;
+}
+
+/* Uploads the coinbase and merkle branches of work unless they are the ones
+ * on the device already */
+static cl_int upload_job(_clState *clState, struct work *work)
+{
+  size_t len = work->n2_cb_len + 32 * (size_t)work->n2_merkles;
+  cl_int status;
+
+  if (len == clState->n2joblen && !memcmp(clState->n2job, work->n2_job, len))
+    return CL_SUCCESS;
+
+  if (len > clState->n2jobsize) {
+    if (clState->n2jobBuffer)
+      clReleaseMemObject(clState->n2jobBuffer);
+    clState->n2jobsize = 0;
+    clState->n2jobBuffer = clCreateBuffer(clState->context, CL_MEM_READ_ONLY, len, NULL, &status);
+    if (status != CL_SUCCESS) {
+      applog(LOG_ERR, "Error %d: clCreateBuffer (n2jobBuffer)", status);
+      clState->n2jobBuffer = NULL;
+      return status;
+    }
+    clState->n2jobsize = len;
+
+    clState->n2job = (unsigned char *)realloc(clState->n2job, len);
+    if (unlikely(!clState->n2job))
+      quit(1, "Failed to realloc n2job in upload_job");
+  }
+
+  /* Forget the old job until the new one is on the device */
+  clState->n2joblen = 0;
+  status = clEnqueueWriteBuffer(clState->commandQueue, clState->n2jobBuffer, CL_TRUE, 0, len,
+                                work->n2_job, 0, NULL, NULL);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: clEnqueueWriteBuffer (n2jobBuffer)", status);
+    return status;
+  }
+  memcpy(clState->n2job, work->n2_job, len);
+  clState->n2joblen = len;
+
+  return CL_SUCCESS;
+}
+
+cl_int gpu_nonce2_headers(_clState *clState, struct work *work)
+{
+  cl_kernel *kernel = &clState->n2kernel;
+  unsigned char header[HEADER_SIZE];
+  size_t globalThreads[1], localThreads[1] = { clState->wsize };
+  cl_uint cb_len = work->n2_cb_len;
+  cl_uint nonce2_offset = work->n2_offset;
+  cl_uint n2size = work->nonce2_len;
+  cl_uint merkles = work->n2_merkles;
+  cl_uint merkle_word = work->n2_merkle_offset / 4;
+  cl_uint cb_sha256d = work->pool->algorithm.gen_hash == gen_hash;
+  cl_ulong nonce2 = work->nonce2;
+  cl_uint count = work->nonce2_range;
+  unsigned int num = 0;
+  cl_int status;
+
+  status = upload_job(clState, work);
+  if (status != CL_SUCCESS)
+    return status;
+
+  flip80(header, work->data);
+  status = clEnqueueWriteBuffer(clState->commandQueue, clState->n2templateBuffer, CL_TRUE, 0, HEADER_SIZE,
+                                header, 0, NULL, NULL);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: clEnqueueWriteBuffer (n2templateBuffer)", status);
+    return status;
+  }
+
+  status |= clSetKernelArg(*kernel, num++, sizeof(cl_mem), (void *)&clState->n2jobBuffer);
+  status |= clSetKernelArg(*kernel, num++, sizeof(cb_len), (void *)&cb_len);
+  status |= clSetKernelArg(*kernel, num++, sizeof(nonce2_offset), (void *)&nonce2_offset);
+  status |= clSetKernelArg(*kernel, num++, sizeof(n2size), (void *)&n2size);
+  status |= clSetKernelArg(*kernel, num++, sizeof(merkles), (void *)&merkles);
+  status |= clSetKernelArg(*kernel, num++, sizeof(merkle_word), (void *)&merkle_word);
+  status |= clSetKernelArg(*kernel, num++, sizeof(cb_sha256d), (void *)&cb_sha256d);
+  status |= clSetKernelArg(*kernel, num++, sizeof(nonce2), (void *)&nonce2);
+  status |= clSetKernelArg(*kernel, num++, sizeof(count), (void *)&count);
+  status |= clSetKernelArg(*kernel, num++, sizeof(cl_mem), (void *)&clState->n2templateBuffer);
+  status |= clSetKernelArg(*kernel, num++, sizeof(cl_mem), (void *)&clState->n2headerBuffer);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error: clSetKernelArg of nonce2_headers failed.");
+    return status;
+  }
+
+  globalThreads[0] = (count + localThreads[0] - 1) / localThreads[0] * localThreads[0];
+  status = clEnqueueNDRangeKernel(clState->commandQueue, *kernel, 1, NULL, globalThreads, localThreads, 0, NULL, NULL);
+  if (status != CL_SUCCESS) {
+    applog(LOG_ERR, "Error %d: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)", status);
+    return status;
+  }
+
+  /* Once per work item, and the queue may run out of order */
+  return clFinish(clState->commandQueue);
+}
+
+cl_int gpu_nonce2_select(_clState *clState, unsigned int index, cl_event *event)
+{
+  cl_int status;
+
+  status = clEnqueueCopyBuffer(clState->commandQueue, clState->n2headerBuffer, clState->CLbuffer0,
+                               (size_t)index * HEADER_SIZE, 0, HEADER_SIZE, 0, NULL, event);
+  if (status != CL_SUCCESS)
+    applog(LOG_ERR, "Error %d: clEnqueueCopyBuffer (n2headerBuffer)", status);
+
+  return status;
+}
@@ -0,0 +1,45 @@
+#ifndef GPU_NONCE2_H
+#define GPU_NONCE2_H
+
+#ifdef __APPLE_CC__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include "miner.h"
+#include "ocl.h"
+#include "ocl/build_kernel.h"
+
+/* Most nonce2 values one stratum work item reserves */
+#define GPU_NONCE2_MAX 4096
+
+extern int opt_gpu_nonce2;
+
+/* Whether the headers of algorithm can be derived on the device: the
+ * search kernels read the header from CLbuffer0 and the coinbase is hashed
+ * with SHA-256 or SHA-256d */
+extern bool gpu_nonce2_supported(const algorithm_t *algorithm);
+
+/* Whether the search kernel of algorithm should be built for multi-header
+ * launches on device, see kernel/multi_header.cl: --gpu-nonce2 is on, the
+ * kernel takes MULTI_HEADER and the device and host have 64-bit size_t
+ * for global ids past 2^32 */
+extern bool gpu_nonce2_multi_header(const algorithm_t *algorithm, cl_device_id device);
+
+/* Builds kernel/nonce2.cl for the device of clState, with the settings the
+ * search kernels were built with, and allocates its buffers. On failure the
+ * headers of the device are derived on the host as usual */
+extern bool gpu_nonce2_init(_clState *clState, const build_kernel_data *base);
+
+extern void gpu_nonce2_release(_clState *clState);
+
+/* Derives the headers of the nonce2 range of work on the device, uploading
+ * the coinbase and merkle branches only when the job changed */
+extern cl_int gpu_nonce2_headers(_clState *clState, struct work *work);
+
+/* Copies the header of nonce2 index of the range into CLbuffer0, event
+ * completes with the copy */
+extern cl_int gpu_nonce2_select(_clState *clState, unsigned int index, cl_event *event);
+
+#endif /* GPU_NONCE2_H */
@@ -0,0 +1,223 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "miner.h"
+#include "algorithm.h"
+#include "ocl/kernel_profile.h"
+
+/* Create command queues with CL_QUEUE_PROFILING_ENABLE and time each kernel */
+bool opt_kernel_profile;
+
+struct kernel_stage_stats {
+  uint64_t runs;
+  uint64_t total_ns;
+  uint64_t min_ns;
+  uint64_t max_ns;
+  uint64_t buckets[KERNEL_PROFILE_BUCKETS];
+};
+
+struct kernel_profile {
+  char algorithm[20];
+  const algorithm_stage_t *chain; /* Chain of algorithm, static so kept by pointer */
+  unsigned int n_chain;           /* Stages in chain */
+  unsigned int n_stages;
+  bool zero;
+  struct kernel_stage_stats stages[KERNEL_PROFILE_MAX_STAGES];
+};
+
+static pthread_mutex_t profile_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct kernel_profile profiles[MAX_GPUDEVICES];
+
+static struct kernel_profile *gpu_profile(struct cgpu_info *gpu)
+{
+  if (gpu->device_id < 0 || gpu->device_id >= MAX_GPUDEVICES)
+    return NULL;
+  return &profiles[gpu->device_id];
+}
+
+static int bucket_of(uint64_t ns)
+{
+  uint64_t us = ns / 1000;
+  int b = 0;
+
+  while (us && b < KERNEL_PROFILE_BUCKETS - 1) {
+    us >>= 1;
+    b++;
+  }
+  return b;
+}
+
+void kernel_profile_record(struct cgpu_info *gpu, cl_event *events, unsigned int n_events)
+{
+  struct kernel_profile *profile = gpu_profile(gpu);
+  uint64_t ns[KERNEL_PROFILE_MAX_STAGES];
+  unsigned int i;
+
+  if (n_events > KERNEL_PROFILE_MAX_STAGES)
+    n_events = KERNEL_PROFILE_MAX_STAGES;
+
+  /* Queries outside the lock, they may wait on the driver */
+  for (i = 0; i < n_events; i++) {
+    cl_ulong start, end;
+
+    ns[i] = 0;
+    if (!events[i])
+      continue;
+    if (clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_START, sizeof(start), &start, NULL) == CL_SUCCESS &&
+        clGetEventProfilingInfo(events[i], CL_PROFILING_COMMAND_END, sizeof(end), &end, NULL) == CL_SUCCESS &&
+        end >= start)
+      ns[i] = end - start;
+    clReleaseEvent(events[i]);
+    events[i] = NULL;
+  }
+  if (!profile)
+    return;
+
+  mutex_lock(&profile_lock);
+  /* Start over when the GPU switches algorithm or stats were zeroed */
+  if (profile->zero || strcmp(profile->algorithm, gpu->algorithm.name)) {
+    memset(profile, 0, sizeof(*profile));
+    snprintf(profile->algorithm, sizeof(profile->algorithm), "%s", gpu->algorithm.name);
+    profile->chain = gpu->algorithm.chain;
+    profile->n_chain = gpu->algorithm.chain ? gpu->algorithm.n_extra_kernels + 1 : 0;
+  }
+  if (n_events > profile->n_stages)
+    profile->n_stages = n_events;
+  for (i = 0; i < n_events; i++) {
+    struct kernel_stage_stats *stage = &profile->stages[i];
+
+    if (!ns[i])
+      continue;
+    if (!stage->runs || ns[i] < stage->min_ns)
+      stage->min_ns = ns[i];
+    if (ns[i] > stage->max_ns)
+      stage->max_ns = ns[i];
+    stage->runs++;
+    stage->total_ns += ns[i];
+    stage->buckets[bucket_of(ns[i])]++;
+  }
+  mutex_unlock(&profile_lock);
+}
+
+static const char *stage_name(struct kernel_profile *profile, unsigned int stage, char *buf, size_t len)
+{
+  const char *name = stage < profile->n_chain ? profile->chain[stage].hashes : NULL;
+
+  if (!name) {
+    if (stage)
+      snprintf(buf, len, "search%u", stage);
+    else
+      snprintf(buf, len, "search");
+    name = buf;
+  }
+  return name;
+}
+
+static uint64_t chain_ns(struct kernel_profile *profile)
+{
+  uint64_t total = 0;
+  unsigned int i;
+
+  for (i = 0; i < profile->n_stages; i++)
+    total += profile->stages[i].total_ns;
+  return total;
+}
+
+struct api_data *kernel_profile_api_stats(struct cgpu_info *gpu, struct api_data *root)
+{
+  struct kernel_profile *profile = gpu_profile(gpu);
+  unsigned int i;
+
+  if (!opt_kernel_profile || !profile)
+    return root;
+
+  mutex_lock(&profile_lock);
+  for (i = 0; i < profile->n_stages; i++) {
+    struct kernel_stage_stats *stage = &profile->stages[i];
+    char key[64], buf[32];
+    double avg_us = stage->runs ? (double)stage->total_ns / stage->runs / 1000.0 : 0.0;
+
+    snprintf(key, sizeof(key), "Kernel%u %s Avg us", i, stage_name(profile, i, buf, sizeof(buf)));
+    root = api_add_double(root, key, &avg_us, true);
+  }
+  mutex_unlock(&profile_lock);
+
+  return root;
+}
+
+bool kernel_profile_api_stage(struct cgpu_info *gpu, unsigned int stage_no, struct api_data **root)
+{
+  struct kernel_profile *profile = gpu_profile(gpu);
+  struct kernel_stage_stats stage;
+  char name[32], algorithm[20], histogram[KERNEL_PROFILE_BUCKETS * 24];
+  const char *known;
+  double avg_us, min_us, max_us, total_ms, percent;
+  uint64_t total;
+  size_t used = 0;
+  int b;
+
+  if (!profile)
+    return false;
+
+  mutex_lock(&profile_lock);
+  if (stage_no >= profile->n_stages) {
+    mutex_unlock(&profile_lock);
+    return false;
+  }
+  memcpy(&stage, &profile->stages[stage_no], sizeof(stage));
+  known = stage_name(profile, stage_no, name, sizeof(name));
+  if (known != name)
+    snprintf(name, sizeof(name), "%s", known);
+  snprintf(algorithm, sizeof(algorithm), "%s", profile->algorithm);
+  total = chain_ns(profile);
+  mutex_unlock(&profile_lock);
+
+  avg_us = stage.runs ? (double)stage.total_ns / stage.runs / 1000.0 : 0.0;
+  min_us = (double)stage.min_ns / 1000.0;
+  max_us = (double)stage.max_ns / 1000.0;
+  total_ms = (double)stage.total_ns / 1000000.0;
+  percent = total ? (double)stage.total_ns * 100.0 / total : 0.0;
+
+  /* Non-empty buckets as "<upper bound in us>:<runs>" */
+  histogram[0] = '\0';
+  for (b = 0; b < KERNEL_PROFILE_BUCKETS && used < sizeof(histogram); b++) {
+    if (!stage.buckets[b])
+      continue;
+    used += snprintf(histogram + used, sizeof(histogram) - used, "%s%llu:%"PRIu64,
+                     used ? "," : "", 1ULL << b, stage.buckets[b]);
+  }
+
+  *root = api_add_int(*root, "GPU", &gpu->device_id, false);
+  *root = api_add_string(*root, "Algorithm", algorithm, true);
+  *root = api_add_uint(*root, "Stage", &stage_no, true);
+  *root = api_add_string(*root, "Name", name, true);
+  *root = api_add_uint64(*root, "Runs", &stage.runs, true);
+  *root = api_add_double(*root, "Total ms", &total_ms, true);
+  *root = api_add_double(*root, "Avg us", &avg_us, true);
+  *root = api_add_double(*root, "Min us", &min_us, true);
+  *root = api_add_double(*root, "Max us", &max_us, true);
+  *root = api_add_percent(*root, "Chain %", &percent, true);
+  *root = api_add_string(*root, "Histogram", histogram, true);
+
+  return true;
+}
+
+void kernel_profile_zero(struct cgpu_info *gpu)
+{
+  struct kernel_profile *profile = gpu_profile(gpu);
+
+  if (profile)
+    profile->zero = true;
+}
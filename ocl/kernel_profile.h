@@ -0,0 +1,33 @@
+#ifndef KERNEL_PROFILE_H
+#define KERNEL_PROFILE_H
+
+#ifdef __APPLE_CC__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+#include "miner.h"
+
+/* Kernels per chain that are timed, enough for the 15 stage x15 chains */
+#define KERNEL_PROFILE_MAX_STAGES 32
+/* Histogram buckets, bucket b counts runs shorter than 2^b microseconds */
+#define KERNEL_PROFILE_BUCKETS 24
+
+extern bool opt_kernel_profile;
+
+/* Adds the execution times of one pass over a GPU's kernel chain, from the
+ * events of its enqueues, and releases the events */
+void kernel_profile_record(struct cgpu_info *gpu, cl_event *events, unsigned int n_events);
+
+/* Adds the per stage averages of a GPU to its stats API output */
+struct api_data *kernel_profile_api_stats(struct cgpu_info *gpu, struct api_data *root);
+
+/* Adds the full figures of one stage to root. Returns false once stage is
+ * past the last one profiled on the GPU */
+bool kernel_profile_api_stage(struct cgpu_info *gpu, unsigned int stage, struct api_data **root);
+
+/* Clears a GPU's figures on its next record, without taking any lock */
+void kernel_profile_zero(struct cgpu_info *gpu);
+
+#endif /* KERNEL_PROFILE_H */
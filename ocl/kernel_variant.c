@@ -0,0 +1,232 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "miner.h"
+#include "ocl/kernel_variant.h"
+
+/* Variants picked by the selection pass, a line of algorithm, device name
+ * and variant separated by tabs each. Kept next to the kernel binaries */
+#define KERNEL_VARIANT_FILE "kernel-variants.txt"
+
+struct variant_param {
+  const char *name;   /* In --kernel-variant */
+  const char *define; /* Kernel define */
+  const char *tag;    /* In the binary file name */
+  const char *hash;   /* Hash function whose code it changes */
+  int n_values;
+  int values[KERNEL_VARIANT_MAX_VALUES];
+};
+
+static const struct variant_param params[KERNEL_VARIANT_PARAMS] = {
+  { "groestl-small",   "SPH_SMALL_FOOTPRINT_GROESTL", "gs", "groestl",  2, { 0, 1 } },
+  { "groestl-local",   "GROESTL_LOCAL_TABLES",        "gl", "groestl",  2, { 0, 1 } },
+  { "echo-local",      "ECHO_LOCAL_TABLES",           "el", "echo",     2, { 0, 1 } },
+  { "cubehash-unroll", "SPH_CUBEHASH_UNROLL",         "cu", "cubehash", 4, { 0, 2, 4, 8 } },
+  { "keccak-unroll",   "SPH_KECCAK_UNROLL",           "ku", "keccak",   7, { 0, 1, 2, 4, 6, 8, 12 } },
+  { "luffa-parallel",  "SPH_LUFFA_PARALLEL",          "lp", "luffa",    2, { 0, 1 } },
+  { "hamsi-expand",    "SPH_HAMSI_EXPAND_BIG",        "he", "hamsi",    4, { 1, 2, 4, 8 } },
+  { "hamsi-compact",   "SPH_HAMSI_COMPACT",           "hc", "hamsi",    2, { 0, 1 } },
+};
+
+static bool valid_value(const struct variant_param *param, int value)
+{
+  int i;
+
+  for (i = 0; i < param->n_values; i++) {
+    if (param->values[i] == value)
+      return true;
+  }
+  return false;
+}
+
+char *kernel_variant_parse(const char *spec, struct kernel_variant *variant)
+{
+  char *buf = (char *)alloca(strlen(spec) + 1);
+  char *token, *save = NULL;
+
+  memset(variant, 0, sizeof(struct kernel_variant));
+  strcpy(buf, spec);
+
+  for (token = strtok_r(buf, ":", &save); token; token = strtok_r(NULL, ":", &save)) {
+    char *eq = strchr(token, '=');
+    char *end;
+    long value;
+    int i;
+
+    if (!strcmp(token, "auto")) {
+      variant->autoselect = true;
+      continue;
+    }
+    if (!strcmp(token, "default"))
+      continue;
+    if (!eq)
+      return "Invalid kernel variant, expected name=value";
+
+    *eq = '\0';
+    for (i = 0; i < KERNEL_VARIANT_PARAMS; i++) {
+      if (!strcmp(token, params[i].name))
+        break;
+    }
+    if (i == KERNEL_VARIANT_PARAMS)
+      return "Unknown kernel variant parameter";
+
+    value = strtol(eq + 1, &end, 10);
+    if (end == eq + 1 || *end || !valid_value(&params[i], (int)value))
+      return "Invalid value for kernel variant parameter";
+
+    variant->set |= 1 << i;
+    variant->value[i] = (int8_t)value;
+  }
+
+  return NULL;
+}
+
+void kernel_variant_str(const struct kernel_variant *variant, char *buf, size_t len)
+{
+  size_t used = 0;
+  int i;
+
+  buf[0] = '\0';
+  for (i = 0; i < KERNEL_VARIANT_PARAMS; i++) {
+    if (!(variant->set & (1 << i)))
+      continue;
+    used += snprintf(buf + used, used < len ? len - used : 0, "%s%s=%d",
+                     used ? ":" : "", params[i].name, variant->value[i]);
+  }
+  if (!used)
+    snprintf(buf, len, "default");
+}
+
+void append_kernel_variant_options(build_kernel_data *data, const struct kernel_variant *variant)
+{
+  char buf[64];
+  int i;
+
+  for (i = 0; i < KERNEL_VARIANT_PARAMS; i++) {
+    if (!(variant->set & (1 << i)))
+      continue;
+
+    sprintf(buf, " -D %s=%d", params[i].define, variant->value[i]);
+    strcat(data->compiler_options, buf);
+
+    sprintf(buf, "%s%d", params[i].tag, variant->value[i]);
+    strcat(data->binary_filename, buf);
+  }
+}
+
+int kernel_variant_values(enum kernel_variant_param param, const int **values)
+{
+  *values = params[param].values;
+  return params[param].n_values;
+}
+
+bool kernel_variant_affects(enum kernel_variant_param param, const char *hashes)
+{
+  const char *hash = params[param].hash;
+  size_t len = strlen(hash);
+  const char *p;
+
+  /* hashes is one name or several fused ones separated by '-' */
+  for (p = hashes; *p; p += strcspn(p, "-")) {
+    if (*p == '-')
+      p++;
+    if (!strncmp(p, hash, len) && (p[len] == '-' || !p[len]))
+      return true;
+  }
+  return false;
+}
+
+bool kernel_variant_same_hash(enum kernel_variant_param a, enum kernel_variant_param b)
+{
+  return !strcmp(params[a].hash, params[b].hash);
+}
+
+bool kernel_variant_load(const char *algorithm, const char *device, struct kernel_variant *variant)
+{
+  char line[256];
+  bool ret = false;
+  FILE *fp;
+
+  fp = fopen(KERNEL_VARIANT_FILE, "r");
+  if (!fp)
+    return false;
+
+  while (!ret && fgets(line, sizeof(line), fp)) {
+    char *algo = line, *name, *spec;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    name = strchr(algo, '\t');
+    if (!name)
+      continue;
+    *name++ = '\0';
+    spec = strchr(name, '\t');
+    if (!spec)
+      continue;
+    *spec++ = '\0';
+
+    if (strcmp(algo, algorithm) || strcmp(name, device))
+      continue;
+    if (kernel_variant_parse(spec, variant)) {
+      applog(LOG_WARNING, "Ignoring invalid variant \"%s\" in %s", spec, KERNEL_VARIANT_FILE);
+      continue;
+    }
+    /* What was picked is final */
+    variant->autoselect = false;
+    ret = true;
+  }
+  fclose(fp);
+
+  return ret;
+}
+
+void kernel_variant_save(const char *algorithm, const char *device, const struct kernel_variant *variant)
+{
+  char line[256], spec[128];
+  char *kept = NULL;
+  size_t kept_len = 0;
+  FILE *fp;
+
+  /* Keep the entries of other algorithms and devices */
+  fp = fopen(KERNEL_VARIANT_FILE, "r");
+  if (fp) {
+    size_t prefix = snprintf(spec, sizeof(spec), "%s\t%s\t", algorithm, device);
+
+    while (fgets(line, sizeof(line), fp)) {
+      size_t len = strlen(line);
+
+      if (!strncmp(line, spec, prefix))
+        continue;
+      kept = (char *)realloc(kept, kept_len + len + 1);
+      if (unlikely(!kept))
+        quit(1, "Failed to realloc kept in kernel_variant_save");
+      memcpy(kept + kept_len, line, len + 1);
+      kept_len += len;
+    }
+    fclose(fp);
+  }
+
+  fp = fopen(KERNEL_VARIANT_FILE, "w");
+  if (!fp) {
+    applog(LOG_WARNING, "Unable to open %s for writing", KERNEL_VARIANT_FILE);
+    free(kept);
+    return;
+  }
+  if (kept)
+    fputs(kept, fp);
+  kernel_variant_str(variant, spec, sizeof(spec));
+  fprintf(fp, "%s\t%s\t%s\n", algorithm, device, spec);
+  fclose(fp);
+  free(kept);
+}
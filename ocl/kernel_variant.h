@@ -0,0 +1,39 @@
+#ifndef KERNEL_VARIANT_H
+#define KERNEL_VARIANT_H
+
+#include "miner.h"
+#include "ocl/build_kernel.h"
+
+/* Most values a parameter can take */
+#define KERNEL_VARIANT_MAX_VALUES 8
+
+/* Parses a variant, colon separated name=value pairs such as
+ * "groestl-local=0:keccak-unroll=4", "auto" or "default", into variant.
+ * Returns an error message or NULL */
+extern char *kernel_variant_parse(const char *spec, struct kernel_variant *variant);
+
+/* Formats the parameters set in variant the way kernel_variant_parse()
+ * reads them, "default" when none are */
+extern void kernel_variant_str(const struct kernel_variant *variant, char *buf, size_t len);
+
+/* Adds the defines of the parameters set in variant to the compiler
+ * options, and a tag for them to the binary file name */
+extern void append_kernel_variant_options(build_kernel_data *data, const struct kernel_variant *variant);
+
+/* Values param can take, returns how many */
+extern int kernel_variant_values(enum kernel_variant_param param, const int **values);
+
+/* Whether param changes the code of a chain stage running hashes */
+extern bool kernel_variant_affects(enum kernel_variant_param param, const char *hashes);
+
+/* Whether params a and b change the same hash function, so have to be
+ * benchmarked together */
+extern bool kernel_variant_same_hash(enum kernel_variant_param a, enum kernel_variant_param b);
+
+/* Looks up the variant remembered for algorithm on devices named device */
+extern bool kernel_variant_load(const char *algorithm, const char *device, struct kernel_variant *variant);
+
+/* Remembers the variant picked for algorithm on devices named device */
+extern void kernel_variant_save(const char *algorithm, const char *device, const struct kernel_variant *variant);
+
+#endif /* KERNEL_VARIANT_H */
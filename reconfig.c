@@ -0,0 +1,299 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "miner.h"
+#include "algorithm.h"
+#include "pool.h"
+#include "config_parser.h"
+#include "adl.h"
+#include "driver-opencl.h"
+#include "reconfig.h"
+
+pthread_mutex_t reconfig_lock = PTHREAD_MUTEX_INITIALIZER;
+
+const char *reconfig_level_str(enum reconfig_level level)
+{
+  switch (level) {
+    case RECONFIG_NONE:
+      return "unchanged";
+    case RECONFIG_LIVE:
+      return "live";
+    case RECONFIG_REBUILD:
+      return "kernel rebuild";
+    case RECONFIG_REALLOC:
+      return "kernel rebuild and buffer reallocation";
+  }
+  return "unknown";
+}
+
+void get_device_settings(struct cgpu_info *cgpu, struct device_settings *settings)
+{
+  settings->algorithm = cgpu->algorithm;
+  settings->intensity = cgpu->intensity;
+  settings->xintensity = cgpu->xintensity;
+  settings->rawintensity = cgpu->rawintensity;
+  settings->dynamic = cgpu->dynamic;
+  settings->work_size = cgpu->work_size;
+  settings->opt_lg = cgpu->opt_lg;
+  settings->opt_tc = cgpu->opt_tc;
+  settings->shaders = cgpu->shaders;
+}
+
+enum reconfig_level diff_device_settings(const struct device_settings *from,
+                                         const struct device_settings *to)
+{
+  enum reconfig_level level = RECONFIG_NONE;
+
+  if (from->intensity != to->intensity || from->xintensity != to->xintensity ||
+      from->rawintensity != to->rawintensity || from->dynamic != to->dynamic)
+    level = RECONFIG_LIVE;
+
+  if (!cmp_algorithm((algorithm_t *)&from->algorithm, (algorithm_t *)&to->algorithm) ||
+      from->work_size != to->work_size)
+    level = RECONFIG_REBUILD;
+
+  /* Lookup gap, thread concurrency and the shaders it is planned from only
+   * matter to kernels whose padbuffer they size */
+  if (to->algorithm.rw_buffer_size < 0 &&
+      (level == RECONFIG_REBUILD || from->opt_lg != to->opt_lg ||
+       from->opt_tc != to->opt_tc || from->shaders != to->shaders))
+    level = RECONFIG_REALLOC;
+
+  return level;
+}
+
+unsigned long pool_settings_options(struct pool *pool)
+{
+  unsigned long options = RECONFIG_POOL_OPTIONS;
+
+  if (!empty_string(get_pool_setting(pool->rawintensity, default_profile.rawintensity)))
+    options |= SWITCHER_APPLY_RAWINT;
+  else if (!empty_string(get_pool_setting(pool->xintensity, default_profile.xintensity)))
+    options |= SWITCHER_APPLY_XINT;
+  else if (!empty_string(get_pool_setting(pool->intensity, default_profile.intensity)))
+    options |= SWITCHER_APPLY_INT;
+  else
+    options |= SWITCHER_APPLY_INT8;
+
+  return options;
+}
+
+/* Some setters tokenise their argument, so they get a copy rather than
+ * the string of the pool or profile */
+static void apply_setting(char *(*set)(char *), const char *value)
+{
+  char *arg = strdup(value);
+
+  if (unlikely(!arg))
+    quit(1, "Failed to strdup in apply_setting");
+  set(arg);
+  free(arg);
+}
+
+void apply_pool_settings(struct pool *pool, unsigned long options)
+{
+  const char *opt;
+#ifdef HAVE_ADL
+  int i;
+#endif
+
+  //lookup gap
+  if(opt_isset(options, SWITCHER_APPLY_LG))
+  {
+    if(!empty_string((opt = get_pool_setting(pool->lookup_gap, default_profile.lookup_gap))))
+      apply_setting(set_lookup_gap, opt);
+  }
+
+  //raw intensity from pool
+  if(opt_isset(options, SWITCHER_APPLY_RAWINT))
+  {
+    if(!empty_string((opt = get_pool_setting(pool->rawintensity, default_profile.rawintensity))))
+      set_rawintensity(opt);
+  }
+  //xintensity
+  else if(opt_isset(options, SWITCHER_APPLY_XINT))
+  {
+    if(!empty_string((opt = get_pool_setting(pool->xintensity, default_profile.xintensity))))
+      set_xintensity(opt);
+  }
+  //intensity
+  else if(opt_isset(options, SWITCHER_APPLY_INT))
+  {
+    if(!empty_string((opt = get_pool_setting(pool->intensity, default_profile.intensity))))
+      set_intensity(opt);
+  }
+  //default basic intensity
+  else if(opt_isset(options, SWITCHER_APPLY_INT8))
+  {
+    /* A static default, this runs on every reconfigure and pool switch */
+    default_profile.intensity = "8";
+    set_intensity(default_profile.intensity);
+  }
+
+  //shaders
+  if(opt_isset(options, SWITCHER_APPLY_SHADER))
+  {
+    if(!empty_string((opt = get_pool_setting(pool->shaders, default_profile.shaders))))
+      apply_setting(set_shaders, opt);
+  }
+
+  //thread-concurrency
+  if(opt_isset(options, SWITCHER_APPLY_TC))
+  {
+    if(!empty_string((opt = get_pool_setting(pool->thread_concurrency, default_profile.thread_concurrency))))
+      set_thread_concurrency(opt);
+  }
+
+  //worksize
+  if(opt_isset(options, SWITCHER_APPLY_WORKSIZE))
+  {
+    if(!empty_string((opt = get_pool_setting(pool->worksize, default_profile.worksize))))
+      apply_setting(set_worksize, opt);
+  }
+
+  #ifdef HAVE_ADL
+    //clocks the pool leaves unset are left alone
+    //GPU clock
+    if(opt_isset(options, SWITCHER_APPLY_GPU_ENGINE))
+    {
+      if(!empty_string((opt = get_pool_setting(pool->gpu_engine, default_profile.gpu_engine))))
+        set_gpu_engine(opt);
+      else
+        options &= ~SWITCHER_APPLY_GPU_ENGINE;
+    }
+
+    //GPU memory clock
+    if(opt_isset(options, SWITCHER_APPLY_GPU_MEMCLOCK))
+    {
+      if(!empty_string((opt = get_pool_setting(pool->gpu_memclock, default_profile.gpu_memclock))))
+        set_gpu_memclock(opt);
+      else
+        options &= ~SWITCHER_APPLY_GPU_MEMCLOCK;
+    }
+
+    //GPU fans
+    if(opt_isset(options, SWITCHER_APPLY_GPU_FAN))
+    {
+      if(!empty_string((opt = get_pool_setting(pool->gpu_fan, default_profile.gpu_fan))))
+        set_gpu_fan(opt);
+      else
+        options &= ~SWITCHER_APPLY_GPU_FAN;
+    }
+
+    //GPU powertune
+    if(opt_isset(options, SWITCHER_APPLY_GPU_POWERTUNE))
+    {
+      if(!empty_string((opt = get_pool_setting(pool->gpu_powertune, default_profile.gpu_powertune))))
+        apply_setting(set_gpu_powertune, opt);
+      else
+        options &= ~SWITCHER_APPLY_GPU_POWERTUNE;
+    }
+
+    //GPU vddc
+    if(opt_isset(options, SWITCHER_APPLY_GPU_VDDC))
+    {
+      if(!empty_string((opt = get_pool_setting(pool->gpu_vddc, default_profile.gpu_vddc))))
+        apply_setting(set_gpu_vddc, opt);
+      else
+        options &= ~SWITCHER_APPLY_GPU_VDDC;
+    }
+
+    //apply gpu settings
+    for (i = 0; i < nDevs; i++)
+    {
+      if(opt_isset(options, SWITCHER_APPLY_GPU_ENGINE))
+        set_engineclock(i, gpus[i].min_engine);
+      if(opt_isset(options, SWITCHER_APPLY_GPU_MEMCLOCK))
+        set_memoryclock(i, gpus[i].gpu_memclock);
+      if(opt_isset(options, SWITCHER_APPLY_GPU_FAN))
+        set_fanspeed(i, gpus[i].min_fan);
+      if(opt_isset(options, SWITCHER_APPLY_GPU_POWERTUNE))
+        set_powertune(i, gpus[i].gpu_powertune);
+      if(opt_isset(options, SWITCHER_APPLY_GPU_VDDC))
+        set_vddc(i, gpus[i].gpu_vddc);
+    }
+  #endif
+}
+
+void reconfigure_devices(struct pool *pool, unsigned long options)
+{
+  struct device_settings *from, to;
+  enum reconfig_level level;
+  int i;
+
+  applog(LOG_NOTICE, "Applying pool settings for %s...", isnull(get_pool_name(pool), ""));
+
+  mutex_lock(&reconfig_lock);
+  rd_lock(&devices_lock);
+
+  from = (struct device_settings *)malloc(sizeof(struct device_settings) * MAX(total_devices, 1));
+  if (unlikely(!from))
+    quit(1, "Failed to malloc in reconfigure_devices");
+  for (i = 0; i < total_devices; i++)
+    get_device_settings(devices[i], &from[i]);
+
+  apply_pool_settings(pool, options);
+
+  for (i = 0; i < total_devices; i++) {
+    struct cgpu_info *cgpu = devices[i];
+
+    if (opt_isset(options, SWITCHER_APPLY_ALGO))
+      cgpu->algorithm = pool->algorithm;
+
+    get_device_settings(cgpu, &to);
+    level = diff_device_settings(&from[i], &to);
+    if (level == RECONFIG_NONE)
+      continue;
+
+    cgpu->reconfig_gen++;
+    applog(LOG_INFO, "%s %d: new settings, %s", cgpu->drv->name, cgpu->device_id, reconfig_level_str(level));
+  }
+
+  rd_unlock(&devices_lock);
+  mutex_unlock(&reconfig_lock);
+  free(from);
+
+  rd_lock(&mining_thr_lock);
+  for (i = 0; i < mining_threads; i++) {
+    struct thr_info *thr = mining_thr[i];
+
+    thr->pool_no = pool->pool_no;
+
+    // Necessary because algorithms can have dramatically different diffs
+    if (opt_isset(options, SWITCHER_APPLY_ALGO))
+      thr->cgpu->drv->working_diff = 1;
+  }
+  rd_unlock(&mining_thr_lock);
+
+  // Reset stats (e.g. for working_diff to be set properly in hash_sole_work)
+  if (opt_isset(options, SWITCHER_APPLY_ALGO))
+    zero_stats();
+}
+
+void reconfigure_pool(struct pool *pool)
+{
+  int pool_no = -1;
+
+  rd_lock(&mining_thr_lock);
+  if (mining_thr && mining_threads > 0)
+    pool_no = mining_thr[0]->pool_no;
+  rd_unlock(&mining_thr_lock);
+
+  if (pool_no != pool->pool_no)
+    return;
+
+  reconfigure_devices(pool, pool_settings_options(pool));
+}
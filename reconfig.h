@@ -0,0 +1,72 @@
+#ifndef RECONFIG_H
+#define RECONFIG_H
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "miner.h"
+
+/* How far a device has to go for new settings to take effect, cheapest
+ * first. Only changes of the devices mined on or of threads per device
+ * still restart every mining thread */
+enum reconfig_level {
+  RECONFIG_NONE,
+  /* Read every round: intensity */
+  RECONFIG_LIVE,
+  /* Built into the kernel: algorithm, worksize. The new kernel is built in
+   * the background and swapped in between two rounds */
+  RECONFIG_REBUILD,
+  /* As above for kernels with a padbuffer sized from thread concurrency
+   * and lookup gap, which is only reallocated once the old one is freed
+   * between two rounds */
+  RECONFIG_REALLOC,
+};
+
+/* The settings of a device that pool profiles and config reloads change */
+struct device_settings {
+  algorithm_t algorithm;
+  int intensity;
+  int xintensity;
+  int rawintensity;
+  bool dynamic;
+  size_t work_size;
+  int opt_lg;
+  size_t opt_tc;
+  size_t shaders;
+};
+
+/* Every soft setting a pool has, see pool_settings_options() */
+#define RECONFIG_POOL_OPTIONS (SWITCHER_APPLY_ALGO | SWITCHER_APPLY_LG | SWITCHER_APPLY_SHADER | \
+                               SWITCHER_APPLY_TC | SWITCHER_APPLY_WORKSIZE | SWITCHER_APPLY_GPU_ENGINE | \
+                               SWITCHER_APPLY_GPU_MEMCLOCK | SWITCHER_APPLY_GPU_FAN | \
+                               SWITCHER_APPLY_GPU_POWERTUNE | SWITCHER_APPLY_GPU_VDDC)
+
+/* Held while the settings of devices are written or read */
+extern pthread_mutex_t reconfig_lock;
+
+extern const char *reconfig_level_str(enum reconfig_level level);
+
+/* Copies the settings of cgpu, with reconfig_lock held */
+extern void get_device_settings(struct cgpu_info *cgpu, struct device_settings *settings);
+
+/* What it takes a device to go from settings from to settings to */
+extern enum reconfig_level diff_device_settings(const struct device_settings *from,
+                                                const struct device_settings *to);
+
+/* Options flags for every soft setting of pool, the intensity picked the
+ * way it is at startup */
+extern unsigned long pool_settings_options(struct pool *pool);
+
+/* Writes the soft settings of pool that options flags to the devices */
+extern void apply_pool_settings(struct pool *pool, unsigned long options);
+
+/* Applies the soft settings of pool that options flags without stopping
+ * the mining threads: each device is told how far it has to go and its
+ * threads catch up between two rounds, the others keep hashing */
+extern void reconfigure_devices(struct pool *pool, unsigned long options);
+
+/* Applies pool again after its profile or the config file changed, if it
+ * is the pool the devices are set up for */
+extern void reconfigure_pool(struct pool *pool);
+
+#endif /* RECONFIG_H */
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "miner.h"
+#include "adl.h"
+#include "sensors.h"
+#include "util.h"
+
+/* Milliseconds between samples of every device */
+int opt_sensor_interval = 1000;
+
+/* Snapshot of one device. The sampling thread is the only writer: seq is
+ * odd while it updates reading, so readers copy it without a lock and try
+ * again when seq was odd or changed under them */
+struct sensor_slot {
+  volatile unsigned int seq;
+  struct gpu_sensors reading;
+};
+
+static struct sensor_slot slots[MAX_GPUDEVICES];
+
+#ifdef HAVE_ADL
+static bool adl_available(int gpu)
+{
+  return adl_active && gpus[gpu].has_adl;
+}
+
+static bool adl_read(int gpu, struct gpu_sensors *sensors)
+{
+  if (!gpu_stats(gpu, &sensors->temp, &sensors->engineclock, &sensors->memclock, &sensors->vddc,
+                 &sensors->activity, &sensors->fanspeed, &sensors->fanpercent, &sensors->powertune))
+    return false;
+  /* Read once more on its own, which notices fans that stopped reporting
+   * due to driver corruption */
+  if (sensors->fanpercent == -1)
+    sensors->fanpercent = gpu_fanpercent(gpu);
+  return true;
+}
+#endif
+
+static struct timeval mock_start;
+
+static bool mock_available(int __maybe_unused gpu)
+{
+  return true;
+}
+
+/* Made up readings for machines without the hardware, the temperature
+ * swinging around 70C every two minutes with the fan following it, and
+ * activity only while the device has hashed in the last few seconds */
+static bool mock_read(int gpu, struct gpu_sensors *sensors)
+{
+  struct cgpu_info *cgpu = &gpus[gpu];
+  struct timeval now;
+  double t;
+
+  cgtime(&now);
+  if (!mock_start.tv_sec)
+    mock_start = now;
+  t = tdiff(&now, &mock_start);
+
+  sensors->temp = 70 + 8 * sin(t * M_PI / 60 + gpu);
+  sensors->fanpercent = 50 + (int)((sensors->temp - 70) * 3);
+  sensors->fanspeed = sensors->fanpercent * 40;
+  sensors->engineclock = 1000;
+  sensors->memclock = 1250;
+  sensors->vddc = 1.15;
+  sensors->activity = cgpu->thr && cgpu->thr[0] && now.tv_sec - cgpu->thr[0]->last.tv_sec < 5 ? 99 : 0;
+  sensors->powertune = 0;
+  return true;
+}
+
+static bool none_available(int __maybe_unused gpu)
+{
+  return false;
+}
+
+static bool none_read(int __maybe_unused gpu, struct gpu_sensors __maybe_unused *sensors)
+{
+  return false;
+}
+
+static const struct gpu_sensor_backend backends[] = {
+#ifdef HAVE_ADL
+  { "adl",  true,  adl_available,  adl_read },
+#endif
+  { "none", false, none_available, none_read },
+  { "mock", false, mock_available, mock_read },
+};
+
+/* adl when built with it, none otherwise */
+static const struct gpu_sensor_backend *backend = &backends[0];
+
+char *set_sensor_backend(const char *arg)
+{
+  unsigned int i;
+
+  for (i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+    if (!strcasecmp(arg, backends[i].name)) {
+      backend = &backends[i];
+      return NULL;
+    }
+  }
+  return "Invalid sensor backend";
+}
+
+bool gpu_sensors_available(int gpu)
+{
+  return backend->available(gpu);
+}
+
+bool gpu_sensors_hardware(void)
+{
+  return backend->hardware;
+}
+
+bool gpu_sensors_get(int gpu, struct gpu_sensors *sensors)
+{
+  struct sensor_slot *slot;
+  struct timeval now;
+  unsigned int seq;
+
+  if (gpu < 0 || gpu >= nDevs)
+    return false;
+  slot = &slots[gpu];
+
+  do {
+    seq = slot->seq;
+    __sync_synchronize();
+    memcpy(sensors, &slot->reading, sizeof(struct gpu_sensors));
+    __sync_synchronize();
+  } while ((seq & 1) || seq != slot->seq);
+
+  /* Never sampled */
+  if (!seq)
+    return false;
+
+  /* Reads of the device keep failing, as after a hang */
+  cgtime(&now);
+  return ms_tdiff(&now, &sensors->tv) <= 2 * opt_sensor_interval;
+}
+
+static void sample_gpu(int gpu)
+{
+  struct sensor_slot *slot = &slots[gpu];
+  struct gpu_sensors sensors;
+
+  if (!backend->available(gpu))
+    return;
+
+  memset(&sensors, 0, sizeof(sensors));
+  if (!backend->read(gpu, &sensors))
+    return;
+  cgtime(&sensors.tv);
+  gpus[gpu].temp = sensors.temp;
+
+  slot->seq++;
+  __sync_synchronize();
+  memcpy(&slot->reading, &sensors, sizeof(struct gpu_sensors));
+  __sync_synchronize();
+  slot->seq++;
+}
+
+void *gpu_sensors_thread(void __maybe_unused *userdata)
+{
+  RenameThread("Sensors");
+
+  while (1) {
+    int gpu;
+
+    /* Only cancelled between passes, never while holding the ADL lock */
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+    for (gpu = 0; gpu < nDevs; gpu++)
+      sample_gpu(gpu);
+    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+
+    cgsleep_ms(opt_sensor_interval);
+    pthread_testcancel();
+  }
+
+  return NULL;
+}
@@ -0,0 +1,51 @@
+#ifndef SENSORS_H
+#define SENSORS_H
+
+#include <stdbool.h>
+#include <sys/time.h>
+
+/* GPU sensor readings, sampled by a thread of their own so that slow
+ * driver calls hold up neither the watchdog nor API replies. Readers get
+ * the last snapshot of a device, -1 marks a value the device does not
+ * report */
+struct gpu_sensors {
+  float temp;
+  int engineclock;
+  int memclock;
+  float vddc;
+  int activity;
+  int fanspeed;
+  int fanpercent;
+  int powertune;
+  struct timeval tv; /* When sampled */
+};
+
+/* Where readings come from, picked with --sensor-backend */
+struct gpu_sensor_backend {
+  const char *name;
+  /* Readings come from the devices themselves, so fan and clock
+   * autotuning may act on them */
+  bool hardware;
+  bool (*available)(int gpu);
+  bool (*read)(int gpu, struct gpu_sensors *sensors);
+};
+
+extern int opt_sensor_interval;
+
+extern char *set_sensor_backend(const char *arg);
+
+/* Whether the backend has readings for gpu */
+extern bool gpu_sensors_available(int gpu);
+
+/* Whether the backend reads the devices' own sensors */
+extern bool gpu_sensors_hardware(void);
+
+/* Copies the last snapshot of gpu. False for an id that is not a GPU,
+ * until it was sampled once and once the snapshot is older than two
+ * --sensor-interval periods */
+extern bool gpu_sensors_get(int gpu, struct gpu_sensors *sensors);
+
+/* Samples every device each --sensor-interval milliseconds */
+extern void *gpu_sensors_thread(void *userdata);
+
+#endif /* SENSORS_H */
@@ -53,8 +53,19 @@ char *curly = ":D";
 #include "miner.h"
 #include "findnonce.h"
 #include "adl.h"
+#include "sensors.h"
+#include "reconfig.h"
 #include "driver-opencl.h"
+#include "ocl/kernel_profile.h"
+#include "ocl/gpu_nonce2.h"
+#include "driver-cpu.h"
+#include "benchmark.h"
+#include "affinity.h"
+#include "trace.h"
+#include "share_table.h"
+#include "stratum_record.h"
 #include "bench_block.h"
+#include "lowmem.h"
 
 #include "algorithm.h"
 #include "pool.h"
@@ -126,8 +137,8 @@ static bool opt_submit_stale = true;
 int opt_shares;
 bool opt_fail_only;
 int opt_fail_switch_delay = 60;
+int opt_hot_standby;
 static bool opt_fix_protocol;
-static bool opt_lowmem;
 static bool opt_morenotices;
 bool opt_autofan;
 bool opt_autoengine;
@@ -165,6 +176,8 @@ struct thr_info **mining_thr = NULL;
 static int gwsched_thr_id;
 static int watchpool_thr_id;
 static int watchdog_thr_id;
+static int sensors_thr_id;
+static int status_thr_id;
 #ifdef HAVE_CURSES
 static int input_thr_id;
 #endif
@@ -224,6 +237,12 @@ unsigned int found_blocks;
 
 unsigned int local_work;
 unsigned int total_go, total_ro;
+/* Failovers from a dead current pool, and the time from the pool being
+ * declared dead until work from another pool was staged */
+unsigned int total_failovers;
+double last_failover_gap, max_failover_gap;
+static struct pool *failover_from;
+static struct timeval failover_start;
 
 struct pool **pools;
 static struct pool *currentpool = NULL;
@@ -273,19 +292,6 @@ static struct block *blocks = NULL;
 
 int swork_id;
 
-/* For creating a hash database of stratum shares submitted that have not had
- * a response yet */
-struct stratum_share {
-  UT_hash_handle hh;
-  bool block;
-  struct work *work;
-  int id;
-  time_t sshare_time;
-  time_t sshare_sent;
-};
-
-static struct stratum_share *stratum_shares = NULL;
-
 char *opt_socks_proxy = NULL;
 
 #if defined(unix) || defined(__APPLE__)
@@ -534,6 +540,7 @@ struct pool *add_pool(void)
   mutex_init(&pool->stratum_lock);
   cglock_init(&pool->gbt_lock);
   INIT_LIST_HEAD(&pool->curlring);
+  pool->share_table = share_table_new();
 
   /* Make sure the pool doesn't think we've been idle since time 0 */
   pool->tv_idle.tv_sec = ~0UL;
@@ -634,6 +641,25 @@ char *set_int_1_to_10(const char *arg, int *i)
   return set_int_range(arg, i, 1, 10);
 }
 
+static char *set_gpu_nonce2(const char *arg, int *i)
+{
+  return set_int_range(arg, i, 0, GPU_NONCE2_MAX);
+}
+
+/* The share timer wheel holds at most SHARE_TIMEOUT_MAX seconds */
+static char *set_share_timeout(const char *arg, int *i)
+{
+  static char err_buf[64];
+  int old = *i;
+
+  if (set_int_range(arg, i, 0, SHARE_TIMEOUT_MAX)) {
+    *i = old;
+    snprintf(err_buf, sizeof(err_buf), "Share timeout must be 0 to %d seconds", SHARE_TIMEOUT_MAX);
+    return err_buf;
+  }
+  return NULL;
+}
+
 void get_intrange(char *arg, int *val1, int *val2)
 {
   if (sscanf(arg, "%d-%d", val1, val2) == 1)
@@ -879,6 +905,16 @@ static char *set_pool_nfactor(const char *arg)
   return NULL;
 }
 
+static char *set_pool_nfactor_start(const char *arg)
+{
+  struct pool *pool = get_current_pool();
+
+  applog(LOG_DEBUG, "Setting pool %i adaptive N-factor chain start to %s", pool->pool_no, arg);
+  set_algorithm_nfactor_start(&pool->algorithm, (const uint32_t) strtoul(arg, NULL, 10));
+
+  return NULL;
+}
+
 static char *set_pool_name(char *arg)
 {
   struct pool *pool = get_current_pool();
@@ -1250,6 +1286,9 @@ char *set_difficulty_multiplier(char *arg)
 
 /* These options are available from config file or commandline */
 struct opt_table opt_config_table[] = {
+  OPT_WITH_ARG("--affinity",
+         set_affinity, NULL, NULL,
+         "Pin thread classes, e.g. miner=auto,verify=node0,stratum=0-1,api=any"),
   OPT_WITH_ARG("--algorithm|--kernel|-k",
          set_default_algorithm, NULL, NULL,
          "Set mining algorithm and most common defaults, default: scrypt"),
@@ -1297,11 +1336,20 @@ struct opt_table opt_config_table[] = {
   OPT_WITHOUT_ARG("--balance",
       set_balance, &pool_strategy,
       "Change multipool strategy from failover to even share balance"),
+  OPT_WITHOUT_ARG("--benchmark",
+      opt_set_bool, &opt_benchmark,
+      "Run offline on synthesised work and report pipeline timings at exit"),
+  OPT_WITH_ARG("--benchmark-diff",
+      set_benchmark_diff, NULL, NULL,
+      "Share difficulty of --benchmark work (default: 1)"),
 #ifdef HAVE_CURSES
   OPT_WITHOUT_ARG("--compact",
       opt_set_bool, &opt_compact,
       "Use compact display without per device statistics"),
 #endif
+  OPT_WITH_ARG("--cpu-threads",
+      set_int_0_to_9999, opt_show_intval, &opt_cpu_threads,
+      "Number of CPU mining threads, each pinned to its own core (0 disables CPU mining)"),
   OPT_WITHOUT_ARG("--debug|-D",
       enable_debug, &opt_debug,
       "Enable debug output"),
@@ -1335,6 +1383,9 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--gpu-dyninterval",
       set_int_1_to_65535, opt_show_intval, &opt_dynamic_interval,
       "Set the refresh interval in ms for GPUs using dynamic intensity"),
+  OPT_WITH_ARG("--gpu-nonce2",
+      set_gpu_nonce2, opt_show_intval, &opt_gpu_nonce2,
+      "Nonce2 values per stratum work item whose headers the GPU derives, 0 to derive all on the host"),
   OPT_WITH_ARG("--gpu-platform",
       set_int_0_to_9999, opt_show_intval, &opt_platform_id,
       "Select OpenCL platform ID to use for GPU mining"),
@@ -1381,6 +1432,9 @@ struct opt_table opt_config_table[] = {
   OPT_WITHOUT_ARG("--hamsi-short",
       opt_set_bool, &opt_hamsi_short,
       "Set SPH_HAMSI_SHORT for X13 derived algorithms (Can give better hashrate for some GPUs)"),
+  OPT_WITH_ARG("--hot-standby",
+      set_int_0_to_9999, opt_show_intval, &opt_hot_standby,
+      "Number of backup stratum pools to keep connected and subscribed for instant failover"),
 #ifdef HAVE_CURSES
   OPT_WITHOUT_ARG("--incognito",
       opt_set_bool, &opt_incognito,
@@ -1409,9 +1463,18 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--kernel-path|-K",
       opt_set_charp, opt_show_charp, &opt_kernel_path,
       "Specify a path to where kernel files are"),
+  OPT_WITHOUT_ARG("--kernel-profile",
+      opt_set_bool, &opt_kernel_profile,
+      "Time every kernel of each GPU's chain, see the kernelprofile API command"),
+  OPT_WITH_ARG("--kernel-variant",
+      set_kernel_variant, NULL, NULL,
+      "Build variant of split kernels per GPU, name=value pairs separated by ':', 'auto' to benchmark the rest, comma separated"),
   OPT_WITHOUT_ARG("--load-balance",
       set_loadbalance, &pool_strategy,
       "Change multipool strategy from failover to quota based balance"),
+  OPT_WITHOUT_ARG("--lock-stats",
+      opt_set_bool, &opt_lock_stats,
+      "Record lock contention per lock call site for the lockstats API command"),
   OPT_WITH_ARG("--log|-l",
       set_int_0_to_9999, opt_show_intval, &opt_log_interval,
       "Interval in seconds between log output"),
@@ -1420,7 +1483,7 @@ struct opt_table opt_config_table[] = {
       "Show date on every log line"),
   OPT_WITHOUT_ARG("--lowmem",
       opt_set_bool, &opt_lowmem,
-      "Minimise caching of shares for low memory applications"),
+      "Bound memory use with preallocated object pools and minimal share caching"),
 #if defined(unix) || defined(__APPLE__)
   OPT_WITH_ARG("--monitor|-m",
       opt_set_charp, NULL, &opt_stderr_cmd,
@@ -1435,6 +1498,9 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--nfactor",
       set_default_nfactor, NULL, NULL,
       "Override default scrypt N-factor parameter."),
+  OPT_WITH_ARG("--nfactor-start",
+      set_default_nfactor_start, NULL, NULL,
+      "Chain start time of the adaptive N-factor schedule, N-factor is fixed if unset"),
 #ifdef HAVE_ADL
   OPT_WITHOUT_ARG("--no-adl",
       opt_set_bool, &opt_noadl,
@@ -1503,6 +1569,9 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--pool-nfactor",
       set_pool_nfactor, NULL, NULL,
       "Set N-factor for pool"),
+  OPT_WITH_ARG("--pool-nfactor-start",
+      set_pool_nfactor_start, NULL, NULL,
+      "Set adaptive N-factor chain start time for pool"),
   OPT_WITH_ARG("--pool-profile",
       set_pool_profile, NULL, NULL,
       "Profile to use with the pool"),
@@ -1564,6 +1633,9 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--profile-nfactor",
       set_profile_nfactor, NULL, NULL,
       "Set N-factor for profile"),
+  OPT_WITH_ARG("--profile-nfactor-start",
+      set_profile_nfactor_start, NULL, NULL,
+      "Set adaptive N-factor chain start time for profile"),
   OPT_WITH_ARG("--profile-rawintensity",
       set_profile_rawintensity, NULL, NULL,
       "Raw intensity of GPU scanning (profile-specific)"),
@@ -1622,6 +1694,15 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--shaders",
       set_default_shaders, NULL, NULL,
       "GPU shaders per card for tuning scrypt, comma separated"),
+  OPT_WITH_ARG("--share-timeout",
+      set_share_timeout, opt_show_intval, &opt_share_timeout,
+      "Seconds to wait for a pool to answer a stratum share before counting it as lost, 0 waits until disconnect"),
+  OPT_WITH_ARG("--sensor-backend",
+      set_sensor_backend, NULL, NULL,
+      "Where GPU temperature, fan and clock readings come from: adl, mock or none"),
+  OPT_WITH_ARG("--sensor-interval",
+      set_int_1_to_65535, opt_show_intval, &opt_sensor_interval,
+      "Milliseconds between GPU sensor samples"),
   OPT_WITH_ARG("--sharelog",
       set_sharelog, NULL, NULL,
       "Append share log to file"),
@@ -1637,6 +1718,9 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--state|--pool-state",
       set_pool_state, NULL, NULL,
       "Specify pool state at startup (default: enabled)"),
+  OPT_WITH_ARG("--stratum-record",
+      opt_set_charp, NULL, &opt_stratum_record,
+      "Record each pool's stratum session to <arg>-poolN.srec for tools/stratum-replay"),
   OPT_WITH_ARG("--switcher-mode",
       set_switcher_mode, NULL, NULL,
       "Algorithm/gpu settings switcher mode."),
@@ -1680,6 +1764,9 @@ struct opt_table opt_config_table[] = {
   OPT_WITH_ARG("--thread-concurrency",
       set_default_thread_concurrency, NULL, NULL,
       "Set GPU thread concurrency for scrypt mining, comma separated"),
+  OPT_WITH_ARG("--trace",
+      set_trace_file, NULL, NULL,
+      "Record a timeline of work, kernel, share and stratum events and write it to <arg> as Chrome trace JSON on exit"),
   OPT_WITH_ARG("--url|--pool-url|-o",
       set_url, NULL, NULL,
       "URL for bitcoin JSON-RPC server"),
@@ -1795,10 +1882,10 @@ static void calc_midstate(struct work *work)
 
 static struct work *make_work(void)
 {
-  struct work *w = (struct work *)calloc(1, sizeof(struct work));
+  struct work *w = (struct work *)lowmem_alloc(LOWMEM_WORK);
 
   if (unlikely(!w))
-    quit(1, "Failed to calloc work in make_work");
+    quit(1, "Failed to allocate work in make_work");
 
   cg_wlock(&control_lock);
   w->id = total_work++;
@@ -1815,6 +1902,7 @@ void clean_work(struct work *w)
   free(w->ntime);
   free(w->coinbase);
   free(w->nonce1);
+  free(w->n2_job);
   memset(w, 0, sizeof(struct work));
 }
 
@@ -1823,7 +1911,7 @@ void clean_work(struct work *w)
 void free_work(struct work *w)
 {
   clean_work(w);
-  free(w);
+  lowmem_free(LOWMEM_WORK, w);
 }
 
 static void calc_diff(struct work *work, double known);
@@ -2075,6 +2163,7 @@ static bool gbt_decode(struct pool *pool, json_t *res_val)
   cal_len = pool->coinbase_len + 1;
   align_len(&cal_len);
   free(pool->coinbase);
+  pool->swork.cb_alloc = 0;
   pool->coinbase = (unsigned char *)calloc(cal_len, 1);
   if (unlikely(!pool->coinbase))
     quit(1, "Failed to calloc pool coinbase in gbt_decode");
@@ -2137,7 +2226,7 @@ static bool getwork_decode(json_t *res_val, struct work *work)
 /* Returns whether the pool supports local work generation or not. */
 static bool pool_localgen(struct pool *pool)
 {
-  return (pool->has_stratum || pool->has_gbt);
+  return (pool->has_stratum || pool->has_gbt || opt_benchmark);
 }
 
 static bool work_decode(struct pool *pool, struct work *work, json_t *val)
@@ -2223,6 +2312,13 @@ static int devcursor, logstart, logcursor;
 #ifdef HAVE_CURSES
 /* statusy is where the status window goes up to in cases where it won't fit at startup */
 static int statusy;
+
+/* Device rows as last drawn, only rows that changed are drawn again
+ * unless the whole status window needs redrawing */
+#define DEVROW_SIZ 512
+static char (*dev_rows)[DEVROW_SIZ];
+static int dev_rows_n;
+static bool status_redraw = true;
 #endif
 
 extern struct cgpu_info gpus[MAX_GPUDEVICES]; /* Maximum number apparently possible */
@@ -2336,18 +2432,28 @@ double cgpu_runtime(struct cgpu_info *cgpu)
   return dev_runtime;
 }
 
+/* Copies the hash rate counters of cgpu the miner threads update */
+static void get_dev_hashes(struct cgpu_info *cgpu, double *rolling, double *total_mhashes)
+{
+  mutex_lock(&hash_lock);
+  *rolling = cgpu->rolling;
+  *total_mhashes = cgpu->total_mhashes;
+  mutex_unlock(&hash_lock);
+}
+
 static void get_statline(char *buf, size_t bufsiz, struct cgpu_info *cgpu)
 {
   char displayed_hashes[16], displayed_rolling[16];
-  double dev_runtime, wu;
+  double dev_runtime, wu, rolling, total_mhashes;
   uint64_t dh64, dr64;
 
   dev_runtime = cgpu_runtime(cgpu);
 
   wu = cgpu->diff1 / dev_runtime * 60.0;
 
-  dh64 = (double)cgpu->total_mhashes / dev_runtime * 1000000ull;
-  dr64 = (double)cgpu->rolling * 1000000ull;
+  get_dev_hashes(cgpu, &rolling, &total_mhashes);
+  dh64 = (double)total_mhashes / dev_runtime * 1000000ull;
+  dr64 = (double)rolling * 1000000ull;
   suffix_string(dh64, displayed_hashes, sizeof(displayed_hashes), 4);
   suffix_string(dr64, displayed_rolling, sizeof(displayed_rolling), 4);
 
@@ -2460,12 +2566,12 @@ static int dev_width;
 static void curses_print_devstatus(struct cgpu_info *cgpu, int count)
 {
   static int drwidth = 5, hwwidth = 1, wuwidth = 1;
-  char logline[256];
+  char row[DEVROW_SIZ];
   char displayed_hashes[16], displayed_rolling[16];
   float reject_pct = 0.0;
   uint64_t dh64, dr64;
   struct timeval now;
-  double dev_runtime, wu;
+  double dev_runtime, wu, rolling, total_mhashes;
 
   /* Do not print if window vertical size too small. */
   if (devcursor + count > LINES - 2)
@@ -2487,27 +2593,25 @@ static void curses_print_devstatus(struct cgpu_info *cgpu, int count)
   cgpu->utility = cgpu->accepted / dev_runtime * 60;
   wu = cgpu->diff1 / dev_runtime * 60;
 
-  wmove(statuswin, devcursor + count, 0);
-  cg_wprintw(statuswin, "%s %*d: ", cgpu->drv->name, dev_width, cgpu->device_id);
-  logline[0] = '\0';
-  cgpu->drv->get_statline_before(logline, sizeof(logline), cgpu);
-  cg_wprintw(statuswin, "%s", logline);
+  snprintf(row, sizeof(row), "%s %*d: ", cgpu->drv->name, dev_width, cgpu->device_id);
+  cgpu->drv->get_statline_before(row, sizeof(row), cgpu);
 
-  dh64 = (double)cgpu->total_mhashes / dev_runtime * 1000000ull;
-  dr64 = (double)cgpu->rolling * 1000000ull;
+  get_dev_hashes(cgpu, &rolling, &total_mhashes);
+  dh64 = (double)total_mhashes / dev_runtime * 1000000ull;
+  dr64 = (double)rolling * 1000000ull;
   suffix_string(dh64, displayed_hashes, sizeof(displayed_hashes), 4);
   suffix_string(dr64, displayed_rolling, sizeof(displayed_rolling), 4);
 
   if (cgpu->status == LIFE_DEAD)
-    cg_wprintw(statuswin, "DEAD  ");
+    tailsprintf(row, sizeof(row), "DEAD  ");
   else if (cgpu->status == LIFE_SICK)
-    cg_wprintw(statuswin, "SICK  ");
+    tailsprintf(row, sizeof(row), "SICK  ");
   else if (cgpu->deven == DEV_DISABLED)
-    cg_wprintw(statuswin, "OFF   ");
+    tailsprintf(row, sizeof(row), "OFF   ");
   else if (cgpu->deven == DEV_RECOVER)
-    cg_wprintw(statuswin, "REST  ");
+    tailsprintf(row, sizeof(row), "REST  ");
   else
-    cg_wprintw(statuswin, "%6s", displayed_rolling);
+    tailsprintf(row, sizeof(row), "%6s", displayed_rolling);
 
   if ((cgpu->diff_accepted + cgpu->diff_rejected) > 0)
     reject_pct = (cgpu->diff_rejected / (cgpu->diff_accepted + cgpu->diff_rejected)) * 100;
@@ -2515,15 +2619,25 @@ static void curses_print_devstatus(struct cgpu_info *cgpu, int count)
   adj_width(cgpu->hw_errors, &hwwidth);
   adj_width(wu, &wuwidth);
 
-  cg_wprintw(statuswin, "/%6sh/s | R:%*.1f%% HW:%*d WU:%*.3f/m",
+  tailsprintf(row, sizeof(row), "/%6sh/s | R:%*.1f%% HW:%*d WU:%*.3f/m",
       displayed_hashes,
       drwidth, reject_pct,
       hwwidth, cgpu->hw_errors,
       wuwidth + 2, wu);
-  logline[0] = '\0';
-  cgpu->drv->get_statline(logline, sizeof(logline), cgpu);
-  cg_wprintw(statuswin, "%s", logline);
+  cgpu->drv->get_statline(row, sizeof(row), cgpu);
+
+  if (count >= dev_rows_n) {
+    dev_rows = realloc(dev_rows, sizeof(*dev_rows) * (count + 1));
+    if (unlikely(!dev_rows))
+      quit(1, "Failed to realloc dev_rows in curses_print_devstatus");
+    for (; dev_rows_n <= count; dev_rows_n++)
+      dev_rows[dev_rows_n][0] = '\0';
+  } else if (!status_redraw && !strcmp(dev_rows[count], row))
+    return;
+  strcpy(dev_rows[count], row);
 
+  wmove(statuswin, devcursor + count, 0);
+  wprintw(statuswin, "%s", row);
   wclrtoeol(statuswin);
 }
 #endif
@@ -2546,6 +2660,7 @@ static inline void change_logwinsize(void)
     logcursor = statusy + 1;
     mvwin(logwin, logcursor, 0);
     wresize(statuswin, statusy, x);
+    status_redraw = true;
   }
 
   y -= logcursor;
@@ -2563,6 +2678,7 @@ static void check_winsizes(void)
     int y, x;
 
     erase();
+    status_redraw = true;
     x = getmaxx(statuswin);
     if (logstart > LINES - 2)
       statusy = LINES - 2;
@@ -3361,6 +3477,16 @@ static void __kill_work(void)
   thr = &control_thr[watchdog_thr_id];
   kill_timeout(thr);
 
+  forcelog(LOG_DEBUG, "Killing off sensors thread");
+  /* Kill the sensors thread */
+  thr = &control_thr[sensors_thr_id];
+  kill_timeout(thr);
+
+  forcelog(LOG_DEBUG, "Killing off status thread");
+  /* Kill the status thread */
+  thr = &control_thr[status_thr_id];
+  kill_timeout(thr);
+
   forcelog(LOG_DEBUG, "Shutting down mining threads");
   rd_lock(&mining_thr_lock);
   for (i = 0; i < mining_threads; i++) {
@@ -3467,7 +3593,7 @@ retry:
     recruited = true;
   } else if (list_empty(&pool->curlring)) {
     if (pool->curls >= curl_limit) {
-      pthread_cond_wait(&pool->cr_cond, &pool->pool_lock);
+      cond_wait(&pool->cr_cond, &pool->pool_lock);
       goto retry;
     } else {
       recruit_curl(pool);
@@ -3727,6 +3853,14 @@ static void _copy_work(struct work *work, const struct work *base_work, int noff
   }
   if (base_work->coinbase)
     work->coinbase = strdup(base_work->coinbase);
+  if (base_work->n2_job) {
+    size_t len = base_work->n2_cb_len + 32 * (size_t)base_work->n2_merkles;
+
+    work->n2_job = (unsigned char *)malloc(len);
+    if (unlikely(!work->n2_job))
+      quit(1, "Failed to malloc n2_job in _copy_work");
+    memcpy(work->n2_job, base_work->n2_job, len);
+  }
 }
 
 /* Generates a copy of an existing work struct, creating fresh heap allocations
@@ -3758,6 +3892,12 @@ static void pool_died(struct pool *pool)
     cgtime(&pool->tv_idle);
     if (pool == current_pool()) {
       applog(LOG_WARNING, "%s not responding!", get_pool_name(pool));
+      mutex_lock(&stats_lock);
+      if (!failover_from) {
+        failover_from = pool;
+        failover_start = pool->tv_idle;
+      }
+      mutex_unlock(&stats_lock);
       switch_pools(NULL);
     } else
       applog(LOG_INFO, "%s failed to return work", get_pool_name(pool));
@@ -4053,6 +4193,7 @@ static void *restart_thread(void __maybe_unused *arg)
   int i;
 
   pthread_detach(pthread_self());
+  TRACE_BEGIN("restart_threads");
 
   /* Artificially set the lagging flag to avoid pool not providing work
    * fast enough  messages after every long poll */
@@ -4076,6 +4217,7 @@ static void *restart_thread(void __maybe_unused *arg)
   mutex_lock(&restart_lock);
   pthread_cond_broadcast(&restart_cond);
   mutex_unlock(&restart_lock);
+  TRACE_END("restart_threads");
 
   return NULL;
 }
@@ -4086,6 +4228,7 @@ static void restart_threads(void)
 {
   pthread_t rthread;
 
+  TRACE_INSTANT("restart");
   if (unlikely(pthread_create(&rthread, NULL, restart_thread, NULL)))
     quit(1, "Failed to create restart thread");
 }
@@ -4294,9 +4437,39 @@ static bool hash_push(struct work *work)
   return rc;
 }
 
+/* Closes the failover gap opened in pool_died once another pool's work is
+ * staged. If the dead pool comes back first there was no failover */
+static void failover_staged(struct pool *pool)
+{
+  struct timeval now;
+  struct pool *from;
+  double gap = 0;
+
+  cgtime(&now);
+  mutex_lock(&stats_lock);
+  from = failover_from;
+  if (from && (pool != from || !from->idle)) {
+    failover_from = NULL;
+    if (pool != from) {
+      gap = tdiff(&now, &failover_start);
+      total_failovers++;
+      last_failover_gap = gap;
+      if (gap > max_failover_gap)
+        max_failover_gap = gap;
+    }
+  }
+  mutex_unlock(&stats_lock);
+
+  if (gap > 0)
+    applog(LOG_NOTICE, "Failed over from %s to %s in %.3f seconds",
+           get_pool_name(from), get_pool_name(pool), gap);
+}
+
 static void stage_work(struct work *work)
 {
   applog(LOG_DEBUG, "Pushing work from %s to hash queue", get_pool_name(work->pool));
+  if (unlikely(failover_from))
+    failover_staged(work->pool);
   work->work_block = work_block;
   test_work_current(work);
   work->pool->works++;
@@ -4867,6 +5040,7 @@ static void *api_thread(void *userdata)
   pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
 
   RenameThread("API");
+  affinity_apply(AFFINITY_API, NULL);
 
   set_lowprio();
   api(api_thr_id);
@@ -4906,9 +5080,6 @@ static void hashmeter(int thr_id, struct timeval *diff,
   double local_secs;
   static double local_mhashes_done = 0;
   double local_mhashes;
-  bool showlog = false;
-  char displayed_hashes[16], displayed_rolling[16];
-  uint64_t dh64, dr64;
   struct thr_info *thr = NULL;
 
   local_mhashes = (double)hashes_done / 1000000.0;
@@ -4941,28 +5112,6 @@ static void hashmeter(int thr_id, struct timeval *diff,
     decay_time(&cgpu->rolling, thread_rolling, secs);
     cgpu->total_mhashes += local_mhashes;
     mutex_unlock(&hash_lock);
-
-    // If needed, output detailed, per-device stats
-    if (want_per_device_stats) {
-      struct timeval now;
-      struct timeval elapsed;
-
-      cgtime(&now);
-      timersub(&now, &thr->cgpu->last_message_tv, &elapsed);
-      if (opt_log_interval <= elapsed.tv_sec) {
-        struct cgpu_info *cgpu = thr->cgpu;
-        char logline[255];
-
-        cgpu->last_message_tv = now;
-
-        get_statline(logline, sizeof(logline), cgpu);
-        if (!curses_active) {
-          printf("%s          \r", logline);
-          fflush(stdout);
-        } else
-          applog(LOG_INFO, "%s", logline);
-      }
-    }
   }
 
   /* Totals are updated by all threads so can race without locking */
@@ -4975,7 +5124,6 @@ static void hashmeter(int thr_id, struct timeval *diff,
   /* Only update with opt_log_interval */
   if (total_diff.tv_sec < opt_log_interval)
     goto out_unlock;
-  showlog = true;
   cgtime(&total_tv_end);
 
   local_secs = (double)total_diff.tv_sec + ((double)total_diff.tv_usec / 1000000.0);
@@ -4986,29 +5134,9 @@ static void hashmeter(int thr_id, struct timeval *diff,
   total_secs = (double)total_diff.tv_sec +
     ((double)total_diff.tv_usec / 1000000.0);
 
-  dh64 = (double)total_mhashes_done / total_secs * 1000000ull;
-  dr64 = (double)total_rolling * 1000000ull;
-  suffix_string(dh64, displayed_hashes, sizeof(displayed_hashes), 4);
-  suffix_string(dr64, displayed_rolling, sizeof(displayed_rolling), 4);
-
-  snprintf(statusline, sizeof(statusline),
-    "%s(%ds):%s (avg):%sh/s | A:%.0f  R:%.0f  HW:%d  WU:%.3f/m",
-    want_per_device_stats ? "ALL " : "",
-    opt_log_interval, displayed_rolling, displayed_hashes,
-    total_diff_accepted, total_diff_rejected, hw_errors,
-    total_diff1 / total_secs * 60);
-
   local_mhashes_done = 0;
 out_unlock:
   mutex_unlock(&hash_lock);
-
-  if (showlog) {
-    if (!curses_active) {
-      printf("%s          \r", statusline);
-      fflush(stdout);
-    } else
-      applog(LOG_INFO, "%s", statusline);
-  }
 }
 
 static void stratum_share_result(json_t *val, json_t *res_val, json_t *err_val,
@@ -5028,52 +5156,14 @@ static void stratum_share_result(json_t *val, json_t *res_val, json_t *err_val,
   share_result(val, res_val, err_val, work, hashshow, false, "");
 }
 
-/* Parses stratum json responses and tries to find the id that the request
- * matched to and treat it accordingly. */
-static bool parse_stratum_response(struct pool *pool, char *s)
+/* Matches a stratum reply to the share submitted with that id and accounts
+ * for it. val and err_val are only used to report why a share was rejected */
+static bool stratum_share_reply(struct pool *pool, int id, json_t *val,
+        json_t *res_val, json_t *err_val)
 {
-  json_t *val = NULL, *err_val, *res_val, *id_val;
-  struct stratum_share *sshare;
-  json_error_t err;
-  bool ret = false;
-  int id;
-
-  val = JSON_LOADS(s, &err);
-  if (!val) {
-    applog(LOG_INFO, "JSON decode failed(%d): %s", err.line, err.text);
-    goto out;
-  }
-
-  res_val = json_object_get(val, "result");
-  err_val = json_object_get(val, "error");
-  id_val = json_object_get(val, "id");
-
-  if (json_is_null(id_val) || !id_val) {
-    char *ss;
-
-    if (err_val)
-      ss = json_dumps(err_val, JSON_INDENT(3));
-    else
-      ss = strdup("(unknown reason)");
-
-    applog(LOG_INFO, "JSON-RPC non method decode failed: %s", ss);
-
-    free(ss);
-
-    goto out;
-  }
+  struct stratum_share sshare;
 
-  id = json_integer_value(id_val);
-
-  mutex_lock(&sshare_lock);
-  HASH_FIND_INT(stratum_shares, &id, sshare);
-  if (sshare) {
-    HASH_DEL(stratum_shares, sshare);
-    pool->sshares--;
-  }
-  mutex_unlock(&sshare_lock);
-
-  if (!sshare) {
+  if (!share_table_take(pool->share_table, id, &sshare)) {
     double pool_diff;
 
     /* Since the share is untracked, we can only guess at what the
@@ -5103,45 +5193,92 @@ static bool parse_stratum_response(struct pool *pool, char *s)
       pool->diff_rejected += pool_diff;
       mutex_unlock(&stats_lock);
     }
-    goto out;
+    return false;
   }
-  stratum_share_result(val, res_val, err_val, sshare);
-  free_work(sshare->work);
-  free(sshare);
+  stratum_share_result(val, res_val, err_val, &sshare);
+  free_work(sshare.work);
 
-  ret = true;
-out:
-  if (val)
-    json_decref(val);
+  return true;
+}
 
-  return ret;
+/* Parses stratum json responses and tries to find the id that the request
+ * matched to and treat it accordingly. */
+static bool parse_stratum_response(struct pool *pool, json_t *val)
+{
+  json_t *err_val, *res_val, *id_val;
+
+  res_val = json_object_get(val, "result");
+  err_val = json_object_get(val, "error");
+  id_val = json_object_get(val, "id");
+
+  if (json_is_null(id_val) || !id_val) {
+    char *ss;
+
+    if (err_val)
+      ss = json_dumps(err_val, JSON_INDENT(3));
+    else
+      ss = strdup("(unknown reason)");
+
+    applog(LOG_INFO, "JSON-RPC non method decode failed: %s", ss);
+
+    free(ss);
+
+    return false;
+  }
+
+  return stratum_share_reply(pool, json_integer_value(id_val), val, res_val, err_val);
 }
 
-void clear_stratum_shares(struct pool *pool)
+/* Counts shares that will never get a response as stale */
+static void lose_stratum_shares(struct pool *pool, struct stratum_share *sshares, int count)
 {
-  struct stratum_share *sshare, *tmpshare;
-  double diff_cleared = 0;
-  int cleared = 0;
+  double diff_lost = 0;
+  int i;
 
-  mutex_lock(&sshare_lock);
-  HASH_ITER(hh, stratum_shares, sshare, tmpshare) {
-    if (sshare->work->pool == pool) {
-      HASH_DEL(stratum_shares, sshare);
-      diff_cleared += sshare->work->work_difficulty;
-      free_work(sshare->work);
-      pool->sshares--;
-      free(sshare);
-      cleared++;
-    }
+  for (i = 0; i < count; i++) {
+    diff_lost += sshares[i].work->work_difficulty;
+    free_work(sshares[i].work);
   }
-  mutex_unlock(&sshare_lock);
 
+  mutex_lock(&stats_lock);
+  pool->stale_shares += count;
+  total_stale += count;
+  pool->diff_stale += diff_lost;
+  total_diff_stale += diff_lost;
+  mutex_unlock(&stats_lock);
+}
+
+void clear_stratum_shares(struct pool *pool)
+{
+  struct stratum_share *sshares;
+  int cleared;
+
+  sshares = share_table_take_expired(pool->share_table, time(NULL), true, &cleared);
   if (cleared) {
     applog(LOG_WARNING, "Lost %d shares due to stratum disconnect on %s", cleared, get_pool_name(pool));
-    pool->stale_shares += cleared;
-    total_stale += cleared;
-    pool->diff_stale += diff_cleared;
-    total_diff_stale += diff_cleared;
+    lose_stratum_shares(pool, sshares, cleared);
+  }
+  free(sshares);
+}
+
+/* Drops shares a pool has not answered within --share-timeout */
+static void expire_stratum_shares(void)
+{
+  time_t now = time(NULL);
+  int i;
+
+  for (i = 0; i < total_pools; i++) {
+    struct pool *pool = pools[i];
+    struct stratum_share *sshares;
+    int expired;
+
+    sshares = share_table_take_expired(pool->share_table, now, false, &expired);
+    if (expired) {
+      applog(LOG_WARNING, "Lost %d shares with no response within %d seconds from %s",
+             expired, opt_share_timeout, get_pool_name(pool));
+      lose_stratum_shares(pool, sshares, expired);
+    }
+    free(sshares);
   }
 }
 
@@ -5175,6 +5312,27 @@ static int cp_prio(void)
   return prio;
 }
 
+/* Whether pool is one of the opt_hot_standby live stratum pools next in
+ * priority behind the current pool, which are kept subscribed */
+static bool pool_hot_standby(struct pool *pool, struct pool *cp)
+{
+  int i, ahead = 0;
+
+  if (!opt_hot_standby || pool == cp || !pool->has_stratum)
+    return false;
+
+  for (i = 0; i < total_pools; i++) {
+    struct pool *other = pools[i];
+
+    if (other == cp || other == pool || other->removed || other->idle ||
+        other->state != POOL_ENABLED || !other->has_stratum)
+      continue;
+    if (other->prio < pool->prio)
+      ahead++;
+  }
+  return ahead < opt_hot_standby;
+}
+
 /* We only need to maintain a secondary pool connection when we need the
  * capacity to get work from the backup pools while still on the primary */
 static bool cnx_needed(struct pool *pool)
@@ -5197,13 +5355,17 @@ static bool cnx_needed(struct pool *pool)
   /* Getwork pools without opt_fail_only need backup pools up to be able
    * to leak shares */
   cp = current_pool();
+  pool->hot_standby = pool_hot_standby(pool, cp);
   if (cp == pool)
     return true;
+  /* Hot standby pools stay subscribed so failing over needs no reconnect */
+  if (pool->hot_standby)
+    return true;
   if (!pool_localgen(cp) && (!opt_fail_only || !cp->hdr_path))
     return true;
   /* If we're waiting for a response from shares submitted, keep the
    * connection open. */
-  if (pool->sshares)
+  if (share_table_outstanding(pool->share_table))
     return true;
   /* If the pool has only just come to life and is higher priority than
    * the current pool keep the connection open so we can fail back to
@@ -5256,10 +5418,14 @@ static void *stratum_rthread(void *userdata)
 
   snprintf(threadname, sizeof(threadname), "%d/RStratum", pool->pool_no);
   RenameThread(threadname);
+  affinity_apply(AFFINITY_STRATUM, NULL);
 
   while (42) {
     struct timeval timeout;
-    int sel_ret;
+    json_error_t err;
+    bool handled;
+    json_t *val;
+    int sel_ret, id;
     fd_set rd;
     char *s;
 
@@ -5313,8 +5479,13 @@ static void *stratum_rthread(void *userdata)
       if (!supports_resume(pool) || opt_lowmem)
         clear_stratum_shares(pool);
       clear_pool_work(pool);
-      if (pool == current_pool())
+      if (pool == current_pool()) {
         restart_threads();
+        /* Hand over to a hot standby pool now rather than after the
+         * reconnect attempt */
+        if (opt_hot_standby)
+          pool_died(pool);
+      }
 
       if (restart_stratum(pool))
         continue;
@@ -5334,7 +5505,31 @@ static void *stratum_rthread(void *userdata)
      * has not had its idle flag cleared */
     stratum_resumed(pool);
 
-    if (!parse_method(pool, s) && !parse_stratum_response(pool, s))
+    /* Notifies and share accepts are handled straight from the line, the
+     * rest is decoded once and offered to both parsers */
+    switch (parse_stratum_fast(pool, s, &id)) {
+      case STRATUM_FAST_NOTIFY:
+        handled = true;
+        break;
+      case STRATUM_FAST_ACCEPT:
+        handled = stratum_share_reply(pool, id, NULL, json_true(), NULL);
+        break;
+      case STRATUM_FAST_FAILED:
+        handled = false;
+        break;
+      default:
+        val = JSON_LOADS(s, &err);
+        if (!val) {
+          applog(LOG_INFO, "JSON decode failed(%d): %s", err.line, err.text);
+          handled = false;
+          break;
+        }
+        handled = parse_method_json(pool, val) || parse_stratum_response(pool, val);
+        json_decref(val);
+        break;
+    }
+
+    if (!handled)
       applog(LOG_INFO, "Unknown stratum msg: %s", s);
     else if (pool->swork.clean) {
       struct work *work = make_work();
@@ -5368,6 +5563,7 @@ static void *stratum_sthread(void *userdata)
 
   snprintf(threadname, sizeof(threadname), "%d/SStratum", pool->pool_no);
   RenameThread(threadname);
+  affinity_apply(AFFINITY_STRATUM, NULL);
 
   pool->stratum_q = tq_new();
   if (!pool->stratum_q)
@@ -5375,7 +5571,7 @@ static void *stratum_sthread(void *userdata)
 
   while (42) {
     char noncehex[12], nonce2hex[20], s[1024];
-    struct stratum_share *sshare;
+    struct stratum_share sshare, evicted;
     uint32_t *hash32, nonce;
     unsigned char nonce2[8];
     uint64_t *nonce2_64;
@@ -5396,21 +5592,20 @@ static void *stratum_sthread(void *userdata)
       continue;
     }
 
-    // TODO: check for memory leaks
-    sshare = (struct stratum_share *)calloc(sizeof(struct stratum_share), 1);
+    memset(&sshare, 0, sizeof(sshare));
     hash32 = (uint32_t *)work->hash;
     submitted = false;
 
-    sshare->sshare_time = time(NULL);
+    sshare.sshare_time = time(NULL);
     /* This work item is freed in parse_stratum_response */
-    sshare->work = work;
+    sshare.work = work;
     nonce = *((uint32_t *)(work->data + 76));
     __bin2hex(noncehex, (const unsigned char *)&nonce, 4);
     memset(s, 0, 1024);
 
     mutex_lock(&sshare_lock);
     /* Give the stratum share a unique id */
-    sshare->id = swork_id++;
+    sshare.id = swork_id++;
     mutex_unlock(&sshare_lock);
 
     nonce2_64 = (uint64_t *)nonce2;
@@ -5419,26 +5614,36 @@ static void *stratum_sthread(void *userdata)
 
     snprintf(s, sizeof(s),
       "{\"params\": [\"%s\", \"%s\", \"%s\", \"%s\", \"%s\"], \"id\": %d, \"method\": \"mining.submit\"}",
-      pool->rpc_user, work->job_id, nonce2hex, work->ntime, noncehex, sshare->id);
+      pool->rpc_user, work->job_id, nonce2hex, work->ntime, noncehex, sshare.id);
 
     applog(LOG_INFO, "Submitting share %08lx to %s", (long unsigned int)htole32(hash32[6]), get_pool_name(pool));
 
     /* Try resubmitting for up to 2 minutes if we fail to submit
      * once and the stratum pool nonce1 still matches suggesting
      * we may be able to resume. */
-    while (time(NULL) < sshare->sshare_time + 120) {
+    while (time(NULL) < sshare.sshare_time + 120) {
       bool sessionid_match;
 
+      /* Tracked before it is sent, the response can be parsed before
+       * stratum_send returns */
+      sshare.sshare_sent = time(NULL);
+      cgtime(&sshare.tv_sent);
+      if (share_table_add(pool->share_table, &sshare, &evicted)) {
+        applog(LOG_WARNING, "Lost share %d with no response from %s, its slot was reused",
+               evicted.id, get_pool_name(pool));
+        lose_stratum_shares(pool, &evicted, 1);
+      }
+
       if (likely(stratum_send(pool, s, strlen(s)))) {
         if (pool_tclear(pool, &pool->submit_fail))
             applog(LOG_WARNING, "%s communication resumed, submitting work", get_pool_name(pool));
 
-        mutex_lock(&sshare_lock);
-        HASH_ADD_INT(stratum_shares, id, sshare);
-        pool->sshares++;
-        mutex_unlock(&sshare_lock);
-
-        applog(LOG_DEBUG, "Successfully submitted, adding to stratum_shares db");
+        applog(LOG_DEBUG, "Successfully submitted, added to %s share table", get_pool_name(pool));
+        submitted = true;
+        break;
+      }
+      /* Already taken by a response or a flush, which dealt with the work */
+      if (!share_table_cancel(pool->share_table, sshare.id)) {
         submitted = true;
         break;
       }
@@ -5468,14 +5673,13 @@ static void *stratum_sthread(void *userdata)
     if (unlikely(!submitted)) {
       applog(LOG_DEBUG, "Failed to submit stratum share, discarding");
       free_work(work);
-      free(sshare);
       pool->stale_shares++;
       total_stale++;
     } else {
       int ssdiff;
 
-      sshare->sshare_sent = time(NULL);
-      ssdiff = sshare->sshare_sent - sshare->sshare_time;
+      /* Only the local copy, the share may already have been answered */
+      ssdiff = sshare.sshare_sent - sshare.sshare_time;
       if (opt_debug || ssdiff > 0) {
         applog(LOG_INFO, "Pool %d stratum share submission lag time %d seconds",
                pool->pool_no, ssdiff);
@@ -5523,6 +5727,12 @@ static bool pool_active(struct pool *pool, bool pinging)
   char curl_err_str[CURL_ERROR_SIZE];
   int rolltime = 0;
 
+  /* The benchmark pool generates its work locally and never goes away */
+  if (opt_benchmark) {
+    successful_connect = true;
+    return true;
+  }
+
   if (pool->has_gbt)
     applog(LOG_DEBUG, "Retrieving block template from %s", get_pool_name(pool));
   else
@@ -5713,6 +5923,7 @@ static struct work *hash_pop(bool blocking)
   struct work *work = NULL, *tmp;
   int hc;
 
+  TRACE_BEGIN("hash_pop");
   mutex_lock(stgd_lock);
   if (!HASH_COUNT(staged_work)) {
     if (!blocking)
@@ -5726,7 +5937,7 @@ static struct work *hash_pop(bool blocking)
       then.tv_sec = now.tv_sec + 10;
       then.tv_nsec = now.tv_usec * 1000;
       pthread_cond_signal(&gws_cond);
-      rc = pthread_cond_timedwait(&getq->cond, stgd_lock, &then);
+      rc = cond_timedwait(&getq->cond, stgd_lock, &then);
       /* Check again for !no_work as multiple threads may be
         * waiting on this condition and another may set the
         * bool separately. */
@@ -5765,6 +5976,7 @@ static struct work *hash_pop(bool blocking)
   last_getwork = time(NULL);
 out_unlock:
   mutex_unlock(stgd_lock);
+  TRACE_END("hash_pop");
 
   return work;
 }
@@ -5821,16 +6033,44 @@ void set_target(unsigned char *dest_target, double diff, double diff_multiplier2
   memcpy(dest_target, target, 32);
 }
 
+/* Hashes a coinbase up the merkle branches into the header's merkle root */
+static void stratum_merkle_root(algorithm_t *algorithm, const unsigned char *coinbase, size_t cb_len,
+                                unsigned char **merkle_bin, int merkles, unsigned char *merkle_root)
+{
+  unsigned char merkle_sha[64];
+  uint32_t *data32, *swap32;
+  int i;
+
+  algorithm->gen_hash(coinbase, cb_len, merkle_root);
+  memcpy(merkle_sha, merkle_root, 32);
+  for (i = 0; i < merkles; i++) {
+    memcpy(merkle_sha + 32, merkle_bin[i], 32);
+    gen_hash(merkle_sha, 64, merkle_root);
+    memcpy(merkle_sha, merkle_root, 32);
+  }
+  data32 = (uint32_t *)merkle_sha;
+  swap32 = (uint32_t *)merkle_root;
+  flip32(swap32, data32);
+}
+
+/* Whether stratum work of pool can leave the device a range of nonce2
+ * values, see --gpu-nonce2 */
+static bool pool_gpu_nonce2(struct pool *pool)
+{
+  return opt_gpu_nonce2 > 1 && pool->n2size <= 8 && !(pool->merkle_offset & 3) &&
+         gpu_nonce2_supported(&pool->algorithm);
+}
+
 /* Generates stratum based work based on the most recent notify information
  * from the pool. This will keep generating work while a pool is down so we use
  * other means to detect when the pool has died in stratum_thread */
 static void gen_stratum_work(struct pool *pool, struct work *work)
 {
-  unsigned char merkle_root[32], merkle_sha[64];
-  uint32_t *data32, *swap32;
+  unsigned char merkle_root[32];
   uint64_t nonce2le;
   int i;
 
+  TRACE_BEGIN("gen_stratum_work");
   cg_wlock(&pool->data_lock);
 
   /* Update coinbase. Always use an LE encoded nonce2 to fill in values
@@ -5840,25 +6080,36 @@ static void gen_stratum_work(struct pool *pool, struct work *work)
   work->nonce2 = pool->nonce2++;
   work->nonce2_len = pool->n2size;
 
+  /* The device derives the headers of the rest of the range */
+  if (pool_gpu_nonce2(pool)) {
+    work->nonce2_range = opt_gpu_nonce2;
+    pool->nonce2 += opt_gpu_nonce2 - 1;
+  }
+
   /* Downgrade to a read lock to read off the pool variables */
   cg_dwlock(&pool->data_lock);
 
   /* Generate merkle root */
-  pool->algorithm.gen_hash(pool->coinbase, pool->swork.cb_len, merkle_root);
-  memcpy(merkle_sha, merkle_root, 32);
-  for (i = 0; i < pool->swork.merkles; i++) {
-    memcpy(merkle_sha + 32, pool->swork.merkle_bin[i], 32);
-    gen_hash(merkle_sha, 64, merkle_root);
-    memcpy(merkle_sha, merkle_root, 32);
-  }
-  data32 = (uint32_t *)merkle_sha;
-  swap32 = (uint32_t *)merkle_root;
-  flip32(swap32, data32);
+  stratum_merkle_root(&pool->algorithm, pool->coinbase, pool->swork.cb_len, pool->swork.merkle_bin,
+                      pool->swork.merkles, merkle_root);
 
   /* Copy the data template from header_bin */
   memcpy(work->data, pool->header_bin, 128);
   memcpy(work->data + pool->merkle_offset, merkle_root, 32);
 
+  if (work->nonce2_range) {
+    work->n2_cb_len = pool->swork.cb_len;
+    work->n2_offset = pool->nonce2_offset;
+    work->n2_merkles = pool->swork.merkles;
+    work->n2_merkle_offset = pool->merkle_offset;
+    work->n2_job = (unsigned char *)malloc(work->n2_cb_len + 32 * (size_t)work->n2_merkles);
+    if (unlikely(!work->n2_job))
+      quit(1, "Failed to malloc n2_job in gen_stratum_work");
+    memcpy(work->n2_job, pool->coinbase, work->n2_cb_len);
+    for (i = 0; i < work->n2_merkles; i++)
+      memcpy(work->n2_job + work->n2_cb_len + 32 * i, pool->swork.merkle_bin[i], 32);
+  }
+
   /* Store the stratum work diff to check it still matches the pool's
    * stratum diff when submitting shares */
   work->sdiff = pool->swork.diff;
@@ -5869,6 +6120,9 @@ static void gen_stratum_work(struct pool *pool, struct work *work)
   work->ntime = strdup(pool->swork.ntime);
   cg_runlock(&pool->data_lock);
 
+  if (unlikely(opt_stratum_record))
+    stratum_record_work(pool, work);
+
   if (opt_debug) {
     char *header, *merkle_hash;
 
@@ -5898,6 +6152,56 @@ static void gen_stratum_work(struct pool *pool, struct work *work)
   calc_diff(work, work->sdiff);
 
   cgtime(&work->tv_staged);
+  TRACE_END("gen_stratum_work");
+}
+
+/* Turns --gpu-nonce2 work into the work of nonce2 in its range, for the
+ * shares the device found on a header it derived */
+void work_set_nonce2(struct work *work, uint64_t nonce2)
+{
+  unsigned char merkle_root[32];
+  unsigned char *coinbase = (unsigned char *)alloca(work->n2_cb_len);
+  unsigned char **merkle_bin = (unsigned char **)alloca(sizeof(unsigned char *) * (work->n2_merkles + 1));
+  uint64_t nonce2le = htole64(nonce2);
+  int i;
+
+  memcpy(coinbase, work->n2_job, work->n2_cb_len);
+  memcpy(coinbase + work->n2_offset, &nonce2le, work->nonce2_len);
+  for (i = 0; i < work->n2_merkles; i++)
+    merkle_bin[i] = work->n2_job + work->n2_cb_len + 32 * i;
+
+  stratum_merkle_root(&work->pool->algorithm, coinbase, work->n2_cb_len, merkle_bin, work->n2_merkles, merkle_root);
+  memcpy(work->data + work->n2_merkle_offset, merkle_root, 32);
+  work->nonce2 = nonce2;
+  calc_midstate(work);
+}
+
+/* Synthesises --benchmark work from the block in bench_block.h. The last
+ * word of the merkle root carries the work id so no two items repeat a
+ * nonce range */
+static void gen_benchmark_work(struct pool *pool, struct work *work)
+{
+  static const unsigned char bench_block[] = { SGMINER_BENCHMARK_BLOCK };
+  uint32_t *merkle_tail = (uint32_t *)(work->data + 64);
+
+  memcpy(work->data, bench_block, sizeof(work->data));
+  work->id = total_work++;
+  *merkle_tail ^= htole32((uint32_t)work->id);
+
+  calc_midstate(work);
+  set_target(work->target, opt_benchmark_diff, pool->algorithm.diff_multiplier2);
+
+  local_work++;
+  work->pool = pool;
+  work->blk.nonce = 0;
+  work->longpoll = false;
+  work->getwork_mode = GETWORK_MODE_BENCHMARK;
+  work->work_block = work_block;
+  calc_diff(work, opt_benchmark_diff);
+
+  cgtime(&work->tv_getwork);
+  copy_time(&work->tv_getwork_reply, &work->tv_getwork);
+  cgtime(&work->tv_staged);
 }
 
 static void enable_devices(void)
@@ -6259,6 +6563,16 @@ static void get_work_prepare_thread(struct thr_info *mythr, struct work *work)
       pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
       return;
     }
+
+    //short of a change of devices or threads per device, the devices pick
+    //up the new settings between rounds and the mining threads keep going
+    if(!opt_isset(pool_switch_options, SWITCHER_HARD_RESET))
+    {
+      reconfigure_devices(work->pool, pool_switch_options);
+      mutex_unlock(&algo_switch_lock);
+      pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+      return;
+    }
   }
 
   mutex_lock(&algo_switch_wait_lock);
@@ -6287,17 +6601,6 @@ static void get_work_prepare_thread(struct thr_info *mythr, struct work *work)
     applog(LOG_NOTICE, "Applying pool settings for %s...", isnull(get_pool_name(work->pool), ""));
     rd_lock(&mining_thr_lock);
 
-    // Shutdown all threads first (necessary)
-    if(opt_isset(pool_switch_options, SWITCHER_SOFT_RESET))
-    {
-      applog(LOG_DEBUG, "Soft Reset... Shutdown threads...");
-      for (i = 0; i < mining_threads; i++)
-      {
-        struct thr_info *thr = mining_thr[i];
-        thr->cgpu->drv->thread_shutdown(thr);
-      }
-    }
-
     // Reset stats (e.g. for working_diff to be set properly in hash_sole_work)
     zero_stats();
 
@@ -6315,114 +6618,9 @@ static void get_work_prepare_thread(struct thr_info *mythr, struct work *work)
       }
     }
 
-    //lookup gap
-    if(opt_isset(pool_switch_options, SWITCHER_APPLY_LG))
-    {
-      if(!empty_string((opt = get_pool_setting(work->pool->lookup_gap, default_profile.lookup_gap))))
-        set_lookup_gap((char *)opt);
-    }
-
-    //raw intensity from pool
-    if(opt_isset(pool_switch_options, SWITCHER_APPLY_RAWINT))
-    {
-      if(!empty_string((opt = get_pool_setting(work->pool->rawintensity, default_profile.rawintensity))))
-        set_rawintensity((char *)opt);
-    }
-    //xintensity
-    else if(opt_isset(pool_switch_options, SWITCHER_APPLY_XINT))
-    {
-      if(!empty_string((opt = get_pool_setting(work->pool->xintensity, default_profile.xintensity))))
-        set_xintensity((char *)opt);
-    }
-    //intensity
-    else if(opt_isset(pool_switch_options, SWITCHER_APPLY_INT))
-    {
-      if(!empty_string((opt = get_pool_setting(work->pool->intensity, default_profile.intensity))))
-        set_intensity((char *)opt);
-    }
-    //default basic intensity
-    else if(opt_isset(pool_switch_options, SWITCHER_APPLY_INT8))
-    {
-      default_profile.intensity = strdup("8");
-      set_intensity(default_profile.intensity);
-    }
-
-    //shaders
-    if(opt_isset(pool_switch_options, SWITCHER_APPLY_SHADER))
-    {
-      if(!empty_string((opt = get_pool_setting(work->pool->shaders, default_profile.shaders))))
-        set_shaders((char *)opt);
-    }
-
-    //thread-concurrency
-    if(opt_isset(pool_switch_options, SWITCHER_APPLY_TC))
-    {
-      if(!empty_string((opt = get_pool_setting(work->pool->thread_concurrency, default_profile.thread_concurrency))))
-        set_thread_concurrency((char *)opt);
-    }
-
-    //worksize
-    if(opt_isset(pool_switch_options, SWITCHER_APPLY_WORKSIZE))
-    {
-      if(!empty_string((opt = get_pool_setting(work->pool->worksize, default_profile.worksize))))
-        set_worksize((char *)opt);
-    }
-
-    #ifdef HAVE_ADL
-      //GPU clock
-      if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_ENGINE))
-      {
-        if(!empty_string((opt = get_pool_setting(work->pool->gpu_engine, default_profile.gpu_engine))))
-          set_gpu_engine((char *)opt);
-      }
-
-      //GPU memory clock
-      if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_MEMCLOCK))
-      {
-        if(!empty_string((opt = get_pool_setting(work->pool->gpu_memclock, default_profile.gpu_memclock))))
-          set_gpu_memclock((char *)opt);
-      }
-
-      //GPU fans
-      if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_FAN))
-      {
-        if(!empty_string((opt = get_pool_setting(work->pool->gpu_fan, default_profile.gpu_fan))))
-          set_gpu_fan((char *)opt);
-      }
-
-      //GPU powertune
-      if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_POWERTUNE))
-      {
-        if(!empty_string((opt = get_pool_setting(work->pool->gpu_powertune, default_profile.gpu_powertune))))
-          set_gpu_powertune((char *)opt);
-      }
-
-      //GPU vddc
-      if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_VDDC))
-      {
-        if(!empty_string((opt = get_pool_setting(work->pool->gpu_vddc, default_profile.gpu_vddc))))
-          set_gpu_vddc((char *)opt);
-      }
-
-      //apply gpu settings
-      for (i = 0; i < nDevs; i++)
-      {
-        if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_ENGINE))
-          set_engineclock(i, gpus[i].min_engine);
-        if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_MEMCLOCK))
-          set_memoryclock(i, gpus[i].gpu_memclock);
-        if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_FAN))
-          set_fanspeed(i, gpus[i].min_fan);
-        if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_POWERTUNE))
-          set_powertune(i, gpus[i].gpu_powertune);
-        if(opt_isset(pool_switch_options, SWITCHER_APPLY_GPU_VDDC))
-          set_vddc(i, gpus[i].gpu_vddc);
-      }
-    #endif
-
-    // Change algorithm for each thread (thread_prepare calls initCl)
-    if(opt_isset(pool_switch_options, SWITCHER_SOFT_RESET))
-      applog(LOG_DEBUG, "Soft Reset... Restarting threads...");
+    mutex_lock(&reconfig_lock);
+    apply_pool_settings(work->pool, pool_switch_options);
+    mutex_unlock(&reconfig_lock);
 
     struct thr_info *thr;
 
@@ -6435,12 +6633,6 @@ static void get_work_prepare_thread(struct thr_info *mythr, struct work *work)
       if(opt_isset(pool_switch_options, SWITCHER_APPLY_ALGO))
         thr->cgpu->algorithm = work->pool->algorithm;
 
-      if(opt_isset(pool_switch_options, SWITCHER_SOFT_RESET))
-      {
-        thr->cgpu->drv->thread_prepare(thr);
-        thr->cgpu->drv->thread_init(thr);
-      }
-
       // Necessary because algorithms can have dramatically different diffs
       thr->cgpu->drv->working_diff = 1;
     }
@@ -6448,54 +6640,38 @@ static void get_work_prepare_thread(struct thr_info *mythr, struct work *work)
     rd_unlock(&mining_thr_lock);
     mutex_unlock(&algo_switch_lock);
 
-    // Hard restart if needed
-    if(opt_isset(pool_switch_options, SWITCHER_HARD_RESET))
-    {
-      applog(LOG_DEBUG, "Hard Reset Mining Threads...");
-
-      //if devices changed... enable/disable as needed
-      if(opt_isset(pool_switch_options, SWITCHER_APPLY_DEVICE))
-        enable_devices();
+    // Hard restart
+    applog(LOG_DEBUG, "Hard Reset Mining Threads...");
 
-      //figure out how many mining threads we'll need
-      unsigned int n_threads = 0;
-      pthread_t restart_thr;
-
-      #ifdef HAVE_ADL
-        //change gpu threads if needed
-        if(opt_isset(pool_switch_options, SWITCHER_APPLY_GT))
-        {
-          if(!empty_string((opt = get_pool_setting(work->pool->gpu_threads, default_profile.gpu_threads))))
-            set_gpu_threads(opt);
-        }
+    //if devices changed... enable/disable as needed
+    if(opt_isset(pool_switch_options, SWITCHER_APPLY_DEVICE))
+      enable_devices();
 
-        rd_lock(&devices_lock);
-        for (i = 0; i < total_devices; i++)
-          if (!opt_removedisabled || !opt_devs_enabled || devices_enabled[i])
-            n_threads += devices[i]->threads;
-        rd_unlock(&devices_lock);
-      #else
-        n_threads = mining_threads;
-      #endif
+    //figure out how many mining threads we'll need
+    unsigned int n_threads = 0;
+    pthread_t restart_thr;
 
-      if (unlikely(pthread_create(&restart_thr, NULL, restart_mining_threads_thread, (void *) (intptr_t) n_threads)))
-        quit(1, "restart_mining_threads create thread failed");
+    #ifdef HAVE_ADL
+      //change gpu threads if needed
+      if(opt_isset(pool_switch_options, SWITCHER_APPLY_GT))
+      {
+        if(!empty_string((opt = get_pool_setting(work->pool->gpu_threads, default_profile.gpu_threads))))
+          set_gpu_threads(opt);
+      }
 
-      // go wait with the other threads...
-    }
-    else
-    {
-      // Signal other threads to start working now
-      mutex_lock(&algo_switch_wait_lock);
-      algo_switch_n = 0;
-      pthread_cond_broadcast(&algo_switch_wait_cond);
-      mutex_unlock(&algo_switch_wait_lock);
+      rd_lock(&devices_lock);
+      for (i = 0; i < total_devices; i++)
+        if (!opt_removedisabled || !opt_devs_enabled || devices_enabled[i])
+          n_threads += devices[i]->threads;
+      rd_unlock(&devices_lock);
+    #else
+      n_threads = mining_threads;
+    #endif
 
-      pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+    if (unlikely(pthread_create(&restart_thr, NULL, restart_mining_threads_thread, (void *) (intptr_t) n_threads)))
+      quit(1, "restart_mining_threads create thread failed");
 
-      // no need to wait, exit
-      return;
-    }
+    // go wait with the other threads...
   }
   else
     mutex_unlock(&algo_switch_lock);
@@ -6507,7 +6683,7 @@ static void get_work_prepare_thread(struct thr_info *mythr, struct work *work)
   // Wait for signal to start working again
   mutex_lock(&algo_switch_wait_lock);
   while(algo_switch_n > 0)
-    pthread_cond_wait(&algo_switch_wait_cond, &algo_switch_wait_lock);
+    cond_wait(&algo_switch_wait_cond, &algo_switch_wait_lock);
   // Non-zero argument will execute the cleanup handler after popping it
   pthread_cleanup_pop(1);
 }
@@ -6518,6 +6694,7 @@ struct work *get_work(struct thr_info *thr, const int thr_id)
   time_t diff_t;
 
   thread_reportout(thr);
+  TRACE_BEGIN("get_work");
   applog(LOG_DEBUG, "Popping work from get queue to get work");
   diff_t = time(NULL);
   while (!work) {
@@ -6546,6 +6723,7 @@ struct work *get_work(struct thr_info *thr, const int thr_id)
   thread_reportin(thr);
   work->mined = true;
   work->device_diff = MIN(thr->cgpu->drv->max_diff, work->work_difficulty);
+  TRACE_END("get_work");
   return work;
 }
 
@@ -6556,6 +6734,8 @@ static void submit_work_async(struct work *work)
   pthread_t submit_thread;
 
   cgtime(&work->tv_work_found);
+  if (opt_benchmark)
+    benchmark_stage(BENCH_SHARE, &work->tv_work_start, &work->tv_work_found);
 
   if (stale_work(work, true)) {
     if (opt_submit_stale)
@@ -6579,10 +6759,25 @@ static void submit_work_async(struct work *work)
     work->stale = true;
   }
 
+  /* Benchmark shares are accounted for as accepted without leaving the
+   * process */
+  if (opt_benchmark) {
+    char hashshow[64];
+
+    benchmark_share();
+    show_hash(work, hashshow);
+    share_result(NULL, json_true(), NULL, work, hashshow, false, "");
+    free_work(work);
+    return;
+  }
+
   if (work->stratum) {
     applog(LOG_DEBUG, "Pushing %s work to stratum queue", get_pool_name(pool));
     if (unlikely(!tq_push(pool->stratum_q, work))) {
-      applog(LOG_DEBUG, "Discarding work from removed pool");
+      if (pool->removed)
+        applog(LOG_DEBUG, "Discarding work from removed pool");
+      else
+        applog(LOG_WARNING, "Failed to queue share to %s, share lost", get_pool_name(pool));
       free_work(work);
     }
   } else {
@@ -6615,18 +6810,25 @@ static void rebuild_nonce(struct work *work, uint32_t nonce)
   work->pool->algorithm.regenhash(work);
 }
 
-/* For testing a nonce against diff 1 */
-bool test_nonce(struct work *work, uint32_t nonce)
+/* Tests the hash already built into work->hash against diff 1 */
+static bool test_hash_diff1(struct work *work)
 {
   uint32_t *hash_32 = (uint32_t *)(work->hash + 28);
   uint32_t diff1targ;
 
-  rebuild_nonce(work, nonce);
   diff1targ = work->pool->algorithm.diff1targ;
 
   return (le32toh(*hash_32) <= diff1targ);
 }
 
+/* For testing a nonce against diff 1 */
+bool test_nonce(struct work *work, uint32_t nonce)
+{
+  rebuild_nonce(work, nonce);
+
+  return test_hash_diff1(work);
+}
+
 static void update_work_stats(struct thr_info *thr, struct work *work)
 {
   double test_diff = current_diff;
@@ -6672,8 +6874,31 @@ bool submit_tested_work(struct thr_info *thr, struct work *work)
 /* Returns true if nonce for work was a valid share */
 bool submit_nonce(struct thr_info *thr, struct work *work, uint32_t nonce)
 {
+  bool ret = true;
+
+  TRACE_BEGIN("submit_nonce");
   if (test_nonce(work, nonce))
     submit_tested_work(thr, work);
+  else {
+    inc_hw_errors(thr);
+    ret = false;
+  }
+  TRACE_END("submit_nonce");
+
+  return ret;
+}
+
+/* As submit_nonce, for a nonce whose hash has already been computed
+ * elsewhere, e.g. by a batch verifier */
+bool submit_hashed_nonce(struct thr_info *thr, struct work *work, uint32_t nonce, const uint32_t *hash)
+{
+  uint32_t *work_nonce = (uint32_t *)(work->data + 64 + 12);
+
+  *work_nonce = htole32(nonce);
+  memcpy(work->hash, hash, 32);
+
+  if (test_hash_diff1(work))
+    submit_tested_work(thr, work);
   else {
     inc_hw_errors(thr);
     return false;
@@ -6783,13 +7008,17 @@ static void hash_sole_work(struct thr_info *mythr)
       pool_stats->getwork_calls++;
 
       cgtime(&(work->tv_work_start));
+      if (opt_benchmark)
+        benchmark_stage(BENCH_QUEUE, &work->tv_staged, &work->tv_work_start);
 
       /* Only allow the mining thread to be cancelled when
        * it is not in the driver code. */
       pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
 
       thread_reportin(mythr);
+      TRACE_BEGIN("scanhash");
       hashes = drv->scanhash(mythr, work, work->blk.nonce + max_nonce);
+      TRACE_END("scanhash");
       thread_reportout(mythr);
 
       pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
@@ -6881,6 +7110,10 @@ void *miner_thread(void *userdata)
 
         snprintf(threadname, sizeof(threadname), "%d/Miner", thr_id);
   RenameThread(threadname);
+  /* Placed before thread_init so the host buffers it allocates are first
+   * touched on its node. The OpenCL state was already set up by
+   * thread_prepare on the main thread */
+  affinity_apply(AFFINITY_MINER, cgpu);
 
   thread_reportout(mythr);
   if (!drv->thread_init(mythr)) {
@@ -6891,7 +7124,11 @@ void *miner_thread(void *userdata)
   applog(LOG_DEBUG, "Waiting on sem in miner thread");
   cgsem_wait(&mythr->sem);
 
-  set_highprio();
+  /* CPU workers share the machine with everything else */
+  if (drv->drv_id == DRIVER_cpu)
+    set_lowprio();
+  else
+    set_highprio();
   drv->hash_work(mythr);
 out:
   drv->thread_shutdown(mythr);
@@ -6987,7 +7224,7 @@ static void wait_lpcurrent(struct pool *pool)
          (pool != current_pool() && pool_strategy != POOL_LOADBALANCE &&
          pool_strategy != POOL_BALANCE))) {
     mutex_lock(&lp_lock);
-    pthread_cond_wait(&lp_cond, &lp_lock);
+    cond_wait(&lp_cond, &lp_lock);
     mutex_unlock(&lp_lock);
   }
 }
@@ -7238,43 +7475,94 @@ static void *watchpool_thread(void __maybe_unused *userdata)
   return NULL;
 }
 
-/* Makes sure the hashmeter keeps going even if mining threads stall, updates
- * the screen at regular intervals, and restarts threads if they appear to have
- * died. */
-#define WATCHDOG_INTERVAL   2
-#define WATCHDOG_SICK_TIME    120
-#define WATCHDOG_DEAD_TIME    600
-#define WATCHDOG_SICK_COUNT   (WATCHDOG_SICK_TIME/WATCHDOG_INTERVAL)
-#define WATCHDOG_DEAD_COUNT   (WATCHDOG_DEAD_TIME/WATCHDOG_INTERVAL)
+/* Formats the status line from the totals the hashmeter keeps */
+static void format_statusline(void)
+{
+  char displayed_hashes[16], displayed_rolling[16];
+  double mhashes, rolling, secs, accepted, rejected, diff1;
+  uint64_t dh64, dr64;
+  int hw;
 
-static void *watchdog_thread(void __maybe_unused *userdata)
+  mutex_lock(&hash_lock);
+  mhashes = total_mhashes_done;
+  rolling = total_rolling;
+  secs = total_secs;
+  accepted = total_diff_accepted;
+  rejected = total_diff_rejected;
+  hw = hw_errors;
+  diff1 = total_diff1;
+  mutex_unlock(&hash_lock);
+
+  if (secs <= 0)
+    secs = 1;
+
+  dh64 = (double)mhashes / secs * 1000000ull;
+  dr64 = (double)rolling * 1000000ull;
+  suffix_string(dh64, displayed_hashes, sizeof(displayed_hashes), 4);
+  suffix_string(dr64, displayed_rolling, sizeof(displayed_rolling), 4);
+
+  snprintf(statusline, sizeof(statusline),
+    "%s(%ds):%s (avg):%sh/s | A:%.0f  R:%.0f  HW:%d  WU:%.3f/m",
+    want_per_device_stats ? "ALL " : "",
+    opt_log_interval, displayed_rolling, displayed_hashes,
+    accepted, rejected, hw,
+    diff1 / secs * 60);
+}
+
+static void log_statline(const char *line)
 {
-  const unsigned int interval = WATCHDOG_INTERVAL;
-  struct timeval zero_tv;
+  if (!curses_active) {
+    printf("%s          \r", line);
+    fflush(stdout);
+  } else
+    applog(LOG_INFO, "%s", line);
+}
 
-  pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
+/* Formats and prints the status line and device rows, so the mining threads
+ * only ever update counters. Redraws the screen every STATUS_INTERVAL and
+ * logs the status every --log seconds */
+#define STATUS_INTERVAL 1
 
-  RenameThread("Watchdog");
+static void *status_thread(void __maybe_unused *userdata)
+{
+  struct timeval last_log;
+
+  RenameThread("Status");
 
   set_lowprio();
-  memset(&zero_tv, 0, sizeof(struct timeval));
-  cgtime(&rotate_tv);
+  cgtime(&last_log);
 
   while (1) {
-    int i;
+    struct cgpu_info *cgpu;
     struct timeval now;
+    int i;
 
-    sleep(interval);
+    sleep(STATUS_INTERVAL);
 
-    discard_stale();
+    /* Only cancelled while sleeping, never while holding the curses lock */
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
 
-    hashmeter(-1, &zero_tv, 0);
+    format_statusline();
 
-    rd_lock(&mining_thr_lock);
+    cgtime(&now);
+    if (now.tv_sec - last_log.tv_sec >= opt_log_interval) {
+      last_log = now;
+      if (want_per_device_stats) {
+        char logline[255];
+
+        for (i = 0; i < total_devices; i++) {
+          cgpu = get_devices(i);
+          if (!cgpu || cgpu->deven == DEV_DISABLED)
+            continue;
+          get_statline(logline, sizeof(logline), cgpu);
+          log_statline(logline);
+        }
+      }
+      log_statline(statusline);
+    }
 
 #ifdef HAVE_CURSES
     if (curses_active_locked()) {
-      struct cgpu_info *cgpu;
       int count;
 
       change_logwinsize();
@@ -7289,7 +7577,9 @@ static void *watchdog_thread(void __maybe_unused *userdata)
         }
       }
 
-      touchwin(statuswin);
+      if (status_redraw)
+        touchwin(statuswin);
+      status_redraw = false;
       wrefresh(statuswin);
       touchwin(logwin);
       wrefresh(logwin);
@@ -7297,6 +7587,47 @@ static void *watchdog_thread(void __maybe_unused *userdata)
     }
 #endif
 
+    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+    pthread_testcancel();
+  }
+
+  return NULL;
+}
+
+/* Makes sure the hashmeter keeps going even if mining threads stall, and
+ * restarts threads if they appear to have died. */
+#define WATCHDOG_INTERVAL   2
+#define WATCHDOG_SICK_TIME    120
+#define WATCHDOG_DEAD_TIME    600
+#define WATCHDOG_SICK_COUNT   (WATCHDOG_SICK_TIME/WATCHDOG_INTERVAL)
+#define WATCHDOG_DEAD_COUNT   (WATCHDOG_DEAD_TIME/WATCHDOG_INTERVAL)
+
+static void *watchdog_thread(void __maybe_unused *userdata)
+{
+  const unsigned int interval = WATCHDOG_INTERVAL;
+  struct timeval zero_tv;
+
+  pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
+
+  RenameThread("Watchdog");
+
+  set_lowprio();
+  memset(&zero_tv, 0, sizeof(struct timeval));
+  cgtime(&rotate_tv);
+
+  while (1) {
+    int i;
+    struct timeval now;
+
+    sleep(interval);
+
+    discard_stale();
+    expire_stratum_shares();
+
+    hashmeter(-1, &zero_tv, 0);
+
+    rd_lock(&mining_thr_lock);
+
     cgtime(&now);
 
     if (!sched_paused && !should_run()) {
@@ -7339,6 +7670,8 @@ static void *watchdog_thread(void __maybe_unused *userdata)
       struct cgpu_info *cgpu = get_devices(i);
       struct thr_info *thr = cgpu->thr[0];
       enum dev_enable *denable;
+      struct gpu_sensors sensors;
+      bool busy;
       char dev_str[8];
       int gpu;
 
@@ -7349,17 +7682,17 @@ static void *watchdog_thread(void __maybe_unused *userdata)
       snprintf(dev_str, sizeof(dev_str), "%s%d", cgpu->drv->name, gpu);
 
 #ifdef HAVE_ADL
-      if (adl_active && cgpu->has_adl)
+      if (adl_active && cgpu->has_adl && gpu_sensors_hardware())
         gpu_autotune(gpu, denable);
-      if (opt_debug && cgpu->has_adl) {
-        int engineclock = 0, memclock = 0, activity = 0, fanspeed = 0, fanpercent = 0, powertune = 0;
-        float temp = 0, vddc = 0;
-
-        if (gpu_stats(gpu, &temp, &engineclock, &memclock, &vddc, &activity, &fanspeed, &fanpercent, &powertune))
-          applog(LOG_DEBUG, "%.1f C  F: %d%%(%dRPM)  E: %dMHz  M: %dMhz  V: %.3fV  A: %d%%  P: %d%%",
-          temp, fanpercent, fanspeed, engineclock, memclock, vddc, activity, powertune);
-      }
 #endif
+      /* From the last sample, the watchdog never waits on the driver. Only
+       * GPUs are sampled, other devices' ids do not index the GPU slots */
+      busy = cgpu->drv->drv_id == DRIVER_opencl && gpu_sensors_get(gpu, &sensors);
+      if (opt_debug && busy)
+        applog(LOG_DEBUG, "%.1f C  F: %d%%(%dRPM)  E: %dMHz  M: %dMhz  V: %.3fV  A: %d%%  P: %d%%",
+        sensors.temp, sensors.fanpercent, sensors.fanspeed, sensors.engineclock, sensors.memclock,
+        sensors.vddc, sensors.activity, sensors.powertune);
+      busy = busy && sensors.activity > 50;
 
       /* Thread is disabled or waiting on getwork */
       if (*denable == DEV_DISABLED || thr->getwork)
@@ -7377,13 +7710,10 @@ static void *watchdog_thread(void __maybe_unused *userdata)
         cgtime(&thr->sick);
 
         dev_error(cgpu, REASON_DEV_SICK_IDLE_60);
-#ifdef HAVE_ADL
-        if (adl_active && cgpu->has_adl && gpu_activity(gpu) > 50) {
+        if (busy) {
           applog(LOG_ERR, "GPU still showing activity suggesting a hard hang.");
           applog(LOG_ERR, "Will not attempt to auto-restart it.");
-        } else
-#endif
-        if (opt_restart) {
+        } else if (opt_restart) {
           applog(LOG_ERR, "%s: Attempting to restart", dev_str);
           reinit_device(cgpu);
         }
@@ -7397,12 +7727,8 @@ static void *watchdog_thread(void __maybe_unused *userdata)
            (cgpu->status == LIFE_SICK || cgpu->status == LIFE_DEAD)) {
         /* Attempt to restart a GPU that's sick or dead once every minute */
         cgtime(&thr->sick);
-#ifdef HAVE_ADL
-        if (adl_active && cgpu->has_adl && gpu_activity(gpu) > 50) {
-          /* Again do not attempt to restart a device that may have hard hung */
-        } else
-#endif
-        if (opt_restart)
+        /* Again do not attempt to restart a device that may have hard hung */
+        if (!busy && opt_restart)
           reinit_device(cgpu);
       }
     }
@@ -7491,6 +7817,9 @@ void print_summary(void)
     }
   }
 
+  if (opt_benchmark)
+    benchmark_report(total_secs, total_mhashes_done);
+
   applog(LOG_WARNING, "Summary of per device statistics:\n");
   for (i = 0; i < total_devices; ++i) {
     struct cgpu_info *cgpu = get_devices(i);
@@ -7525,6 +7854,8 @@ static void clean_up(bool restarting)
 #endif
   if (!restarting && !opt_realquiet && successful_connect)
     print_summary();
+  if (opt_trace)
+    trace_dump(opt_trace_file);
 
   curl_global_cleanup();
 }
@@ -8306,6 +8637,7 @@ int main(int argc, char *argv[])
 
   // this will set total_devices
   opencl_drv.drv_detect();
+  cpu_drv.drv_detect();
 
   if (opt_display_devs) {
     applog(LOG_ERR, "Devices detected:");
@@ -8369,6 +8701,25 @@ int main(int argc, char *argv[])
   if (!getenv("GPU_USE_SYNC_OBJECTS"))
     applog(LOG_WARNING, "WARNING: GPU_USE_SYNC_OBJECTS is not specified!");
 
+  /* Benchmark mode mines its own work from a single local pool */
+  if (opt_benchmark) {
+    struct pool *pool;
+
+    if (total_pools)
+      applog(LOG_WARNING, "Benchmark mode: ignoring the %d configured pool(s)", total_pools);
+    while (total_pools)
+      remove_pool(pools[0]);
+
+    pool = add_pool();
+    pool->rpc_url = strdup("Benchmark");
+    pool->rpc_user = strdup("benchmark");
+    pool->rpc_pass = strdup("benchmark");
+    free(pool->name);
+    pool->name = strdup("Benchmark");
+    set_algorithm(&pool->algorithm, default_profile.algorithm.name);
+    applog(LOG_NOTICE, "Benchmarking %s at share difficulty %g", pool->algorithm.name, opt_benchmark_diff);
+  }
+
   if (!total_pools) {
     applog(LOG_WARNING, "Need to specify at least one pool server.");
 #ifdef HAVE_CURSES
@@ -8397,6 +8748,8 @@ int main(int argc, char *argv[])
   /* Set the currentpool to pool 0 */
   currentpool = pools[0];
 
+  lowmem_init(mining_threads, opt_queue, total_pools);
+
 #ifdef HAVE_SYSLOG_H
   if (use_syslog)
     openlog(PACKAGE, LOG_PID, LOG_USER);
@@ -8499,6 +8852,12 @@ int main(int argc, char *argv[])
     quit(1, "watchpool thread create failed");
   pthread_detach(thr->pth);
 
+  sensors_thr_id = 6;
+  thr = &control_thr[sensors_thr_id];
+  /* start sensors thread, before the watchdog that reads its samples */
+  if (thr_info_create(thr, NULL, gpu_sensors_thread, NULL))
+    quit(1, "sensors thread create failed");
+
   watchdog_thr_id = 3;
   thr = &control_thr[watchdog_thr_id];
   /* start watchdog thread */
@@ -8506,6 +8865,12 @@ int main(int argc, char *argv[])
     quit(1, "watchdog thread create failed");
   pthread_detach(thr->pth);
 
+  status_thr_id = 1;
+  thr = &control_thr[status_thr_id];
+  /* start status thread */
+  if (thr_info_create(thr, NULL, status_thread, NULL))
+    quit(1, "status thread create failed");
+
   /* Create reinit gpu thread */
   gpur_thr_id = 4;
   thr = &control_thr[gpur_thr_id];
@@ -8567,7 +8932,7 @@ int main(int argc, char *argv[])
 
     /* Wait until hash_pop tells us we need to create more work */
     if (ts > max_staged) {
-      pthread_cond_timedwait(&gws_cond, stgd_lock, &then);
+      cond_timedwait(&gws_cond, stgd_lock, &then);
       ts = __total_staged();
     }
     mutex_unlock(stgd_lock);
@@ -8592,16 +8957,28 @@ int main(int argc, char *argv[])
       applog(LOG_WARNING, "%s not providing work fast enough", cp->name);
       cp->getfail_occasions++;
       total_go++;
-      if (!pool_localgen(cp))
+      /* --lowmem sized its work pool from the queue depth */
+      if (!pool_localgen(cp) && !opt_lowmem)
         applog(LOG_INFO, "Increasing queue to %d", ++opt_queue);
     }
     pool = select_pool(lagging);
 retry:
+    if (opt_benchmark) {
+      gen_benchmark_work(pool, work);
+      applog(LOG_DEBUG, "Generated benchmark work");
+      stage_work(work);
+      continue;
+    }
+
     if (pool->has_stratum) {
       while (!pool->stratum_active || !pool->stratum_notify) {
         struct pool *altpool = select_pool(true);
 
-        cgsleep_ms(5000);
+        /* A hot standby pool that is live can take over without waiting,
+         * others would have this loop spin through pools that are not */
+        if (!opt_hot_standby || altpool == pool ||
+            !altpool->stratum_active || !altpool->stratum_notify)
+          cgsleep_ms(5000);
         if (altpool != pool) {
           pool = altpool;
           goto retry;
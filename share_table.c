@@ -0,0 +1,249 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "miner.h"
+#include "share_table.h"
+#include "util.h"
+
+/* Seconds an unanswered stratum share is kept before it counts as lost,
+ * 0 keeps it until the pool disconnects */
+int opt_share_timeout = 120;
+
+#define SHARE_TABLE_MASK (SHARE_TABLE_SLOTS - 1)
+#define SHARE_WHEEL_MASK (SHARE_WHEEL_SIZE - 1)
+
+/* Per pool table of unanswered shares, indexed by id & SHARE_TABLE_MASK. A
+ * slot is in use while its work is set. Shares that can time out are also
+ * linked into a bucket of the timer wheel by slot index */
+struct share_table {
+  pthread_mutex_t lock;
+  struct stratum_share slots[SHARE_TABLE_SLOTS];
+  /* First slot of each bucket or -1. The SHARE_WHEEL_SIZE level 0 buckets
+   * are single seconds, the level 1 buckets after them span
+   * SHARE_WHEEL_SIZE seconds each and are cascaded down to level 0 as the
+   * wheel reaches them */
+  int wheel[2 * SHARE_WHEEL_SIZE];
+  time_t wheel_time; /* Last second expired */
+  struct share_table_stats stats;
+};
+
+struct share_table *share_table_new(void)
+{
+  struct share_table *table;
+  int i;
+
+  table = (struct share_table *)calloc(1, sizeof(struct share_table));
+  if (unlikely(!table))
+    quit(1, "Failed to calloc share table in share_table_new");
+  mutex_init(&table->lock);
+  for (i = 0; i < 2 * SHARE_WHEEL_SIZE; i++)
+    table->wheel[i] = -1;
+  table->wheel_time = time(NULL);
+
+  return table;
+}
+
+static void wheel_link(struct share_table *table, int slot)
+{
+  struct stratum_share *sshare = &table->slots[slot];
+  time_t when = sshare->expires;
+  int *head;
+
+  /* Already due, expire it on the next tick */
+  if (when <= table->wheel_time)
+    when = table->wheel_time + 1;
+
+  if (when - table->wheel_time < SHARE_WHEEL_SIZE)
+    sshare->wheel_bucket = when & SHARE_WHEEL_MASK;
+  else
+    sshare->wheel_bucket = SHARE_WHEEL_SIZE + ((when >> SHARE_WHEEL_BITS) & SHARE_WHEEL_MASK);
+  head = &table->wheel[sshare->wheel_bucket];
+
+  sshare->wheel_prev = -1;
+  sshare->wheel_next = *head;
+  if (*head >= 0)
+    table->slots[*head].wheel_prev = slot;
+  *head = slot;
+}
+
+static void wheel_unlink(struct share_table *table, int slot)
+{
+  struct stratum_share *sshare = &table->slots[slot];
+
+  if (sshare->wheel_bucket < 0)
+    return;
+
+  if (sshare->wheel_prev >= 0)
+    table->slots[sshare->wheel_prev].wheel_next = sshare->wheel_next;
+  else
+    table->wheel[sshare->wheel_bucket] = sshare->wheel_next;
+  if (sshare->wheel_next >= 0)
+    table->slots[sshare->wheel_next].wheel_prev = sshare->wheel_prev;
+  sshare->wheel_bucket = -1;
+}
+
+/* Takes a share out of its slot, the caller accounts for it */
+static void slot_take(struct share_table *table, int slot, struct stratum_share *sshare)
+{
+  wheel_unlink(table, slot);
+  memcpy(sshare, &table->slots[slot], sizeof(struct stratum_share));
+  table->slots[slot].work = NULL;
+  table->stats.outstanding--;
+}
+
+bool share_table_add(struct share_table *table, struct stratum_share *sshare, struct stratum_share *evicted)
+{
+  int slot = sshare->id & SHARE_TABLE_MASK;
+  int timeout = opt_share_timeout;
+  bool ret = false;
+
+  mutex_lock(&table->lock);
+  if (table->slots[slot].work) {
+    slot_take(table, slot, evicted);
+    table->stats.lost++;
+    ret = true;
+  }
+
+  memcpy(&table->slots[slot], sshare, sizeof(struct stratum_share));
+  table->slots[slot].wheel_bucket = -1;
+  if (timeout > 0) {
+    table->slots[slot].expires = sshare->tv_sent.tv_sec + timeout;
+    wheel_link(table, slot);
+  }
+  table->stats.outstanding++;
+  mutex_unlock(&table->lock);
+
+  return ret;
+}
+
+bool share_table_take(struct share_table *table, int id, struct stratum_share *sshare)
+{
+  int slot = id & SHARE_TABLE_MASK;
+  struct timeval now;
+  double ack_ms;
+
+  cgtime(&now);
+
+  mutex_lock(&table->lock);
+  if (!table->slots[slot].work || table->slots[slot].id != id) {
+    mutex_unlock(&table->lock);
+    return false;
+  }
+  slot_take(table, slot, sshare);
+  ack_ms = tdiff(&now, &sshare->tv_sent) * 1000.0;
+  table->stats.acked++;
+  table->stats.ack_total_ms += ack_ms;
+  if (ack_ms > table->stats.ack_max_ms)
+    table->stats.ack_max_ms = ack_ms;
+  mutex_unlock(&table->lock);
+
+  return true;
+}
+
+bool share_table_cancel(struct share_table *table, int id)
+{
+  int slot = id & SHARE_TABLE_MASK;
+  struct stratum_share sshare;
+  bool ret = false;
+
+  mutex_lock(&table->lock);
+  if (table->slots[slot].work && table->slots[slot].id == id) {
+    slot_take(table, slot, &sshare);
+    ret = true;
+  }
+  mutex_unlock(&table->lock);
+
+  return ret;
+}
+
+/* Relinks every share of a bucket, either down a level or as expired into
+ * out when it is due */
+static void wheel_drain(struct share_table *table, int *head, struct stratum_share *out, int *count)
+{
+  int slot = *head, next;
+
+  *head = -1;
+  for (; slot >= 0; slot = next) {
+    struct stratum_share *sshare = &table->slots[slot];
+
+    next = sshare->wheel_next;
+    sshare->wheel_bucket = -1;
+    if (sshare->expires <= table->wheel_time) {
+      slot_take(table, slot, &out[(*count)++]);
+      table->stats.lost++;
+    } else
+      wheel_link(table, slot);
+  }
+}
+
+struct stratum_share *share_table_take_expired(struct share_table *table, time_t now, bool all, int *count)
+{
+  struct stratum_share *out = NULL;
+  int slot;
+
+  *count = 0;
+
+  mutex_lock(&table->lock);
+  if (table->stats.outstanding) {
+    out = (struct stratum_share *)calloc(table->stats.outstanding, sizeof(struct stratum_share));
+    /* Try again on the next call */
+    if (unlikely(!out)) {
+      mutex_unlock(&table->lock);
+      return NULL;
+    }
+  }
+
+  if (all) {
+    /* Disconnected, everything goes and the wheel is left empty */
+    for (slot = 0; slot < SHARE_TABLE_SLOTS; slot++) {
+      if (table->slots[slot].work)
+        slot_take(table, slot, &out[(*count)++]);
+    }
+  } else {
+    while (table->wheel_time < now) {
+      table->wheel_time++;
+      if (!(table->wheel_time & SHARE_WHEEL_MASK))
+        wheel_drain(table, &table->wheel[SHARE_WHEEL_SIZE + ((table->wheel_time >> SHARE_WHEEL_BITS) & SHARE_WHEEL_MASK)], out, count);
+      wheel_drain(table, &table->wheel[table->wheel_time & SHARE_WHEEL_MASK], out, count);
+    }
+  }
+  mutex_unlock(&table->lock);
+
+  if (!*count) {
+    free(out);
+    out = NULL;
+  }
+
+  return out;
+}
+
+int share_table_outstanding(struct share_table *table)
+{
+  int ret;
+
+  mutex_lock(&table->lock);
+  ret = table->stats.outstanding;
+  mutex_unlock(&table->lock);
+
+  return ret;
+}
+
+void share_table_get_stats(struct share_table *table, struct share_table_stats *stats)
+{
+  mutex_lock(&table->lock);
+  memcpy(stats, &table->stats, sizeof(struct share_table_stats));
+  mutex_unlock(&table->lock);
+}
@@ -0,0 +1,64 @@
+#ifndef SHARE_TABLE_H
+#define SHARE_TABLE_H
+
+#include "miner.h"
+
+/* Shares a pool can have unanswered at once, a power of 2. Ids are taken
+ * from the global swork_id so a slot is reused every SHARE_TABLE_SLOTS
+ * requests at the earliest */
+#define SHARE_TABLE_SLOTS 1024
+
+/* Timer wheel of two levels of 64 one second ticks. --share-timeout is
+ * limited to what the second level can hold */
+#define SHARE_WHEEL_BITS 6
+#define SHARE_WHEEL_SIZE (1 << SHARE_WHEEL_BITS)
+#define SHARE_TIMEOUT_MAX ((SHARE_WHEEL_SIZE - 1) * SHARE_WHEEL_SIZE)
+
+/* A stratum share submitted that has not had a response yet */
+struct stratum_share {
+  struct work *work;
+  int id;
+  time_t sshare_time;
+  time_t sshare_sent;
+  struct timeval tv_sent;
+
+  /* Private to share_table.c */
+  time_t expires;
+  int wheel_bucket;
+  int wheel_prev, wheel_next;
+};
+
+struct share_table_stats {
+  int outstanding;
+  uint64_t acked;
+  uint64_t lost;      /* Expired or evicted without a response */
+  double ack_total_ms;
+  double ack_max_ms;
+};
+
+extern int opt_share_timeout;
+
+extern struct share_table *share_table_new(void);
+
+/* Tracks a submitted share, copying sshare into its slot. If the slot
+ * still holds a share from SHARE_TABLE_SLOTS ids ago, that share is
+ * copied to evicted and true returned, for the caller to count as lost */
+extern bool share_table_add(struct share_table *table, struct stratum_share *sshare, struct stratum_share *evicted);
+
+/* Takes the share with the id of a response out of the table, records
+ * its ack latency and returns false if it was not there */
+extern bool share_table_take(struct share_table *table, int id, struct stratum_share *sshare);
+
+/* Takes back a share whose submission failed, without counting it as
+ * answered or lost. Returns false if a response already took it */
+extern bool share_table_cancel(struct share_table *table, int id);
+
+/* Takes the shares whose timeout has passed, or every share when all is
+ * set, out of the table. Returns an array the caller frees, or NULL with
+ * count 0 when there are none */
+extern struct stratum_share *share_table_take_expired(struct share_table *table, time_t now, bool all, int *count);
+
+extern int share_table_outstanding(struct share_table *table);
+extern void share_table_get_stats(struct share_table *table, struct share_table_stats *stats);
+
+#endif /* SHARE_TABLE_H */
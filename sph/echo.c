@@ -35,6 +35,7 @@
 #include <limits.h>
 
 #include "sph_echo.h"
+#include "sph_cpu.h"
 
 #if SPH_SMALL_FOOTPRINT && !defined SPH_SMALL_FOOTPRINT_ECHO
 #define SPH_SMALL_FOOTPRINT_ECHO   1
@@ -707,11 +708,252 @@ echo_big_init(sph_echo_big_context *sc, unsigned out_len)
 	sc->C0 = sc->C1 = sc->C2 = sc->C3 = 0;
 }
 
+#if SPH_AESNI
+
+/*
+ * AES-NI implementation. Each 128-bit word of the ECHO state is an AES
+ * state whose bytes are in the same order as AES-NI expects, so the two
+ * AES rounds of BIG.SubWords are two AESENC (the second one with a zero
+ * key), and BIG.ShiftRows and BIG.MixColumns work on whole words.
+ *
+ * With VAES, words n and n + 8 (the same row, columns c and c + 2) share
+ * a 256-bit register: BIG.MixColumns then processes two columns at once,
+ * and BIG.ShiftRows only moves registers and swaps their halves.
+ */
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#if SPH_VAES
+#include <immintrin.h>
+#endif
+
+/*
+ * Salt for word n of the current round: the 128-bit counter (klo, khi)
+ * plus n.
+ */
+#define ECHO_KEY(klo, khi, n)   _mm_set_epi64x( \
+		(long long)((khi) + ((klo) + (n) < (klo))), \
+		(long long)((klo) + (n)))
+
+#define ECHO_NEXT_ROUND(klo, khi)   do { \
+		sph_u64 nlo = (klo) + 16; \
+		(khi) += (nlo < (klo)); \
+		(klo) = nlo; \
+	} while (0)
+
+#define ECHO_XTIME(x)   _mm_xor_si128(_mm_add_epi8(x, x), \
+		_mm_and_si128(_mm_cmpgt_epi8(_mm_setzero_si128(), x), \
+		_mm_set1_epi8(0x1B)))
+
+#define ECHO_MIX_COLUMN_NI(ia, ib, ic, id)   do { \
+		__m128i a = W[ia]; \
+		__m128i b = W[ib]; \
+		__m128i c = W[ic]; \
+		__m128i d = W[id]; \
+		__m128i ab = _mm_xor_si128(a, b); \
+		__m128i bc = _mm_xor_si128(b, c); \
+		__m128i cd = _mm_xor_si128(c, d); \
+		__m128i abx = ECHO_XTIME(ab); \
+		__m128i bcx = ECHO_XTIME(bc); \
+		__m128i cdx = ECHO_XTIME(cd); \
+		W[ia] = _mm_xor_si128(abx, _mm_xor_si128(bc, d)); \
+		W[ib] = _mm_xor_si128(bcx, _mm_xor_si128(a, cd)); \
+		W[ic] = _mm_xor_si128(cdx, _mm_xor_si128(ab, d)); \
+		W[id] = _mm_xor_si128(_mm_xor_si128(abx, bcx), \
+			_mm_xor_si128(cdx, _mm_xor_si128(ab, c))); \
+	} while (0)
+
+/*
+ * Compress one block with the AES-NI code. V is the chaining value
+ * (nv = 4 words for ECHO-224/256, 8 for ECHO-384/512) and the message
+ * block fills the remaining 16 - nv words.
+ */
+static SPH_TARGET_AESNI void
+echo_compress_aesni(void *V, unsigned nv, const unsigned char *buf,
+	sph_u32 C0, sph_u32 C1, sph_u32 C2, sph_u32 C3, unsigned rounds)
+{
+	__m128i W[16];
+	__m128i *VV = (__m128i *)V;
+	const __m128i *M = (const __m128i *)buf;
+	__m128i z = _mm_setzero_si128();
+	sph_u64 klo = (sph_u64)C0 | ((sph_u64)C1 << 32);
+	sph_u64 khi = (sph_u64)C2 | ((sph_u64)C3 << 32);
+	unsigned u, n;
+
+	for (u = 0; u < nv; u ++)
+		W[u] = _mm_loadu_si128(VV + u);
+	for (u = nv; u < 16; u ++)
+		W[u] = _mm_loadu_si128(M + u - nv);
+
+	for (u = 0; u < rounds; u ++) {
+		__m128i t;
+
+		for (n = 0; n < 16; n ++)
+			W[n] = _mm_aesenc_si128(_mm_aesenc_si128(W[n],
+				ECHO_KEY(klo, khi, n)), z);
+		ECHO_NEXT_ROUND(klo, khi);
+
+		t = W[1]; W[1] = W[5]; W[5] = W[9]; W[9] = W[13]; W[13] = t;
+		t = W[2]; W[2] = W[10]; W[10] = t;
+		t = W[6]; W[6] = W[14]; W[14] = t;
+		t = W[15]; W[15] = W[11]; W[11] = W[7]; W[7] = W[3]; W[3] = t;
+
+		ECHO_MIX_COLUMN_NI(0, 1, 2, 3);
+		ECHO_MIX_COLUMN_NI(4, 5, 6, 7);
+		ECHO_MIX_COLUMN_NI(8, 9, 10, 11);
+		ECHO_MIX_COLUMN_NI(12, 13, 14, 15);
+	}
+
+	if (nv == 8) {
+		for (u = 0; u < 8; u ++)
+			_mm_storeu_si128(VV + u, _mm_xor_si128(
+				_mm_xor_si128(_mm_loadu_si128(VV + u),
+				_mm_loadu_si128(M + u)),
+				_mm_xor_si128(W[u], W[u + 8])));
+	} else {
+		for (u = 0; u < 4; u ++) {
+			__m128i x;
+
+			x = _mm_xor_si128(_mm_loadu_si128(M + u),
+				_mm_loadu_si128(M + u + 4));
+			x = _mm_xor_si128(x, _mm_loadu_si128(M + u + 8));
+			x = _mm_xor_si128(x, _mm_xor_si128(W[u], W[u + 4]));
+			x = _mm_xor_si128(x, _mm_xor_si128(W[u + 8], W[u + 12]));
+			_mm_storeu_si128(VV + u,
+				_mm_xor_si128(_mm_loadu_si128(VV + u), x));
+		}
+	}
+}
+
+#if SPH_VAES
+
+#define ECHO_XTIME2(x)   _mm256_xor_si256(_mm256_add_epi8(x, x), \
+		_mm256_and_si256(_mm256_cmpgt_epi8(_mm256_setzero_si256(), x), \
+		_mm256_set1_epi8(0x1B)))
+
+#define ECHO_SWAP2(x)   _mm256_permute4x64_epi64(x, 0x4E)
+
+#define ECHO_MIX_COLUMN_V(ia, ib, ic, id)   do { \
+		__m256i a = Y[ia]; \
+		__m256i b = Y[ib]; \
+		__m256i c = Y[ic]; \
+		__m256i d = Y[id]; \
+		__m256i ab = _mm256_xor_si256(a, b); \
+		__m256i bc = _mm256_xor_si256(b, c); \
+		__m256i cd = _mm256_xor_si256(c, d); \
+		__m256i abx = ECHO_XTIME2(ab); \
+		__m256i bcx = ECHO_XTIME2(bc); \
+		__m256i cdx = ECHO_XTIME2(cd); \
+		Y[ia] = _mm256_xor_si256(abx, _mm256_xor_si256(bc, d)); \
+		Y[ib] = _mm256_xor_si256(bcx, _mm256_xor_si256(a, cd)); \
+		Y[ic] = _mm256_xor_si256(cdx, _mm256_xor_si256(ab, d)); \
+		Y[id] = _mm256_xor_si256(_mm256_xor_si256(abx, bcx), \
+			_mm256_xor_si256(cdx, _mm256_xor_si256(ab, c))); \
+	} while (0)
+
+/*
+ * As echo_compress_aesni(), with Y[k] holding words k (low half) and
+ * k + 8 (high half).
+ */
+static SPH_TARGET_VAES void
+echo_compress_vaes(void *V, unsigned nv, const unsigned char *buf,
+	sph_u32 C0, sph_u32 C1, sph_u32 C2, sph_u32 C3, unsigned rounds)
+{
+	__m128i W[16];
+	__m256i Y[8];
+	__m128i *VV = (__m128i *)V;
+	const __m128i *M = (const __m128i *)buf;
+	__m256i z = _mm256_setzero_si256();
+	sph_u64 klo = (sph_u64)C0 | ((sph_u64)C1 << 32);
+	sph_u64 khi = (sph_u64)C2 | ((sph_u64)C3 << 32);
+	unsigned u, n;
+
+	for (u = 0; u < nv; u ++)
+		W[u] = _mm_loadu_si128(VV + u);
+	for (u = nv; u < 16; u ++)
+		W[u] = _mm_loadu_si128(M + u - nv);
+	for (n = 0; n < 8; n ++)
+		Y[n] = _mm256_set_m128i(W[n + 8], W[n]);
+
+	for (u = 0; u < rounds; u ++) {
+		__m256i t;
+
+		for (n = 0; n < 8; n ++)
+			Y[n] = _mm256_aesenc_epi128(_mm256_aesenc_epi128(Y[n],
+				_mm256_set_m128i(ECHO_KEY(klo, khi, n + 8),
+				ECHO_KEY(klo, khi, n))), z);
+		ECHO_NEXT_ROUND(klo, khi);
+
+		t = Y[1]; Y[1] = Y[5]; Y[5] = ECHO_SWAP2(t);
+		Y[2] = ECHO_SWAP2(Y[2]);
+		Y[6] = ECHO_SWAP2(Y[6]);
+		t = Y[3]; Y[3] = ECHO_SWAP2(Y[7]); Y[7] = t;
+
+		ECHO_MIX_COLUMN_V(0, 1, 2, 3);
+		ECHO_MIX_COLUMN_V(4, 5, 6, 7);
+	}
+
+	for (n = 0; n < 8; n ++) {
+		W[n] = _mm256_castsi256_si128(Y[n]);
+		W[n + 8] = _mm256_extracti128_si256(Y[n], 1);
+	}
+	if (nv == 8) {
+		for (u = 0; u < 8; u ++)
+			_mm_storeu_si128(VV + u, _mm_xor_si128(
+				_mm_xor_si128(_mm_loadu_si128(VV + u),
+				_mm_loadu_si128(M + u)),
+				_mm_xor_si128(W[u], W[u + 8])));
+	} else {
+		for (u = 0; u < 4; u ++) {
+			__m128i x;
+
+			x = _mm_xor_si128(_mm_loadu_si128(M + u),
+				_mm_loadu_si128(M + u + 4));
+			x = _mm_xor_si128(x, _mm_loadu_si128(M + u + 8));
+			x = _mm_xor_si128(x, _mm_xor_si128(W[u], W[u + 4]));
+			x = _mm_xor_si128(x, _mm_xor_si128(W[u + 8], W[u + 12]));
+			_mm_storeu_si128(VV + u,
+				_mm_xor_si128(_mm_loadu_si128(VV + u), x));
+		}
+	}
+}
+
+#endif
+
+/*
+ * Runs the compression function with the fastest available code;
+ * returns 0 if the portable code must be used.
+ */
+static int
+echo_compress_accel(void *V, unsigned nv, const unsigned char *buf,
+	sph_u32 C0, sph_u32 C1, sph_u32 C2, sph_u32 C3, unsigned rounds)
+{
+#if SPH_VAES
+	if (sph_cpu_has_vaes()) {
+		echo_compress_vaes(V, nv, buf, C0, C1, C2, C3, rounds);
+		return 1;
+	}
+#endif
+	if (sph_cpu_has_aesni()) {
+		echo_compress_aesni(V, nv, buf, C0, C1, C2, C3, rounds);
+		return 1;
+	}
+	return 0;
+}
+
+#endif
+
 static void
 echo_small_compress(sph_echo_small_context *sc)
 {
 	DECL_STATE_SMALL
 
+#if SPH_AESNI
+	if (echo_compress_accel(&sc->u, 4, sc->buf,
+		sc->C0, sc->C1, sc->C2, sc->C3, 8))
+		return;
+#endif
 	COMPRESS_SMALL(sc);
 }
 
@@ -720,6 +962,11 @@ echo_big_compress(sph_echo_big_context *sc)
 {
 	DECL_STATE_BIG
 
+#if SPH_AESNI
+	if (echo_compress_accel(&sc->u, 8, sc->buf,
+		sc->C0, sc->C1, sc->C2, sc->C3, 10))
+		return;
+#endif
 	COMPRESS_BIG(sc);
 }
 
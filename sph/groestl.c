@@ -34,6 +34,7 @@
 #include <string.h>
 
 #include "sph_groestl.h"
+#include "sph_cpu.h"
 
 #if SPH_SMALL_FOOTPRINT && !defined SPH_SMALL_FOOTPRINT_GROESTL
 #define SPH_SMALL_FOOTPRINT_GROESTL   1
@@ -2730,6 +2731,279 @@ static const sph_u32 T3dn[] = {
 
 #endif
 
+#if SPH_AESNI && USE_LE
+
+/*
+ * AES-NI implementation of the Groestl-512 permutations. The state is
+ * kept as eight 128-bit rows (byte j of row i is the byte in row i and
+ * column j). SubBytes is AESENCLAST with a zero key; that instruction
+ * also applies the AES ShiftRows, which is undone by the same PSHUFB
+ * that performs ShiftBytes. MixBytes is computed on whole rows.
+ *
+ * With USE_LE, the state words and the message block hold the matrix
+ * column by column, one byte per row, so they are transposed on the way
+ * in and out.
+ */
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#define GROESTL_AESNI   1
+
+/*
+ * PSHUFB masks for ShiftBytes followed by the inverse of the AES
+ * ShiftRows, for each row of P and Q.
+ */
+static const unsigned char groestl_ni_shift_p[8][16] = {
+	{  0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3 },
+	{  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4 },
+	{  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4,  1, 14, 11,  8,  5 },
+	{  3,  0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6 },
+	{  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7 },
+	{  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4,  1, 14, 11,  8 },
+	{  6,  3,  0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9 },
+	{ 11,  8,  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4,  1, 14 }
+};
+
+static const unsigned char groestl_ni_shift_q[8][16] = {
+	{  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4 },
+	{  3,  0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6 },
+	{  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4,  1, 14, 11,  8 },
+	{ 11,  8,  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4,  1, 14 },
+	{  0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3 },
+	{  2, 15, 12,  9,  6,  3,  0, 13, 10,  7,  4,  1, 14, 11,  8,  5 },
+	{  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3,  0, 13, 10,  7 },
+	{  6,  3,  0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9 }
+};
+
+/* Column numbers in the high nibble, for the round constants */
+static const unsigned char groestl_ni_cols[16] = {
+	0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70,
+	0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0
+};
+
+#define GROESTL_XTIME(x)   _mm_xor_si128(_mm_add_epi8(x, x), \
+		_mm_and_si128(_mm_cmpgt_epi8(_mm_setzero_si128(), x), \
+		_mm_set1_epi8(0x1B)))
+
+/*
+ * 8x8 byte transposition of the low 64 bits of a0..a7: the result holds
+ * the transposed rows two by two, rows 0 and 1 in d[0] and so on.
+ */
+#define GROESTL_T8(d, a0, a1, a2, a3, a4, a5, a6, a7)   do { \
+		__m128i t0 = _mm_unpacklo_epi8(a0, a1); \
+		__m128i t1 = _mm_unpacklo_epi8(a2, a3); \
+		__m128i t2 = _mm_unpacklo_epi8(a4, a5); \
+		__m128i t3 = _mm_unpacklo_epi8(a6, a7); \
+		__m128i u0 = _mm_unpacklo_epi16(t0, t1); \
+		__m128i u1 = _mm_unpackhi_epi16(t0, t1); \
+		__m128i u2 = _mm_unpacklo_epi16(t2, t3); \
+		__m128i u3 = _mm_unpackhi_epi16(t2, t3); \
+		(d)[0] = _mm_unpacklo_epi32(u0, u2); \
+		(d)[1] = _mm_unpackhi_epi32(u0, u2); \
+		(d)[2] = _mm_unpacklo_epi32(u1, u3); \
+		(d)[3] = _mm_unpackhi_epi32(u1, u3); \
+	} while (0)
+
+/* 128 bytes in column order to eight rows */
+static SPH_TARGET_AESNI void
+groestl_ni_load(__m128i R[8], const unsigned char *src)
+{
+	const __m128i *s = (const __m128i *)src;
+	__m128i c[8], lo[4], hi[4];
+	int i;
+
+	for (i = 0; i < 8; i ++)
+		c[i] = _mm_loadu_si128(s + i);
+	GROESTL_T8(lo, c[0], _mm_srli_si128(c[0], 8),
+		c[1], _mm_srli_si128(c[1], 8),
+		c[2], _mm_srli_si128(c[2], 8),
+		c[3], _mm_srli_si128(c[3], 8));
+	GROESTL_T8(hi, c[4], _mm_srli_si128(c[4], 8),
+		c[5], _mm_srli_si128(c[5], 8),
+		c[6], _mm_srli_si128(c[6], 8),
+		c[7], _mm_srli_si128(c[7], 8));
+	for (i = 0; i < 4; i ++) {
+		R[2 * i] = _mm_unpacklo_epi64(lo[i], hi[i]);
+		R[2 * i + 1] = _mm_unpackhi_epi64(lo[i], hi[i]);
+	}
+}
+
+/* Eight rows back to 128 bytes in column order */
+static SPH_TARGET_AESNI void
+groestl_ni_store(unsigned char *dst, const __m128i R[8])
+{
+	__m128i *d = (__m128i *)dst;
+	__m128i lo[4], hi[4];
+	int i;
+
+	GROESTL_T8(lo, R[0], R[1], R[2], R[3], R[4], R[5], R[6], R[7]);
+	GROESTL_T8(hi, _mm_srli_si128(R[0], 8), _mm_srli_si128(R[1], 8),
+		_mm_srli_si128(R[2], 8), _mm_srli_si128(R[3], 8),
+		_mm_srli_si128(R[4], 8), _mm_srli_si128(R[5], 8),
+		_mm_srli_si128(R[6], 8), _mm_srli_si128(R[7], 8));
+	for (i = 0; i < 4; i ++) {
+		_mm_storeu_si128(d + i, lo[i]);
+		_mm_storeu_si128(d + i + 4, hi[i]);
+	}
+}
+
+/*
+ * MixBytes: row i becomes the sum of c[m] * R[i + m] for
+ * c = (2, 2, 3, 4, 5, 3, 5, 7), computed as 2 * (A + 2 * B) + C.
+ */
+#define GROESTL_MIX_ROW(d, r0, r1, r2, r3, r4, r5, r6, r7)   do { \
+		__m128i r57 = _mm_xor_si128(r5, r7); \
+		__m128i r46 = _mm_xor_si128(r4, r6); \
+		__m128i a, b, c; \
+		a = _mm_xor_si128(_mm_xor_si128(r0, r1), \
+			_mm_xor_si128(r2, r57)); \
+		b = _mm_xor_si128(_mm_xor_si128(r3, r7), r46); \
+		c = _mm_xor_si128(_mm_xor_si128(r2, r57), r46); \
+		b = GROESTL_XTIME(b); \
+		a = GROESTL_XTIME(_mm_xor_si128(a, b)); \
+		d = _mm_xor_si128(a, c); \
+	} while (0)
+
+#define GROESTL_MIX   do { \
+		__m128i T0, T1, T2, T3, T4, T5, T6, T7; \
+		GROESTL_MIX_ROW(T0, R0, R1, R2, R3, R4, R5, R6, R7); \
+		GROESTL_MIX_ROW(T1, R1, R2, R3, R4, R5, R6, R7, R0); \
+		GROESTL_MIX_ROW(T2, R2, R3, R4, R5, R6, R7, R0, R1); \
+		GROESTL_MIX_ROW(T3, R3, R4, R5, R6, R7, R0, R1, R2); \
+		GROESTL_MIX_ROW(T4, R4, R5, R6, R7, R0, R1, R2, R3); \
+		GROESTL_MIX_ROW(T5, R5, R6, R7, R0, R1, R2, R3, R4); \
+		GROESTL_MIX_ROW(T6, R6, R7, R0, R1, R2, R3, R4, R5); \
+		GROESTL_MIX_ROW(T7, R7, R0, R1, R2, R3, R4, R5, R6); \
+		R0 = T0; \
+		R1 = T1; \
+		R2 = T2; \
+		R3 = T3; \
+		R4 = T4; \
+		R5 = T5; \
+		R6 = T6; \
+		R7 = T7; \
+	} while (0)
+
+/* SubBytes and ShiftBytes of one row, with the masks in table s */
+#define GROESTL_SUB_SHIFT(x, s, i)   \
+	_mm_aesenclast_si128(_mm_shuffle_epi8(x, \
+		_mm_loadu_si128((const __m128i *)(s)[i])), z)
+
+#define GROESTL_SUB_SHIFT_ALL(s)   do { \
+		R0 = GROESTL_SUB_SHIFT(R0, s, 0); \
+		R1 = GROESTL_SUB_SHIFT(R1, s, 1); \
+		R2 = GROESTL_SUB_SHIFT(R2, s, 2); \
+		R3 = GROESTL_SUB_SHIFT(R3, s, 3); \
+		R4 = GROESTL_SUB_SHIFT(R4, s, 4); \
+		R5 = GROESTL_SUB_SHIFT(R5, s, 5); \
+		R6 = GROESTL_SUB_SHIFT(R6, s, 6); \
+		R7 = GROESTL_SUB_SHIFT(R7, s, 7); \
+	} while (0)
+
+#define GROESTL_READ_ROWS(R)   do { \
+		R0 = (R)[0]; \
+		R1 = (R)[1]; \
+		R2 = (R)[2]; \
+		R3 = (R)[3]; \
+		R4 = (R)[4]; \
+		R5 = (R)[5]; \
+		R6 = (R)[6]; \
+		R7 = (R)[7]; \
+	} while (0)
+
+#define GROESTL_WRITE_ROWS(R)   do { \
+		(R)[0] = R0; \
+		(R)[1] = R1; \
+		(R)[2] = R2; \
+		(R)[3] = R3; \
+		(R)[4] = R4; \
+		(R)[5] = R5; \
+		(R)[6] = R6; \
+		(R)[7] = R7; \
+	} while (0)
+
+static SPH_TARGET_AESNI void
+groestl_ni_perm_p(__m128i R[8])
+{
+	const __m128i cols = _mm_loadu_si128((const __m128i *)groestl_ni_cols);
+	__m128i z = _mm_setzero_si128();
+	__m128i R0, R1, R2, R3, R4, R5, R6, R7;
+	int r;
+
+	GROESTL_READ_ROWS(R);
+	for (r = 0; r < 14; r ++) {
+		R0 = _mm_xor_si128(R0,
+			_mm_xor_si128(cols, _mm_set1_epi8((char)r)));
+		GROESTL_SUB_SHIFT_ALL(groestl_ni_shift_p);
+		GROESTL_MIX;
+	}
+	GROESTL_WRITE_ROWS(R);
+}
+
+static SPH_TARGET_AESNI void
+groestl_ni_perm_q(__m128i R[8])
+{
+	const __m128i cols = _mm_loadu_si128((const __m128i *)groestl_ni_cols);
+	__m128i ones = _mm_set1_epi8((char)0xFF);
+	__m128i z = _mm_setzero_si128();
+	__m128i R0, R1, R2, R3, R4, R5, R6, R7;
+	int r;
+
+	GROESTL_READ_ROWS(R);
+	for (r = 0; r < 14; r ++) {
+		R0 = _mm_xor_si128(R0, ones);
+		R1 = _mm_xor_si128(R1, ones);
+		R2 = _mm_xor_si128(R2, ones);
+		R3 = _mm_xor_si128(R3, ones);
+		R4 = _mm_xor_si128(R4, ones);
+		R5 = _mm_xor_si128(R5, ones);
+		R6 = _mm_xor_si128(R6, ones);
+		R7 = _mm_xor_si128(R7, _mm_xor_si128(ones,
+			_mm_xor_si128(cols, _mm_set1_epi8((char)r))));
+		GROESTL_SUB_SHIFT_ALL(groestl_ni_shift_q);
+		GROESTL_MIX;
+	}
+	GROESTL_WRITE_ROWS(R);
+}
+
+/* H ^= P(H ^ M) ^ Q(M) */
+static SPH_TARGET_AESNI void
+groestl_big_compress_aesni(void *H, const unsigned char *buf)
+{
+	__m128i h[8], g[8], m[8];
+	int i;
+
+	groestl_ni_load(h, (const unsigned char *)H);
+	groestl_ni_load(m, buf);
+	for (i = 0; i < 8; i ++)
+		g[i] = _mm_xor_si128(h[i], m[i]);
+	groestl_ni_perm_p(g);
+	groestl_ni_perm_q(m);
+	for (i = 0; i < 8; i ++)
+		h[i] = _mm_xor_si128(h[i], _mm_xor_si128(g[i], m[i]));
+	groestl_ni_store((unsigned char *)H, h);
+}
+
+/* H ^= P(H) */
+static SPH_TARGET_AESNI void
+groestl_big_final_aesni(void *H)
+{
+	__m128i h[8], x[8];
+	int i;
+
+	groestl_ni_load(h, (const unsigned char *)H);
+	for (i = 0; i < 8; i ++)
+		x[i] = h[i];
+	groestl_ni_perm_p(x);
+	for (i = 0; i < 8; i ++)
+		h[i] = _mm_xor_si128(h[i], x[i]);
+	groestl_ni_store((unsigned char *)H, h);
+}
+
+#endif
+
 static void
 groestl_small_init(sph_groestl_small_context *sc, unsigned out_size)
 {
@@ -2925,6 +3199,11 @@ groestl_big_core(sph_groestl_big_context *sc, const void *data, size_t len)
 		data = (const unsigned char *)data + clen;
 		len -= clen;
 		if (ptr == sizeof sc->buf) {
+#if GROESTL_AESNI
+			if (sph_cpu_has_aesni())
+				groestl_big_compress_aesni(H, buf);
+			else
+#endif
 			COMPRESS_BIG;
 #if SPH_64
 			sc->count ++;
@@ -2986,6 +3265,11 @@ groestl_big_close(sph_groestl_big_context *sc,
 #endif
 	groestl_big_core(sc, pad, pad_len);
 	READ_STATE_BIG(sc);
+#if GROESTL_AESNI
+	if (sph_cpu_has_aesni())
+		groestl_big_final_aesni(H);
+	else
+#endif
 	FINAL_BIG;
 #if SPH_GROESTL_64
 	for (u = 0; u < 8; u ++)
@@ -34,6 +34,7 @@
 #include <string.h>
 
 #include "sph_shavite.h"
+#include "sph_cpu.h"
 
 #if SPH_SMALL_FOOTPRINT && !defined SPH_SMALL_FOOTPRINT_SHAVITE
 #define SPH_SMALL_FOOTPRINT_SHAVITE   1
@@ -1471,6 +1472,130 @@ c512(sph_shavite_big_context *sc, const void *msg)
 
 #endif
 
+#if SPH_AESNI
+
+/*
+ * AES-NI implementation of c512(). The AES rounds of SHAvite-3 have no
+ * key of their own and are followed by a XOR with the next round key,
+ * which is exactly what AESENC computes; the last round of each block of
+ * four, and those of the key schedule, use a zero key.
+ */
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+static SPH_TARGET_AESNI void
+c512_aesni(sph_shavite_big_context *sc, const void *msg)
+{
+	__m128i rk[112];
+	__m128i p0, p1, p2, p3, x;
+	__m128i z = _mm_setzero_si128();
+	const __m128i *m = (const __m128i *)msg;
+	size_t u;
+	int r, s;
+
+	for (u = 0; u < 8; u ++)
+		rk[u] = _mm_loadu_si128(m + u);
+
+	/*
+	 * Key schedule, as in c512() with four words per step: the
+	 * nonlinear steps take words (u - 31, u - 30, u - 29, u - 32),
+	 * the linear ones the unaligned words u - 7 to u - 4.
+	 */
+	u = 8;
+	for (;;) {
+		for (s = 0; s < 4; s ++) {
+			x = _mm_shuffle_epi32(rk[u - 8], 0x39);
+			x = _mm_aesenc_si128(x, z);
+			rk[u] = _mm_xor_si128(x, rk[u - 1]);
+			if (u == 8) {
+				rk[u] = _mm_xor_si128(rk[u], _mm_set_epi32(
+					(int)SPH_T32(~sc->count3),
+					(int)sc->count2, (int)sc->count1,
+					(int)sc->count0));
+			} else if (u == 110) {
+				rk[u] = _mm_xor_si128(rk[u], _mm_set_epi32(
+					(int)SPH_T32(~sc->count2),
+					(int)sc->count3, (int)sc->count0,
+					(int)sc->count1));
+			}
+			u ++;
+
+			x = _mm_shuffle_epi32(rk[u - 8], 0x39);
+			x = _mm_aesenc_si128(x, z);
+			rk[u] = _mm_xor_si128(x, rk[u - 1]);
+			if (u == 41) {
+				rk[u] = _mm_xor_si128(rk[u], _mm_set_epi32(
+					(int)SPH_T32(~sc->count0),
+					(int)sc->count1, (int)sc->count2,
+					(int)sc->count3));
+			} else if (u == 79) {
+				rk[u] = _mm_xor_si128(rk[u], _mm_set_epi32(
+					(int)SPH_T32(~sc->count1),
+					(int)sc->count0, (int)sc->count3,
+					(int)sc->count2));
+			}
+			u ++;
+		}
+		if (u == 112)
+			break;
+		for (s = 0; s < 8; s ++) {
+			rk[u] = _mm_xor_si128(rk[u - 8],
+				_mm_alignr_epi8(rk[u - 1], rk[u - 2], 4));
+			u ++;
+		}
+	}
+
+	p0 = _mm_loadu_si128((const __m128i *)sc->h + 0);
+	p1 = _mm_loadu_si128((const __m128i *)sc->h + 1);
+	p2 = _mm_loadu_si128((const __m128i *)sc->h + 2);
+	p3 = _mm_loadu_si128((const __m128i *)sc->h + 3);
+	u = 0;
+	for (r = 0; r < 14; r ++) {
+		x = _mm_aesenc_si128(_mm_xor_si128(p1, rk[u]), rk[u + 1]);
+		x = _mm_aesenc_si128(x, rk[u + 2]);
+		x = _mm_aesenc_si128(x, rk[u + 3]);
+		p0 = _mm_xor_si128(p0, _mm_aesenc_si128(x, z));
+		x = _mm_aesenc_si128(_mm_xor_si128(p3, rk[u + 4]), rk[u + 5]);
+		x = _mm_aesenc_si128(x, rk[u + 6]);
+		x = _mm_aesenc_si128(x, rk[u + 7]);
+		p2 = _mm_xor_si128(p2, _mm_aesenc_si128(x, z));
+		u += 8;
+
+		x = p3;
+		p3 = p2;
+		p2 = p1;
+		p1 = p0;
+		p0 = x;
+	}
+	_mm_storeu_si128((__m128i *)sc->h + 0, _mm_xor_si128(
+		_mm_loadu_si128((const __m128i *)sc->h + 0), p0));
+	_mm_storeu_si128((__m128i *)sc->h + 1, _mm_xor_si128(
+		_mm_loadu_si128((const __m128i *)sc->h + 1), p1));
+	_mm_storeu_si128((__m128i *)sc->h + 2, _mm_xor_si128(
+		_mm_loadu_si128((const __m128i *)sc->h + 2), p2));
+	_mm_storeu_si128((__m128i *)sc->h + 3, _mm_xor_si128(
+		_mm_loadu_si128((const __m128i *)sc->h + 3), p3));
+}
+
+#endif
+
+/*
+ * Compression function for SHAvite-384/512, with AES-NI when available.
+ */
+static void
+shavite_big_compress(sph_shavite_big_context *sc, const void *msg)
+{
+#if SPH_AESNI
+	if (sph_cpu_has_aesni()) {
+		c512_aesni(sc, msg);
+		return;
+	}
+#endif
+	c512(sc, msg);
+}
+
 static void
 shavite_small_init(sph_shavite_small_context *sc, const sph_u32 *iv)
 {
@@ -1586,7 +1711,7 @@ shavite_big_core(sph_shavite_big_context *sc, const void *data, size_t len)
 					}
 				}
 			}
-			c512(sc, buf);
+			shavite_big_compress(sc, buf);
 			ptr = 0;
 		}
 	}
@@ -1620,7 +1745,7 @@ shavite_big_close(sph_shavite_big_context *sc,
 	} else {
 		buf[ptr ++] = z;
 		memset(buf + ptr, 0, 128 - ptr);
-		c512(sc, buf);
+		shavite_big_compress(sc, buf);
 		memset(buf, 0, 110);
 		sc->count0 = sc->count1 = sc->count2 = sc->count3 = 0;
 	}
@@ -1630,7 +1755,7 @@ shavite_big_close(sph_shavite_big_context *sc,
 	sph_enc32le(buf + 122, count3);
 	buf[126] = out_size_w32 << 5;
 	buf[127] = out_size_w32 >> 3;
-	c512(sc, buf);
+	shavite_big_compress(sc, buf);
 	for (u = 0; u < out_size_w32; u ++)
 		sph_enc32le((unsigned char *)dst + (u << 2), sc->h[u]);
 }
@@ -0,0 +1,123 @@
+/*
+ * Runtime CPU feature detection, see sph_cpu.h.
+ */
+
+#include "sph_cpu.h"
+
+#if SPH_AESNI
+
+#if defined _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#define CPU_SSSE3   0x001
+#define CPU_AESNI   0x002
+#define CPU_VAES    0x004
+#define CPU_INIT    0x100
+
+static volatile int cpu_features;
+
+static void
+cpuid(unsigned leaf, unsigned sub, unsigned r[4])
+{
+#if defined _MSC_VER
+	int t[4];
+
+	__cpuidex(t, (int)leaf, (int)sub);
+	r[0] = t[0];
+	r[1] = t[1];
+	r[2] = t[2];
+	r[3] = t[3];
+#else
+	__cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+static int
+os_saves_avx(void)
+{
+#if defined _MSC_VER
+	return (_xgetbv(0) & 6) == 6;
+#else
+	unsigned lo, hi;
+
+	__asm__ __volatile__ ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+	return (lo & 6) == 6;
+#endif
+}
+
+/*
+ * The result does not change, so concurrent first calls racing on
+ * cpu_features all store the same value.
+ */
+static int
+cpu_detect(void)
+{
+	unsigned r[4];
+	unsigned max;
+	int f;
+
+	f = cpu_features;
+	if (f & CPU_INIT)
+		return f;
+
+	f = CPU_INIT;
+	cpuid(0, 0, r);
+	max = r[0];
+	if (max >= 1) {
+		cpuid(1, 0, r);
+		if (r[2] & (1U << 9))
+			f |= CPU_SSSE3;
+		if ((f & CPU_SSSE3) && (r[2] & (1U << 25)))
+			f |= CPU_AESNI;
+		/* OSXSAVE and AVX, then VAES in leaf 7 */
+		if ((f & CPU_AESNI) && (r[2] & (1U << 27))
+			&& (r[2] & (1U << 28)) && os_saves_avx()
+			&& max >= 7)
+		{
+			cpuid(7, 0, r);
+			if ((r[1] & (1U << 5)) && (r[2] & (1U << 9)))
+				f |= CPU_VAES;
+		}
+	}
+	cpu_features = f;
+	return f;
+}
+
+/* see sph_cpu.h */
+int
+sph_cpu_has_aesni(void)
+{
+	return (cpu_detect() & CPU_AESNI) != 0;
+}
+
+/* see sph_cpu.h */
+int
+sph_cpu_has_vaes(void)
+{
+#if SPH_VAES
+	return (cpu_detect() & CPU_VAES) != 0;
+#else
+	return 0;
+#endif
+}
+
+#else
+
+/* see sph_cpu.h */
+int
+sph_cpu_has_aesni(void)
+{
+	return 0;
+}
+
+/* see sph_cpu.h */
+int
+sph_cpu_has_vaes(void)
+{
+	return 0;
+}
+
+#endif
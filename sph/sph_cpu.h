@@ -0,0 +1,55 @@
+/**
+ * Runtime CPU feature detection for the sphlib primitives which have
+ * hardware-accelerated variants (AES-NI for Groestl, ECHO and SHAvite,
+ * VAES for ECHO).
+ *
+ * Accelerated code paths are compiled in when the compiler can emit
+ * them (SPH_AESNI, SPH_VAES), and selected at runtime with CPUID, so
+ * that a single binary still runs on CPUs without the instructions.
+ * The accelerated variants produce exactly the same output as the
+ * portable table-based code.
+ *
+ * Define SPH_NO_AESNI to build the portable code only, or SPH_NO_VAES
+ * to leave out the VAES variants.
+ *
+ * @file     sph_cpu.h
+ */
+
+#ifndef SPH_CPU_H__
+#define SPH_CPU_H__
+
+#include "sph_types.h"
+
+#if !defined SPH_NO_AESNI && (SPH_AMD64_GCC || SPH_I386_GCC) \
+	&& (defined __clang__ || __GNUC__ > 4 \
+	|| (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define SPH_AESNI   1
+#define SPH_TARGET_AESNI   __attribute__((target("sse2,ssse3,aes")))
+#if !defined SPH_NO_VAES && (defined __clang__ || __GNUC__ >= 8)
+#define SPH_VAES    1
+#define SPH_TARGET_VAES    __attribute__((target("avx2,aes,vaes")))
+#endif
+#elif !defined SPH_NO_AESNI && (SPH_AMD64_MSVC || SPH_I386_MSVC)
+#define SPH_AESNI   1
+#define SPH_TARGET_AESNI
+#endif
+
+#ifndef SPH_AESNI
+#define SPH_AESNI   0
+#endif
+#ifndef SPH_VAES
+#define SPH_VAES    0
+#endif
+
+/**
+ * Non-zero if the CPU supports AES-NI and SSSE3.
+ */
+int sph_cpu_has_aesni(void);
+
+/**
+ * Non-zero if the CPU supports VAES on 256-bit registers and the OS
+ * saves the AVX state.
+ */
+int sph_cpu_has_vaes(void);
+
+#endif
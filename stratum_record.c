@@ -0,0 +1,104 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "miner.h"
+#include "pool.h"
+#include "stratum_record.h"
+#include "util.h"
+
+/* Prefix of the per pool session logs, NULL when not recording */
+char *opt_stratum_record;
+
+/* One lock for all pools, so records carry timestamps from one clock and
+ * the files can be lined up against each other */
+static pthread_mutex_t record_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct timeval record_start;
+
+static void put_le(unsigned char *p, uint64_t val, int bytes)
+{
+  int i;
+
+  for (i = 0; i < bytes; i++, val >>= 8)
+    p[i] = val & 0xff;
+}
+
+/* Opens the pool's log on its first record */
+static FILE *record_file(struct pool *pool)
+{
+  char path[PATH_MAX];
+
+  if (pool->record_file)
+    return pool->record_file;
+
+  snprintf(path, sizeof(path), "%s-pool%d.srec", opt_stratum_record, pool->pool_no);
+  pool->record_file = fopen(path, "wb");
+  if (pool->record_file && (fwrite(SREC_MAGIC, 4, 1, pool->record_file) != 1 ||
+      fputc(SREC_VERSION, pool->record_file) == EOF)) {
+    fclose(pool->record_file);
+    pool->record_file = NULL;
+  }
+  return pool->record_file;
+}
+
+/* Appends one record to the pool's log. A pool whose log can't be written
+ * stops recording for good rather than retrying on every line */
+void stratum_record(struct pool *pool, enum srec_type type, const char *buf, size_t len)
+{
+  unsigned char rec[SREC_RECORD_LEN];
+  struct timeval now;
+  bool failed = false;
+  FILE *f;
+
+  cgtime(&now);
+
+  mutex_lock(&record_lock);
+  if (!pool->record_failed) {
+    if (!record_start.tv_sec)
+      copy_time(&record_start, &now);
+    put_le(rec, (uint64_t)us_tdiff(&now, &record_start), 8);
+    rec[8] = type;
+    put_le(rec + 9, len, 4);
+    /* Flushed per record so a log survives the crash it may be
+     * needed to reproduce */
+    f = record_file(pool);
+    if (!f || fwrite(rec, sizeof(rec), 1, f) != 1 ||
+        (len && fwrite(buf, len, 1, f) != 1) || fflush(f)) {
+      if (f)
+        fclose(f);
+      pool->record_file = NULL;
+      pool->record_failed = failed = true;
+    }
+  }
+  mutex_unlock(&record_lock);
+
+  if (unlikely(failed))
+    applog(LOG_ERR, "Failed to write stratum record for %s, recording stopped",
+           get_pool_name(pool));
+}
+
+void stratum_record_work(struct pool *pool, struct work *work)
+{
+  char *header, *line;
+  int len;
+
+  header = bin2hex(work->data, 128);
+  line = (char *)malloc(strlen(work->job_id) + 24 + strlen(header) + 1);
+  if (unlikely(!line))
+    quithere(1, "Failed to malloc stratum record line");
+  len = sprintf(line, "%s %"PRIu64" %s", work->job_id, work->nonce2, header);
+  stratum_record(pool, SREC_WORK, line, len);
+  free(line);
+  free(header);
+}
@@ -0,0 +1,35 @@
+#ifndef STRATUM_RECORD_H
+#define STRATUM_RECORD_H
+
+#include <stddef.h>
+
+/* Stratum session logs written with --stratum-record, one file per pool,
+ * and fed back to a miner by tools/stratum-replay. A log starts with the
+ * magic and version byte, followed by records of:
+ *   uint64_t  usecs since the recording started, little endian
+ *   uint8_t   type, one of enum srec_type
+ *   uint32_t  payload length, little endian
+ *   payload   a stratum line without its \n, the pool address for
+ *             SREC_CONNECT, or "job_id nonce2 header" in hex for each
+ *             work item gen_stratum_work made for SREC_WORK
+ */
+#define SREC_MAGIC       "SGSR"
+#define SREC_VERSION     1
+#define SREC_RECORD_LEN  13
+
+enum srec_type {
+  SREC_CONNECT = 'C', /* Stratum socket (re)connected */
+  SREC_RECV    = 'R', /* Line received from the pool */
+  SREC_SEND    = 'S', /* Line sent to the pool */
+  SREC_WORK    = 'W', /* Work generated from the stratum job */
+};
+
+struct pool;
+struct work;
+
+extern char *opt_stratum_record;
+
+extern void stratum_record(struct pool *pool, enum srec_type type, const char *buf, size_t len);
+extern void stratum_record_work(struct pool *pool, struct work *work);
+
+#endif /* STRATUM_RECORD_H */
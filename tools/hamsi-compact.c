@@ -0,0 +1,191 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+/*
+ * hamsi-compact: generates kernel/hamsi_helper_compact.cl from the 1 bit
+ * Hamsi-384/512 expansion table (T512) of kernel/hamsi_helper.cl.
+ *
+ *   hamsi-compact kernel/hamsi_helper.cl > kernel/hamsi_helper_compact.cl
+ *
+ * Group u of n input bits covers bits n*u to n*u+n-1 of the block, taken
+ * from the most significant end of each byte as INPUT_BIG reads them. Entry
+ * v of its table is the XOR of the T512 rows of the bits set in v, the most
+ * significant bit of v being the first bit of the group.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define T512_ROWS 64
+#define T512_COLS 16
+
+static uint32_t t512[T512_ROWS][T512_COLS];
+
+static const char *header =
+  "/*\n"
+  " * Compact helper code for the Hamsi-384/512 input block expansion. The\n"
+  " * per group tables of hamsi_helper.cl are merged into one table for each\n"
+  " * expansion level, which lets INPUT_BIG run as a loop over the groups of\n"
+  " * input bits instead of an unrolled sequence. Every entry is the XOR of\n"
+  " * the rows of the 1 bit table of hamsi_helper.cl selected by its index.\n"
+  " *\n"
+  " * Generated by tools/hamsi-compact.c (make hamsi-compact), regenerate it\n"
+  " * rather than editing the tables by hand:\n"
+  " *\n"
+  " *   hamsi-compact kernel/hamsi_helper.cl > kernel/hamsi_helper_compact.cl\n"
+  " *\n"
+  " * This file is included from hamsi.cl when SPH_HAMSI_COMPACT is set, and\n"
+  " * is not meant to be compiled independently.\n"
+  " *\n"
+  " * ==========================(LICENSE BEGIN)============================\n"
+  " *\n"
+  " * Copyright (c) 2007-2010  Projet RNRT SAPHIR\n"
+  " * \n"
+  " * Permission is hereby granted, free of charge, to any person obtaining\n"
+  " * a copy of this software and associated documentation files (the\n"
+  " * \"Software\"), to deal in the Software without restriction, including\n"
+  " * without limitation the rights to use, copy, modify, merge, publish,\n"
+  " * distribute, sublicense, and/or sell copies of the Software, and to\n"
+  " * permit persons to whom the Software is furnished to do so, subject to\n"
+  " * the following conditions:\n"
+  " * \n"
+  " * The above copyright notice and this permission notice shall be\n"
+  " * included in all copies or substantial portions of the Software.\n"
+  " * \n"
+  " * THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND,\n"
+  " * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF\n"
+  " * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.\n"
+  " * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY\n"
+  " * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,\n"
+  " * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE\n"
+  " * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.\n"
+  " *\n"
+  " * ===========================(LICENSE END)=============================\n"
+  " *\n"
+  " * @author   Thomas Pornin <thomas.pornin@cryptolog.com>\n"
+  " */\n";
+
+/* Reads T512 out of the SPH_HAMSI_EXPAND_BIG == 1 section of hamsi_helper.cl */
+static int read_t512(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  char *text, *p;
+  long len;
+  int n = 0;
+
+  if (!f) {
+    perror(path);
+    return 0;
+  }
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  text = (char *)malloc(len + 1);
+  if (!text || fread(text, 1, len, f) != (size_t)len) {
+    fprintf(stderr, "%s: read failed\n", path);
+    fclose(f);
+    free(text);
+    return 0;
+  }
+  fclose(f);
+  text[len] = '\0';
+
+  p = strstr(text, "T512[64][16] = {");
+  if (!p) {
+    fprintf(stderr, "%s: no T512 table\n", path);
+    free(text);
+    return 0;
+  }
+  while (n < T512_ROWS * T512_COLS && (p = strstr(p, "SPH_C32(0x"))) {
+    p += strlen("SPH_C32(0x");
+    t512[n / T512_COLS][n % T512_COLS] = (uint32_t)strtoul(p, &p, 16);
+    n++;
+  }
+  free(text);
+
+  if (n != T512_ROWS * T512_COLS) {
+    fprintf(stderr, "%s: T512 table is short, %d values\n", path, n);
+    return 0;
+  }
+  return 1;
+}
+
+static void print_entry(const uint32_t *row, int last)
+{
+  int i;
+
+  printf("    {");
+  for (i = 0; i < T512_COLS; i++) {
+    if (i && !(i % 3))
+      printf("\n     ");
+    printf(" SPH_C32(0x%08x)%s", row[i], i < T512_COLS - 1 ? "," : "");
+  }
+  printf(" }%s\n", last ? "" : ",");
+}
+
+/* The table of n bit groups and the INPUT_BIG loop that walks it. index is
+ * the expression extracting the bits of group u from the block */
+static void print_level(int n, const char *index)
+{
+  int groups = T512_ROWS / n, entries = 1 << n, per_byte = 8 / n;
+  uint32_t entry[T512_COLS];
+  int u, v, j, i;
+
+  printf("#if SPH_HAMSI_EXPAND_BIG == %d\n\n", n);
+  printf("__constant static const sph_u32 T512_N%d[%d][%d][%d] = {\n", n, groups, entries, T512_COLS);
+  for (u = 0; u < groups; u++) {
+    int shift = 8 - n - n * (u % per_byte);
+    int row = 8 * (u / per_byte) + shift;
+
+    printf("  {\n");
+    for (v = 0; v < entries; v++) {
+      memset(entry, 0, sizeof(entry));
+      for (j = 0; j < n; j++) {
+        if (!(v & (1 << j)))
+          continue;
+        for (i = 0; i < T512_COLS; i++)
+          entry[i] ^= t512[row + j][i];
+      }
+      print_entry(entry, v == entries - 1);
+    }
+    printf("  }%s\n", u < groups - 1 ? "," : "");
+  }
+  printf("};\n\n");
+
+  printf("#define INPUT_BIG   do { \\\n");
+  printf("    __constant const sph_u32 *rp; \\\n");
+  printf("    unsigned u; \\\n");
+  for (i = 0; i < T512_COLS; i++)
+    printf("    m%X = 0; \\\n", i);
+  printf("    for (u = 0; u < %d; u ++) { \\\n", groups);
+  printf("      rp = &T512_N%d[u][%s & 0x%02x][0]; \\\n", n, index, entries - 1);
+  for (i = 0; i < T512_COLS; i++)
+    printf("      m%X ^= rp[%d]; \\\n", i, i);
+  printf("    } \\\n");
+  printf("  } while (0)\n\n");
+  printf("#endif\n");
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s kernel/hamsi_helper.cl > kernel/hamsi_helper_compact.cl\n", argv[0]);
+    return 1;
+  }
+  if (!read_t512(argv[1]))
+    return 1;
+
+  printf("%s\n", header);
+  print_level(2, "(buf((u >> 2)) >> (6 - 2 * (u & 3)))");
+  printf("\n");
+  print_level(4, "(buf((u >> 1)) >> ((~u & 1) << 2))");
+  return 0;
+}
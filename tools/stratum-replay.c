@@ -0,0 +1,769 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+/*
+ * stratum-replay: plays a session recorded with sgminer --stratum-record
+ * back to a miner, to reproduce problems seen with real pool traffic and to
+ * benchmark changes to stratum parsing and work generation against it.
+ *
+ *   stratum-replay [--port N] [--speed X] recorded-pool0.srec
+ *
+ * Point the miner at stratum+tcp://127.0.0.1:N. Everything the pool sent is
+ * replayed with its original timing divided by the speed (1 to 100). Replies
+ * are matched to the miner's live requests by method, and carry the live
+ * ids. A reconnect in the recording drops the miner and waits for it to come
+ * back; recorded client.reconnect requests are not passed on, as they would
+ * send the miner to the real pool. Shares are checked against the ones in
+ * the recording and against the jobs replayed so far.
+ *
+ * Run the miner with --stratum-record during the replay too, then check that
+ * it generated the same work from the same jobs as in the recording:
+ *
+ *   stratum-replay --compare recorded-pool0.srec replayed-pool0.srec
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <jansson.h>
+
+#include "../stratum_record.h"
+
+#define LINE_MAX_LEN 8192
+#define REQUEST_WAIT 10.0
+#define CONNECT_WAIT 60.0
+
+struct record {
+  double at;
+  char type;
+  char *data;
+  size_t len;
+};
+
+struct request {
+  char method[64];
+  json_t *id;
+  bool answered;
+};
+
+struct work_item {
+  char *key;
+  char *header;
+};
+
+static int opt_port = 3333;
+static double opt_speed = 1.0;
+static double opt_linger = 2.0;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static int live_fd = -1;
+static int sessions;
+
+/* The miner's requests waiting for a reply, in arrival order */
+static struct request *requests;
+static int nrequests, requests_size;
+
+/* Shares submitted in the recording, as "job nonce2 ntime nonce" */
+static char **recorded_shares;
+static int nrecorded_shares;
+
+/* Job ids replayed so far */
+static char **jobs;
+static int njobs, jobs_size;
+
+static uint64_t sent_notifies, sent_replies, sent_other, skipped_reconnects;
+static uint64_t unanswered, submits, identical_submits, unknown_job_submits;
+static double start_time;
+static volatile bool stopping;
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+static void sleep_until(double t)
+{
+  struct timespec ts;
+  double wait = t - now();
+
+  if (wait <= 0)
+    return;
+  ts.tv_sec = (time_t)wait;
+  ts.tv_nsec = (long)((wait - ts.tv_sec) * 1000000000.0);
+  while (nanosleep(&ts, &ts) && errno == EINTR && !stopping)
+    ;
+}
+
+static void say(const char *fmt, ...)
+{
+  va_list ap;
+
+  printf("[%9.3f] ", start_time ? now() - start_time : 0.0);
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+  putchar('\n');
+  fflush(stdout);
+}
+
+static void *grow(void *ptr, int *size, size_t item)
+{
+  *size = *size ? *size * 2 : 64;
+  ptr = realloc(ptr, *size * item);
+  if (!ptr) {
+    fprintf(stderr, "Out of memory\n");
+    exit(1);
+  }
+  return ptr;
+}
+
+static uint64_t get_le(const unsigned char *p, int bytes)
+{
+  uint64_t val = 0;
+
+  while (bytes--)
+    val = (val << 8) | p[bytes];
+  return val;
+}
+
+static bool load_log(const char *path, struct record **records, int *nrecords)
+{
+  unsigned char hdr[SREC_RECORD_LEN];
+  int size = 0;
+  FILE *f;
+
+  *records = NULL;
+  *nrecords = 0;
+
+  f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  if (fread(hdr, 5, 1, f) != 1 || memcmp(hdr, SREC_MAGIC, 4) || hdr[4] != SREC_VERSION) {
+    fprintf(stderr, "%s: not a version %d stratum record\n", path, SREC_VERSION);
+    fclose(f);
+    return false;
+  }
+  while (fread(hdr, sizeof(hdr), 1, f) == 1) {
+    struct record *rec;
+
+    if (*nrecords == size)
+      *records = (struct record *)grow(*records, &size, sizeof(**records));
+    rec = &(*records)[*nrecords];
+    rec->at = (double)get_le(hdr, 8) / 1000000.0;
+    rec->type = hdr[8];
+    rec->len = get_le(hdr + 9, 4);
+    rec->data = (char *)malloc(rec->len + 1);
+    if (!rec->data || (rec->len && fread(rec->data, rec->len, 1, f) != 1)) {
+      /* A log cut short by a crash ends with a partial record */
+      free(rec->data);
+      fprintf(stderr, "%s: truncated after %d records\n", path, *nrecords);
+      break;
+    }
+    rec->data[rec->len] = '\0';
+    (*nrecords)++;
+  }
+  fclose(f);
+  return true;
+}
+
+/* "job nonce2 ntime nonce" of a mining.submit request, or NULL */
+static char *share_key(json_t *val)
+{
+  json_t *params = json_object_get(val, "params");
+  const char *part[4];
+  char *key;
+  int i;
+
+  if (!json_is_array(params) || json_array_size(params) < 5)
+    return NULL;
+  for (i = 0; i < 4; i++) {
+    part[i] = json_string_value(json_array_get(params, i + 1));
+    if (!part[i])
+      return NULL;
+  }
+  key = (char *)malloc(strlen(part[0]) + strlen(part[1]) + strlen(part[2]) + strlen(part[3]) + 4);
+  if (key)
+    sprintf(key, "%s %s %s %s", part[0], part[1], part[2], part[3]);
+  return key;
+}
+
+static bool is_method(json_t *val, const char *method)
+{
+  const char *m = json_string_value(json_object_get(val, "method"));
+
+  return m && !strcmp(m, method);
+}
+
+static bool known_job(const char *job)
+{
+  int i;
+
+  for (i = njobs - 1; i >= 0; i--) {
+    if (!strcmp(jobs[i], job))
+      return true;
+  }
+  return false;
+}
+
+static void check_submit(json_t *val)
+{
+  char *key = share_key(val);
+  char *job_end;
+  int i;
+
+  submits++;
+  if (!key)
+    return;
+  for (i = 0; i < nrecorded_shares; i++) {
+    if (!strcmp(recorded_shares[i], key)) {
+      identical_submits++;
+      break;
+    }
+  }
+  job_end = strchr(key, ' ');
+  *job_end = '\0';
+  if (!known_job(key)) {
+    say("share on job %s which was never replayed", key);
+    unknown_job_submits++;
+  }
+  free(key);
+}
+
+static void handle_line(const char *line)
+{
+  json_t *val = json_loads(line, 0, NULL);
+  const char *method;
+  struct request *req;
+
+  if (!val)
+    return;
+  method = json_string_value(json_object_get(val, "method"));
+  if (!method) {
+    json_decref(val);
+    return;
+  }
+
+  pthread_mutex_lock(&lock);
+  if (!strcmp(method, "mining.submit"))
+    check_submit(val);
+  if (nrequests == requests_size)
+    requests = (struct request *)grow(requests, &requests_size, sizeof(*requests));
+  req = &requests[nrequests++];
+  snprintf(req->method, sizeof(req->method), "%s", method);
+  req->id = json_incref(json_object_get(val, "id"));
+  req->answered = false;
+  pthread_cond_broadcast(&cond);
+  pthread_mutex_unlock(&lock);
+
+  json_decref(val);
+}
+
+static void *reader_thread(void *arg)
+{
+  int fd = (int)(intptr_t)arg;
+  char buf[LINE_MAX_LEN];
+  size_t have = 0;
+
+  pthread_detach(pthread_self());
+
+  while (!stopping) {
+    ssize_t n = recv(fd, buf + have, sizeof(buf) - 1 - have, 0);
+    char *start, *eol;
+
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    have += n;
+    buf[have] = '\0';
+
+    start = buf;
+    while ((eol = strchr(start, '\n'))) {
+      *eol = '\0';
+      if (eol > start)
+        handle_line(start);
+      start = eol + 1;
+    }
+    have -= start - buf;
+    memmove(buf, start, have);
+    if (have == sizeof(buf) - 1)
+      break;
+  }
+
+  pthread_mutex_lock(&lock);
+  if (live_fd == fd)
+    live_fd = -1;
+  pthread_mutex_unlock(&lock);
+  close(fd);
+  say("miner disconnected");
+  return NULL;
+}
+
+static void *accept_thread(void *arg)
+{
+  int lsock = *(int *)arg;
+
+  while (!stopping) {
+    struct sockaddr_in addr;
+    socklen_t addrlen = sizeof(addr);
+    pthread_t pth;
+    int fd, one = 1;
+
+    fd = accept(lsock, (struct sockaddr *)&addr, &addrlen);
+    if (fd < 0) {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    pthread_mutex_lock(&lock);
+    /* Only one miner at a time, a newcomer replaces the last one */
+    if (live_fd >= 0)
+      shutdown(live_fd, SHUT_RDWR);
+    live_fd = fd;
+    sessions++;
+    while (nrequests)
+      json_decref(requests[--nrequests].id);
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&lock);
+
+    say("miner connected from %s", inet_ntoa(addr.sin_addr));
+    if (pthread_create(&pth, NULL, reader_thread, (void *)(intptr_t)fd)) {
+      say("failed to create reader thread");
+      shutdown(fd, SHUT_RDWR);
+    }
+  }
+  return NULL;
+}
+
+static void timed_wait(double deadline)
+{
+  struct timespec ts;
+  double secs = deadline - now();
+
+  clock_gettime(CLOCK_REALTIME, &ts);
+  if (secs > 0.1)
+    secs = 0.1;
+  ts.tv_sec += (time_t)secs;
+  ts.tv_nsec += (long)((secs - (time_t)secs) * 1000000000.0);
+  if (ts.tv_nsec >= 1000000000L) {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+  }
+  pthread_cond_timedwait(&cond, &lock, &ts);
+}
+
+/* Waits for a connection newer than the given session, returns the time
+ * spent waiting */
+static double wait_for_miner(int after_session)
+{
+  double start = now(), deadline = start + CONNECT_WAIT;
+
+  pthread_mutex_lock(&lock);
+  while (!stopping && (live_fd < 0 || sessions <= after_session) && now() < deadline)
+    timed_wait(deadline);
+  pthread_mutex_unlock(&lock);
+  return now() - start;
+}
+
+static void live_send(const char *line, size_t len)
+{
+  size_t sent = 0;
+
+  pthread_mutex_lock(&lock);
+  while (live_fd >= 0 && sent <= len) {
+    ssize_t n;
+
+    if (sent == len)
+      n = send(live_fd, "\n", 1, MSG_NOSIGNAL);
+    else
+      n = send(live_fd, line + sent, len - sent, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    sent += n;
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+/* Finds the oldest live request for the method still waiting on a reply,
+ * waiting for the miner to send it unless it's a share. Returns its id, or
+ * NULL, with the time spent waiting added to waited */
+static json_t *take_request(const char *method, double *waited)
+{
+  double start = now(), deadline = start + REQUEST_WAIT;
+  bool wait = strcmp(method, "mining.submit");
+  json_t *id = NULL;
+
+  pthread_mutex_lock(&lock);
+  while (!stopping) {
+    int i;
+
+    for (i = 0; i < nrequests; i++) {
+      if (!requests[i].answered && !strcmp(requests[i].method, method)) {
+        requests[i].answered = true;
+        id = requests[i].id;
+        break;
+      }
+    }
+    if (id || !wait || now() >= deadline || live_fd < 0)
+      break;
+    timed_wait(deadline);
+  }
+  pthread_mutex_unlock(&lock);
+
+  *waited += now() - start;
+  return id;
+}
+
+static void add_job(json_t *val)
+{
+  const char *job = json_string_value(json_array_get(json_object_get(val, "params"), 0));
+
+  if (!job)
+    return;
+  pthread_mutex_lock(&lock);
+  if (njobs == jobs_size)
+    jobs = (char **)grow(jobs, &jobs_size, sizeof(*jobs));
+  jobs[njobs++] = strdup(job);
+  pthread_mutex_unlock(&lock);
+}
+
+static void replay(struct record *records, int nrecords)
+{
+  struct request *recorded = NULL;
+  int nrecorded = 0, recorded_size = 0, session, i;
+  double base, first_at = nrecords ? records[0].at : 0, shifted = 0;
+
+  say("waiting for a miner on port %d", opt_port);
+  wait_for_miner(0);
+  pthread_mutex_lock(&lock);
+  session = sessions;
+  pthread_mutex_unlock(&lock);
+  base = start_time = now();
+
+  for (i = 0; i < nrecords && !stopping; i++) {
+    struct record *rec = &records[i];
+    const char *method;
+    json_t *val, *id;
+    int j;
+
+    switch (rec->type) {
+      case SREC_CONNECT:
+        if (i == 0)
+          continue;
+        sleep_until(base + shifted + (rec->at - first_at) / opt_speed);
+        say("recorded reconnect to %s, dropping the miner", rec->data);
+        pthread_mutex_lock(&lock);
+        if (live_fd >= 0)
+          shutdown(live_fd, SHUT_RDWR);
+        pthread_mutex_unlock(&lock);
+        shifted += wait_for_miner(session);
+        pthread_mutex_lock(&lock);
+        session = sessions;
+        pthread_mutex_unlock(&lock);
+        nrecorded = 0;
+        continue;
+      case SREC_SEND:
+        /* Remember what the recorded miner asked, to pair with the reply */
+        val = json_loads(rec->data, 0, NULL);
+        if (!val)
+          continue;
+        if (nrecorded == recorded_size)
+          recorded = (struct request *)grow(recorded, &recorded_size, sizeof(*recorded));
+        method = json_string_value(json_object_get(val, "method"));
+        snprintf(recorded[nrecorded].method, sizeof(recorded[nrecorded].method), "%s",
+                 method ? method : "");
+        recorded[nrecorded].id = json_incref(json_object_get(val, "id"));
+        recorded[nrecorded++].answered = false;
+        json_decref(val);
+        continue;
+      case SREC_RECV:
+        break;
+      default:
+        continue;
+    }
+
+    sleep_until(base + shifted + (rec->at - first_at) / opt_speed);
+    val = json_loads(rec->data, 0, NULL);
+    if (!val) {
+      live_send(rec->data, rec->len);
+      sent_other++;
+      continue;
+    }
+
+    if (json_object_get(val, "method")) {
+      if (is_method(val, "client.reconnect"))
+        skipped_reconnects++;
+      else {
+        if (is_method(val, "mining.notify")) {
+          add_job(val);
+          sent_notifies++;
+        } else
+          sent_other++;
+        live_send(rec->data, rec->len);
+      }
+      json_decref(val);
+      continue;
+    }
+
+    /* A reply, find the recorded request it answered and the live one
+     * standing in for it */
+    id = json_object_get(val, "id");
+    for (j = 0; j < nrecorded; j++) {
+      if (!recorded[j].answered && json_equal(recorded[j].id, id))
+        break;
+    }
+    if (j < nrecorded) {
+      json_t *live_id;
+
+      recorded[j].answered = true;
+      live_id = take_request(recorded[j].method, &shifted);
+      if (live_id) {
+        char *line;
+
+        json_object_set(val, "id", live_id);
+        line = json_dumps(val, JSON_COMPACT | JSON_PRESERVE_ORDER);
+        if (line) {
+          live_send(line, strlen(line));
+          sent_replies++;
+          free(line);
+        }
+      } else {
+        say("no %s from the miner to answer", recorded[j].method);
+        unanswered++;
+      }
+    }
+    json_decref(val);
+  }
+
+  /* Give the miner a moment to submit shares on the last jobs */
+  sleep_until(now() + opt_linger);
+  for (i = 0; i < nrecorded; i++)
+    json_decref(recorded[i].id);
+  free(recorded);
+}
+
+static void print_report(double recorded_secs, int nrecords)
+{
+  double secs = now() - start_time;
+
+  pthread_mutex_lock(&lock);
+  printf("\nReplayed %d records covering %.3f secs in %.3f secs (%.1fx)\n",
+         nrecords, recorded_secs, secs, secs > 0 ? recorded_secs / secs : 0.0);
+  printf("  Sent: %llu notifies, %llu replies, %llu others; %llu client.reconnect skipped\n",
+         (unsigned long long)sent_notifies, (unsigned long long)sent_replies,
+         (unsigned long long)sent_other, (unsigned long long)skipped_reconnects);
+  printf("  Recorded replies with no live request to answer: %llu\n",
+         (unsigned long long)unanswered);
+  printf("  Shares: %d recorded, %llu submitted, %llu identical to recorded ones, "
+         "%llu on jobs never replayed\n", nrecorded_shares, (unsigned long long)submits,
+         (unsigned long long)identical_submits, (unsigned long long)unknown_job_submits);
+  pthread_mutex_unlock(&lock);
+}
+
+static int compare_work_items(const void *a, const void *b)
+{
+  return strcmp(((const struct work_item *)a)->key, ((const struct work_item *)b)->key);
+}
+
+/* Collects the SREC_WORK records of a log, sorted by "job nonce2" */
+static struct work_item *load_work(const char *path, int *nitems)
+{
+  struct record *records;
+  struct work_item *items = NULL;
+  int nrecords, size = 0, i;
+
+  *nitems = 0;
+  if (!load_log(path, &records, &nrecords))
+    exit(1);
+  for (i = 0; i < nrecords; i++) {
+    char *space;
+
+    if (records[i].type != SREC_WORK) {
+      free(records[i].data);
+      continue;
+    }
+    /* "job nonce2 header", split after nonce2 */
+    space = strchr(records[i].data, ' ');
+    if (space)
+      space = strchr(space + 1, ' ');
+    if (!space) {
+      free(records[i].data);
+      continue;
+    }
+    *space = '\0';
+    if (*nitems == size)
+      items = (struct work_item *)grow(items, &size, sizeof(*items));
+    items[*nitems].key = records[i].data;
+    items[(*nitems)++].header = space + 1;
+  }
+  free(records);
+  if (*nitems)
+    qsort(items, *nitems, sizeof(*items), compare_work_items);
+  return items;
+}
+
+/* Checks that work generated during a replay is identical to the work
+ * generated from the same job and nonce2 in the recording */
+static int compare(const char *recorded_path, const char *replayed_path)
+{
+  struct work_item *recorded, *replayed;
+  int nrecorded, nreplayed, i, compared = 0, differing = 0, unmatched = 0;
+
+  recorded = load_work(recorded_path, &nrecorded);
+  replayed = load_work(replayed_path, &nreplayed);
+
+  for (i = 0; i < nreplayed; i++) {
+    struct work_item *match = (struct work_item *)bsearch(&replayed[i], recorded, nrecorded,
+                                                          sizeof(*recorded), compare_work_items);
+
+    if (!match) {
+      unmatched++;
+      continue;
+    }
+    compared++;
+    if (strcmp(match->header, replayed[i].header)) {
+      if (differing++ < 10)
+        printf("Work for job/nonce2 %s differs:\n  recorded %s\n  replayed %s\n",
+               replayed[i].key, match->header, replayed[i].header);
+    }
+  }
+  printf("Work items: %d recorded, %d replayed, %d compared, %d differing, "
+         "%d with no recorded counterpart\n", nrecorded, nreplayed, compared, differing, unmatched);
+  if (!compared)
+    printf("No work in common to compare, was the miner recording both runs?\n");
+  return differing || !compared;
+}
+
+static void stop(int __attribute__((unused)) sig)
+{
+  stopping = true;
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr,
+    "Usage: %s [options] RECORD\n"
+    "       %s --compare RECORDED REPLAYED\n"
+    "  --port N      Port to listen on (default 3333)\n"
+    "  --speed X     Replay X times faster than recorded, 1 to 100 (default 1)\n"
+    "  --linger S    Wait S seconds for late shares after the last record (default 2)\n"
+    "  --compare     Compare the work generated in two records of the same session\n",
+    prog, prog);
+}
+
+int main(int argc, char *argv[])
+{
+  static const struct option longopts[] = {
+    { "port", required_argument, NULL, 'p' },
+    { "speed", required_argument, NULL, 's' },
+    { "linger", required_argument, NULL, 'l' },
+    { "compare", no_argument, NULL, 'c' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  struct record *records;
+  struct sockaddr_in addr;
+  pthread_t pth;
+  int nrecords, lsock, opt, one = 1, i;
+  bool opt_compare = false;
+
+  while ((opt = getopt_long(argc, argv, "h", longopts, NULL)) != -1) {
+    switch (opt) {
+      case 'p': opt_port = atoi(optarg); break;
+      case 's': opt_speed = strtod(optarg, NULL); break;
+      case 'l': opt_linger = strtod(optarg, NULL); break;
+      case 'c': opt_compare = true; break;
+      default:
+        usage(argv[0]);
+        return opt == 'h' ? 0 : 1;
+    }
+  }
+  if (opt_compare) {
+    if (argc - optind != 2) {
+      usage(argv[0]);
+      return 1;
+    }
+    return compare(argv[optind], argv[optind + 1]);
+  }
+  if (argc - optind != 1 || opt_speed < 1 || opt_speed > 100) {
+    usage(argv[0]);
+    return 1;
+  }
+  if (!load_log(argv[optind], &records, &nrecords))
+    return 1;
+
+  for (i = 0; i < nrecords; i++) {
+    json_t *val;
+    char *key;
+
+    if (records[i].type != SREC_SEND)
+      continue;
+    val = json_loads(records[i].data, 0, NULL);
+    if (val && is_method(val, "mining.submit") && (key = share_key(val))) {
+      recorded_shares = (char **)realloc(recorded_shares,
+                                         (nrecorded_shares + 1) * sizeof(*recorded_shares));
+      if (!recorded_shares)
+        return 1;
+      recorded_shares[nrecorded_shares++] = key;
+    }
+    if (val)
+      json_decref(val);
+  }
+
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+  signal(SIGPIPE, SIG_IGN);
+
+  lsock = socket(AF_INET, SOCK_STREAM, 0);
+  if (lsock < 0) {
+    perror("socket");
+    return 1;
+  }
+  setsockopt(lsock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(opt_port);
+  if (bind(lsock, (struct sockaddr *)&addr, sizeof(addr)) || listen(lsock, 4)) {
+    perror("bind");
+    return 1;
+  }
+  if (pthread_create(&pth, NULL, accept_thread, &lsock)) {
+    perror("pthread_create");
+    return 1;
+  }
+
+  replay(records, nrecords);
+  print_report(nrecords ? records[nrecords - 1].at - records[0].at : 0, nrecords);
+  return 0;
+}
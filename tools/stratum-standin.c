@@ -0,0 +1,758 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+/*
+ * stratum-standin: a local stand-in for a stratum pool, to load test the
+ * miner's pool handling without a real pool.
+ *
+ * It answers mining.subscribe, mining.authorize, mining.extranonce.subscribe
+ * and mining.submit, and pushes mining.set_difficulty and mining.notify at a
+ * configurable rate. Replies can be delayed, and clients can be dropped or
+ * sent client.reconnect / mining.set_extranonce, either periodically from the
+ * command line or at set times from a scenario file:
+ *
+ *   # seconds  action      arguments
+ *   0          notify-rate 500
+ *   10         diff        0.01
+ *   20         latency     250
+ *   30         disconnect
+ *   45         reconnect   127.0.0.1 3334
+ *   50         extranonce  deadbeef 4
+ *   60         notify      clean
+ *   90         end
+ *
+ * Shares are accepted without checking their hash. Everything is measured
+ * from what the miner sends back:
+ * - server turnaround of submits, from reading one off the socket to sending
+ *   its reply. This is the --latency delay plus the stand-in's own overhead,
+ *   not the round trip the miner sees, which also includes the network and
+ *   the miner's own queueing
+ * - the time from a clean notify to the first share on the new job, ie. how
+ *   long the miner takes to restart its work
+ * - shares on jobs older than the last clean notify
+ * - how long the miner takes to come back after a disconnect
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <jansson.h>
+
+#define LINE_MAX_LEN 8192
+#define MAX_EVENTS 256
+
+static const char *coinbase1 = "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff20020862062f503253482f04b8864e5008";
+static const char *coinbase2 = "072f736c7573682f000000000100f2052a010000001976a914d23fcdf86f7e756a64a7a9688ef9903327048ed988ac00000000";
+
+/* Settings, from the command line and changed by scenario events */
+static int opt_port = 3333;
+static double opt_diff = 1.0;
+static int opt_notify_ms = 30000;
+static int opt_clean_every = 1;
+static int opt_latency_ms;
+static int opt_disconnect_secs;
+static char *opt_reconnect;
+static int opt_duration;
+static int opt_report_secs = 10;
+static char *opt_scenario;
+
+struct client {
+  int fd;
+  int no;
+  bool subscribed;
+  bool authorized;
+  bool await_restart;   /* No share seen since the last clean notify */
+  char extranonce1[9];
+  pthread_mutex_t send_lock;
+  struct client *next;
+};
+
+struct latency {
+  uint64_t count;
+  double total;
+  double max;
+};
+
+enum event_action {
+  EV_NOTIFY,
+  EV_NOTIFY_RATE,
+  EV_CLEAN_EVERY,
+  EV_DIFF,
+  EV_LATENCY,
+  EV_DISCONNECT,
+  EV_RECONNECT,
+  EV_EXTRANONCE,
+  EV_END
+};
+
+struct event {
+  double at;
+  char name[32];
+  enum event_action action;
+  char arg1[128];
+  char arg2[128];
+};
+
+static struct event events[MAX_EVENTS];
+static int nevents;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static struct client *clients;
+static int client_count;
+
+/* Job state, under lock */
+static unsigned int job_no;
+static unsigned int clean_job_no;
+static double clean_job_time;
+static char prev_hash[65];
+static char nbit[9] = "1d00ffff";
+static int notifies_since_clean;
+
+/* Results, under lock */
+static struct latency submit_turnaround;
+static struct latency restart_latency;
+static struct latency reconnect_gap;
+static uint64_t submits, stale_submits, notifies, connects, disconnects;
+static double disconnect_time;
+static double start_time;
+static volatile bool stopping;
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+}
+
+static void msleep(int ms)
+{
+  struct timespec ts;
+
+  if (ms <= 0)
+    return;
+  ts.tv_sec = ms / 1000;
+  ts.tv_nsec = (long)(ms % 1000) * 1000000;
+  while (nanosleep(&ts, &ts) && errno == EINTR)
+    ;
+}
+
+static void say(const char *fmt, ...)
+{
+  va_list ap;
+
+  printf("[%9.3f] ", now() - start_time);
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+  putchar('\n');
+  fflush(stdout);
+}
+
+static void latency_add(struct latency *lat, double secs)
+{
+  lat->count++;
+  lat->total += secs;
+  if (secs > lat->max)
+    lat->max = secs;
+}
+
+static void latency_print(const char *name, struct latency *lat)
+{
+  printf("  %-26s %8llu %10.3f %10.3f\n", name, (unsigned long long)lat->count,
+         lat->count ? lat->total * 1000.0 / lat->count : 0.0, lat->max * 1000.0);
+}
+
+static void random_hex(char *buf, int bytes)
+{
+  int i;
+
+  for (i = 0; i < bytes; i++)
+    sprintf(buf + i * 2, "%02x", rand() & 0xff);
+}
+
+/* Sends one line to a client, returns false once the socket is gone */
+static bool client_send(struct client *client, const char *fmt, ...)
+{
+  char buf[LINE_MAX_LEN];
+  ssize_t sent, len;
+  va_list ap;
+  bool ret = true;
+
+  va_start(ap, fmt);
+  len = vsnprintf(buf, sizeof(buf) - 1, fmt, ap);
+  va_end(ap);
+  if (len < 0 || len >= (ssize_t)sizeof(buf) - 1)
+    return false;
+  buf[len++] = '\n';
+
+  pthread_mutex_lock(&client->send_lock);
+  for (sent = 0; sent < len && client->fd >= 0; ) {
+    ssize_t n = send(client->fd, buf + sent, len - sent, MSG_NOSIGNAL);
+
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0) {
+      ret = false;
+      break;
+    }
+    sent += n;
+  }
+  if (client->fd < 0)
+    ret = false;
+  pthread_mutex_unlock(&client->send_lock);
+
+  return ret;
+}
+
+/* Builds the current notify, with lock held */
+static void __notify_line(char *buf, size_t len, bool clean)
+{
+  snprintf(buf, len, "{\"id\":null,\"method\":\"mining.notify\",\"params\":"
+           "[\"%x\",\"%s\",\"%s\",\"%s\",[],\"00000002\",\"%s\",\"%08x\",%s]}",
+           job_no, prev_hash, coinbase1, coinbase2, nbit,
+           (unsigned int)time(NULL), clean ? "true" : "false");
+}
+
+static void send_difficulty(struct client *client, double diff)
+{
+  client_send(client, "{\"id\":null,\"method\":\"mining.set_difficulty\",\"params\":[%g]}", diff);
+}
+
+/* Starts a new job and pushes it to every subscribed client */
+static void broadcast_notify(bool clean)
+{
+  char line[LINE_MAX_LEN];
+  struct client *client;
+
+  pthread_mutex_lock(&lock);
+  job_no++;
+  if (clean) {
+    random_hex(prev_hash, 32);
+    clean_job_no = job_no;
+    clean_job_time = now();
+    notifies_since_clean = 0;
+  } else
+    notifies_since_clean++;
+  notifies++;
+  __notify_line(line, sizeof(line), clean);
+  for (client = clients; client; client = client->next) {
+    if (!client->subscribed)
+      continue;
+    if (clean)
+      client->await_restart = true;
+    client_send(client, "%s", line);
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+static void broadcast_difficulty(double diff)
+{
+  struct client *client;
+
+  pthread_mutex_lock(&lock);
+  opt_diff = diff;
+  for (client = clients; client; client = client->next) {
+    if (client->subscribed)
+      send_difficulty(client, diff);
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+/* Drops every client, optionally asking them to reconnect elsewhere first */
+static void drop_clients(const char *host, const char *port)
+{
+  struct client *client;
+
+  pthread_mutex_lock(&lock);
+  for (client = clients; client; client = client->next) {
+    if (host)
+      client_send(client, "{\"id\":null,\"method\":\"client.reconnect\",\"params\":[\"%s\",\"%s\",0]}",
+                  host, port);
+    else
+      shutdown(client->fd, SHUT_RDWR);
+  }
+  disconnect_time = now();
+  disconnects++;
+  pthread_mutex_unlock(&lock);
+}
+
+static void broadcast_extranonce(const char *extranonce1, int n2size)
+{
+  struct client *client;
+
+  pthread_mutex_lock(&lock);
+  for (client = clients; client; client = client->next) {
+    if (!client->subscribed)
+      continue;
+    snprintf(client->extranonce1, sizeof(client->extranonce1), "%s", extranonce1);
+    client_send(client, "{\"id\":null,\"method\":\"mining.set_extranonce\",\"params\":[\"%s\",%d]}",
+                extranonce1, n2size);
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+static void handle_subscribe(struct client *client, long long id)
+{
+  char line[LINE_MAX_LEN];
+
+  msleep(opt_latency_ms);
+  client_send(client, "{\"id\":%lld,\"result\":[[[\"mining.set_difficulty\",\"%x\"],"
+              "[\"mining.notify\",\"%x\"]],\"%s\",4],\"error\":null}",
+              id, client->no, client->no, client->extranonce1);
+
+  pthread_mutex_lock(&lock);
+  client->subscribed = true;
+  client->await_restart = false;
+  connects++;
+  if (disconnect_time > 0) {
+    latency_add(&reconnect_gap, now() - disconnect_time);
+    say("client %d back %.3f secs after the disconnect", client->no, now() - disconnect_time);
+    disconnect_time = 0;
+  }
+  send_difficulty(client, opt_diff);
+  __notify_line(line, sizeof(line), true);
+  client_send(client, "%s", line);
+  pthread_mutex_unlock(&lock);
+}
+
+static void handle_submit(struct client *client, long long id, json_t *params, double received)
+{
+  const char *job_id = json_string_value(json_array_get(params, 1));
+  unsigned int job = job_id ? (unsigned int)strtoul(job_id, NULL, 16) : 0;
+
+  msleep(opt_latency_ms);
+  client_send(client, "{\"id\":%lld,\"result\":true,\"error\":null}", id);
+
+  pthread_mutex_lock(&lock);
+  submits++;
+  latency_add(&submit_turnaround, now() - received);
+  if (job < clean_job_no)
+    stale_submits++;
+  else if (client->await_restart && job >= clean_job_no) {
+    client->await_restart = false;
+    latency_add(&restart_latency, received - clean_job_time);
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+static void handle_line(struct client *client, const char *line)
+{
+  double received = now();
+  json_error_t err;
+  json_t *val, *id_val;
+  const char *method;
+  long long id;
+
+  val = json_loads(line, 0, &err);
+  if (!val) {
+    say("client %d: bad JSON: %s", client->no, line);
+    return;
+  }
+  method = json_string_value(json_object_get(val, "method"));
+  id_val = json_object_get(val, "id");
+  id = json_is_integer(id_val) ? (long long)json_integer_value(id_val) : 0;
+
+  if (!method)
+    ; /* A reply to client.get_version and friends */
+  else if (!strcmp(method, "mining.subscribe"))
+    handle_subscribe(client, id);
+  else if (!strcmp(method, "mining.submit"))
+    handle_submit(client, id, json_object_get(val, "params"), received);
+  else if (!strcmp(method, "mining.authorize")) {
+    msleep(opt_latency_ms);
+    client->authorized = true;
+    client_send(client, "{\"id\":%lld,\"result\":true,\"error\":null}", id);
+  } else if (!strcmp(method, "mining.extranonce.subscribe")) {
+    msleep(opt_latency_ms);
+    client_send(client, "{\"id\":%lld,\"result\":true,\"error\":null}", id);
+  } else {
+    client_send(client, "{\"id\":%lld,\"result\":null,\"error\":[20,\"Unknown method\",null]}", id);
+  }
+  json_decref(val);
+}
+
+static void *client_thread(void *arg)
+{
+  struct client *client = (struct client *)arg;
+  struct client **pp;
+  char buf[LINE_MAX_LEN];
+  size_t have = 0;
+
+  pthread_detach(pthread_self());
+
+  while (!stopping) {
+    ssize_t n = recv(client->fd, buf + have, sizeof(buf) - 1 - have, 0);
+    char *start, *eol;
+
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    have += n;
+    buf[have] = '\0';
+
+    start = buf;
+    while ((eol = strchr(start, '\n'))) {
+      *eol = '\0';
+      if (eol > start)
+        handle_line(client, start);
+      start = eol + 1;
+    }
+    have -= start - buf;
+    memmove(buf, start, have);
+    if (have == sizeof(buf) - 1) {
+      say("client %d: line too long, dropping", client->no);
+      break;
+    }
+  }
+
+  pthread_mutex_lock(&lock);
+  for (pp = &clients; *pp; pp = &(*pp)->next) {
+    if (*pp == client) {
+      *pp = client->next;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&lock);
+
+  pthread_mutex_lock(&client->send_lock);
+  close(client->fd);
+  client->fd = -1;
+  pthread_mutex_unlock(&client->send_lock);
+  say("client %d disconnected", client->no);
+
+  pthread_mutex_destroy(&client->send_lock);
+  free(client);
+  return NULL;
+}
+
+static void *accept_thread(void *arg)
+{
+  int lsock = *(int *)arg;
+
+  while (!stopping) {
+    struct sockaddr_in addr;
+    socklen_t addrlen = sizeof(addr);
+    struct client *client;
+    pthread_t pth;
+    int fd, one = 1;
+
+    fd = accept(lsock, (struct sockaddr *)&addr, &addrlen);
+    if (fd < 0) {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    client = (struct client *)calloc(1, sizeof(*client));
+    if (!client) {
+      close(fd);
+      continue;
+    }
+    client->fd = fd;
+    pthread_mutex_init(&client->send_lock, NULL);
+
+    pthread_mutex_lock(&lock);
+    client->no = ++client_count;
+    snprintf(client->extranonce1, sizeof(client->extranonce1), "%08x", client->no);
+    client->next = clients;
+    clients = client;
+    pthread_mutex_unlock(&lock);
+
+    say("client %d connected from %s", client->no, inet_ntoa(addr.sin_addr));
+    if (pthread_create(&pth, NULL, client_thread, client)) {
+      say("failed to create client thread");
+      shutdown(fd, SHUT_RDWR);
+    }
+  }
+  return NULL;
+}
+
+static void print_report(void)
+{
+  pthread_mutex_lock(&lock);
+  printf("\nAfter %.1f secs: %llu notifies, %llu shares (%llu stale), %llu connects, %llu disconnects\n",
+         now() - start_time, (unsigned long long)notifies, (unsigned long long)submits,
+         (unsigned long long)stale_submits, (unsigned long long)connects,
+         (unsigned long long)disconnects);
+  printf("  %-26s %8s %10s %10s\n", "", "Count", "Avg ms", "Max ms");
+  latency_print("Server submit turnaround", &submit_turnaround);
+  latency_print("Clean notify to new share", &restart_latency);
+  latency_print("Disconnect to resubscribe", &reconnect_gap);
+  printf("\n");
+  fflush(stdout);
+  pthread_mutex_unlock(&lock);
+}
+
+static bool parse_action(const char *name, enum event_action *action)
+{
+  static const struct {
+    const char *name;
+    enum event_action action;
+  } actions[] = {
+    { "notify", EV_NOTIFY },
+    { "notify-rate", EV_NOTIFY_RATE },
+    { "clean-every", EV_CLEAN_EVERY },
+    { "diff", EV_DIFF },
+    { "latency", EV_LATENCY },
+    { "disconnect", EV_DISCONNECT },
+    { "reconnect", EV_RECONNECT },
+    { "extranonce", EV_EXTRANONCE },
+    { "end", EV_END },
+  };
+  size_t i;
+
+  for (i = 0; i < sizeof(actions) / sizeof(actions[0]); i++) {
+    if (!strcmp(name, actions[i].name)) {
+      *action = actions[i].action;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool load_scenario(const char *path)
+{
+  char line[512];
+  FILE *fp;
+  int lineno = 0;
+
+  fp = fopen(path, "r");
+  if (!fp) {
+    fprintf(stderr, "Failed to open scenario %s: %s\n", path, strerror(errno));
+    return false;
+  }
+  while (fgets(line, sizeof(line), fp)) {
+    struct event *ev = &events[nevents];
+    int n;
+
+    lineno++;
+    if (line[strspn(line, " \t\r\n")] == '#' || !line[strspn(line, " \t\r\n")])
+      continue;
+    if (nevents == MAX_EVENTS) {
+      fprintf(stderr, "%s:%d: too many events\n", path, lineno);
+      fclose(fp);
+      return false;
+    }
+    ev->arg1[0] = ev->arg2[0] = '\0';
+    n = sscanf(line, "%lf %31s %127s %127s", &ev->at, ev->name, ev->arg1, ev->arg2);
+    if (n < 2 || !parse_action(ev->name, &ev->action)) {
+      fprintf(stderr, "%s:%d: cannot parse event: %s", path, lineno, line);
+      fclose(fp);
+      return false;
+    }
+    if (nevents && ev->at < events[nevents - 1].at) {
+      fprintf(stderr, "%s:%d: events must be in time order\n", path, lineno);
+      fclose(fp);
+      return false;
+    }
+    nevents++;
+  }
+  fclose(fp);
+  return true;
+}
+
+static void split_hostport(char *hostport, char **host, char **port)
+{
+  char *colon = strrchr(hostport, ':');
+
+  *host = hostport;
+  *port = (char *)"3333";
+  if (colon) {
+    *colon = '\0';
+    *port = colon + 1;
+  }
+}
+
+/* Returns false on the end event */
+static bool run_event(struct event *ev)
+{
+  say("event: %s %s %s", ev->name, ev->arg1, ev->arg2);
+  switch (ev->action) {
+    case EV_NOTIFY:
+      broadcast_notify(!strcmp(ev->arg1, "clean"));
+      break;
+    case EV_NOTIFY_RATE:
+      opt_notify_ms = atoi(ev->arg1);
+      break;
+    case EV_CLEAN_EVERY:
+      opt_clean_every = atoi(ev->arg1);
+      break;
+    case EV_DIFF:
+      broadcast_difficulty(strtod(ev->arg1, NULL));
+      break;
+    case EV_LATENCY:
+      opt_latency_ms = atoi(ev->arg1);
+      break;
+    case EV_DISCONNECT:
+      drop_clients(NULL, NULL);
+      break;
+    case EV_RECONNECT:
+      drop_clients(ev->arg1, ev->arg2[0] ? ev->arg2 : "3333");
+      break;
+    case EV_EXTRANONCE:
+      broadcast_extranonce(ev->arg1, ev->arg2[0] ? atoi(ev->arg2) : 4);
+      break;
+    case EV_END:
+      return false;
+  }
+  return true;
+}
+
+static void stop(int __attribute__((unused)) sig)
+{
+  stopping = true;
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr,
+    "Usage: %s [options]\n"
+    "  --port N              Port to listen on (default 3333)\n"
+    "  --diff D              Share difficulty (default 1)\n"
+    "  --notify-interval MS  Time between notifies (default 30000)\n"
+    "  --clean-every N       Make every Nth notify a clean job (default 1, 0 for never)\n"
+    "  --latency MS          Delay before every reply\n"
+    "  --disconnect-every S  Drop all clients every S seconds\n"
+    "  --reconnect HOST:PORT Send client.reconnect instead of dropping clients\n"
+    "  --scenario FILE       Run the timed events in FILE\n"
+    "  --duration S          Stop after S seconds\n"
+    "  --report S            Print results every S seconds (default 10)\n",
+    prog);
+}
+
+int main(int argc, char *argv[])
+{
+  static const struct option longopts[] = {
+    { "port", required_argument, NULL, 'p' },
+    { "diff", required_argument, NULL, 'd' },
+    { "notify-interval", required_argument, NULL, 'n' },
+    { "clean-every", required_argument, NULL, 'c' },
+    { "latency", required_argument, NULL, 'l' },
+    { "disconnect-every", required_argument, NULL, 'D' },
+    { "reconnect", required_argument, NULL, 'r' },
+    { "scenario", required_argument, NULL, 's' },
+    { "duration", required_argument, NULL, 't' },
+    { "report", required_argument, NULL, 'R' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  double last_notify, last_disconnect, last_report;
+  struct sockaddr_in addr;
+  pthread_t pth;
+  int lsock, opt, one = 1, next_event = 0;
+
+  while ((opt = getopt_long(argc, argv, "h", longopts, NULL)) != -1) {
+    switch (opt) {
+      case 'p': opt_port = atoi(optarg); break;
+      case 'd': opt_diff = strtod(optarg, NULL); break;
+      case 'n': opt_notify_ms = atoi(optarg); break;
+      case 'c': opt_clean_every = atoi(optarg); break;
+      case 'l': opt_latency_ms = atoi(optarg); break;
+      case 'D': opt_disconnect_secs = atoi(optarg); break;
+      case 'r': opt_reconnect = optarg; break;
+      case 's': opt_scenario = optarg; break;
+      case 't': opt_duration = atoi(optarg); break;
+      case 'R': opt_report_secs = atoi(optarg); break;
+      default:
+        usage(argv[0]);
+        return opt == 'h' ? 0 : 1;
+    }
+  }
+  if (opt_diff <= 0 || opt_notify_ms <= 0) {
+    usage(argv[0]);
+    return 1;
+  }
+  if (opt_scenario && !load_scenario(opt_scenario))
+    return 1;
+
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+  signal(SIGPIPE, SIG_IGN);
+  srand((unsigned int)time(NULL));
+  random_hex(prev_hash, 32);
+  start_time = now();
+
+  lsock = socket(AF_INET, SOCK_STREAM, 0);
+  if (lsock < 0) {
+    perror("socket");
+    return 1;
+  }
+  setsockopt(lsock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(opt_port);
+  if (bind(lsock, (struct sockaddr *)&addr, sizeof(addr)) || listen(lsock, 16)) {
+    perror("bind");
+    return 1;
+  }
+  if (pthread_create(&pth, NULL, accept_thread, &lsock)) {
+    perror("pthread_create");
+    return 1;
+  }
+  say("listening on port %d, diff %g, notify every %d ms", opt_port, opt_diff, opt_notify_ms);
+
+  last_notify = last_disconnect = last_report = now();
+  while (!stopping) {
+    double t = now();
+
+    while (next_event < nevents && events[next_event].at <= t - start_time) {
+      if (!run_event(&events[next_event++]))
+        stopping = true;
+    }
+    if (opt_duration && t - start_time >= opt_duration)
+      break;
+
+    if ((t - last_notify) * 1000.0 >= opt_notify_ms) {
+      bool clean = opt_clean_every > 0 && notifies_since_clean + 1 >= opt_clean_every;
+
+      broadcast_notify(clean);
+      last_notify = t;
+    }
+    if (opt_disconnect_secs && t - last_disconnect >= opt_disconnect_secs) {
+      if (opt_reconnect) {
+        char hostport[256], *host, *port;
+
+        snprintf(hostport, sizeof(hostport), "%s", opt_reconnect);
+        split_hostport(hostport, &host, &port);
+        say("asking clients to reconnect to %s:%s", host, port);
+        drop_clients(host, port);
+      } else {
+        say("dropping clients");
+        drop_clients(NULL, NULL);
+      }
+      last_disconnect = t;
+    }
+    if (opt_report_secs && t - last_report >= opt_report_secs) {
+      print_report();
+      last_report = t;
+    }
+    msleep(10);
+  }
+
+  print_report();
+  return 0;
+}
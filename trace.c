@@ -0,0 +1,243 @@
+/*
+ * Copyright 2014 sgminer developers (see AUTHORS.md)
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the Free
+ * Software Foundation; either version 3 of the License, or (at your option)
+ * any later version.  See COPYING for more details.
+ */
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "miner.h"
+#include "trace.h"
+#include "util.h"
+
+/* Record begin/end events for a timeline, see trace_dump */
+bool opt_trace;
+/* Chrome trace-event file written on exit */
+char *opt_trace_file;
+
+/* Events kept per thread, older ones are overwritten */
+#define TRACE_RING_EVENTS 16384
+
+struct trace_event {
+  uint64_t us;
+  const char *name;
+  char phase;
+};
+
+/* One timeline lane. Only the owning thread writes to it, the lock just
+ * keeps trace_dump from copying a half written event. Rings of exited
+ * threads are handed to the next new thread, so the short lived postcalc
+ * and restart threads share a few lanes instead of growing memory */
+struct trace_ring {
+  struct trace_ring *next;
+  pthread_mutex_t lock;
+  int tid;
+  bool in_use;
+  char name[16];
+  uint64_t head;
+  struct trace_event events[TRACE_RING_EVENTS];
+};
+
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct trace_ring *trace_rings;
+static int trace_tids;
+static struct timeval trace_start;
+
+static pthread_once_t trace_once = PTHREAD_ONCE_INIT;
+static pthread_key_t trace_key;
+
+char *set_trace_file(const char *arg)
+{
+  if (!(arg && arg[0]))
+    return "Invalid parameters for set trace file";
+
+  free(opt_trace_file);
+  opt_trace_file = strdup(arg);
+  cgtime(&trace_start);
+  opt_trace = true;
+
+  return NULL;
+}
+
+/* Thread exit destructor, the ring keeps its events for the dump */
+static void trace_ring_release(void *arg)
+{
+  struct trace_ring *ring = (struct trace_ring *)arg;
+
+  mutex_lock(&trace_lock);
+  ring->in_use = false;
+  mutex_unlock(&trace_lock);
+}
+
+static void trace_key_create(void)
+{
+  if (unlikely(pthread_key_create(&trace_key, trace_ring_release))) {
+    applog(LOG_ERR, "Failed to create trace key, tracing disabled");
+    opt_trace = false;
+  }
+}
+
+static struct trace_ring *trace_ring(void)
+{
+  struct trace_ring *ring;
+
+  pthread_once(&trace_once, trace_key_create);
+  if (unlikely(!opt_trace))
+    return NULL;
+
+  ring = (struct trace_ring *)pthread_getspecific(trace_key);
+  if (likely(ring))
+    return ring;
+
+  mutex_lock(&trace_lock);
+  for (ring = trace_rings; ring; ring = ring->next) {
+    if (!ring->in_use)
+      break;
+  }
+  if (!ring) {
+    ring = (struct trace_ring *)calloc(1, sizeof(struct trace_ring));
+    if (ring) {
+      mutex_init(&ring->lock);
+      ring->tid = ++trace_tids;
+      strcpy(ring->name, "Thread");
+      ring->next = trace_rings;
+      trace_rings = ring;
+    }
+  }
+  if (ring)
+    ring->in_use = true;
+  mutex_unlock(&trace_lock);
+
+  if (unlikely(!ring)) {
+    applog(LOG_ERR, "Failed to calloc trace ring, tracing disabled");
+    opt_trace = false;
+    return NULL;
+  }
+  pthread_setspecific(trace_key, ring);
+
+  return ring;
+}
+
+/* Names the calling thread's lane, called from RenameThread */
+void trace_thread_name(const char *name)
+{
+  struct trace_ring *ring;
+
+  if (!opt_trace)
+    return;
+  ring = trace_ring();
+  if (!ring)
+    return;
+
+  mutex_lock(&ring->lock);
+  snprintf(ring->name, sizeof(ring->name), "%s", name);
+  mutex_unlock(&ring->lock);
+}
+
+void __trace_event(const char *name, char phase)
+{
+  struct trace_ring *ring = trace_ring();
+  struct trace_event *event;
+  struct timeval now;
+
+  if (unlikely(!ring))
+    return;
+
+  cgtime(&now);
+  mutex_lock(&ring->lock);
+  event = &ring->events[ring->head++ % TRACE_RING_EVENTS];
+  event->us = (uint64_t)(now.tv_sec - trace_start.tv_sec) * 1000000 +
+              now.tv_usec - trace_start.tv_usec;
+  event->name = name;
+  event->phase = phase;
+  mutex_unlock(&ring->lock);
+}
+
+/* Writes every lane as Chrome trace-event JSON, which chrome://tracing and
+ * Perfetto open directly. Each ring is copied out under its lock so the
+ * mining threads are only held up for the copy, not the file writes */
+bool trace_dump(const char *filename)
+{
+  struct trace_event *events;
+  struct trace_ring *ring;
+  FILE *fp;
+  bool ret;
+
+  events = (struct trace_event *)malloc(sizeof(struct trace_event) * TRACE_RING_EVENTS);
+  if (unlikely(!events)) {
+    applog(LOG_ERR, "Failed to malloc trace events in trace_dump");
+    return false;
+  }
+
+  fp = fopen(filename, "w");
+  if (!fp) {
+    applog(LOG_ERR, "Failed to open trace file %s", filename);
+    free(events);
+    return false;
+  }
+
+  fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"%s\"}}",
+          PACKAGE);
+
+  /* Rings are only ever prepended and never freed, so the list can be
+   * walked without trace_lock once the head is read */
+  mutex_lock(&trace_lock);
+  ring = trace_rings;
+  mutex_unlock(&trace_lock);
+
+  for (; ring; ring = ring->next) {
+    uint64_t head, i, n;
+    char name[16];
+    int depth = 0;
+
+    mutex_lock(&ring->lock);
+    head = ring->head;
+    n = MIN(head, TRACE_RING_EVENTS);
+    for (i = 0; i < n; i++)
+      events[i] = ring->events[(head - n + i) % TRACE_RING_EVENTS];
+    strcpy(name, ring->name);
+    mutex_unlock(&ring->lock);
+
+    fprintf(fp, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+            ring->tid, name);
+
+    for (i = 0; i < n; i++) {
+      struct trace_event *event = &events[i];
+
+      /* Skip ends whose begin was overwritten by the ring wrapping */
+      if (event->phase == 'B')
+        depth++;
+      else if (event->phase == 'E') {
+        if (!depth)
+          continue;
+        depth--;
+      }
+
+      fprintf(fp, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%"PRIu64",\"pid\":1,\"tid\":%d%s}",
+              event->name, event->phase, event->us, ring->tid,
+              event->phase == 'i' ? ",\"s\":\"t\"" : "");
+    }
+  }
+
+  fprintf(fp, "\n]}\n");
+  ret = !ferror(fp);
+  if (fclose(fp))
+    ret = false;
+  free(events);
+
+  if (ret)
+    applog(LOG_NOTICE, "Trace written to %s", filename);
+  else
+    applog(LOG_ERR, "Failed to write trace file %s", filename);
+
+  return ret;
+}
@@ -0,0 +1,32 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "miner.h"
+
+extern bool opt_trace;
+extern char *opt_trace_file;
+
+extern char *set_trace_file(const char *arg);
+extern void trace_thread_name(const char *name);
+extern void __trace_event(const char *name, char phase);
+extern bool trace_dump(const char *filename);
+
+/* Timeline events for --trace. Begin and end must pair up and nest within
+ * a thread, so every path out of a traced region needs its TRACE_END. The
+ * name must be a string literal, only the pointer is kept */
+#define TRACE_BEGIN(name) do { \
+  if (unlikely(opt_trace)) \
+    __trace_event(name, 'B'); \
+} while (0)
+
+#define TRACE_END(name) do { \
+  if (unlikely(opt_trace)) \
+    __trace_event(name, 'E'); \
+} while (0)
+
+#define TRACE_INSTANT(name) do { \
+  if (unlikely(opt_trace)) \
+    __trace_event(name, 'i'); \
+} while (0)
+
+#endif /* TRACE_H */
@@ -15,6 +15,7 @@
 #include <ctype.h>
 #include <stdarg.h>
 #include <string.h>
+#include <limits.h>
 #include <jansson.h>
 #ifdef HAVE_LIBCURL
 #include <curl/curl.h>
@@ -44,6 +45,9 @@
 #include "compat.h"
 #include "util.h"
 #include "pool.h"
+#include "stratum_record.h"
+#include "trace.h"
+#include "lowmem.h"
 
 #define DEFAULT_SOCKWAIT 60
 extern double opt_diff_mult;
@@ -83,11 +87,6 @@ static void keep_sockalive(SOCKETTYPE fd)
 
 }
 
-struct tq_ent {
-  void      *data;
-  struct list_head  q_node;
-};
-
 #ifdef HAVE_LIBCURL
 struct timeval nettime;
 
@@ -735,7 +734,7 @@ void tq_free(struct thread_q *tq)
 
   list_for_each_entry_safe(ent, iter, &tq->q, q_node) {
     list_del(&ent->q_node);
-    free(ent);
+    lowmem_free(LOWMEM_TQ_ENT, ent);
   }
 
   pthread_cond_destroy(&tq->cond);
@@ -768,7 +767,7 @@ bool tq_push(struct thread_q *tq, void *data)
   struct tq_ent *ent;
   bool rc = true;
 
-  ent = (struct tq_ent *)calloc(1, sizeof(*ent));
+  ent = (struct tq_ent *)lowmem_alloc(LOWMEM_TQ_ENT);
   if (!ent)
     return false;
 
@@ -779,7 +778,7 @@ bool tq_push(struct thread_q *tq, void *data)
   if (!tq->frozen) {
     list_add_tail(&ent->q_node, &tq->q);
   } else {
-    free(ent);
+    lowmem_free(LOWMEM_TQ_ENT, ent);
     rc = false;
   }
   pthread_cond_signal(&tq->cond);
@@ -799,9 +798,9 @@ void *tq_pop(struct thread_q *tq, const struct timespec *abstime)
     goto pop;
 
   if (abstime)
-    rc = pthread_cond_timedwait(&tq->cond, &tq->mutex, abstime);
+    rc = cond_timedwait(&tq->cond, &tq->mutex, abstime);
   else
-    rc = pthread_cond_wait(&tq->cond, &tq->mutex);
+    rc = cond_wait(&tq->cond, &tq->mutex);
   if (rc)
     goto out;
   if (list_empty(&tq->q))
@@ -811,7 +810,7 @@ pop:
   rval = ent->data;
 
   list_del(&ent->q_node);
-  free(ent);
+  lowmem_free(LOWMEM_TQ_ENT, ent);
 out:
   mutex_unlock(&tq->mutex);
 
@@ -1291,6 +1290,9 @@ retry:
     len -= sent;
   }
 
+  if (unlikely(opt_stratum_record))
+    stratum_record(pool, SREC_SEND, s, ssent - 1);
+
   pool->sgminer_pool_stats.times_sent++;
   pool->sgminer_pool_stats.bytes_sent += ssent;
   pool->sgminer_pool_stats.net_bytes_sent += ssent;
@@ -1304,10 +1306,12 @@ bool stratum_send(struct pool *pool, char *s, ssize_t len)
   if (opt_protocol)
     applog(LOG_DEBUG, "SEND: %s", s);
 
+  TRACE_BEGIN("stratum_send");
   mutex_lock(&pool->stratum_lock);
   if (pool->stratum_active)
     ret = __stratum_send(pool, s, len);
   mutex_unlock(&pool->stratum_lock);
+  TRACE_END("stratum_send");
 
   /* This is to avoid doing applog under stratum_lock */
   switch (ret) {
@@ -1405,6 +1409,7 @@ char *recv_line(struct pool *pool)
   ssize_t len, buflen;
   int waited = 0;
 
+  TRACE_BEGIN("recv_line");
   if (!strstr(pool->sockbuf, "\n")) {
     struct timeval rstart, now;
 
@@ -1435,9 +1440,25 @@ char *recv_line(struct pool *pool)
           break;
         }
       } else {
-        slen = strlen(s);
+        char *p = s;
+
+        if (pool->sockbuf_discard) {
+          if (!(p = strchr(s, '\n')))
+            continue;
+          p++;
+          pool->sockbuf_discard = false;
+        }
+        slen = strlen(p);
+        /* Drop the line rather than grow the buffer for it */
+        if (opt_lowmem && strlen(pool->sockbuf) + slen > LOWMEM_LINE_MAX && !strchr(p, '\n')) {
+          applog(LOG_WARNING, "%s sent a line over %d bytes, dropping it", get_pool_name(pool), LOWMEM_LINE_MAX);
+          pool->sgminer_pool_stats.lines_dropped++;
+          pool->sockbuf_discard = true;
+          strcpy(pool->sockbuf, "");
+          continue;
+        }
         recalloc_sock(pool, slen);
-        strcat(pool->sockbuf, s);
+        strcat(pool->sockbuf, p);
       }
     } while (waited < DEFAULT_SOCKWAIT && !strstr(pool->sockbuf, "\n"));
   }
@@ -1461,11 +1482,15 @@ char *recv_line(struct pool *pool)
   pool->sgminer_pool_stats.times_received++;
   pool->sgminer_pool_stats.bytes_received += len;
   pool->sgminer_pool_stats.net_bytes_received += len;
+
+  if (unlikely(opt_stratum_record))
+    stratum_record(pool, SREC_RECV, sret, len);
 out:
   if (!sret)
     clear_sock(pool);
   else if (opt_protocol)
     applog(LOG_DEBUG, "RECVD: %s", sret);
+  TRACE_END("recv_line");
   return sret;
 }
 
@@ -1501,157 +1526,371 @@ static char *json_array_string(json_t *val, unsigned int entry)
 
 static char *blank_merkel = "0000000000000000000000000000000000000000000000000000000000000000";
 
-static bool parse_notify(struct pool *pool, json_t *val)
+/* Positions in the mining.notify params array */
+enum notify_param {
+  NOTIFY_JOB_ID,
+  NOTIFY_PREV_HASH,
+  NOTIFY_COINBASE1,
+  NOTIFY_COINBASE2,
+  NOTIFY_MERKLES,
+  NOTIFY_BBVERSION,
+  NOTIFY_NBIT,
+  NOTIFY_NTIME,
+  NOTIFY_CLEAN,
+  NOTIFY_PARAMS
+};
+
+/* A mining.notify message as pointers into the received text or into the
+ * jansson tree, so neither parser has to copy the fields before storing */
+struct stratum_notify {
+  const char *str[NOTIFY_PARAMS];
+  size_t len[NOTIFY_PARAMS];
+  const char **merkle;
+  int merkles;
+  bool clean;
+};
+
+/* Like hex2bin, but for hex that is not NUL terminated at the end of the
+ * value, eg. a field inside the received line */
+static bool hex2bin_len(unsigned char *p, const char *hexstr, size_t len)
 {
-  char *job_id, *prev_hash, *coinbase1, *coinbase2, *bbversion, *nbit,
-       *ntime, *header;
-  size_t cb1_len, cb2_len, alloc_len;
-  unsigned char *cb1, *cb2;
-  bool clean, ret = false;
-  int merkles, i;
-  json_t *arr;
+  int nibble1, nibble2;
 
-  arr = json_array_get(val, 4);
-  if (!arr || !json_is_array(arr))
-    goto out;
+  while (len--) {
+    nibble1 = hex2bin_tbl[(unsigned char)*hexstr++];
+    nibble2 = hex2bin_tbl[(unsigned char)*hexstr++];
+    if (unlikely((nibble1 < 0) || (nibble2 < 0)))
+      return false;
+    *p++ = (((unsigned char)nibble1) << 4) | ((unsigned char)nibble2);
+  }
+  return true;
+}
 
-  merkles = json_array_size(arr);
-
-  job_id = json_array_string(val, 0);
-  prev_hash = json_array_string(val, 1);
-  coinbase1 = json_array_string(val, 2);
-  coinbase2 = json_array_string(val, 3);
-  bbversion = json_array_string(val, 5);
-  nbit = json_array_string(val, 6);
-  ntime = json_array_string(val, 7);
-  clean = json_is_true(json_array_get(val, 8));
-
-  if (!job_id || !prev_hash || !coinbase1 || !coinbase2 || !bbversion || !nbit || !ntime) {
-    /* Annoying but we must not leak memory */
-    if (job_id)
-      free(job_id);
-    if (prev_hash)
-      free(prev_hash);
-    if (coinbase1)
-      free(coinbase1);
-    if (coinbase2)
-      free(coinbase2);
-    if (bbversion)
-      free(bbversion);
-    if (nbit)
-      free(nbit);
-    if (ntime)
-      free(ntime);
-    goto out;
+/* Decodes the next piece of the header template, clipped to what is left of
+ * header_bin */
+static bool header_append(unsigned char **p, size_t *left, const char *hexstr, size_t hexlen)
+{
+  size_t len = hexlen / 2;
+
+  if (len > *left)
+    len = *left;
+  if (unlikely(!hex2bin_len(*p, hexstr, len)))
+    return false;
+  *p += len;
+  *left -= len;
+  return true;
+}
+
+/* Replaces a swork string, reusing its buffer when the new value fits, which
+ * it does for every notify of a session on most pools */
+static void swork_strset(char **dst, const char *src, size_t len)
+{
+  if (!*dst || strlen(*dst) < len) {
+    char *tmp = (char *)realloc(*dst, len + 1);
+
+    if (unlikely(!tmp))
+      quithere(1, "Failed to realloc pool swork string");
+    *dst = tmp;
   }
+  memcpy(*dst, src, len);
+  (*dst)[len] = '\0';
+}
+
+/* Stores a parsed notify in pool->swork. The hex fields are decoded straight
+ * into the pool buffers, which are only reallocated when they grow */
+static bool store_notify(struct pool *pool, const struct stratum_notify *n)
+{
+  size_t cb1_len, cb2_len, alloc_len, left;
+  unsigned char *hdr;
+  bool header_ok;
+  int i;
+
+  cb1_len = n->len[NOTIFY_COINBASE1] / 2;
+  cb2_len = n->len[NOTIFY_COINBASE2] / 2;
 
   cg_wlock(&pool->data_lock);
-  free(pool->swork.job_id);
-  free(pool->swork.prev_hash);
-  free(pool->swork.bbversion);
-  free(pool->swork.nbit);
-  free(pool->swork.ntime);
-  pool->swork.job_id = job_id;
-  pool->swork.prev_hash = prev_hash;
-  cb1_len = strlen(coinbase1) / 2;
-  cb2_len = strlen(coinbase2) / 2;
-  pool->swork.bbversion = bbversion;
-  pool->swork.nbit = nbit;
-  pool->swork.ntime = ntime;
-  pool->swork.clean = clean;
+  swork_strset(&pool->swork.job_id, n->str[NOTIFY_JOB_ID], n->len[NOTIFY_JOB_ID]);
+  swork_strset(&pool->swork.prev_hash, n->str[NOTIFY_PREV_HASH], n->len[NOTIFY_PREV_HASH]);
+  swork_strset(&pool->swork.bbversion, n->str[NOTIFY_BBVERSION], n->len[NOTIFY_BBVERSION]);
+  swork_strset(&pool->swork.nbit, n->str[NOTIFY_NBIT], n->len[NOTIFY_NBIT]);
+  swork_strset(&pool->swork.ntime, n->str[NOTIFY_NTIME], n->len[NOTIFY_NTIME]);
+  pool->swork.clean = n->clean;
   alloc_len = pool->swork.cb_len = cb1_len + pool->n1_len + pool->n2size + cb2_len;
   pool->nonce2_offset = cb1_len + pool->n1_len;
 
-  for (i = 0; i < pool->swork.merkles; i++)
-    free(pool->swork.merkle_bin[i]);
-  if (merkles) {
+  if (n->merkles > pool->swork.merkles_alloc) {
     pool->swork.merkle_bin = (unsigned char **)realloc(pool->swork.merkle_bin,
-             sizeof(char *) * merkles + 1);
-    for (i = 0; i < merkles; i++) {
-      char *merkle = json_array_string(arr, i);
-
+             sizeof(char *) * n->merkles);
+    if (unlikely(!pool->swork.merkle_bin))
+      quit(1, "Failed to realloc pool swork merkle_bin");
+    for (i = pool->swork.merkles_alloc; i < n->merkles; i++) {
       pool->swork.merkle_bin[i] = (unsigned char *)malloc(32);
       if (unlikely(!pool->swork.merkle_bin[i]))
         quit(1, "Failed to malloc pool swork merkle_bin");
-      hex2bin(pool->swork.merkle_bin[i], merkle, 32);
-      free(merkle);
     }
+    pool->swork.merkles_alloc = n->merkles;
   }
-  pool->swork.merkles = merkles;
-  if (clean)
+  for (i = 0; i < n->merkles; i++) {
+    if (unlikely(!hex2bin_len(pool->swork.merkle_bin[i], n->merkle[i], 32))) {
+      cg_wunlock(&pool->data_lock);
+      applog(LOG_WARNING, "%s: Invalid merkle branch %d in notify from pool %d", __func__, i, pool->pool_no);
+      pool_failed(pool);
+      return false;
+    }
+  }
+  pool->swork.merkles = n->merkles;
+  if (n->clean)
     pool->nonce2 = 0;
-  pool->merkle_offset = strlen(pool->swork.bbversion) +
-            strlen(pool->swork.prev_hash);
+  pool->merkle_offset = n->len[NOTIFY_BBVERSION] + n->len[NOTIFY_PREV_HASH];
   pool->swork.header_len = pool->merkle_offset +
   /* merkle_hash */  32 +
-         strlen(pool->swork.ntime) +
-         strlen(pool->swork.nbit) +
+         n->len[NOTIFY_NTIME] +
+         n->len[NOTIFY_NBIT] +
   /* nonce */    8 +
   /* workpadding */  96;
   pool->merkle_offset /= 2;
   pool->swork.header_len = pool->swork.header_len * 2 + 1;
   align_len(&pool->swork.header_len);
-  header = (char *)alloca(pool->swork.header_len);
-  snprintf(header, pool->swork.header_len,
-    "%s%s%s%s%s%s%s",
-    pool->swork.bbversion,
-    pool->swork.prev_hash,
-    blank_merkel,
-    pool->swork.ntime,
-    pool->swork.nbit,
-    "00000000", /* nonce */
-    workpadding);
-  if (unlikely(!hex2bin(pool->header_bin, header, 128))) {
-    applog(LOG_WARNING, "%s: Failed to convert header to header_bin, got %s", __func__, header);
+
+  hdr = pool->header_bin;
+  left = sizeof(pool->header_bin);
+  header_ok = header_append(&hdr, &left, n->str[NOTIFY_BBVERSION], n->len[NOTIFY_BBVERSION]) &&
+        header_append(&hdr, &left, n->str[NOTIFY_PREV_HASH], n->len[NOTIFY_PREV_HASH]) &&
+        header_append(&hdr, &left, blank_merkel, 64) &&
+        header_append(&hdr, &left, n->str[NOTIFY_NTIME], n->len[NOTIFY_NTIME]) &&
+        header_append(&hdr, &left, n->str[NOTIFY_NBIT], n->len[NOTIFY_NBIT]) &&
+        header_append(&hdr, &left, "00000000", 8) && /* nonce */
+        header_append(&hdr, &left, workpadding, strlen(workpadding)) &&
+        !left;
+  if (unlikely(!header_ok)) {
+    cg_wunlock(&pool->data_lock);
+    applog(LOG_WARNING, "%s: Failed to convert header to header_bin", __func__);
     pool_failed(pool);
-    // TODO: memory leaks? goto out, clean up there?
     return false;
   }
 
-  cb1 = (unsigned char *)calloc(cb1_len, 1);
-  if (unlikely(!cb1))
-    quithere(1, "Failed to calloc cb1 in parse_notify");
-  hex2bin(cb1, coinbase1, cb1_len);
-
-  cb2 = (unsigned char *)calloc(cb2_len, 1);
-  if (unlikely(!cb2))
-    quithere(1, "Failed to calloc cb2 in parse_notify");
-  hex2bin(cb2, coinbase2, cb2_len);
-
-  free(pool->coinbase);
   align_len(&alloc_len);
-  pool->coinbase = (unsigned char *)calloc(alloc_len, 1);
-  if (unlikely(!pool->coinbase))
-    quit(1, "Failed to calloc pool coinbase in parse_notify");
-  memcpy(pool->coinbase, cb1, cb1_len);
+  if (alloc_len > pool->swork.cb_alloc) {
+    free(pool->coinbase);
+    pool->coinbase = (unsigned char *)calloc(alloc_len, 1);
+    if (unlikely(!pool->coinbase))
+      quit(1, "Failed to calloc pool coinbase in parse_notify");
+    pool->swork.cb_alloc = alloc_len;
+  }
   memcpy(pool->coinbase + cb1_len, pool->nonce1bin, pool->n1_len);
   // NOTE: gap for nonce2, filled at work generation time
-  memcpy(pool->coinbase + cb1_len + pool->n1_len + pool->n2size, cb2, cb2_len);
+  if (unlikely(!hex2bin_len(pool->coinbase, n->str[NOTIFY_COINBASE1], cb1_len) ||
+         !hex2bin_len(pool->coinbase + cb1_len + pool->n1_len + pool->n2size,
+                n->str[NOTIFY_COINBASE2], cb2_len))) {
+    cg_wunlock(&pool->data_lock);
+    applog(LOG_WARNING, "%s: Invalid coinbase in notify from pool %d", __func__, pool->pool_no);
+    pool_failed(pool);
+    return false;
+  }
   cg_wunlock(&pool->data_lock);
 
   if (opt_protocol) {
-    applog(LOG_DEBUG, "job_id: %s", job_id);
-    applog(LOG_DEBUG, "prev_hash: %s", prev_hash);
-    applog(LOG_DEBUG, "coinbase1: %s", coinbase1);
-    applog(LOG_DEBUG, "coinbase2: %s", coinbase2);
-    applog(LOG_DEBUG, "bbversion: %s", bbversion);
-    applog(LOG_DEBUG, "nbit: %s", nbit);
-    applog(LOG_DEBUG, "ntime: %s", ntime);
-    applog(LOG_DEBUG, "clean: %s", clean ? "yes" : "no");
-  }
-  free(coinbase1);
-  free(coinbase2);
-  free(cb1);
-  free(cb2);
+    applog(LOG_DEBUG, "job_id: %.*s", (int)n->len[NOTIFY_JOB_ID], n->str[NOTIFY_JOB_ID]);
+    applog(LOG_DEBUG, "prev_hash: %.*s", (int)n->len[NOTIFY_PREV_HASH], n->str[NOTIFY_PREV_HASH]);
+    applog(LOG_DEBUG, "coinbase1: %.*s", (int)n->len[NOTIFY_COINBASE1], n->str[NOTIFY_COINBASE1]);
+    applog(LOG_DEBUG, "coinbase2: %.*s", (int)n->len[NOTIFY_COINBASE2], n->str[NOTIFY_COINBASE2]);
+    applog(LOG_DEBUG, "bbversion: %.*s", (int)n->len[NOTIFY_BBVERSION], n->str[NOTIFY_BBVERSION]);
+    applog(LOG_DEBUG, "nbit: %.*s", (int)n->len[NOTIFY_NBIT], n->str[NOTIFY_NBIT]);
+    applog(LOG_DEBUG, "ntime: %.*s", (int)n->len[NOTIFY_NTIME], n->str[NOTIFY_NTIME]);
+    applog(LOG_DEBUG, "clean: %s", n->clean ? "yes" : "no");
+  }
 
   /* A notify message is the closest stratum gets to a getwork */
   pool->getwork_requested++;
   total_getworks++;
-  ret = true;
   if (pool == current_pool())
     opt_work_update = true;
-out:
-  return ret;
+  return true;
+}
+
+static bool parse_notify(struct pool *pool, json_t *val)
+{
+  struct stratum_notify n;
+  json_t *arr;
+  int i;
+
+  arr = json_array_get(val, NOTIFY_MERKLES);
+  if (!arr || !json_is_array(arr))
+    return false;
+
+  for (i = 0; i < NOTIFY_PARAMS; i++) {
+    if (i == NOTIFY_MERKLES || i == NOTIFY_CLEAN)
+      continue;
+    n.str[i] = __json_array_string(val, i);
+    if (!n.str[i])
+      return false;
+    n.len[i] = strlen(n.str[i]);
+  }
+  n.clean = json_is_true(json_array_get(val, NOTIFY_CLEAN));
+
+  n.merkles = json_array_size(arr);
+  n.merkle = (const char **)alloca(sizeof(char *) * (n.merkles + 1));
+  for (i = 0; i < n.merkles; i++) {
+    n.merkle[i] = __json_array_string(arr, i);
+    if (!n.merkle[i] || strlen(n.merkle[i]) < 64)
+      return false;
+  }
+
+  return store_notify(pool, &n);
+}
+
+/* The fast path scanner below only accepts the plain shapes pools actually
+ * send: no escapes, no nesting beyond the notify params. Anything else
+ * returns NULL and the line goes through jansson instead */
+#define STRATUM_FAST_MERKLES 32
+
+static inline const char *sfast_ws(const char *p)
+{
+  while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+    p++;
+  return p;
+}
+
+static const char *sfast_str(const char *p, const char **str, size_t *len)
+{
+  const char *q;
+
+  p = sfast_ws(p);
+  if (*p != '"')
+    return NULL;
+  q = ++p;
+  while (*q != '"') {
+    if (!*q || *q == '\\')
+      return NULL;
+    q++;
+  }
+  *str = p;
+  *len = q - p;
+  return sfast_ws(q + 1);
+}
+
+static const char *sfast_lit(const char *p, const char *lit)
+{
+  size_t len = strlen(lit);
+
+  p = sfast_ws(p);
+  if (strncmp(p, lit, len))
+    return NULL;
+  return sfast_ws(p + len);
+}
+
+static const char *sfast_notify_params(const char *p, struct stratum_notify *n)
+{
+  const char *str;
+  size_t len;
+  int i;
+
+  if (!(p = sfast_lit(p, "[")))
+    return NULL;
+  for (i = 0; i < NOTIFY_PARAMS; i++) {
+    if (i && !(p = sfast_lit(p, ",")))
+      return NULL;
+    if (i == NOTIFY_MERKLES) {
+      if (!(p = sfast_lit(p, "[")))
+        return NULL;
+      n->merkles = 0;
+      if (*p != ']') {
+        do {
+          if (n->merkles >= STRATUM_FAST_MERKLES)
+            return NULL;
+          if (!(p = sfast_str(p, &str, &len)) || len != 64)
+            return NULL;
+          n->merkle[n->merkles++] = str;
+        } while (*p++ == ',');
+        p--;
+      }
+      if (!(p = sfast_lit(p, "]")))
+        return NULL;
+    } else if (i == NOTIFY_CLEAN) {
+      if ((str = sfast_lit(p, "true")))
+        n->clean = true;
+      else if ((str = sfast_lit(p, "false")))
+        n->clean = false;
+      p = str;
+    } else
+      p = sfast_str(p, &n->str[i], &n->len[i]);
+    if (!p)
+      return NULL;
+  }
+  return sfast_lit(p, "]");
+}
+
+#define SFAST_KEY(key, klen, name) \
+  ((klen) == sizeof(name) - 1 && !memcmp(key, name, sizeof(name) - 1))
+
+/* Handles the two messages that make up nearly all stratum traffic without
+ * building a jansson tree: mining.notify, which is stored directly, and
+ * {"id": N, "result": true, "error": null}, whose id is returned for the
+ * caller to match against its submitted shares */
+enum stratum_fast parse_stratum_fast(struct pool *pool, const char *s, int *id)
+{
+  const char *merkle[STRATUM_FAST_MERKLES];
+  const char *p, *key, *method = NULL;
+  struct stratum_notify n;
+  size_t klen, mlen = 0;
+  bool has_id = false, has_params = false, result = false;
+
+  n.merkle = merkle;
+
+  if (!(p = sfast_lit(s, "{")))
+    return STRATUM_FAST_NONE;
+  while (42) {
+    if (!(p = sfast_str(p, &key, &klen)) || !(p = sfast_lit(p, ":")))
+      return STRATUM_FAST_NONE;
+    if (SFAST_KEY(key, klen, "id")) {
+      const char *q = sfast_lit(p, "null");
+
+      if (q)
+        p = q;
+      else {
+        char *end;
+        long val = strtol(p, &end, 10);
+
+        if (end == p || val <= 0 || val > INT_MAX)
+          return STRATUM_FAST_NONE;
+        has_id = true;
+        *id = (int)val;
+        p = sfast_ws(end);
+      }
+    } else if (SFAST_KEY(key, klen, "result")) {
+      p = sfast_lit(p, "true");
+      result = true;
+    } else if (SFAST_KEY(key, klen, "error"))
+      p = sfast_lit(p, "null");
+    else if (SFAST_KEY(key, klen, "method"))
+      p = sfast_str(p, &method, &mlen);
+    else if (SFAST_KEY(key, klen, "params")) {
+      p = sfast_notify_params(p, &n);
+      has_params = true;
+    } else
+      return STRATUM_FAST_NONE;
+    if (!p)
+      return STRATUM_FAST_NONE;
+    if (*p == ',') {
+      p++;
+      continue;
+    }
+    if (*p++ != '}')
+      return STRATUM_FAST_NONE;
+    break;
+  }
+  if (*sfast_ws(p))
+    return STRATUM_FAST_NONE;
+
+  if (method) {
+    if (!SFAST_KEY(method, mlen, "mining.notify") || !has_params)
+      return STRATUM_FAST_NONE;
+    pool->stratum_notify = store_notify(pool, &n);
+    return pool->stratum_notify ? STRATUM_FAST_NOTIFY : STRATUM_FAST_FAILED;
+  }
+  if (has_id && result && !has_params)
+    return STRATUM_FAST_ACCEPT;
+  return STRATUM_FAST_NONE;
 }
 
 static bool parse_diff(struct pool *pool, json_t *val)
@@ -1798,90 +2037,72 @@ static bool show_message(struct pool *pool, json_t *val)
   return true;
 }
 
-bool parse_method(struct pool *pool, char *s)
+/* Handles a stratum method call from an already decoded line. The caller
+ * keeps its reference to val */
+bool parse_method_json(struct pool *pool, json_t *val)
 {
-  json_t *val = NULL, *method, *err_val, *params;
-  json_error_t err;
-  bool ret = false;
+  json_t *method, *err_val, *params;
   char *buf;
 
-  if (!s)
-    return ret;
-
-  val = JSON_LOADS(s, &err);
-  if (!val) {
-    applog(LOG_INFO, "JSON decode failed(%d): %s", err.line, err.text);
-    return ret;
-  }
-
   method = json_object_get(val, "method");
-  if (!method) {
-    json_decref(val);
-    return ret;
-  }
+  if (!method)
+    return false;
   err_val = json_object_get(val, "error");
   params = json_object_get(val, "params");
 
   if (err_val && !json_is_null(err_val)) {
     char *ss;
 
-    if (err_val)
-      ss = json_dumps(err_val, JSON_INDENT(3));
-    else
-      ss = strdup("(unknown reason)");
-
+    ss = json_dumps(err_val, JSON_INDENT(3));
     applog(LOG_INFO, "JSON-RPC method decode failed: %s", ss);
-
-    json_decref(val);
     free(ss);
 
-    return ret;
+    return false;
   }
 
   buf = (char *)json_string_value(method);
-  if (!buf) {
-    json_decref(val);
-    return ret;
-  }
+  if (!buf)
+    return false;
 
   if (!strncasecmp(buf, "mining.notify", 13)) {
-    if (parse_notify(pool, params))
-      pool->stratum_notify = ret = true;
-    else
-      pool->stratum_notify = ret = false;
-    json_decref(val);
-    return ret;
+    pool->stratum_notify = parse_notify(pool, params);
+    return pool->stratum_notify;
   }
 
-  if (!strncasecmp(buf, "mining.set_difficulty", 21) && parse_diff(pool, params)) {
-    ret = true;
-    json_decref(val);
-    return ret;
-  }
+  if (!strncasecmp(buf, "mining.set_difficulty", 21) && parse_diff(pool, params))
+    return true;
 
-  if (!strncasecmp(buf, "mining.set_extranonce", 21) && parse_extranonce(pool, params)) {
-    ret = true;
-    json_decref(val);
-    return ret;
-  }
+  if (!strncasecmp(buf, "mining.set_extranonce", 21) && parse_extranonce(pool, params))
+    return true;
 
-  if (!strncasecmp(buf, "client.reconnect", 16) && parse_reconnect(pool, params)) {
-    ret = true;
-    json_decref(val);
-    return ret;
-  }
+  if (!strncasecmp(buf, "client.reconnect", 16) && parse_reconnect(pool, params))
+    return true;
 
-  if (!strncasecmp(buf, "client.get_version", 18) && send_version(pool, val)) {
-    ret = true;
-    json_decref(val);
-    return ret;
-  }
+  if (!strncasecmp(buf, "client.get_version", 18) && send_version(pool, val))
+    return true;
 
-  if (!strncasecmp(buf, "client.show_message", 19) && show_message(pool, params)) {
-    ret = true;
-    json_decref(val);
-    return ret;
+  if (!strncasecmp(buf, "client.show_message", 19) && show_message(pool, params))
+    return true;
+
+  return false;
+}
+
+bool parse_method(struct pool *pool, char *s)
+{
+  json_t *val;
+  json_error_t err;
+  bool ret;
+
+  if (!s)
+    return false;
+
+  val = JSON_LOADS(s, &err);
+  if (!val) {
+    applog(LOG_INFO, "JSON decode failed(%d): %s", err.line, err.text);
+    return false;
   }
+
+  ret = parse_method_json(pool, val);
   json_decref(val);
   return ret;
 }
@@ -2398,6 +2619,13 @@ retry:
 
   pool->sock = sockd;
   keep_sockalive(sockd);
+
+  if (unlikely(opt_stratum_record)) {
+    char addr[256];
+
+    snprintf(addr, sizeof(addr), "%s:%s", pool->sockaddr_url, pool->stratum_port);
+    stratum_record(pool, SREC_CONNECT, addr, strlen(addr));
+  }
   return true;
 }
 
@@ -2674,6 +2902,7 @@ void RenameThread(const char* name)
   // Prevent warnings
   (void)buf;
 #endif
+  trace_thread_name(name);
 }
 
 /* sgminer specific wrappers for true unnamed semaphore usage on platforms
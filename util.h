@@ -135,6 +135,16 @@ bool stratum_send(struct pool *pool, char *s, ssize_t len);
 bool sock_full(struct pool *pool);
 char *recv_line(struct pool *pool);
 bool parse_method(struct pool *pool, char *s);
+bool parse_method_json(struct pool *pool, json_t *val);
+
+/* Outcome of parse_stratum_fast */
+enum stratum_fast {
+  STRATUM_FAST_NONE,    /* Not a shape the fast path handles, use jansson */
+  STRATUM_FAST_NOTIFY,  /* mining.notify stored */
+  STRATUM_FAST_FAILED,  /* mining.notify that could not be stored */
+  STRATUM_FAST_ACCEPT,  /* Share accepted, id returned */
+};
+enum stratum_fast parse_stratum_fast(struct pool *pool, const char *s, int *id);
 bool extract_sockaddr(char *url, char **sockaddr_url, char **sockaddr_port);
 bool auth_stratum(struct pool *pool);
 bool subscribe_extranonce(struct pool *pool);